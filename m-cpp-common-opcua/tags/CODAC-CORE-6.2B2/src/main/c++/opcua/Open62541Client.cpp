@@ -41,13 +41,13 @@
 //#undef LOG_DEBUG_ENABLE
 #include <log-api.h> // Syslog wrapper routines
 
-#include <lu-table.h> // Look-up table class definition, etc.
-
 #include <AnyObject.h> // Abstract base class definition ..
 #include <ObjectDatabase.h> // .. associated object database
 
 #include <any-thread.h> // Thread management class
 
+#include <VariableCache.h> // Variable cache shared with the application
+
 #include <AnyValue.h> // Variable with introspectable data type ..
 #include <AnyValueHelper.h> // .. associated helper routines
 
@@ -114,20 +114,14 @@ public:
 
     UA_Client *client;
 
-//    ccs::types::CompoundType *m_type; // Introspectable type definition for the variable cache ..
-//    ccs::types::AnyValue *m_value; // Introspectable variable mapped to the whole cache ..
+    VariableCache *m_cache; // Variable cache shared with the application
 
     bool m_initialized;
 
     typedef struct VariableInfo {
 
-        bool update;
-        ccs::types::DirIdentifier direction;
-
-        std::function<void(const ccs::types::char8* const,
-                           const ccs::types::AnyValue&)> cb;
-
         ccs::types::string name;
+        VariableCache::Handle_t handle;
 
 #if 0
 		chid channel;
@@ -135,14 +129,11 @@ public:
 #endif
         ccs::types::uint32 mult;
 
-        void *reference; // Reference in the cache
-
-        std::shared_ptr<const ccs::types::AnyType> __type; // Introspectable type definition for the variable cache ..
-        ccs::types::AnyValue *value;
+        void *reference; // Reference in the extension object body
 
     } VariableInfo_t;
 
-    LUTable<VariableInfo_t> *m_var_table;
+    std::vector<VariableInfo_t> m_var_table; // Indexed by variable cache handle
 
     const ccs::types::char8 **extObj;
 
@@ -188,6 +179,16 @@ public:
     ccs::types::AnyValue* GetVariable(ccs::types::uint32 id) const;
     ccs::types::AnyValue* GetVariable(const ccs::types::char8 *const name) const;
 
+    bool GetVariable(ccs::types::uint32 id,
+                     void *const buffer,
+                     const ccs::types::uint32 size) const;
+
+    bool SetVariable(ccs::types::uint32 id,
+                     const void *const buffer,
+                     const ccs::types::uint32 size);
+
+    void NotifyVariables(void);
+
     bool UpdateVariable(ccs::types::uint32 id);
     bool UpdateVariable(const ccs::types::char8 *const name);
 
@@ -291,6 +292,9 @@ void dataChange(UA_Client *client,
                 UA_ExtensionObject_delete(eos);
             }
         }
+        if (ok) {
+            ccs::base::objPtr->NotifyVariables(); // Copy from extension object body to cache
+        }
     }
 
     return;
@@ -306,9 +310,6 @@ void OPCUAInterface_Thread_PRBL(ccs::base::Open62541ClientImpl *self) {
     self->dataPtr = malloc(self->bodyLength);
     self->tempDataPtr = reinterpret_cast<ccs::types::uint8*>(self->dataPtr);
 
-    // Create variable cache
-//    self->m_value = new (std::nothrow) ccs::types::AnyValue(self->m_type);
-
     // Create subscription
     UA_CreateSubscriptionRequest subRequest = UA_CreateSubscriptionRequest_default();
     UA_CreateSubscriptionResponse subResponse = UA_Client_Subscriptions_create(self->client, subRequest, NULL, NULL, NULL);
@@ -326,7 +327,7 @@ void OPCUAInterface_Thread_PRBL(ccs::base::Open62541ClientImpl *self) {
     ccs::types::uint32 arraySize = 20u;
     for (ccs::types::uint32 j = 0u; j < arraySize; j++) { //SCU arraySize
         index = 0u;
-        ccs::types::uint32 numberOfNodesForEachIteration = ((self->m_var_table)->GetSize() / arraySize) * (j + 1u);
+        ccs::types::uint32 numberOfNodesForEachIteration = (static_cast<ccs::types::uint32>(self->m_var_table.size()) / arraySize) * (j + 1u);
         while (nodeCounter < numberOfNodesForEachIteration) {
             if (status) {
                 status = self->GetExtensionObjectByteString(self->entryTypes, self->entryArrayElements, self->entryNumberOfMembers, self->entryArraySize,
@@ -339,25 +340,6 @@ void OPCUAInterface_Thread_PRBL(ccs::base::Open62541ClientImpl *self) {
 
     ccs::types::string name;
 
-    for (ccs::types::uint32 index = 0; index < (self->m_var_table)->GetSize(); index += 1u) {
-
-        ccs::base::Open62541ClientImpl::VariableInfo_t varInfo;
-
-        if ((self->m_var_table)->GetValue(varInfo, index) != STATUS_SUCCESS) {
-            log_warning("%s - LUTable<>::GetValue failed", __FUNCTION__);
-            continue;
-        }
-
-        // Store cache reference
-
-        //varInfo.reference = ccs::HelperTools::GetAttributeReference(self->m_value, name);
-
-        varInfo.value = new (std::nothrow) ccs::types::AnyValue(varInfo.__type, varInfo.reference);
-
-        (self->m_var_table)->SetValue(varInfo, index); //Store for future use
-
-    }
-
     strcpy(name, self->eoNodeId);
 
     ccs::types::uint32 ns;
@@ -413,31 +395,30 @@ void OPCUAInterface_Thread_CB(ccs::base::Open62541ClientImpl *self) {
     log_trace("Entering '%s' routine", __FUNCTION__);
 
     bool ok = self->m_initialized;
+    bool update = false;
 
-    for (ccs::types::uint32 index = 0u; (ok && (index < (self->m_var_table)->GetSize())); index += 1u) {
+    ccs::base::VariableCache::Handle_t handle = VARIABLECACHE_INVALID_HANDLE;
 
-        ccs::base::Open62541ClientImpl::VariableInfo_t varInfo;
+    // Variables queued for update by the application, at most once per cycle each
+    for (ccs::types::uint32 count = 0u; (ok && (count < self->m_var_table.size()) && self->m_cache->PopUpdate(handle)); count += 1u) {
 
-        if ((self->m_var_table)->GetValue(varInfo, index) != STATUS_SUCCESS) {
-            log_warning("%s - LUTable<>::GetValue failed", __FUNCTION__);
-            continue;
-        }
+        ccs::base::Open62541ClientImpl::VariableInfo_t *varInfo = &(self->m_var_table[handle]);
 
-        if ((varInfo.direction == ccs::types::InputVariable) || (varInfo.update != true)) {
+        if ((self->m_cache->GetDirection(handle) == ccs::types::InputVariable) || (NULL == varInfo->reference)) {
             continue; // Nothing to do for this channel
         }
 
-//        memcpy(varInfo.reference, ccs::HelperTools::GetAttributeReference(self->m_value, name), varInfo.__type->GetSize());
-//        log_info("VAL: %d", *reinterpret_cast<ccs::types::uint8*>(varInfo.reference));
-//        (self->m_var_table)->SetValue(varInfo, index);
+        // Consistent copy from cache to extension object body
+        if (self->m_cache->GetValue(handle, varInfo->reference, self->m_cache->GetType(handle)->GetSize())) {
+            update = true;
+        }
+        else {
+            log_warning("%s - VariableCache::GetValue failed", __FUNCTION__);
+        }
 
     }
 
-    ccs::base::Open62541ClientImpl::VariableInfo_t var;
-    if ((self->m_var_table)->GetValue(var, 1) != STATUS_SUCCESS) {
-        log_warning("%s - LUTable<>::GetValue failed", __FUNCTION__);
-    }
-    if (var.update == true) {
+    if (update == true) {
 
         ccs::types::string name;
         ccs::types::string methodName;
@@ -569,18 +550,6 @@ void OPCUAInterface_Thread_CB(ccs::base::Open62541ClientImpl *self) {
 
     }
 
-    for (ccs::types::uint32 index = 0u; (ok && (index < (self->m_var_table)->GetSize())); index += 1u) {
-        ccs::base::Open62541ClientImpl::VariableInfo_t varInfo;
-
-        if ((self->m_var_table)->GetValue(varInfo, index) != STATUS_SUCCESS) {
-            log_warning("%s - LUTable<>::GetValue failed", __FUNCTION__);
-            continue;
-        }
-
-        varInfo.update = false;
-        (self->m_var_table)->SetValue(varInfo, index);
-    }
-
     UA_Client_run_iterate(self->client, 1000);
 
     log_trace("Leaving '%s' routine", __FUNCTION__);
@@ -619,9 +588,7 @@ bool Open62541ClientImpl::AddVariable(const ccs::types::char8 *const name,
     bool status = true;
     VariableInfo_t varInfo;
 
-    varInfo.cb = NULL;
-    varInfo.update = false;
-    varInfo.direction = direction;
+    varInfo.reference = NULL;
     ccs::HelperTools::SafeStringCopy(varInfo.name, name, sizeof(ccs::types::string));
 
     status = (ccs::HelperTools::Is < ccs::types::ScalarType > (type)
@@ -631,26 +598,38 @@ bool Open62541ClientImpl::AddVariable(const ccs::types::char8 *const name,
     if (status) {
         varInfo.mult = (
                 ccs::HelperTools::Is < ccs::types::ScalarType > (type) ? 1 : std::dynamic_pointer_cast<const ccs::types::ArrayType>(type)->GetElementNumber());
-        varInfo.__type = type;
     }
 
-//    if (status) {
-//        status = ((static_cast<ccs::types::CompoundType*>(NULL) != this->m_type) && (static_cast<LUTable<VariableInfo_t>*>(NULL) != this->m_var_table));
-//    }
-//
-//    if (status) {
-//        status = (this->m_type)->AddAttribute(name, varInfo.__type); // Type definition for the variable cache
-//
-//    }
+    if (status) { // Handles are allocated in sequence
+        status = ((static_cast<VariableCache*>(NULL) != this->m_cache) && (index == (this->m_cache)->GetSize()));
+    }
 
     if (status) {
-        status = (this->m_var_table)->AddPair(name, varInfo, index);
+        status = (this->m_cache)->AddVariable(name, direction, type);
+    }
+
+    if (status) {
+        varInfo.handle = (this->m_cache)->GetHandle(name);
+        (this->m_var_table).push_back(varInfo); // Indexed by handle
     }
 
     return status;
 
 }
 
+void Open62541ClientImpl::NotifyVariables(void) {
+
+    for (std::vector<VariableInfo_t>::iterator it = (this->m_var_table).begin(); it != (this->m_var_table).end(); ++it) {
+        if ((NULL == it->reference) || ((this->m_cache)->GetDirection(it->handle) == ccs::types::OutputVariable)) {
+            continue; // Output variables are only updated by the application
+        }
+        (void) (this->m_cache)->NotifyValue(it->handle, it->reference, (this->m_cache)->GetType(it->handle)->GetSize());
+    }
+
+    return;
+
+}
+
 bool Open62541Client::SetNumberOfNodes(const ccs::types::uint32 dim) {
 
     return __impl->SetNumberOfNodes(dim);
@@ -702,12 +681,9 @@ bool Open62541ClientImpl::Initialise(void) {
 
     // Initialize resources
     this->m_sleep = DEFAULT_OPCUAINTERFACE_THREAD_PERIOD;
-    this->m_var_table = new LUTable<VariableInfo_t>(MAXIMUM_VARIABLE_NUM); // The table will be filled with application-specific variable list
+    this->m_cache = new (std::nothrow) VariableCache(MAXIMUM_VARIABLE_NUM); // The cache will be filled with application-specific variable list
     this->m_initialized = false;
 
-//    this->m_type = new (std::nothrow) ccs::types::CompoundType("uaif::VariableCache_t");
-//    this->m_value = static_cast<ccs::types::AnyValue*>(NULL);
-
     log_info("Open62541ClientImpl::Initialise - Creating OPCUA Client and Initialising configuration");
 
     //open62541 Client configuration
@@ -790,16 +766,14 @@ bool Open62541Client::IsValid(const ccs::types::char8 *const name) const {
 }
 
 bool Open62541ClientImpl::IsValid(uint_t id) const {
-    return ((this->m_var_table)->IsValid(id) == STATUS_SUCCESS);
+    return (this->m_cache)->IsValid(id);
 }
 bool Open62541ClientImpl::IsValid(const ccs::types::char8 *const name) const {
-    return ((this->m_var_table)->IsValid(name) == STATUS_SUCCESS);
+    return (this->m_cache)->IsValid(name);
 }
 
 uint_t Open62541ClientImpl::GetVariableId(const ccs::types::char8 *const name) const {
-    uint_t id = 0;
-    (this->m_var_table)->GetIndex(name, id);
-    return id;
+    return (this->m_cache)->GetHandle(name);
 }
 
 ccs::types::AnyValue* Open62541Client::GetVariable(const ccs::types::char8 *const name) const {
@@ -807,31 +781,48 @@ ccs::types::AnyValue* Open62541Client::GetVariable(const ccs::types::char8 *cons
 }
 
 ccs::types::AnyValue* Open62541ClientImpl::GetVariable(uint_t id) const {
-    VariableInfo_t varInfo;
-    varInfo.value = static_cast<ccs::types::AnyValue*>(NULL);
-    if (this->IsValid(id))
-        if ((this->m_var_table)->GetValue(varInfo, id))
-            return varInfo.value;
+    return (this->m_cache)->GetSnapshot(id);
 }
 ccs::types::AnyValue* Open62541ClientImpl::GetVariable(const ccs::types::char8 *const name) const {
     return this->GetVariable(this->GetVariableId(name));
 }
 
-bool Open62541Client::UpdateVariable(const ccs::types::char8 *const name) {
-    return __impl->UpdateVariable(name);
+bool Open62541Client::GetVariable(const ccs::types::char8 *const name,
+                                  void *const buffer,
+                                  const ccs::types::uint32 size) const {
+    return __impl->GetVariable(__impl->GetVariableId(name), buffer, size);
 }
 
-bool Open62541ClientImpl::UpdateVariable(uint_t id) {
-    bool status = this->IsValid(id);
+bool Open62541ClientImpl::GetVariable(uint_t id,
+                                      void *const buffer,
+                                      const ccs::types::uint32 size) const {
+    return (this->m_cache)->GetValue(id, buffer, size);
+}
+
+bool Open62541Client::SetVariable(const ccs::types::char8 *const name,
+                                  const void *const buffer,
+                                  const ccs::types::uint32 size) {
+    return __impl->SetVariable(__impl->GetVariableId(name), buffer, size);
+}
+
+bool Open62541ClientImpl::SetVariable(uint_t id,
+                                      const void *const buffer,
+                                      const ccs::types::uint32 size) {
+    bool status = (this->m_cache)->SetValue(id, buffer, size);
     if (status) {
-        VariableInfo_t varInfo;
-        (this->m_var_table)->GetValue(varInfo, id);
-        varInfo.update = true;
-        (this->m_var_table)->SetValue(varInfo, id);
+        status = this->UpdateVariable(id);
     }
     return status;
 }
 
+bool Open62541Client::UpdateVariable(const ccs::types::char8 *const name) {
+    return __impl->UpdateVariable(name);
+}
+
+bool Open62541ClientImpl::UpdateVariable(uint_t id) {
+    return ((this->m_cache)->CommitSnapshot(id) && (this->m_cache)->PushUpdate(id));
+}
+
 bool Open62541ClientImpl::UpdateVariable(const ccs::types::char8 *const name) {
     return this->UpdateVariable(this->GetVariableId(name));
 }
@@ -845,14 +836,7 @@ bool Open62541Client::SetCallback(const ccs::types::char8 *const name,
 bool Open62541ClientImpl::SetCallback(ccs::types::uint32 id,
                                       const std::function<void(const ccs::types::char8* const,
                                                                const ccs::types::AnyValue&)> &cb) {
-    VariableInfo_t varInfo;
-    bool status = this->IsValid(id);
-    if (status) {
-        (this->m_var_table)->GetValue(varInfo, id);
-        varInfo.cb = cb;
-        (this->m_var_table)->SetValue(varInfo, id);
-    }
-    return status;
+    return (this->m_cache)->SetCallback(id, cb);
 }
 bool Open62541ClientImpl::SetCallback(const ccs::types::char8 *const name,
                                       const std::function<void(const ccs::types::char8* const,
@@ -879,20 +863,9 @@ bool Open62541ClientImpl::GetExtensionObjectByteString(const ccs::types::uint32
         if (entryArrayElements[index] == 1u) {
             ccs::types::uint32 nOfBytes = sizeof(ccs::types::uint8);
 
-            ccs::types::string name;
-
-            if (m_var_table->GetKeyword(name, nodeCounter) != STATUS_SUCCESS) {
-                log_warning("%s - LUTable<>::GetKeyword failed", __FUNCTION__);
+            if (nodeCounter < m_var_table.size()) {
+                m_var_table[nodeCounter].reference = reinterpret_cast<void*>(tempDataPtr);
             }
-
-            ccs::base::Open62541ClientImpl::VariableInfo_t varInfo;
-
-            if (m_var_table->GetValue(varInfo, nodeCounter) != STATUS_SUCCESS) {
-                log_warning("%s - LUTable<>::GetValue failed", __FUNCTION__);
-            }
-
-            varInfo.reference = reinterpret_cast<void*>(tempDataPtr);
-            m_var_table->SetValue(varInfo, nodeCounter);
             tempDataPtr = &(tempDataPtr[nOfBytes]);
         }
         else {
@@ -903,20 +876,10 @@ bool Open62541ClientImpl::GetExtensionObjectByteString(const ccs::types::uint32
                 ccs::types::uint32 nOfBytes = sizeof(ccs::types::uint8);
                 nOfBytes *= entryArrayElements[index];
 
-                ccs::types::string name;
-
-                if (m_var_table->GetKeyword(name, nodeCounter) != STATUS_SUCCESS) {
-                    log_warning("%s - LUTable<>::GetKeyword failed", __FUNCTION__);
+                if (nodeCounter < m_var_table.size()) {
+                    m_var_table[nodeCounter].reference = reinterpret_cast<void*>(tempDataPtr);
                 }
 
-                ccs::base::Open62541ClientImpl::VariableInfo_t varInfo;
-
-                if (m_var_table->GetValue(varInfo, nodeCounter) != STATUS_SUCCESS) {
-                    log_warning("%s - LUTable<>::GetValue failed", __FUNCTION__);
-                }
-                varInfo.reference = reinterpret_cast<void*>(tempDataPtr);
-                m_var_table->SetValue(varInfo, nodeCounter);
-
                 tempDataPtr = &(tempDataPtr[nOfBytes]);
             }
         }
@@ -1051,11 +1014,12 @@ Open62541ClientImpl::~Open62541ClientImpl(void) {
     // Release resources
     if (this->m_thread != NULL)
         delete this->m_thread;
-    if (this->m_var_table != NULL)
-        delete this->m_var_table;
 
     (void) this->Disconnect();
 
+    if (this->m_cache != NULL)
+        delete this->m_cache;
+
     // Remove instance from object database
     (void) ccs::base::GlobalObjectDatabase::Remove(
     DEFAULT_OPCUAINTERFACE_INSTANCE_NAME);
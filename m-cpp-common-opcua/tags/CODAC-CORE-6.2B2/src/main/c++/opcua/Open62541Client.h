@@ -57,8 +57,11 @@ class Open62541ClientImpl;
  * @brief Interface class providing support for CA client with variable cache.
  * @detail The class provides access to a variable cache and asynchronous CA
  * update to ensure non-blocking calls on the application side. The variable
- * cache is implemented by means of ccs::types::AnyValue instances which allow
- * assignment to/from C-like structures.
+ * cache is implemented by means of ccs::base::VariableCache which holds each
+ * variable in a sequence-locked slot, i.e. the GetVariable and SetVariable
+ * methods copy consistent values to/from C-like structures without blocking
+ * the interface thread. Updated variables are queued for the interface thread
+ * and copied to the extension object body before the method call.
  *
  * The class also offers a callback mechanism for input or bi-directional
  * variables to allow for application-specific synchronous handling of OPC UA
@@ -114,6 +117,33 @@ public:
     template<typename Type> bool SetVariable(const ccs::types::char8 *const name,
                                              Type &value);
 
+    /**
+     * @brief Accessor. GetVariable method.
+     * @detail Consistent copy of the variable held in the cache.
+     * @param name Variable identifier.
+     * @param buffer Placeholder of size equal to that of the variable type.
+     * @param size Placeholder size.
+     * @return True if successful.
+     */
+
+    bool GetVariable(const ccs::types::char8 *const name,
+                     void *const buffer,
+                     const ccs::types::uint32 size) const;
+
+    /**
+     * @brief Accessor. SetVariable method.
+     * @detail Writes the variable held in the cache and queues the variable for
+     * update by the interface thread.
+     * @param name Variable identifier.
+     * @param buffer Value of size equal to that of the variable type.
+     * @param size Value size.
+     * @return True if successful.
+     */
+
+    bool SetVariable(const ccs::types::char8 *const name,
+                     const void *const buffer,
+                     const ccs::types::uint32 size);
+
     bool UpdateVariable(const ccs::types::char8 *const name);
 
     bool SetBodyLength(const ccs::types::uint32 length);
@@ -157,35 +187,12 @@ public:
 
 template<typename Type> bool Open62541Client::GetVariable(const ccs::types::char8 *const name,
                                                           Type &value) const {
-
-    const ccs::types::AnyValue *var = static_cast<ccs::types::AnyValue*>(NULL);
-
-    bool status = this->IsValid(name);
-
-    if (status) {
-        var = this->GetVariable(name);
-        value = static_cast<Type>(*var);
-    }
-
-    return status;
-
+    return this->GetVariable(name, static_cast<void*>(&value), sizeof(Type));
 }
 
 template<typename Type> bool Open62541Client::SetVariable(const ccs::types::char8 *const name,
                                                           Type &value) {
-
-    ccs::types::AnyValue *var = static_cast<ccs::types::AnyValue*>(NULL);
-
-    bool status = this->IsValid(name);
-
-    if (status) {
-        var = this->GetVariable(name);
-        *var = value;
-        this->UpdateVariable(name);
-    }
-
-    return status;
-
+    return this->SetVariable(name, static_cast<const void*>(&value), sizeof(Type));
 }
 
 } // namespace base
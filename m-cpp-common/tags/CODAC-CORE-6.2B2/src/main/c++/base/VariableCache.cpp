@@ -0,0 +1,603 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/base/VariableCache.cpp $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Variable cache class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <new> // std::nothrow, etc.
+#include <string.h> // memcpy, etc.
+
+// Local header files
+
+#include "BasicTypes.h" // Global type definition
+#include "SysTools.h" // Misc. helper functions, e.g. hash, etc.
+
+//#define LOG_DEBUG_ENABLE
+//#undef LOG_DEBUG_ENABLE
+#include "log-api.h" // Syslog wrapper routines (ccs::log)
+
+#include "AnyType.h"
+#include "AnyValue.h"
+
+#include "VariableCache.h" // This class definition
+
+// Constants
+
+#undef LOG_ALTERN_SRC
+#define LOG_ALTERN_SRC "ccs::base"
+
+// Type definition
+
+// Global variables
+
+// Function declaration
+
+// Function definition
+
+namespace ccs {
+
+namespace base {
+
+bool VariableCache::Read (const Slot_t& slot, void* buffer) const
+{
+
+  bool status = (static_cast<ccs::types::AnyValue*>(NULL) != slot.value);
+
+  bool done = !status;
+
+  while (!done)
+    {
+      ccs::types::uint32 seq = slot.sequence;
+      __sync_synchronize();
+
+      if (0u == (seq & 1u)) // No write in progress
+	{
+	  (void)memcpy(buffer, (slot.value)->GetInstance(), (slot.value)->GetSize());
+	  __sync_synchronize();
+	  done = (seq == slot.sequence);
+
+	  if (!done) // Copy invalidated by concurrent write
+	    {
+	      (void)__sync_fetch_and_add(const_cast<volatile ccs::types::uint64*>(&slot.retries), 1ul);
+	    }
+	}
+    }
+
+  if (status)
+    {
+      (void)__sync_fetch_and_add(const_cast<volatile ccs::types::uint64*>(&slot.reads), 1ul);
+    }
+
+  return status;
+
+}
+
+bool VariableCache::Write (Slot_t& slot, const void* buffer)
+{
+
+  bool status = (static_cast<ccs::types::AnyValue*>(NULL) != slot.value);
+
+  if (status)
+    {
+      // Exclude concurrent writers, sequence number odd till completion
+      ccs::types::uint32 seq = slot.sequence;
+
+      while ((0u != (seq & 1u)) || !__sync_bool_compare_and_swap(&slot.sequence, seq, seq + 1u))
+	{
+	  seq = slot.sequence;
+	}
+
+      (void)memcpy((slot.value)->GetInstance(), buffer, (slot.value)->GetSize());
+      __sync_synchronize();
+
+      slot.sequence = seq + 2u;
+      (void)__sync_fetch_and_add(&slot.writes, 1ul);
+    }
+
+  return status;
+
+}
+
+bool VariableCache::Push (Handle_t handle)
+{
+
+  // Bounded queue with per-cell sequence number, the cell is free when its sequence equals the tail
+  ccs::types::uint32 pos = __tail;
+  Cell_t* cell = static_cast<Cell_t*>(NULL);
+
+  bool status = false;
+  bool done = false;
+
+  while (!done)
+    {
+      cell = __queue + (pos & __mask);
+
+      ccs::types::int32 diff = static_cast<ccs::types::int32>(cell->sequence - pos);
+
+      if (0 == diff)
+	{
+	  done = status = __sync_bool_compare_and_swap(&__tail, pos, pos + 1u);
+	}
+      else
+	{
+	  done = (0 > diff); // Full, may not happen since variables are queued at most once
+	}
+
+      if (!done)
+	{
+	  pos = __tail;
+	}
+    }
+
+  if (status)
+    {
+      cell->handle = handle;
+      __sync_synchronize();
+      cell->sequence = pos + 1u;
+    }
+
+  return status;
+
+}
+
+bool VariableCache::PopUpdate (Handle_t& handle)
+{
+
+  ccs::types::uint32 pos = __head;
+  Cell_t* cell = static_cast<Cell_t*>(NULL);
+
+  bool status = false;
+  bool done = false;
+
+  while (!done)
+    {
+      cell = __queue + (pos & __mask);
+
+      ccs::types::int32 diff = static_cast<ccs::types::int32>(cell->sequence - (pos + 1u));
+
+      if (0 == diff)
+	{
+	  done = status = __sync_bool_compare_and_swap(&__head, pos, pos + 1u);
+	}
+      else
+	{
+	  done = (0 > diff); // Empty
+	}
+
+      if (!done)
+	{
+	  pos = __head;
+	}
+    }
+
+  if (status)
+    {
+      handle = cell->handle;
+      __sync_synchronize();
+      cell->sequence = pos + __mask + 1u;
+
+      // Allow the variable to be queued again
+      __slots[handle].dirty = false;
+      __sync_synchronize();
+    }
+
+  return status;
+
+}
+
+bool VariableCache::PushUpdate (Handle_t handle)
+{
+
+  bool status = this->IsValid(handle);
+
+  if (status)
+    {
+      if (false == __sync_lock_test_and_set(&(__slots[handle].dirty), true))
+	{
+	  status = this->Push(handle);
+	  (void)__sync_fetch_and_add(&(__slots[handle].updates), 1ul);
+
+	  if (!status)
+	    {
+	      __slots[handle].dirty = false;
+	    }
+	}
+      else
+	{
+	  (void)__sync_fetch_and_add(&(__slots[handle].coalesced), 1ul);
+	}
+    }
+
+  return status;
+
+}
+
+bool VariableCache::AddVariable (const char* name, ccs::types::DirIdentifier direction, const std::shared_ptr<const ccs::types::AnyType>& type)
+{
+
+  bool status = ((static_cast<Slot_t*>(NULL) != __slots) && (__size < __capacity));
+
+  if (status)
+    {
+      status = ((static_cast<const char*>(NULL) != name) && !__table.IsValid(name));
+    }
+
+  ccs::types::AnyValue* value = static_cast<ccs::types::AnyValue*>(NULL);
+  ccs::types::AnyValue* snapshot = static_cast<ccs::types::AnyValue*>(NULL);
+
+  if (status && type)
+    {
+      value = new (std::nothrow) ccs::types::AnyValue (type);
+      snapshot = new (std::nothrow) ccs::types::AnyValue (type);
+      status = ((static_cast<ccs::types::AnyValue*>(NULL) != value) && (static_cast<ccs::types::AnyValue*>(NULL) != snapshot));
+    }
+
+  if (status)
+    {
+      status = __table.Register(name, __size);
+    }
+
+  if (status)
+    {
+      Slot_t& slot = __slots[__size];
+
+      ccs::HelperTools::SafeStringCopy(slot.name, name, ccs::types::MaxStringLength);
+      slot.direction = direction;
+      slot.value = value;
+      slot.snapshot = snapshot;
+      __sync_synchronize();
+      __size += 1u;
+    }
+  else
+    {
+      if (static_cast<ccs::types::AnyValue*>(NULL) != value)
+	{
+	  delete value;
+	}
+
+      if (static_cast<ccs::types::AnyValue*>(NULL) != snapshot)
+	{
+	  delete snapshot;
+	}
+    }
+
+  return status;
+
+}
+
+ccs::types::uint32 VariableCache::GetSize (void) const { return __size; }
+
+bool VariableCache::IsValid (Handle_t handle) const { return (handle < __size); }
+bool VariableCache::IsValid (const char* name) const { return __table.IsValid(name); }
+
+VariableCache::Handle_t VariableCache::GetHandle (const char* name) const
+{
+
+  Handle_t handle = VARIABLECACHE_INVALID_HANDLE;
+
+  if (!__table.GetElement(name, handle))
+    {
+      handle = VARIABLECACHE_INVALID_HANDLE;
+    }
+
+  return handle;
+
+}
+
+const char* VariableCache::GetName (Handle_t handle) const { return (this->IsValid(handle) ? __slots[handle].name : static_cast<const char*>(NULL)); }
+
+ccs::types::DirIdentifier VariableCache::GetDirection (Handle_t handle) const { return (this->IsValid(handle) ? __slots[handle].direction : ccs::types::AnyputVariable); }
+
+std::shared_ptr<const ccs::types::AnyType> VariableCache::GetType (Handle_t handle) const
+{
+
+  std::shared_ptr<const ccs::types::AnyType> type;
+
+  ccs::types::AnyValue* value = this->GetSlotValue(handle);
+
+  if (static_cast<ccs::types::AnyValue*>(NULL) != value)
+    {
+      type = value->GetType();
+    }
+
+  return type;
+
+}
+
+bool VariableCache::SetType (Handle_t handle, const std::shared_ptr<const ccs::types::AnyType>& type)
+{
+
+  bool status = (this->IsValid(handle) && type && (static_cast<ccs::types::AnyValue*>(NULL) == __slots[handle].value));
+
+  ccs::types::AnyValue* value = static_cast<ccs::types::AnyValue*>(NULL);
+  ccs::types::AnyValue* snapshot = static_cast<ccs::types::AnyValue*>(NULL);
+
+  if (status)
+    {
+      value = new (std::nothrow) ccs::types::AnyValue (type);
+      snapshot = new (std::nothrow) ccs::types::AnyValue (type);
+      status = ((static_cast<ccs::types::AnyValue*>(NULL) != value) && (static_cast<ccs::types::AnyValue*>(NULL) != snapshot));
+    }
+
+  if (status)
+    {
+      // The snapshot is claimed first so as to be available once the value is published
+      status = __sync_bool_compare_and_swap(&(__slots[handle].snapshot), static_cast<ccs::types::AnyValue*>(NULL), snapshot);
+    }
+
+  if (status)
+    {
+      __sync_synchronize(); // Instance complete before being published
+      status = __sync_bool_compare_and_swap(&(__slots[handle].value), static_cast<ccs::types::AnyValue*>(NULL), value);
+    }
+
+  if (!status && (static_cast<ccs::types::AnyValue*>(NULL) != value))
+    {
+      delete value;
+    }
+
+  if (!status && (static_cast<ccs::types::AnyValue*>(NULL) != snapshot) && (snapshot != __slots[handle].snapshot))
+    {
+      delete snapshot;
+    }
+
+  return status;
+
+}
+
+ccs::types::AnyValue* VariableCache::GetSlotValue (Handle_t handle) const { return (this->IsValid(handle) ? __slots[handle].value : static_cast<ccs::types::AnyValue*>(NULL)); }
+
+bool VariableCache::GetValue (Handle_t handle, void* buffer, ccs::types::uint32 size) const
+{
+
+  ccs::types::AnyValue* value = this->GetSlotValue(handle);
+
+  bool status = ((static_cast<ccs::types::AnyValue*>(NULL) != value) && (static_cast<void*>(NULL) != buffer) && (value->GetSize() == size));
+
+  if (status)
+    {
+      status = this->Read(__slots[handle], buffer);
+    }
+
+  return status;
+
+}
+
+bool VariableCache::GetValue (Handle_t handle, ccs::types::AnyValue& value) const { return this->GetValue(handle, value.GetInstance(), value.GetSize()); }
+
+bool VariableCache::SetValue (Handle_t handle, const void* buffer, ccs::types::uint32 size)
+{
+
+  ccs::types::AnyValue* value = this->GetSlotValue(handle);
+
+  bool status = ((static_cast<ccs::types::AnyValue*>(NULL) != value) && (static_cast<const void*>(NULL) != buffer) && (value->GetSize() == size));
+
+  if (status)
+    {
+      __slots[handle].lent = false; // Supersedes the snapshot not yet committed, if any
+      status = this->Write(__slots[handle], buffer);
+    }
+
+  return status;
+
+}
+
+bool VariableCache::SetValue (Handle_t handle, const ccs::types::AnyValue& value) { return this->SetValue(handle, value.GetInstance(), value.GetSize()); }
+
+ccs::types::AnyValue* VariableCache::GetSnapshot (Handle_t handle) const
+{
+
+  ccs::types::AnyValue* snapshot = static_cast<ccs::types::AnyValue*>(NULL);
+
+  bool status = (static_cast<ccs::types::AnyValue*>(NULL) != this->GetSlotValue(handle));
+
+  if (status)
+    {
+      snapshot = __slots[handle].snapshot;
+      status = ((static_cast<ccs::types::AnyValue*>(NULL) != snapshot) && this->Read(__slots[handle], snapshot->GetInstance()));
+    }
+
+  if (status)
+    {
+      __slots[handle].lent = true;
+    }
+  else
+    {
+      snapshot = static_cast<ccs::types::AnyValue*>(NULL);
+    }
+
+  return snapshot;
+
+}
+
+bool VariableCache::CommitSnapshot (Handle_t handle)
+{
+
+  bool status = this->IsValid(handle);
+
+  if (status && __sync_lock_test_and_set(&(__slots[handle].lent), false))
+    {
+      status = this->Write(__slots[handle], (__slots[handle].snapshot)->GetInstance());
+    }
+
+  return status;
+
+}
+
+bool VariableCache::NotifyValue (Handle_t handle, const void* buffer, ccs::types::uint32 size)
+{
+
+  ccs::types::AnyValue* value = this->GetSlotValue(handle);
+
+  bool status = ((static_cast<ccs::types::AnyValue*>(NULL) != value) && (static_cast<const void*>(NULL) != buffer) && (value->GetSize() == size));
+
+  if (status)
+    {
+      status = this->Write(__slots[handle], buffer);
+    }
+
+  if (status && (NULL != __slots[handle].cb))
+    {
+      log_debug("VariableCache::NotifyValue - Invoke callback for '%s'", __slots[handle].name);
+      __slots[handle].cb(__slots[handle].name, *(__slots[handle].value));
+      (void)__sync_fetch_and_add(&(__slots[handle].notifications), 1ul);
+    }
+
+  return status;
+
+}
+
+bool VariableCache::NotifyValue (Handle_t handle, const ccs::types::AnyValue& value) { return this->NotifyValue(handle, value.GetInstance(), value.GetSize()); }
+
+bool VariableCache::SetCallback (Handle_t handle, const Callback_t& cb)
+{
+
+  bool status = this->IsValid(handle);
+
+  if (status)
+    {
+      __slots[handle].cb = cb;
+    }
+
+  return status;
+
+}
+
+VariableCache::Statistics_t VariableCache::GetStatistics (void) const
+{
+
+  Statistics_t stats;
+
+  stats.reads = 0ul;
+  stats.retries = 0ul;
+  stats.writes = 0ul;
+  stats.updates = 0ul;
+  stats.coalesced = 0ul;
+  stats.notifications = 0ul;
+
+  for (Handle_t handle = 0u; handle < __size; handle += 1u)
+    {
+      stats.reads += __slots[handle].reads;
+      stats.retries += __slots[handle].retries;
+      stats.writes += __slots[handle].writes;
+      stats.updates += __slots[handle].updates;
+      stats.coalesced += __slots[handle].coalesced;
+      stats.notifications += __slots[handle].notifications;
+    }
+
+  return stats;
+
+}
+
+VariableCache::VariableCache (ccs::types::uint32 capacity)
+{
+
+  // Initialise attributes
+  __capacity = capacity;
+  __size = 0u;
+
+  __head = 0u;
+  __tail = 0u;
+
+  // Queue size as power of 2 to allow for wrap-around with a mask
+  ccs::types::uint32 length = 1u;
+
+  while (length < capacity)
+    {
+      length <<= 1;
+    }
+
+  __mask = length - 1u;
+
+  __slots = new (std::nothrow) Slot_t [capacity];
+  __queue = new (std::nothrow) Cell_t [length];
+
+  for (Handle_t handle = 0u; ((static_cast<Slot_t*>(NULL) != __slots) && (handle < capacity)); handle += 1u)
+    {
+      __slots[handle].name[0] = 0;
+      __slots[handle].direction = ccs::types::AnyputVariable;
+      __slots[handle].value = static_cast<ccs::types::AnyValue*>(NULL);
+      __slots[handle].snapshot = static_cast<ccs::types::AnyValue*>(NULL);
+      __slots[handle].cb = NULL;
+      __slots[handle].sequence = 0u;
+      __slots[handle].dirty = false;
+      __slots[handle].lent = false;
+      __slots[handle].reads = 0ul;
+      __slots[handle].retries = 0ul;
+      __slots[handle].writes = 0ul;
+      __slots[handle].updates = 0ul;
+      __slots[handle].coalesced = 0ul;
+      __slots[handle].notifications = 0ul;
+    }
+
+  for (ccs::types::uint32 index = 0u; ((static_cast<Cell_t*>(NULL) != __queue) && (index < length)); index += 1u)
+    {
+      __queue[index].sequence = index;
+      __queue[index].handle = VARIABLECACHE_INVALID_HANDLE;
+    }
+
+  if ((static_cast<Slot_t*>(NULL) == __slots) || (static_cast<Cell_t*>(NULL) == __queue))
+    {
+      log_error("VariableCache::VariableCache - Unable to allocate '%u' slots", capacity);
+      __capacity = 0u;
+    }
+
+  return;
+
+}
+
+VariableCache::~VariableCache (void)
+{
+
+  for (Handle_t handle = 0u; ((static_cast<Slot_t*>(NULL) != __slots) && (handle < __capacity)); handle += 1u)
+    {
+      if (static_cast<ccs::types::AnyValue*>(NULL) != __slots[handle].value)
+	{
+	  delete __slots[handle].value;
+	}
+
+      if (static_cast<ccs::types::AnyValue*>(NULL) != __slots[handle].snapshot)
+	{
+	  delete __slots[handle].snapshot;
+	}
+    }
+
+  if (static_cast<Slot_t*>(NULL) != __slots)
+    {
+      delete [] __slots;
+    }
+
+  if (static_cast<Cell_t*>(NULL) != __queue)
+    {
+      delete [] __queue;
+    }
+
+  __slots = static_cast<Slot_t*>(NULL);
+  __queue = static_cast<Cell_t*>(NULL);
+
+  return;
+
+}
+
+} // namespace base
+
+} // namespace ccs
+
+#undef LOG_ALTERN_SRC
@@ -0,0 +1,343 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/base/VariableCache.h $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Variable cache class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                 CS 90 046
+*                 13067 St. Paul-lez-Durance Cedex
+*                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+/**
+ * @file VariableCache.h
+ * @brief Header file for VariableCache class
+ * @date 01/07/2019
+ * @author Bertrand Bauvir (IO)
+ * @copyright 2010-2019 ITER Organization
+ * @detail This header file contains the definition of the VariableCache class.
+ */
+
+#ifndef _VariableCache_h_
+#define _VariableCache_h_
+
+// Global header files
+
+#include <functional> // std::function
+#include <memory> // std::shared_ptr
+
+// Local header files
+
+#include "BasicTypes.h"
+
+#include "AnyType.h"
+#include "AnyValue.h"
+
+#include "LookUpTable.h"
+
+// Constants
+
+#define DEFAULT_VARIABLECACHE_SIZE 256u // Variables
+#define VARIABLECACHE_INVALID_HANDLE 0xFFFFFFFFu
+
+// Type definition
+
+namespace ccs {
+
+namespace base {
+
+/**
+ * @brief The class provides a variable cache shared between an application and the
+ * asynchronous thread of a network client, e.g. ChannelAccess, pvAccess, OPC UA.
+ * @detail Variables are registered by name before use and thereafter accessed through
+ * handles, i.e. the index of the variable in the cache. Handles remain valid for the
+ * lifetime of the cache.
+ *
+ * Each variable is held in a slot protected by a sequence lock. Readers copy the value
+ * out of the slot and retry if a concurrent write has been detected; writers are mutually
+ * excluded through the sequence number and never wait for readers.
+ *
+ * Output variables updated by the application are queued for the client thread in a
+ * bounded lock-free queue. A variable is queued at most once, i.e. updates requested
+ * whilst the variable is already queued are coalesced.
+ *
+ * Input variables updated by the client thread through NotifyValue invoke the callback
+ * installed for the variable, if any.
+ *
+ * @note Variables must be registered and callbacks installed before the cache is being
+ * accessed concurrently.
+ *
+ * @note Applications relying on in-place access, e.g. attribute level access to structured
+ * variables, are provided with a snapshot of the variable through GetSnapshot. The snapshot
+ * is an instance distinct from the slot, i.e. never written by the client thread, and is
+ * written back through CommitSnapshot.
+ */
+
+class VariableCache
+{
+
+  public:
+
+    typedef ccs::types::uint32 Handle_t;
+
+    typedef std::function<void(const char*, const ccs::types::AnyValue&)> Callback_t;
+
+    typedef struct Statistics {
+
+      ccs::types::uint64 reads; // Consistent copies out of the cache ..
+      ccs::types::uint64 retries; // .. retried due to concurrent write
+      ccs::types::uint64 writes;
+      ccs::types::uint64 updates; // Update requests queued ..
+      ccs::types::uint64 coalesced; // .. or coalesced with a queued one
+      ccs::types::uint64 notifications; // Callbacks invoked
+
+    } Statistics_t;
+
+  private:
+
+    typedef struct Slot {
+
+      ccs::types::string name;
+      ccs::types::DirIdentifier direction;
+      ccs::types::AnyValue* value;
+      ccs::types::AnyValue* snapshot; // Application-side copy for in-place access
+
+      Callback_t cb;
+
+      volatile ccs::types::uint32 sequence; // Odd whilst being written
+      volatile bool dirty; // Queued for update
+      volatile bool lent; // Snapshot handed out since last commit
+
+      // Per-slot counters to avoid sharing between variables
+      volatile ccs::types::uint64 reads;
+      volatile ccs::types::uint64 retries;
+      volatile ccs::types::uint64 writes;
+      volatile ccs::types::uint64 updates;
+      volatile ccs::types::uint64 coalesced;
+      volatile ccs::types::uint64 notifications;
+
+    } Slot_t;
+
+    typedef struct Cell {
+
+      volatile ccs::types::uint32 sequence;
+      Handle_t handle;
+
+    } Cell_t;
+
+    ccs::types::uint32 __capacity;
+    ccs::types::uint32 __size;
+
+    Slot_t* __slots;
+
+    LookUpTable<Handle_t> __table; // Name resolution
+
+    // Update queue
+    ccs::types::uint32 __mask;
+    Cell_t* __queue;
+
+    volatile ccs::types::uint32 __head;
+    volatile ccs::types::uint32 __tail;
+
+    bool Push (Handle_t handle);
+
+    ccs::types::AnyValue* GetSlotValue (Handle_t handle) const;
+
+    bool Read (const Slot_t& slot, void* buffer) const;
+    bool Write (Slot_t& slot, const void* buffer);
+
+    VariableCache (const VariableCache& cache); // Undefined
+    VariableCache& operator= (const VariableCache& cache); // Undefined
+
+  protected:
+
+  public:
+
+    /**
+     * @brief Constructor.
+     * @param capacity Maximum number of variables.
+     */
+
+    explicit VariableCache (ccs::types::uint32 capacity = DEFAULT_VARIABLECACHE_SIZE);
+
+    /**
+     * @brief Destructor.
+     */
+
+    virtual ~VariableCache (void);
+
+    /**
+     * @brief AddVariable method.
+     * @detail The type may be left unspecified and provided later through SetType,
+     * e.g. if it is discovered from the remote peer upon connection.
+     * @param name Variable name.
+     * @param direction Variable direction, see ccs::types::DirIdentifier.
+     * @param type Introspectable type definition.
+     * @return True if successful.
+     */
+
+    bool AddVariable (const char* name, ccs::types::DirIdentifier direction, const std::shared_ptr<const ccs::types::AnyType>& type);
+
+    /**
+     * @brief Accessor.
+     * @return Number of registered variables.
+     */
+
+    ccs::types::uint32 GetSize (void) const;
+
+    /**
+     * @brief Accessor.
+     * @return True if the handle corresponds to a registered variable.
+     */
+
+    bool IsValid (Handle_t handle) const;
+
+    /**
+     * @brief Accessor.
+     * @return True if the variable is registered.
+     */
+
+    bool IsValid (const char* name) const;
+
+    /**
+     * @brief Accessor.
+     * @return Handle of the named variable, VARIABLECACHE_INVALID_HANDLE otherwise.
+     */
+
+    Handle_t GetHandle (const char* name) const;
+
+    /**
+     * @brief Accessor.
+     * @return Variable name, NULL if invalid handle.
+     */
+
+    const char* GetName (Handle_t handle) const;
+
+    /**
+     * @brief Accessor.
+     * @return Variable direction.
+     */
+
+    ccs::types::DirIdentifier GetDirection (Handle_t handle) const;
+
+    /**
+     * @brief Accessor.
+     * @return Variable type, empty if not (yet) typed.
+     */
+
+    std::shared_ptr<const ccs::types::AnyType> GetType (Handle_t handle) const;
+
+    /**
+     * @brief Accessor.
+     * @detail Types the variable registered without type definition.
+     * @return True if successful, false if the variable is already typed.
+     */
+
+    bool SetType (Handle_t handle, const std::shared_ptr<const ccs::types::AnyType>& type);
+
+    /**
+     * @brief Accessor.
+     * @detail Consistent copy of the variable, retried upon concurrent write.
+     * @param buffer Placeholder of size equal to that of the variable type.
+     * @return True if successful.
+     */
+
+    bool GetValue (Handle_t handle, void* buffer, ccs::types::uint32 size) const;
+    bool GetValue (Handle_t handle, ccs::types::AnyValue& value) const;
+
+    /**
+     * @brief Accessor.
+     * @detail Writes the variable, excluding concurrent writers. The snapshot provided
+     * through GetSnapshot and not yet committed, if any, is discarded.
+     * @return True if successful.
+     */
+
+    bool SetValue (Handle_t handle, const void* buffer, ccs::types::uint32 size);
+    bool SetValue (Handle_t handle, const ccs::types::AnyValue& value);
+
+    /**
+     * @brief Accessor.
+     * @detail Refreshes the snapshot of the variable with a consistent copy and provides
+     * it for in-place access. The snapshot is not shared with the client thread, modifications
+     * are discarded by the next call unless written back through CommitSnapshot.
+     * @return Snapshot instance, NULL if invalid handle or variable not (yet) typed.
+     */
+
+    ccs::types::AnyValue* GetSnapshot (Handle_t handle) const;
+
+    /**
+     * @brief Accessor.
+     * @detail Writes the snapshot back to the variable, if provided through GetSnapshot
+     * since the last commit.
+     * @return True if successful.
+     */
+
+    bool CommitSnapshot (Handle_t handle);
+
+    /**
+     * @brief Accessor.
+     * @detail Writes the variable, and invokes the callback, if any. The method is meant
+     * to be called by the client thread upon notification from the remote peer.
+     * @return True if successful.
+     */
+
+    bool NotifyValue (Handle_t handle, const void* buffer, ccs::types::uint32 size);
+    bool NotifyValue (Handle_t handle, const ccs::types::AnyValue& value);
+
+    /**
+     * @brief PushUpdate method.
+     * @detail Queues the variable for update, if not already queued.
+     * @return True if successful.
+     */
+
+    bool PushUpdate (Handle_t handle);
+
+    /**
+     * @brief PopUpdate method.
+     * @detail Dequeues the next variable to update. The variable may be queued again
+     * from then on, i.e. the value should be read after this call.
+     * @param handle Placeholder for the variable handle.
+     * @return True if a variable has been dequeued, false if the queue is empty.
+     */
+
+    bool PopUpdate (Handle_t& handle);
+
+    /**
+     * @brief Accessor.
+     * @detail Installs a callback invoked by NotifyValue.
+     * @return True if successful.
+     */
+
+    bool SetCallback (Handle_t handle, const Callback_t& cb);
+
+    /**
+     * @brief Accessor.
+     * @return Statistics accumulated over all variables.
+     */
+
+    Statistics_t GetStatistics (void) const;
+
+};
+
+// Global variables
+
+// Function declaration
+
+// Function definition
+
+} // namespace base
+
+} // namespace ccs
+
+#endif // _VariableCache_h_
+
@@ -29,10 +29,15 @@
  * @author Bertrand Bauvir (IO)
  * @copyright 2010-2017 ITER Organization
  * @detail This header file contains the definition of the CyclicRedundancyCheck<> methods.
+ * The CRC-32C (Castagnoli) variant uses the SSE4.2 instruction when supported by the host
+ * and a slicing-by-8 table otherwise. CRCs computed over consecutive portions of a buffer can
+ * be combined, e.g. to compute the CRC of large buffers in parallel.
  */
 
 // Global header files
 
+#include <string.h> // memcpy
+
 // Local header files
 
 #include "BasicTypes.h"
@@ -50,6 +55,9 @@ namespace HelperTools {
 static ccs::types::uint32 __table [256];
 static bool __table_init = false;
 
+static ccs::types::uint32 __table_castagnoli [8][256]; // Slicing-by-8
+static bool __table_castagnoli_init = false;
+
 // Function declaration
 
 /**
@@ -68,6 +76,30 @@ static inline bool InitialiseCyclicRedundancyCheck (const ccs::types::uint32 pol
 
 template <typename Type> inline Type CyclicRedundancyCheck (const ccs::types::uint8 * const buffer, const ccs::types::uint32 size, const ccs::types::uint32 seed = 0u);
 
+/**
+ * @brief CRC-32C operation
+ * @detail This method implements a cyclic redundancy check using the Castagnoli polynomial
+ * on a sized byte array with an optional seed, with the same seed semantics as CyclicRedundancyCheck<uint32>.
+ * The computation uses the SSE4.2 CRC32 instruction when supported by the host.
+ * @return The CRC-32C over the sized array.
+ */
+
+static inline ccs::types::uint32 CyclicRedundancyCheckCastagnoli (const ccs::types::uint8 * const buffer, const ccs::types::uint32 size, const ccs::types::uint32 seed = 0u);
+
+/**
+ * @brief CRC combine operation
+ * @detail This method computes the CRC of the concatenation of two buffers given the CRC
+ * of each, and the size of the second buffer. The polynomial selects the variant, i.e.
+ * 0xEDB88320u for CRC-32 and 0x82F63B78u for CRC-32C.
+ * @code
+   ccs::types::uint32 crc = ccs::HelperTools::CyclicRedundancyCheck<ccs::types::uint32>(buffer, half, seed);
+   crc = ccs::HelperTools::CombineCyclicRedundancyCheck(crc, ccs::HelperTools::CyclicRedundancyCheck<ccs::types::uint32>(buffer + half, size - half), size - half);
+   @endcode
+ * @return The CRC over the concatenated buffers.
+ */
+
+static inline ccs::types::uint32 CombineCyclicRedundancyCheck (const ccs::types::uint32 first, const ccs::types::uint32 second, const ccs::types::uint32 size, const ccs::types::uint32 poly = 0xEDB88320u);
+
 // Function definition
 
 static inline bool InitialiseCyclicRedundancyCheck (const ccs::types::uint32 poly)
@@ -133,6 +165,208 @@ template <> inline ccs::types::uint32 CyclicRedundancyCheck (const ccs::types::u
 
 }
 
+static inline bool InitialiseCyclicRedundancyCheckCastagnoli (void)
+{
+
+  bool status = (__table_castagnoli_init == false);
+
+  if (status)
+    {
+      for (ccs::types::uint32 table_index = 0u; table_index < 256u; table_index++) 
+        {
+          ccs::types::uint32 seed  = table_index;
+          
+          for (ccs::types::uint32 bit_index = 0u; bit_index < 8u; bit_index++) 
+            {
+              seed = (0x01u == (seed & 0x01u)) ? (0x82F63B78u ^ (seed >> 1)) : (seed >> 1);
+            }
+          
+          __table_castagnoli[0][table_index] = seed;
+        }
+
+      for (ccs::types::uint32 table_index = 0u; table_index < 256u; table_index++) 
+        {
+          for (ccs::types::uint32 slice_index = 1u; slice_index < 8u; slice_index++) 
+            {
+              ccs::types::uint32 prev = __table_castagnoli[slice_index - 1u][table_index];
+              __table_castagnoli[slice_index][table_index] = __table_castagnoli[0][prev & 0xFFu] ^ (prev >> 8);
+            }
+        }
+      
+      __table_castagnoli_init = true;
+    }
+
+  return status;
+
+}
+
+static inline ccs::types::uint32 __CyclicRedundancyCheckCastagnoli_Table (ccs::types::uint32 chksum, const ccs::types::uint8 * const buffer, const ccs::types::uint32 size)
+{
+
+  if (__builtin_expect((__table_castagnoli_init == false), 0)) // Unlikely
+    {
+      (void)InitialiseCyclicRedundancyCheckCastagnoli();
+    }
+
+  ccs::types::uint32 index = 0u;
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+  for (; (index + 8u) <= size; index += 8u) 
+    {
+      ccs::types::uint32 low; (void)memcpy(&low, buffer + index, 4u);
+      ccs::types::uint32 high; (void)memcpy(&high, buffer + index + 4u, 4u);
+
+      low ^= chksum;
+
+      chksum = (__table_castagnoli[7][low & 0xFFu] ^ __table_castagnoli[6][(low >> 8) & 0xFFu] ^
+                __table_castagnoli[5][(low >> 16) & 0xFFu] ^ __table_castagnoli[4][low >> 24] ^
+                __table_castagnoli[3][high & 0xFFu] ^ __table_castagnoli[2][(high >> 8) & 0xFFu] ^
+                __table_castagnoli[1][(high >> 16) & 0xFFu] ^ __table_castagnoli[0][high >> 24]);
+    }
+#endif
+
+  for (; index < size; index++) 
+    {
+      chksum = __table_castagnoli[0][(chksum ^ buffer[index]) & 0xFFu] ^ (chksum >> 8);
+    }
+
+  return chksum;
+
+}
+#if defined(__x86_64__)
+__attribute__((target("sse4.2"))) static inline ccs::types::uint32 __CyclicRedundancyCheckCastagnoli_SSE42 (ccs::types::uint32 chksum, const ccs::types::uint8 * const buffer, const ccs::types::uint32 size)
+{
+
+  ccs::types::uint64 crc = chksum;
+  ccs::types::uint32 index = 0u;
+
+  for (; (index + 8u) <= size; index += 8u) 
+    {
+      ccs::types::uint64 word; (void)memcpy(&word, buffer + index, 8u);
+      crc = __builtin_ia32_crc32di(crc, word);
+    }
+
+  chksum = static_cast<ccs::types::uint32>(crc);
+
+  for (; index < size; index++) 
+    {
+      chksum = __builtin_ia32_crc32qi(chksum, buffer[index]);
+    }
+
+  return chksum;
+
+}
+#endif
+static inline ccs::types::uint32 CyclicRedundancyCheckCastagnoli (const ccs::types::uint8 * const buffer, const ccs::types::uint32 size, const ccs::types::uint32 seed)
+{
+
+  ccs::types::uint32 chksum = 0xFFFFFFFFul; // Initial value
+#if defined(__x86_64__)
+  static bool hw_support = __builtin_cpu_supports("sse4.2");
+
+  if (__builtin_expect(hw_support, 1)) // Likely
+    {
+      if (0u != seed)
+        {
+          chksum = __CyclicRedundancyCheckCastagnoli_SSE42(chksum, reinterpret_cast<const ccs::types::uint8*>(&seed), 4u);
+        }
+
+      chksum = __CyclicRedundancyCheckCastagnoli_SSE42(chksum, buffer, size);
+    }
+  else
+#endif
+    {
+      if (0u != seed)
+        {
+          chksum = __CyclicRedundancyCheckCastagnoli_Table(chksum, reinterpret_cast<const ccs::types::uint8*>(&seed), 4u);
+        }
+
+      chksum = __CyclicRedundancyCheckCastagnoli_Table(chksum, buffer, size);
+    }
+
+  chksum = chksum ^ 0xFFFFFFFFul;
+     
+  return chksum;
+
+}
+
+static inline ccs::types::uint32 __GaloisMatrixTimes (const ccs::types::uint32 * const matrix, ccs::types::uint32 vector)
+{
+
+  ccs::types::uint32 sum = 0u;
+
+  for (ccs::types::uint32 index = 0u; 0u != vector; index++, vector >>= 1)
+    {
+      if (0x01u == (vector & 0x01u))
+        {
+          sum ^= matrix[index];
+        }
+    }
+
+  return sum;
+
+}
+
+static inline void __GaloisMatrixSquare (ccs::types::uint32 * const square, const ccs::types::uint32 * const matrix)
+{
+
+  for (ccs::types::uint32 index = 0u; index < 32u; index++)
+    {
+      square[index] = __GaloisMatrixTimes(matrix, matrix[index]);
+    }
+
+  return;
+
+}
+
+static inline ccs::types::uint32 CombineCyclicRedundancyCheck (const ccs::types::uint32 first, const ccs::types::uint32 second, const ccs::types::uint32 size, const ccs::types::uint32 poly)
+{
+
+  ccs::types::uint32 chksum = first;
+  ccs::types::uint32 length = size;
+
+  // Operator for one zero bit in odd, then two and four zero bits in even and odd respectively
+  ccs::types::uint32 even [32];
+  ccs::types::uint32 odd [32];
+
+  odd[0] = poly;
+
+  for (ccs::types::uint32 index = 1u; index < 32u; index++)
+    {
+      odd[index] = (1u << (index - 1u));
+    }
+
+  __GaloisMatrixSquare(even, odd);
+  __GaloisMatrixSquare(odd, even);
+
+  // Apply size zero bytes to the first CRC
+  while (0u != length)
+    {
+      __GaloisMatrixSquare(even, odd);
+
+      if (0x01u == (length & 0x01u))
+        {
+          chksum = __GaloisMatrixTimes(even, chksum);
+        }
+
+      length >>= 1;
+
+      if (0u != length)
+        {
+          __GaloisMatrixSquare(odd, even);
+
+          if (0x01u == (length & 0x01u))
+            {
+              chksum = __GaloisMatrixTimes(odd, chksum);
+            }
+
+          length >>= 1;
+        }
+    }
+
+  return (0u != size) ? (chksum ^ second) : first;
+
+}
+
 } // namespace HelperTools
 
 } // namespace ccs
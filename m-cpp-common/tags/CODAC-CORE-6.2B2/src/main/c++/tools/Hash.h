@@ -33,12 +33,20 @@
 
 // Global header files
 
+#include <string.h> // memcpy
+
 // Local header files
 
 #include "BasicTypes.h" // Condensed integer type definition, RET_STATUS, etc.
 
 // Constants
 
+#define HASH64_PRIME_1 11400714785074694791ul
+#define HASH64_PRIME_2 14029467366897019727ul
+#define HASH64_PRIME_3  1609587929392839161ul
+#define HASH64_PRIME_4  9650029242287828579ul
+#define HASH64_PRIME_5  2870177450012600261ul
+
 // Type definition
 
 namespace ccs {
@@ -127,6 +135,16 @@ static const ccs::types::uint32 __table_uint32 [] = {
 
 template <typename Type> inline Type Hash (const ccs::types::char8 * const key); // Has to be a null terminated array
 
+/**
+ * @brief Buffer hashing operation
+ * @detail This method generates a non-cryptographic hash for a sized byte array with an optional
+ * seed. The 64-bit specialisation implements the XXH64 algorithm which processes the buffer in
+ * 32 bytes stripes and is therefore considerably faster than byte-oriented CRC computation.
+ * @return Hash for all supported types
+ */
+
+template <typename Type> inline Type Hash (const ccs::types::uint8 * const buffer, const ccs::types::uint32 size, const Type seed);
+
 // Function definition
 
 template <> inline ccs::types::uint8 Rotate (const ccs::types::uint8 bitmap, const ccs::types::uint8 nbits)
@@ -249,6 +267,97 @@ template <> inline ccs::types::uint32 Hash (const ccs::types::char8 * const key)
 
 }
 
+static inline ccs::types::uint64 __Hash64Round (ccs::types::uint64 acc, const ccs::types::uint64 input)
+{
+
+  acc += input * HASH64_PRIME_2;
+  acc = (acc << 31) | (acc >> 33);
+  acc *= HASH64_PRIME_1;
+
+  return acc;
+
+}
+
+static inline ccs::types::uint64 __Hash64Merge (ccs::types::uint64 acc, const ccs::types::uint64 val)
+{
+
+  acc ^= __Hash64Round(0ul, val);
+  acc = acc * HASH64_PRIME_1 + HASH64_PRIME_4;
+
+  return acc;
+
+}
+
+template <> inline ccs::types::uint64 Hash (const ccs::types::uint8 * const buffer, const ccs::types::uint32 size, const ccs::types::uint64 seed)
+{
+
+  ccs::types::uint64 hash = 0ul;
+  ccs::types::uint32 index = 0u;
+
+  // WARNING - Little-endian word loads, the result differs on big-endian hosts
+
+  if (size >= 32u)
+    {
+      ccs::types::uint64 acc [4] = { seed + HASH64_PRIME_1 + HASH64_PRIME_2, seed + HASH64_PRIME_2, seed, seed - HASH64_PRIME_1 };
+
+      for (; (index + 32u) <= size; index += 32u)
+        {
+          ccs::types::uint64 word [4]; (void)memcpy(word, buffer + index, 32u);
+
+          acc[0] = __Hash64Round(acc[0], word[0]);
+          acc[1] = __Hash64Round(acc[1], word[1]);
+          acc[2] = __Hash64Round(acc[2], word[2]);
+          acc[3] = __Hash64Round(acc[3], word[3]);
+        }
+
+      hash = (((acc[0] << 1) | (acc[0] >> 63)) + ((acc[1] << 7) | (acc[1] >> 57)) +
+              ((acc[2] << 12) | (acc[2] >> 52)) + ((acc[3] << 18) | (acc[3] >> 46)));
+
+      hash = __Hash64Merge(hash, acc[0]);
+      hash = __Hash64Merge(hash, acc[1]);
+      hash = __Hash64Merge(hash, acc[2]);
+      hash = __Hash64Merge(hash, acc[3]);
+    }
+  else
+    {
+      hash = seed + HASH64_PRIME_5;
+    }
+
+  hash += static_cast<ccs::types::uint64>(size);
+
+  for (; (index + 8u) <= size; index += 8u)
+    {
+      ccs::types::uint64 word; (void)memcpy(&word, buffer + index, 8u);
+
+      hash ^= __Hash64Round(0ul, word);
+      hash = ((hash << 27) | (hash >> 37)) * HASH64_PRIME_1 + HASH64_PRIME_4;
+    }
+
+  for (; (index + 4u) <= size; index += 4u)
+    {
+      ccs::types::uint32 word; (void)memcpy(&word, buffer + index, 4u);
+
+      hash ^= static_cast<ccs::types::uint64>(word) * HASH64_PRIME_1;
+      hash = ((hash << 23) | (hash >> 41)) * HASH64_PRIME_2 + HASH64_PRIME_3;
+    }
+
+  for (; index < size; index++)
+    {
+      hash ^= static_cast<ccs::types::uint64>(buffer[index]) * HASH64_PRIME_5;
+      hash = ((hash << 11) | (hash >> 53)) * HASH64_PRIME_1;
+    }
+
+  // Avalanche
+  hash ^= hash >> 33;
+  hash *= HASH64_PRIME_2;
+  hash ^= hash >> 29;
+  hash *= HASH64_PRIME_3;
+  hash ^= hash >> 32;
+
+  return hash;
+
+}
+
 } // namespace HelperTools
 
 } // namespace ccs
@@ -47,6 +47,7 @@
 #include <endian.h>
 #ifndef LINT // MARTe2 Integration
 #include <stdio.h> // fopen, getline, etc.
+#include <string.h> // memcpy, etc.
 #endif
 // Local header files
 
@@ -490,8 +491,21 @@ template <> inline ccs::types::int64 FromNetworkByteOrder<ccs::types::int64> (cc
   return static_cast<ccs::types::int64>(ret); 
 }
 
-template <> inline ccs::types::float32 FromNetworkByteOrder (ccs::types::float32 value) { return be32toh(value); }
-template <> inline ccs::types::float64 FromNetworkByteOrder (ccs::types::float64 value) { return be64toh(value); }
+template <> inline ccs::types::float32 FromNetworkByteOrder (ccs::types::float32 value) // Bit pattern, not value conversion
+{
+  ccs::types::uint32 tmp; (void)memcpy(&tmp, &value, sizeof(ccs::types::uint32)); tmp = be32toh(tmp);
+  ccs::types::float32 ret; (void)memcpy(&ret, &tmp, sizeof(ccs::types::float32));
+
+  return ret;
+}
+
+template <> inline ccs::types::float64 FromNetworkByteOrder (ccs::types::float64 value)
+{
+  ccs::types::uint64 tmp; (void)memcpy(&tmp, &value, sizeof(ccs::types::uint64)); tmp = be64toh(tmp);
+  ccs::types::float64 ret; (void)memcpy(&ret, &tmp, sizeof(ccs::types::float64));
+
+  return ret;
+}
 
 /**
  * @brief Conversion from host platform to network byte order (big-endianness).
@@ -530,8 +544,21 @@ template <> inline ccs::types::int64 ToNetworkByteOrder<ccs::types::int64> (ccs:
   return static_cast<ccs::types::int64>(ret); 
 }
 
-template <> inline ccs::types::float32 ToNetworkByteOrder<ccs::types::float32> (ccs::types::float32 value) { return htobe32(value); }
-template <> inline ccs::types::float64 ToNetworkByteOrder<ccs::types::float64> (ccs::types::float64 value) { return htobe64(value); }
+template <> inline ccs::types::float32 ToNetworkByteOrder<ccs::types::float32> (ccs::types::float32 value) // Bit pattern, not value conversion
+{
+  ccs::types::uint32 tmp; (void)memcpy(&tmp, &value, sizeof(ccs::types::uint32)); tmp = htobe32(tmp);
+  ccs::types::float32 ret; (void)memcpy(&ret, &tmp, sizeof(ccs::types::float32));
+
+  return ret;
+}
+
+template <> inline ccs::types::float64 ToNetworkByteOrder<ccs::types::float64> (ccs::types::float64 value)
+{
+  ccs::types::uint64 tmp; (void)memcpy(&tmp, &value, sizeof(ccs::types::uint64)); tmp = htobe64(tmp);
+  ccs::types::float64 ret; (void)memcpy(&ret, &tmp, sizeof(ccs::types::float64));
+
+  return ret;
+}
 
 } // namespace HelperTools
 
@@ -21,12 +21,15 @@
 
 // Global header files
 
+#include <string.h> // memcpy, strnlen, etc.
+
 // Local header files
 
 #include "BasicTypes.h" // Misc. type definition
 #include "SysTools.h" // Misc. helper functions
 
 #include "NetTools.h" 
+#include "Hash.h"
 
 //#define LOG_TRACE_ENABLE
 //#undef LOG_TRACE_ENABLE 
@@ -55,7 +58,57 @@ namespace types {
 // Function definition
   
 uint32 AnyType::GetSize (void) const { return __size; }
-AnyType* AnyType::SetSize (const uint32 size) { __size = size; return this; }
+AnyType* AnyType::SetSize (const uint32 size) { __size = size; __fingerprint.store(0ul, std::memory_order_relaxed); __layout.store(0ul, std::memory_order_relaxed); return this; }
+
+uint64 AnyType::Fingerprint (const uint64 hash, const char8 tag, const char8 * const name, const uint64 value)
+{
+
+  uint8 buffer [STRING_MAX_LENGTH + 9u];
+  uint32 length = static_cast<uint32>(strnlen(name, STRING_MAX_LENGTH));
+  uint64 order = ccs::HelperTools::ToNetworkByteOrder<uint64>(value);
+
+  buffer[0] = static_cast<uint8>(tag);
+  (void)memcpy(buffer + 1u, &order, sizeof(uint64));
+  (void)memcpy(buffer + 9u, name, length);
+
+  return ccs::HelperTools::Hash<uint64>(buffer, length + 9u, hash);
+
+}
+
+uint64 AnyType::ComputeFingerprint (const bool names) const { (void)names; return Fingerprint(0ul, 'S', this->GetName(), this->GetSize()); }
+
+uint64 AnyType::GetFingerprint (void) const
+{
+
+  // Concurrent computation is benign as the outcome is identical
+  uint64 hash = __fingerprint.load(std::memory_order_relaxed);
+
+  if (__builtin_expect((0ul == hash), 0)) // Unlikely
+    {
+      hash = this->ComputeFingerprint(true);
+      hash = ((0ul != hash) ? hash : 1ul);
+      __fingerprint.store(hash, std::memory_order_relaxed);
+    }
+
+  return hash;
+
+}
+
+uint64 AnyType::GetLayoutFingerprint (void) const
+{
+
+  uint64 hash = __layout.load(std::memory_order_relaxed);
+
+  if (__builtin_expect((0ul == hash), 0)) // Unlikely
+    {
+      hash = this->ComputeFingerprint(false);
+      hash = ((0ul != hash) ? hash : 1ul);
+      __layout.store(hash, std::memory_order_relaxed);
+    }
+
+  return hash;
+
+}
 
 const char8 * AnyType::GetName (void) const { return __type; }
 AnyType* AnyType::SetName (const char8 * const type) { ccs::HelperTools::SafeStringCopy(__type, type, STRING_MAX_LENGTH); return this; }
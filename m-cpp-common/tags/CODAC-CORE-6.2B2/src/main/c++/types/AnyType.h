@@ -33,6 +33,8 @@
 
 // Global header files
 
+#include <atomic> // std::atomic
+
 // Local header files
 
 #include "BasicTypes.h" // Misc. type definition
@@ -69,6 +71,9 @@ class AnyType
     uint32 __size;
     char8 __type [STRING_MAX_LENGTH];
 
+    mutable std::atomic<uint64> __fingerprint; // 0 until computed
+    mutable std::atomic<uint64> __layout; // 0 until computed
+
     /**
      * @brief Copy constructor.
      * @note Undefined as invalid operation to copy instances of this class.
@@ -85,6 +90,26 @@ class AnyType
 
   protected:
 
+    /**
+     * @brief Virtual method.
+     * @detail Computes the structural fingerprint of the type definition. The default
+     * implementation hashes the name and size, as appropriate for scalar types.
+     * @param names Include attribute names, see AnyType::GetFingerprint, else only the
+     * layout, see AnyType::GetLayoutFingerprint.
+     * @return Structural fingerprint.
+     */
+
+    virtual uint64 ComputeFingerprint (const bool names) const;
+
+    /**
+     * @brief Helper method.
+     * @detail Accumulates a tagged name and value into the hash, irrespective of
+     * host platform endianness.
+     * @return Updated hash.
+     */
+
+    static uint64 Fingerprint (const uint64 hash, const char8 tag, const char8 * const name, const uint64 value);
+
   public:
 
     /**
@@ -134,6 +159,27 @@ class AnyType
      */
 
     AnyType* SetSize (const uint32 size);
+
+    /**
+     * @brief Accessor.
+     * @detail The structural fingerprint covers attribute names, scalar type names, multiplicities
+     * and offsets, but not the name of the type definition itself. Type definitions with the
+     * same fingerprint may be used interchangeably to access instances by attribute name. It is
+     * computed upon first access, i.e. once the type definition is complete, and reset whenever
+     * the type definition is modified.
+     * @return Non-zero 64-bit structural fingerprint.
+     */
+
+    uint64 GetFingerprint (void) const;
+
+    /**
+     * @brief Accessor.
+     * @detail The layout fingerprint is the structural fingerprint without attribute names,
+     * i.e. what is significant to the equivalence of type definitions as per operator==.
+     * @return Non-zero 64-bit layout fingerprint.
+     */
+
+    uint64 GetLayoutFingerprint (void) const;
  
     /**
      * @brief Accessor.
@@ -194,7 +240,8 @@ class AnyType
 
     /**
      * @brief Comparison operator.
-     * @detail Compares against other type definition for equivalence.
+     * @detail Compares against other type definition for equivalence. Specialisations
+     * compare structural fingerprints first and only walk the type definition upon match.
      * @return True if successful.
      */
 
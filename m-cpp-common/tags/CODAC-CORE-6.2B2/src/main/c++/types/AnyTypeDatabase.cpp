@@ -21,52 +21,534 @@
 
 // Global header files
 
-#include <map> // std::map
+#include <algorithm> // std::find
+#include <atomic> // std::atomic
+#include <mutex> // std::mutex, std::call_once, etc.
 #include <new> // std::nothrow
-#include <utility> // std::pair
+#include <string> // std::string
+#include <vector> // std::vector
+
+#include <string.h> // strcmp, etc.
 
 // Local header files
 
 #include "BasicTypes.h" // Misc. type definition
+#include "Hash.h" // Misc. helper functions
 #include "LookUpTable.h"
 
+#include "log-api.h" // Syslog wrapper routines
+
 #include "AnyType.h" // Introspectable type definition (base class) ..
 #include "AnyTypeHelper.h" // .. associated helper routines
 
+#include "ArrayType.h"
 #include "CompoundType.h"
 #include "ScalarType.h"
 
+#include "AnyTypeDatabase.h"
+
 // Constants
 
 #undef LOG_ALTERN_SRC
 #define LOG_ALTERN_SRC "ccs::types"
 
+#define DEFAULT_TYPEINDEX_SIZE 64u
+
 // Type definition
 
 namespace ccs {
 
 namespace types {
 
+namespace GlobalTypeDatabase {
+
+/**
+ * @brief Open addressing hash table with wait-free lookup.
+ * @detail Entries and tables are immutable once published. Writers are serialised by the
+ * caller and publish with release semantics; readers never block. Slots of removed entries
+ * are marked with a tombstone and the table is re-built when too few slots remain free.
+ *
+ * Superseded tables and removed entries are retired rather than freed, since a reader may
+ * still hold them. Readers announce themselves through a ReadGuard for as long as they use
+ * entries; retired memory is reclaimed by the next writer which finds no reader in progress,
+ * and upon destruction otherwise.
+ */
+
+class TypeIndex
+{
+
+  public:
+
+    typedef struct Entry {
+      uint64 hash;
+      std::string name;
+      std::shared_ptr<const AnyType> type;
+    } Entry_t;
+
+  private:
+
+    typedef struct Table {
+      uint32 mask;
+      std::atomic<const Entry_t*>* slots;
+    } Table_t;
+
+    std::atomic<Table_t*> __table;
+
+    uint32 __live; // Occupied slots
+    uint32 __used; // Occupied and tombstone slots
+
+    mutable std::atomic<uint32> __readers; // Lookups in progress
+
+    std::vector<const Entry_t*> __entries; // Inserted and not removed
+    std::vector<Table_t*> __retired_tables; // Superseded, reader may still hold them ..
+    std::vector<const Entry_t*> __retired_entries; // .. resp. removed
+
+    static Entry_t __tombstone;
+
+    static void Delete (Table_t * const table);
+
+    bool Resize (void);
+    void Reclaim (void); // Holding the writer lock
+
+  public:
+
+    class ReadGuard
+    {
+
+      private:
+
+        const TypeIndex& __index;
+
+      public:
+
+        explicit ReadGuard (const TypeIndex& index) : __index (index) { (void)__index.__readers.fetch_add(1u, std::memory_order_seq_cst); };
+        ~ReadGuard (void) { (void)__index.__readers.fetch_sub(1u, std::memory_order_release); };
+
+    };
+
+    TypeIndex (void) : __table (NULL_PTR_CAST(Table_t*)), __live (0u), __used (0u), __readers (0u), __entries (), __retired_tables (), __retired_entries () {};
+    ~TypeIndex (void);
+
+    template <typename Predicate> const Entry_t* Find (const uint64 hash, const Predicate& pred) const;
+
+    const Entry_t* Insert (const uint64 hash, const char8 * const name, const std::shared_ptr<const AnyType>& type);
+    bool Remove (const Entry_t * const entry);
+
+};
+
 // Global variables
 
-namespace GlobalTypeDatabase {
+AnyTypeDatabase* __p_tdb = NULL_PTR_CAST(AnyTypeDatabase*); // Just instantiate the globally scoped type database
+
+TypeIndex::Entry_t TypeIndex::__tombstone;
 
-AnyTypeDatabase* __p_tdb; // Just instantiate the globally scoped type database
+static std::mutex __mutex; // Serialise writers
+static std::once_flag __once;
 
 // Function declaration
 
 // Function definition
-  
-bool IsValid (const char8 * const name) { return GetInstance()->IsValid(name); }
+
+static inline TypeIndex& GetNames (void) // Registered types by name
+{
+  static TypeIndex __names; // Constructed upon first use, irrespective of static initialisation order
+  return __names;
+}
+
+static inline TypeIndex& GetStructures (void) // Canonical types by structural fingerprint
+{
+  static TypeIndex __structures;
+  return __structures;
+}
+
+void TypeIndex::Delete (Table_t * const table)
+{
+
+  if (NULL_PTR_CAST(Table_t*) != table)
+    {
+      delete [] table->slots;
+      delete table;
+    }
+
+  return;
+
+}
+
+void TypeIndex::Reclaim (void)
+{
+
+  // Retired memory has been unpublished by the caller, readers which may still hold it
+  // have announced themselves before
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (0u == __readers.load(std::memory_order_seq_cst))
+    {
+      for (std::vector<Table_t*>::iterator it = __retired_tables.begin(); it != __retired_tables.end(); ++it)
+        {
+          Delete(*it);
+        }
+
+      for (std::vector<const Entry_t*>::iterator it = __retired_entries.begin(); it != __retired_entries.end(); ++it)
+        {
+          delete *it;
+        }
+
+      __retired_tables.clear();
+      __retired_entries.clear();
+    }
+
+  return;
+
+}
+
+template <typename Predicate> const TypeIndex::Entry_t* TypeIndex::Find (const uint64 hash, const Predicate& pred) const
+{
+
+  const Entry_t* found = NULL_PTR_CAST(const Entry_t*);
+  const Table_t* table = __table.load(std::memory_order_acquire);
+
+  for (uint32 probe = 0u; ((NULL_PTR_CAST(const Table_t*) != table) && (probe <= table->mask)); probe += 1u)
+    {
+      const Entry_t* entry = table->slots[(static_cast<uint32>(hash) + probe) & table->mask].load(std::memory_order_acquire);
+
+      if (NULL_PTR_CAST(const Entry_t*) == entry)
+        {
+          break;
+        }
+
+      if ((&__tombstone != entry) && (hash == entry->hash) && pred(entry))
+        {
+          found = entry;
+          break;
+        }
+    }
+
+  return found;
+
+}
+
+bool TypeIndex::Resize (void)
+{
+
+  uint32 size = DEFAULT_TYPEINDEX_SIZE;
+
+  while (size < (4u * (__live + 1u)))
+    {
+      size *= 2u;
+    }
+
+  Table_t* table = new (std::nothrow) Table_t;
+
+  bool status = (NULL_PTR_CAST(Table_t*) != table);
+
+  if (status)
+    {
+      table->mask = size - 1u;
+      table->slots = new (std::nothrow) std::atomic<const Entry_t*> [size];
+      status = (NULL_PTR_CAST(std::atomic<const Entry_t*>*) != table->slots);
+
+      if (!status)
+        {
+          delete table;
+        }
+    }
+
+  if (status)
+    {
+      for (uint32 index = 0u; index < size; index += 1u)
+        {
+          table->slots[index].store(NULL_PTR_CAST(const Entry_t*), std::memory_order_relaxed);
+        }
+
+      // Re-insert live entries, tombstones are dropped
+      const Table_t* current = __table.load(std::memory_order_relaxed);
+
+      for (uint32 index = 0u; ((NULL_PTR_CAST(const Table_t*) != current) && (index <= current->mask)); index += 1u)
+        {
+          const Entry_t* entry = current->slots[index].load(std::memory_order_relaxed);
+
+          if ((NULL_PTR_CAST(const Entry_t*) != entry) && (&__tombstone != entry))
+            {
+              uint32 slot = static_cast<uint32>(entry->hash) & table->mask;
+
+              while (NULL_PTR_CAST(const Entry_t*) != table->slots[slot].load(std::memory_order_relaxed))
+                {
+                  slot = (slot + 1u) & table->mask;
+                }
+
+              table->slots[slot].store(entry, std::memory_order_relaxed);
+            }
+        }
+
+      __used = __live;
+
+      Table_t* superseded = __table.exchange(table, std::memory_order_release);
+
+      if (NULL_PTR_CAST(Table_t*) != superseded)
+        {
+          __retired_tables.push_back(superseded);
+        }
+    }
+
+  return status;
+
+}
+
+const TypeIndex::Entry_t* TypeIndex::Insert (const uint64 hash, const char8 * const name, const std::shared_ptr<const AnyType>& type)
+{
+
+  Entry_t* entry = new (std::nothrow) Entry_t;
+
+  bool status = (NULL_PTR_CAST(Entry_t*) != entry);
+
+  if (status)
+    {
+      entry->hash = hash;
+      entry->name = name;
+      entry->type = type;
+    }
+
+  Table_t* table = __table.load(std::memory_order_relaxed);
+
+  if (status && ((NULL_PTR_CAST(Table_t*) == table) || ((2u * (__used + 1u)) > (table->mask + 1u))))
+    {
+      status = this->Resize();
+      table = __table.load(std::memory_order_relaxed);
+    }
+
+  if (status)
+    {
+      uint32 slot = static_cast<uint32>(hash) & table->mask;
+
+      // Tombstones may be re-used, readers either skip them or find the new entry
+      for (const Entry_t* other = table->slots[slot].load(std::memory_order_relaxed);
+           ((NULL_PTR_CAST(const Entry_t*) != other) && (&__tombstone != other));
+           other = table->slots[slot].load(std::memory_order_relaxed))
+        {
+          slot = (slot + 1u) & table->mask;
+        }
+
+      if (NULL_PTR_CAST(const Entry_t*) == table->slots[slot].load(std::memory_order_relaxed))
+        {
+          __used += 1u;
+        }
+
+      __live += 1u;
+      table->slots[slot].store(entry, std::memory_order_release);
+      __entries.push_back(entry);
+    }
+  else if (NULL_PTR_CAST(Entry_t*) != entry)
+    { // Not published
+      delete entry;
+      entry = NULL_PTR_CAST(Entry_t*);
+    }
+
+  this->Reclaim();
+
+  return entry;
+
+}
+
+bool TypeIndex::Remove (const Entry_t * const entry)
+{
+
+  const Table_t* table = __table.load(std::memory_order_relaxed);
+
+  bool status = false;
+
+  for (uint32 index = 0u; ((NULL_PTR_CAST(const Table_t*) != table) && !status && (index <= table->mask)); index += 1u)
+    {
+      status = (entry == table->slots[index].load(std::memory_order_relaxed));
+
+      if (status)
+        {
+          table->slots[index].store(&__tombstone, std::memory_order_release);
+          __live -= 1u;
+        }
+    }
+
+  if (status)
+    {
+      __entries.erase(std::find(__entries.begin(), __entries.end(), entry));
+      __retired_entries.push_back(entry);
+      this->Reclaim();
+    }
+
+  return status;
+
+}
+
+TypeIndex::~TypeIndex (void)
+{
+
+  // Late lookups, e.g. from static destructors, find nothing
+  Delete(__table.exchange(NULL_PTR_CAST(Table_t*)));
+
+  for (std::vector<Table_t*>::iterator it = __retired_tables.begin(); it != __retired_tables.end(); ++it)
+    {
+      Delete(*it);
+    }
+
+  for (std::vector<const Entry_t*>::iterator it = __entries.begin(); it != __entries.end(); ++it)
+    {
+      delete *it;
+    }
+
+  for (std::vector<const Entry_t*>::iterator it = __retired_entries.begin(); it != __retired_entries.end(); ++it)
+    {
+      delete *it;
+    }
+
+}
+
+static inline uint64 GetNameHash (const char8 * const name)
+{
+  return static_cast<uint64>(::ccs::HelperTools::Hash<uint32>(name));
+}
+
+static inline const TypeIndex::Entry_t* FindByName (const char8 * const name)
+{
+
+  const TypeIndex::Entry_t* entry = NULL_PTR_CAST(const TypeIndex::Entry_t*);
+
+  if (NULL_PTR_CAST(const char8*) != name)
+    {
+      entry = GetNames().Find(GetNameHash(name), [name] (const TypeIndex::Entry_t * const other) { return (0 == strcmp(other->name.c_str(), name)); });
+    }
+
+  return entry;
+
+}
+
+static bool HasSameNames (const AnyType * const type, const AnyType * const other) // Equivalent types
+{
+
+  const ArrayType* array = dynamic_cast<const ArrayType*>(type);
+  const CompoundType* compound = dynamic_cast<const CompoundType*>(type);
+
+  bool status = true;
+
+  if (NULL_PTR_CAST(const ArrayType*) != array)
+    {
+      status = HasSameNames(array->GetElementType().get(), dynamic_cast<const ArrayType*>(other)->GetElementType().get());
+    }
+  else if (NULL_PTR_CAST(const CompoundType*) != compound)
+    {
+      const CompoundType* ref = dynamic_cast<const CompoundType*>(other);
+
+      for (uint32 index = 0u; (status && (index < compound->GetAttributeNumber())); index += 1u)
+        {
+          status = ((0 == strcmp(compound->GetAttributeName(index), ref->GetAttributeName(index))) &&
+                    HasSameNames(compound->GetAttributeType(index).get(), ref->GetAttributeType(index).get()));
+        }
+    }
+
+  return status;
+
+}
+
+static inline bool IsIdentical (const std::shared_ptr<const AnyType>& type, const std::shared_ptr<const AnyType>& other)
+{
+  // Type names are not significant, attribute names are
+  return ((type == other) || ((*type == *other) && HasSameNames(type.get(), other.get())));
+}
+
+static inline const TypeIndex::Entry_t* FindByStructure (const uint64 fingerprint, const std::shared_ptr<const AnyType>& type)
+{
+  return GetStructures().Find(fingerprint, [&type] (const TypeIndex::Entry_t * const other) { return IsIdentical(other->type, type); });
+}
+
+static bool Insert (AnyTypeDatabase * const tdb, const std::shared_ptr<const AnyType>& type) // Holding the writer lock
+{
+
+  bool status = (static_cast<bool>(type) && (NULL_PTR_CAST(const TypeIndex::Entry_t*) == FindByName(type->GetName())));
+
+  if (status)
+    {
+      status = tdb->Register(type->GetName(), type);
+    }
+
+  if (status)
+    {
+      status = (NULL_PTR_CAST(const TypeIndex::Entry_t*) != GetNames().Insert(GetNameHash(type->GetName()), type->GetName(), type));
+    }
+
+  if (status)
+    { // Registered types are candidate canonical instances
+      uint64 fingerprint = type->GetFingerprint();
+
+      if (NULL_PTR_CAST(const TypeIndex::Entry_t*) == FindByStructure(fingerprint, type))
+        {
+          (void)GetStructures().Insert(fingerprint, type->GetName(), type);
+        }
+    }
+
+  return status;
+
+}
+
+static void Initialise (void)
+{
+
+  AnyTypeDatabase* tdb = new (std::nothrow) AnyTypeDatabase ();
+
+  if (NULL_PTR_CAST(AnyTypeDatabase*) != tdb)
+    {
+      std::lock_guard<std::mutex> lock (__mutex);
+
+      // Register scalar types
+      (void)Insert(tdb, ::ccs::types::Boolean);
+      (void)Insert(tdb, ::ccs::types::Character8);
+      (void)Insert(tdb, ::ccs::types::SignedInteger8);
+      (void)Insert(tdb, ::ccs::types::UnsignedInteger8);
+      (void)Insert(tdb, ::ccs::types::SignedInteger16);
+      (void)Insert(tdb, ::ccs::types::UnsignedInteger16);
+      (void)Insert(tdb, ::ccs::types::SignedInteger32);
+      (void)Insert(tdb, ::ccs::types::UnsignedInteger32);
+      (void)Insert(tdb, ::ccs::types::SignedInteger64);
+      (void)Insert(tdb, ::ccs::types::UnsignedInteger64);
+      (void)Insert(tdb, ::ccs::types::Float32);
+      (void)Insert(tdb, ::ccs::types::Float64);
+      (void)Insert(tdb, ::ccs::types::String);
+    }
+
+  __atomic_store_n(&__p_tdb, tdb, __ATOMIC_RELEASE);
+
+  return;
+
+}
+
+AnyTypeDatabase* CreateInstance (void)
+{
+
+  std::call_once(__once, Initialise);
+
+  return __p_tdb;
+
+}
+
+bool IsValid (const char8 * const name)
+{
+
+  (void)GetInstance();
+
+  TypeIndex::ReadGuard guard (GetNames());
+
+  return (NULL_PTR_CAST(const TypeIndex::Entry_t*) != FindByName(name));
+
+}
 
 bool Register (const std::shared_ptr<const AnyType>& type)
 {
 
-  bool status = static_cast<bool>(type);
+  AnyTypeDatabase* tdb = GetInstance();
+
+  bool status = (static_cast<bool>(type) && (NULL_PTR_CAST(AnyTypeDatabase*) != tdb));
 
   if (status)
     {
-      status = GetInstance()->Register(type->GetName(), type);
+      std::lock_guard<std::mutex> lock (__mutex);
+      status = Insert(tdb, type);
     }
   
   return status;
@@ -94,20 +576,93 @@ bool Register (const char8 * const buffer)
 const std::shared_ptr<const AnyType> GetType (const char8 * const name)
 { 
 
+  (void)GetInstance();
+
   std::shared_ptr<const AnyType> type;
 
-  bool status = (true == IsValid(name));
+  TypeIndex::ReadGuard guard (GetNames());
 
-  if (status)
+  const TypeIndex::Entry_t* entry = FindByName(name);
+
+  if (NULL_PTR_CAST(const TypeIndex::Entry_t*) != entry)
     {
-      type = GetInstance()->GetElement(name);
+      type = entry->type;
     }
 
   return type;
 
 }
 
-bool Remove (const char8 * const name) { return GetInstance()->Remove(name); }
+const std::shared_ptr<const AnyType> Intern (const std::shared_ptr<const AnyType>& type)
+{
+
+  AnyTypeDatabase* tdb = GetInstance();
+
+  std::shared_ptr<const AnyType> canonical;
+
+  bool status = (static_cast<bool>(type) && (NULL_PTR_CAST(AnyTypeDatabase*) != tdb));
+
+  uint64 fingerprint = 0ul;
+
+  if (status)
+    {
+      fingerprint = type->GetFingerprint();
+
+      TypeIndex::ReadGuard guard (GetStructures());
+
+      const TypeIndex::Entry_t* entry = FindByStructure(fingerprint, type);
+
+      if (NULL_PTR_CAST(const TypeIndex::Entry_t*) != entry)
+        {
+          canonical = entry->type;
+        }
+    }
+
+  if (status && !canonical)
+    {
+      std::lock_guard<std::mutex> lock (__mutex);
+
+      const TypeIndex::Entry_t* entry = FindByStructure(fingerprint, type);
+
+      if (NULL_PTR_CAST(const TypeIndex::Entry_t*) == entry)
+        {
+          entry = GetStructures().Insert(fingerprint, type->GetName(), type);
+        }
+
+      if (NULL_PTR_CAST(const TypeIndex::Entry_t*) != entry)
+        {
+          canonical = entry->type;
+        }
+    }
+
+  return canonical;
+
+}
+
+bool Remove (const char8 * const name)
+{
+
+  AnyTypeDatabase* tdb = GetInstance();
+
+  bool status = (NULL_PTR_CAST(AnyTypeDatabase*) != tdb);
+
+  if (status)
+    {
+      std::lock_guard<std::mutex> lock (__mutex);
+
+      const TypeIndex::Entry_t* entry = FindByName(name);
+
+      status = ((NULL_PTR_CAST(const TypeIndex::Entry_t*) != entry) && GetNames().Remove(entry));
+
+      if (status)
+        {
+          status = tdb->Remove(name);
+        }
+    }
+
+  return status;
+
+}
 
 } // namespace GlobalTypeDatabase
 
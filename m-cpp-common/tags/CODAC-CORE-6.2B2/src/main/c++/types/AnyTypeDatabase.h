@@ -32,6 +32,10 @@
  * are stored using smart pointers. This ensures persistence of AnyType definitions throughout the
  * lifetime of an application without requiring the application to manage instances and/or
  * references.
+ *
+ * Look-ups by name are wait-free and never contend with registrations, which are serialised
+ * internally. The registered types remain accessible through the LookUpTable instance for
+ * enumeration purposes.
  */
 
 #ifndef _AnyTypeDatabase_h_
@@ -139,6 +143,32 @@ const std::shared_ptr<const AnyType> GetType (const char8 * const name);
 
 bool Remove (const char8 * const name);
 
+/**
+ * @brief Retrieve the canonical instance of a type definition.
+ * @detail Identical types, i.e. same layout, scalar types and attribute names, resolve to
+ * the same instance irrespective of the name of the type definition. The first
+ * registered, or else interned, instance is canonical and retained for the lifetime of the
+ * application.
+ * Type identity may then be tested by pointer comparison.
+ * @param type The type definition to intern.
+ * @return Canonical instance, invalid shared pointer if type is invalid.
+ *
+ * @code
+   bool status = (ccs::types::GlobalTypeDatabase::Intern(value.GetType()) ==
+                  ccs::types::GlobalTypeDatabase::Intern(other.GetType()));
+   @endcode
+ */
+
+const std::shared_ptr<const AnyType> Intern (const ::std::shared_ptr<const AnyType>& type);
+
+/**
+ * @brief Instantiate the GlobalTypeDatabase and register all built-in ScalarType.
+ * @note Thread-safe, the instance is only exposed once the built-in types are registered.
+ * Called implicitly.
+ */
+
+AnyTypeDatabase* CreateInstance (void);
+
 /**
  * @brief Retrieve type definition from the GlobalTypeDatabase.
  * @detail The returned smart pointer is dynamically cast to the 
@@ -168,25 +198,7 @@ static inline AnyTypeDatabase* GetInstance (void)
 
   if (__builtin_expect((NULL_PTR_CAST(AnyTypeDatabase*) == __p_tdb), 0)) // Unlikely
     {
-      __p_tdb = new (std::nothrow) AnyTypeDatabase ();
-
-      if (NULL_PTR_CAST(AnyTypeDatabase*) != __p_tdb)
-        {
-          // Register scalar types
-          (void)Register(::ccs::types::Boolean);
-          (void)Register(::ccs::types::Character8);
-          (void)Register(::ccs::types::SignedInteger8);
-          (void)Register(::ccs::types::UnsignedInteger8);
-          (void)Register(::ccs::types::SignedInteger16);
-          (void)Register(::ccs::types::UnsignedInteger16);
-          (void)Register(::ccs::types::SignedInteger32);
-          (void)Register(::ccs::types::UnsignedInteger32);
-          (void)Register(::ccs::types::SignedInteger64);
-          (void)Register(::ccs::types::UnsignedInteger64);
-          (void)Register(::ccs::types::Float32);
-          (void)Register(::ccs::types::Float64);
-          (void)Register(::ccs::types::String);
-        }
+      (void)CreateInstance();
     }
   
   log_trace("GlobalTypeDatabase::GetInstance - Leaving method"); 
@@ -40,6 +40,8 @@
 #include "AnyTypeHelper.h" // .. helper routines
 
 #include "AnyValue.h"
+#include "AnyValueJSON.h"
+#include "ByteSwapProgram.h"
 
 // Constants
 
@@ -65,10 +67,20 @@ void* AnyValue::CreateInstance (void)
 
   bool status = ((this->GetSize() > 0u) && (NULL_PTR_CAST(uint8*) == __instance));
 
-  if (status) 
+  if (status && (ANYVALUE_INLINE_SIZE >= this->GetSize()))
+    {
+      __instance = reinterpret_cast<uint8*>(__buffer);
+    }
+  else if (status) 
     {
       log_debug("AnyValue::CreateInstance - Create instance of size '%u'", this->GetSize());
-      __instance = new (std::nothrow) uint8 [this->GetSize()];
+
+      if (NULL_PTR_CAST(AnyValueAllocator*) == __allocator)
+        {
+          __allocator = AnyValueAllocator::GetDefault();
+        }
+
+      __instance = static_cast<uint8*>(__allocator->Allocate(this->GetSize()));
       status = (NULL_PTR_CAST(uint8*) != __instance); 
     }
 
@@ -89,13 +101,14 @@ void AnyValue::DeleteInstance (void)
 
   log_trace("AnyValue::DeleteInstance - Entering method");
 
-  if (__allocated && (NULL_PTR_CAST(uint8*) != __instance))
+  if (__allocated && (NULL_PTR_CAST(uint8*) != __instance) && (reinterpret_cast<uint8*>(__buffer) != __instance))
     {
       log_debug("AnyValue::DeleteInstance - Delete instance of size '%u'", this->GetSize());
-      delete [] __instance;
+      __allocator->Release(__instance, this->GetSize());
     }
 
   __instance = NULL_PTR_CAST(uint8*); 
+  __allocated = false;
 
   log_debug("AnyValue::DeleteInstance - Leaving method");
 
@@ -135,7 +148,19 @@ bool AnyValue::ToNetworkByteOrder (void)
 
   if (status)
     {
-      status = this->GetType()->ToNetworkByteOrder(this->GetInstance());
+      if (!__swap)
+        {
+          __swap = ByteSwapProgram::GetInstance(this->GetType());
+        }
+
+      if (__swap)
+        {
+          status = __swap->Execute(this->GetInstance());
+        }
+      else // Type does not compile
+        {
+          status = this->GetType()->ToNetworkByteOrder(this->GetInstance());
+        }
     }
 
   if (status)
@@ -159,7 +184,19 @@ bool AnyValue::FromNetworkByteOrder (void)
 
   if (status)
     {
-      status = this->GetType()->FromNetworkByteOrder(this->GetInstance()); 
+      if (!__swap)
+        {
+          __swap = ByteSwapProgram::GetInstance(this->GetType());
+        }
+
+      if (__swap)
+        {
+          status = __swap->Execute(this->GetInstance());
+        }
+      else // Type does not compile
+        {
+          status = this->GetType()->FromNetworkByteOrder(this->GetInstance());
+        }
     }
 
   if (status)
@@ -178,7 +215,13 @@ bool AnyValue::ParseInstance (const char8 * const buffer)
 
   if (status)
     {
-      status = ccs::HelperTools::ParseInstance(this->GetType(), this->GetInstance(), buffer); 
+      status = (0u < ccs::HelperTools::ParseJSONInstance(this->GetType(), this->GetInstance(), buffer));
+
+      if (!status) // Legacy format
+        {
+          log_debug("AnyValue::ParseInstance - Try legacy parser");
+          status = ccs::HelperTools::ParseInstance(this->GetType(), this->GetInstance(), buffer); 
+        }
     }
 
   return status;
@@ -186,13 +229,36 @@ bool AnyValue::ParseInstance (const char8 * const buffer)
 }
 
 bool AnyValue::SerialiseInstance (char8 * const buffer, uint32 size) const 
+{ 
+
+  std::string copy;
+
+  bool status = ((true == static_cast<bool>(__type)) &&
+                 (NULL_PTR_CAST(char8*) != buffer) && (0u < size));
+
+  if (status)
+    {
+      status = ccs::HelperTools::SerialiseJSONInstance(this->GetType(), this->GetInstance(), copy);
+    }
+
+  if (status)
+    {
+      (void)ccs::HelperTools::SafeStringCopy(buffer, copy.c_str(), size);
+    }
+
+  return status;
+
+}
+
+bool AnyValue::SerialiseInstance (std::string& buffer) const 
 { 
 
   bool status = (true == static_cast<bool>(__type));
 
   if (status)
     {
-      status = (0u < ccs::HelperTools::SerialiseInstance(this->GetType(), this->GetInstance(), buffer, size)); 
+      buffer.clear();
+      status = ccs::HelperTools::SerialiseJSONInstance(this->GetType(), this->GetInstance(), buffer);
     }
 
   return status;
@@ -264,6 +330,7 @@ AnyValue::AnyValue (void)
   __type = std::shared_ptr<AnyType>(); 
   __instance = NULL_PTR_CAST(uint8*); 
   __allocated = false;
+  __allocator = NULL_PTR_CAST(AnyValueAllocator*);
   __order = ccs::HelperTools::GetNativeByteOrder();
 
   return; 
@@ -277,6 +344,7 @@ AnyValue::AnyValue (const char8 * const type)
   __type = std::shared_ptr<AnyType>(); 
   __instance = NULL_PTR_CAST(uint8*); 
   __allocated = false;
+  __allocator = NULL_PTR_CAST(AnyValueAllocator*);
   __order = ccs::HelperTools::GetNativeByteOrder();
 
   std::shared_ptr<AnyType> tmp;
@@ -301,6 +369,7 @@ AnyValue::AnyValue (const std::shared_ptr<const AnyType>& type)
   __type = type; 
   __instance = NULL_PTR_CAST(uint8*); 
   __allocated = false;
+  __allocator = NULL_PTR_CAST(AnyValueAllocator*);
   __order = ccs::HelperTools::GetNativeByteOrder();
 
   // Create value buffer
@@ -317,6 +386,7 @@ AnyValue::AnyValue (const AnyType * const type)
   __type = std::shared_ptr<const AnyType>(type); 
   __instance = NULL_PTR_CAST(uint8*); 
   __allocated = false;
+  __allocator = NULL_PTR_CAST(AnyValueAllocator*);
   __order = ccs::HelperTools::GetNativeByteOrder();
 
   // Create value buffer
@@ -333,6 +403,7 @@ AnyValue::AnyValue (const ArrayType& type)
   __type = std::dynamic_pointer_cast<const AnyType>(std::make_shared<const ArrayType>(type)); // shared_ptr from using copy constructor
   __instance = NULL_PTR_CAST(uint8*); 
   __allocated = false;
+  __allocator = NULL_PTR_CAST(AnyValueAllocator*);
   __order = ccs::HelperTools::GetNativeByteOrder();
 
   // Create value buffer
@@ -349,6 +420,7 @@ AnyValue::AnyValue (const CompoundType& type)
   __type = std::dynamic_pointer_cast<const AnyType>(std::make_shared<const CompoundType>(type)); // shared_ptr from using copy constructor
   __instance = NULL_PTR_CAST(uint8*); 
   __allocated = false;
+  __allocator = NULL_PTR_CAST(AnyValueAllocator*);
   __order = ccs::HelperTools::GetNativeByteOrder();
 
   // Create value buffer
@@ -365,6 +437,7 @@ AnyValue::AnyValue (const ScalarType& type)
   __type = std::dynamic_pointer_cast<const AnyType>(std::make_shared<const ScalarType>(type)); // shared_ptr from using copy constructor
   __instance = NULL_PTR_CAST(uint8*); 
   __allocated = false;
+  __allocator = NULL_PTR_CAST(AnyValueAllocator*);
   __order = ccs::HelperTools::GetNativeByteOrder();
 
   // Create value buffer
@@ -381,8 +454,26 @@ AnyValue::AnyValue (const std::shared_ptr<const AnyType>& type, void * const ins
   __type = type;
   __instance = static_cast<uint8*>(instance); 
   __allocated = false;
+  __allocator = NULL_PTR_CAST(AnyValueAllocator*);
+  __order = ccs::HelperTools::GetNativeByteOrder();
+
+  return; 
+
+}
+
+AnyValue::AnyValue (const std::shared_ptr<const AnyType>& type, AnyValueAllocator& allocator)
+{ 
+
+  // Initialise attributes
+  __type = type;
+  __instance = NULL_PTR_CAST(uint8*); 
+  __allocated = false;
+  __allocator = &allocator;
   __order = ccs::HelperTools::GetNativeByteOrder();
 
+  // Create value buffer
+  (void)this->CreateInstance(); 
+
   return; 
 
 }
@@ -394,6 +485,7 @@ AnyValue::AnyValue (const AnyType * const type, void * const instance)
   __type = std::shared_ptr<const AnyType>(type); 
   __instance = static_cast<uint8*>(instance); 
   __allocated = false;
+  __allocator = NULL_PTR_CAST(AnyValueAllocator*);
   __order = ccs::HelperTools::GetNativeByteOrder();
 
   return; 
@@ -407,6 +499,7 @@ AnyValue::AnyValue (const ArrayType& type, void * const instance)
   __type = std::dynamic_pointer_cast<const AnyType>(std::make_shared<const ArrayType>(type)); // shared_ptr from using copy constructor
   __instance = static_cast<uint8*>(instance); 
   __allocated = false;
+  __allocator = NULL_PTR_CAST(AnyValueAllocator*);
   __order = ccs::HelperTools::GetNativeByteOrder();
 
   return; 
@@ -420,6 +513,7 @@ AnyValue::AnyValue (const CompoundType& type, void * const instance)
   __type = std::dynamic_pointer_cast<const AnyType>(std::make_shared<const CompoundType>(type)); // shared_ptr from using copy constructor
   __instance = static_cast<uint8*>(instance); 
   __allocated = false;
+  __allocator = NULL_PTR_CAST(AnyValueAllocator*);
   __order = ccs::HelperTools::GetNativeByteOrder();
 
   return; 
@@ -433,6 +527,7 @@ AnyValue::AnyValue (const ScalarType& type, void * const instance)
   __type = std::dynamic_pointer_cast<const AnyType>(std::make_shared<const ScalarType>(type)); // shared_ptr from using copy constructor
   __instance = static_cast<uint8*>(instance); 
   __allocated = false;
+  __allocator = NULL_PTR_CAST(AnyValueAllocator*);
   __order = ccs::HelperTools::GetNativeByteOrder();
 
   return; 
@@ -446,6 +541,7 @@ AnyValue::AnyValue (const AnyValue& value) // Copy constructor
   __type = value.GetType(); 
   __instance = NULL_PTR_CAST(uint8*); 
   __allocated = false;
+  __allocator = NULL_PTR_CAST(AnyValueAllocator*);
   __order = ccs::HelperTools::GetNativeByteOrder();
 
   // Create value buffer
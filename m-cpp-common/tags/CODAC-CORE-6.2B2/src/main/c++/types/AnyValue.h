@@ -34,6 +34,7 @@
 // Global header files
 
 #include <memory> // std::shared_ptr, etc.
+#include <string> // std::string
 
 // Local header files
 
@@ -47,18 +48,29 @@
 
 #include "AnyTypeHelper.h"
 
+#include "AnyValueAllocator.h"
+
 // Constants
 
+#define ANYVALUE_INLINE_SIZE 16u // Small values are stored within the AnyValue instance
+
 // Type definition
 
 namespace ccs {
 
 namespace types {
 
+class ByteSwapProgram; // Forward class declaration
+
 /**
  * @brief AnyValue associated to introspectable type definition.
  * @detail The class associates a memory buffer to an introspectable
- * type definition. The memory area is allocated upon instantiation.
+ * type definition. The memory area is allocated upon instantiation, from the
+ * default or explicitly provided AnyValueAllocator. Values smaller than
+ * ANYVALUE_INLINE_SIZE are stored within the AnyValue instance.
+ *
+ * @note The inline buffer and allocator reference are part of the class layout
+ * since version 2.0.0, i.e. code compiled against earlier versions must be rebuilt.
  * The class also provides assignment, comparison, and static cast
  * operator overload to basic types.
  *
@@ -80,8 +92,13 @@ class AnyValue
     uint8* __instance;
     bool __allocated;
 
+    AnyValueAllocator* __allocator; // Default allocator if NULL
+    uint64 __buffer [ANYVALUE_INLINE_SIZE / sizeof(uint64)]; // Small buffer
+
     ccs::types::Endianness __order;
 
+    std::shared_ptr<const ByteSwapProgram> __swap; // Byte order conversion program, resolved upon first use
+
     void* CreateInstance (void);
     void DeleteInstance (void);
 
@@ -140,6 +157,16 @@ class AnyValue
 
     AnyValue (const std::shared_ptr<const AnyType>& type, void * const instance);
 
+    /**
+     * @brief Constructor.
+     * @detail Memory is obtained from the allocator and released to it upon
+     * destruction. Copies of this instance use the default allocator.
+     * @param type Introspectable type definition.
+     * @param allocator Allocator, e.g. a per-request ArenaAllocator.
+     */
+
+    AnyValue (const std::shared_ptr<const AnyType>& type, AnyValueAllocator& allocator);
+
     /**
      * @brief Constructor.
      * @detail Memory is not allocated and assumed to be
@@ -217,6 +244,8 @@ class AnyValue
     /**
      * @brief Serialisation method.
      * @detail Parses serialised buffer and provides binary equivalent.
+     * See ccs::HelperTools::ParseJSONInstance, the legacy parser is tried for
+     * buffers which are not well-formed JSON.
      * @param buffer Serialised instance value.
      * @return True if successful.
      */
@@ -225,7 +254,8 @@ class AnyValue
 
     /**
      * @brief Serialisation method.
-     * @detail Serialises type instance to string buffer.
+     * @detail Serialises type instance to string buffer. The serialised
+     * instance is truncated to the size of the buffer.
      * @param buffer Placeholder to receive serialised instance value.
      * @param size Size of string buffer.
      * @return True if successful.
@@ -233,6 +263,16 @@ class AnyValue
 
     bool SerialiseInstance (char8 * const buffer, uint32 size) const;
 
+    /**
+     * @brief Serialisation method.
+     * @detail Serialises type instance, without size limitation.
+     * See ccs::HelperTools::SerialiseJSONInstance.
+     * @param buffer Placeholder to receive serialised instance value.
+     * @return True if successful.
+     */
+
+    bool SerialiseInstance (std::string& buffer) const;
+
     /**
      * @brief Serialisation method.
      * @detail Serialises type definition to string buffer.
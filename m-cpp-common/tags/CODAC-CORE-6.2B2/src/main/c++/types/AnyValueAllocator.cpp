@@ -0,0 +1,273 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/types/AnyValueAllocator.cpp $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Generic type class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                                 CS 90 046
+*                                 13067 St. Paul-lez-Durance Cedex
+*                                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <atomic> // std::atomic
+#include <mutex> // std::mutex, std::lock_guard
+#include <new> // std::nothrow
+#include <vector> // std::vector
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyValueAllocator.h"
+
+// Constants
+
+#undef LOG_ALTERN_SRC
+#define LOG_ALTERN_SRC "ccs::types"
+
+// Type definition
+
+namespace ccs {
+
+namespace types {
+
+// Global variables
+
+static std::atomic<AnyValueAllocator*> __default (NULL_PTR_CAST(AnyValueAllocator*)); // Heap if NULL
+
+// Function declaration
+
+// Function definition
+
+static inline HeapAllocator* GetHeap (void)
+{
+  static HeapAllocator __heap; // Constructed upon first use, irrespective of static initialisation order
+  return &__heap;
+}
+
+AnyValueAllocator::AnyValueAllocator (void) {}
+AnyValueAllocator::~AnyValueAllocator (void) {}
+
+AnyValueAllocator* AnyValueAllocator::GetDefault (void)
+{
+
+  AnyValueAllocator* allocator = __default.load(std::memory_order_acquire);
+
+  if (NULL_PTR_CAST(AnyValueAllocator*) == allocator)
+    {
+      allocator = GetHeap();
+    }
+
+  return allocator;
+
+}
+
+void AnyValueAllocator::SetDefault (AnyValueAllocator * const allocator) { __default.store(allocator, std::memory_order_release); return; }
+
+HeapAllocator::HeapAllocator (void) {}
+HeapAllocator::~HeapAllocator (void) {}
+
+void* HeapAllocator::Allocate (const uint32 size) { return static_cast<void*>(new (std::nothrow) uint8 [size]); }
+void HeapAllocator::Release (void * const ref, const uint32 size) { (void)size; delete [] static_cast<uint8*>(ref); return; }
+
+uint32 PoolAllocator::GetClass (const uint32 size)
+{
+
+  uint32 index = 0u;
+
+  for (uint32 limit = DEFAULT_POOL_MINIMUM_SIZE; ((index < DEFAULT_POOL_CLASS_NUMBER) && (limit < size)); limit *= 2u)
+    {
+      index += 1u;
+    }
+
+  return index; // DEFAULT_POOL_CLASS_NUMBER if too large
+
+}
+
+PoolAllocator::PoolAllocator (const uint32 limit)
+{
+
+  __limit = limit;
+
+  for (uint32 index = 0u; index < DEFAULT_POOL_CLASS_NUMBER; index += 1u)
+    {
+      __free[index].reserve(__limit); // Release never allocates
+    }
+
+  return;
+
+}
+
+PoolAllocator::~PoolAllocator (void)
+{
+
+  for (uint32 index = 0u; index < DEFAULT_POOL_CLASS_NUMBER; index += 1u)
+    {
+      for (std::vector<void*>::iterator it = __free[index].begin(); it != __free[index].end(); ++it)
+        {
+          delete [] static_cast<uint8*>(*it);
+        }
+    }
+
+  return;
+
+}
+
+void* PoolAllocator::Allocate (const uint32 size)
+{
+
+  uint32 index = GetClass(size);
+
+  void* ref = NULL_PTR_CAST(void*);
+
+  if (index < DEFAULT_POOL_CLASS_NUMBER)
+    {
+      std::lock_guard<std::mutex> lock (__mutex);
+
+      if (!__free[index].empty())
+        {
+          ref = __free[index].back();
+          __free[index].pop_back();
+        }
+    }
+
+  if (NULL_PTR_CAST(void*) == ref)
+    {
+      uint32 block = ((index < DEFAULT_POOL_CLASS_NUMBER) ? (DEFAULT_POOL_MINIMUM_SIZE << index) : size);
+      ref = static_cast<void*>(new (std::nothrow) uint8 [block]);
+    }
+
+  return ref;
+
+}
+
+void PoolAllocator::Release (void * const ref, const uint32 size)
+{
+
+  uint32 index = GetClass(size);
+
+  bool cached = false;
+
+  if ((NULL_PTR_CAST(void*) != ref) && (index < DEFAULT_POOL_CLASS_NUMBER))
+    {
+      std::lock_guard<std::mutex> lock (__mutex);
+
+      cached = (__free[index].size() < __limit);
+
+      if (cached)
+        {
+          __free[index].push_back(ref);
+        }
+    }
+
+  if (!cached)
+    {
+      delete [] static_cast<uint8*>(ref);
+    }
+
+  return;
+
+}
+
+ArenaAllocator::Checkpoint::Checkpoint (ArenaAllocator& arena) : __arena (arena), __mark (arena.GetMark()) {}
+ArenaAllocator::Checkpoint::~Checkpoint (void) { __arena.Rewind(__mark); }
+
+ArenaAllocator::ArenaAllocator (void) : __chunks (), __chunk (0u), __offset (0u) {}
+
+ArenaAllocator::~ArenaAllocator (void)
+{
+
+  for (std::vector<Chunk_t>::iterator it = __chunks.begin(); it != __chunks.end(); ++it)
+    {
+      delete [] it->buffer;
+    }
+
+  return;
+
+}
+
+void* ArenaAllocator::Allocate (const uint32 size)
+{
+
+  uint32 offset = (__offset + (DEFAULT_ARENA_ALIGNMENT - 1u)) & ~(DEFAULT_ARENA_ALIGNMENT - 1u);
+
+  // Skip chunks too small for the request, typically after rewinding
+  while ((__chunk < __chunks.size()) && (__chunks[__chunk].size < (offset + size)))
+    {
+      __chunk += 1u;
+      offset = 0u;
+    }
+
+  bool status = (__chunk < __chunks.size());
+
+  if (!status)
+    {
+      Chunk_t chunk;
+
+      chunk.size = ((DEFAULT_ARENA_CHUNK_SIZE < size) ? size : DEFAULT_ARENA_CHUNK_SIZE);
+      chunk.buffer = new (std::nothrow) uint8 [chunk.size];
+
+      status = (NULL_PTR_CAST(uint8*) != chunk.buffer);
+
+      if (status)
+        {
+          log_debug("ArenaAllocator::Allocate - New chunk of size '%u'", chunk.size);
+          __chunks.push_back(chunk);
+          __chunk = static_cast<uint32>(__chunks.size() - 1u);
+          offset = 0u;
+        }
+    }
+
+  void* ref = NULL_PTR_CAST(void*);
+
+  if (status)
+    {
+      ref = static_cast<void*>(__chunks[__chunk].buffer + offset);
+      __offset = offset + size;
+    }
+
+  return ref;
+
+}
+
+void ArenaAllocator::Release (void * const ref, const uint32 size) { (void)ref; (void)size; return; }
+
+ArenaAllocator::Mark_t ArenaAllocator::GetMark (void) const
+{
+
+  Mark_t mark;
+
+  mark.chunk = __chunk;
+  mark.offset = __offset;
+
+  return mark;
+
+}
+
+void ArenaAllocator::Rewind (const Mark_t& mark) { __chunk = mark.chunk; __offset = mark.offset; return; }
+
+void ArenaAllocator::Reset (void) { __chunk = 0u; __offset = 0u; return; }
+
+ArenaAllocator* ArenaAllocator::GetThreadInstance (void)
+{
+  static thread_local ArenaAllocator __arena;
+  return &__arena;
+}
+
+} // namespace types
+
+} // namespace ccs
@@ -0,0 +1,305 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/types/AnyValueAllocator.h $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Generic type class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                                 CS 90 046
+*                                 13067 St. Paul-lez-Durance Cedex
+*                                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+/**
+ * @file AnyValueAllocator.h
+ * @brief Header file for AnyValue instance memory allocators.
+ * @date 01/07/2019
+ * @author Bertrand Bauvir (IO)
+ * @copyright 2010-2019 ITER Organization
+ * @detail This header file contains the definition of the AnyValueAllocator interface
+ * and implementation classes. AnyValue instances obtain their memory from the process-wide
+ * default allocator, unless explicitly constructed with another allocator. The default
+ * allocator is the heap and may be replaced by e.g. a PoolAllocator.
+ *
+ * The ArenaAllocator is intended for values constructed and discarded while handling a
+ * request. Memory is bump-allocated from retained chunks and reclaimed altogether upon
+ * rewinding the arena, i.e. the instance memory of such values does not hit the heap once
+ * the arena has grown to the request working set. Only instance memory is concerned; type
+ * definitions, and values copied from arena-backed values which use the default allocator,
+ * are still allocated from the heap.
+ *
+ * @code
+   ccs::types::ArenaAllocator* arena = ccs::types::ArenaAllocator::GetThreadInstance();
+
+   {
+     // Rewinds the arena upon leaving the scope
+     ccs::types::ArenaAllocator::Checkpoint checkpoint (*arena);
+
+     // WARNING - Arena-backed values must not outlive the checkpoint
+     ccs::types::AnyValue request (type, *arena);
+     ..
+   }
+   @endcode
+ */
+
+#ifndef _AnyValueAllocator_h_
+#define _AnyValueAllocator_h_
+
+// Global header files
+
+#include <mutex> // std::mutex
+#include <vector> // std::vector
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+
+// Constants
+
+#define DEFAULT_POOL_MINIMUM_SIZE 16u // Smallest size class
+#define DEFAULT_POOL_CLASS_NUMBER 13u // Up to 64kB
+#define DEFAULT_POOL_LIMIT 64u // Cached blocks per size class
+
+#define DEFAULT_ARENA_CHUNK_SIZE 65536u
+#define DEFAULT_ARENA_ALIGNMENT 16u
+
+// Type definition
+
+namespace ccs {
+
+namespace types {
+
+/**
+ * @brief Interface class for AnyValue instance memory allocation.
+ */
+
+class AnyValueAllocator
+{
+
+  private:
+
+  protected:
+
+  public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+
+    AnyValueAllocator (void);
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+
+    virtual ~AnyValueAllocator (void);
+
+    /**
+     * @brief Allocation method.
+     * @param size Byte size of the memory area.
+     * @return Memory area, or NULL in case of error.
+     */
+
+    virtual void* Allocate (const uint32 size) = 0;
+
+    /**
+     * @brief Release method.
+     * @param ref Memory area previously allocated.
+     * @param size Byte size of the memory area, as allocated.
+     */
+
+    virtual void Release (void * const ref, const uint32 size) = 0;
+
+    /**
+     * @brief Accessor.
+     * @return Process-wide default allocator.
+     */
+
+    static AnyValueAllocator* GetDefault (void);
+
+    /**
+     * @brief Accessor.
+     * @detail Replaces the process-wide default allocator. The allocator must be safe
+     * for concurrent use and outlive all AnyValue instances allocated from it.
+     * @param allocator Default allocator, the heap if NULL.
+     */
+
+    static void SetDefault (AnyValueAllocator * const allocator);
+
+};
+
+/**
+ * @brief Heap allocator.
+ */
+
+class HeapAllocator : public AnyValueAllocator
+{
+
+  public:
+
+    HeapAllocator (void);
+    virtual ~HeapAllocator (void);
+
+    virtual void* Allocate (const uint32 size); // Specialises virtual method
+    virtual void Release (void * const ref, const uint32 size); // Specialises virtual method
+
+};
+
+/**
+ * @brief Size-classed pool allocator.
+ * @detail Memory areas are rounded up to power of 2 size classes and recycled through
+ * per-class free lists of bounded depth. Areas larger than the largest class are
+ * obtained from the heap. The allocator is safe for concurrent use.
+ */
+
+class PoolAllocator : public AnyValueAllocator
+{
+
+  private:
+
+    std::mutex __mutex;
+    std::vector<void*> __free [DEFAULT_POOL_CLASS_NUMBER];
+
+    uint32 __limit;
+
+    static uint32 GetClass (const uint32 size);
+
+  public:
+
+    /**
+     * @brief Constructor.
+     * @param limit Maximum number of cached memory areas per size class.
+     */
+
+    explicit PoolAllocator (const uint32 limit = DEFAULT_POOL_LIMIT);
+
+    /**
+     * @brief Destructor.
+     * @detail Frees cached memory areas.
+     */
+
+    virtual ~PoolAllocator (void);
+
+    virtual void* Allocate (const uint32 size); // Specialises virtual method
+    virtual void Release (void * const ref, const uint32 size); // Specialises virtual method
+
+};
+
+/**
+ * @brief Arena allocator.
+ * @detail Memory areas are bump-allocated from chunks which are retained upon rewinding.
+ * Release is a NOOP. The allocator is not safe for concurrent use, see GetThreadInstance.
+ */
+
+class ArenaAllocator : public AnyValueAllocator
+{
+
+  private:
+
+    typedef struct Chunk {
+      uint8* buffer;
+      uint32 size;
+    } Chunk_t;
+
+    std::vector<Chunk_t> __chunks;
+
+    uint32 __chunk; // Current chunk
+    uint32 __offset; // Current offset in chunk
+
+  public:
+
+    typedef struct Mark {
+      uint32 chunk;
+      uint32 offset;
+    } Mark_t;
+
+    /**
+     * @brief Rewinds the arena upon destruction.
+     */
+
+    class Checkpoint
+    {
+
+      private:
+
+        ArenaAllocator& __arena;
+        Mark_t __mark;
+
+        Checkpoint (const Checkpoint& checkpoint); // Undefined
+        Checkpoint& operator= (const Checkpoint& checkpoint); // Undefined
+
+      public:
+
+        explicit Checkpoint (ArenaAllocator& arena);
+        ~Checkpoint (void);
+
+    };
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+
+    ArenaAllocator (void);
+
+    /**
+     * @brief Destructor.
+     * @detail Frees all chunks.
+     */
+
+    virtual ~ArenaAllocator (void);
+
+    virtual void* Allocate (const uint32 size); // Specialises virtual method
+    virtual void Release (void * const ref, const uint32 size); // Specialises virtual method, NOOP
+
+    /**
+     * @brief Accessor.
+     * @return Current position in the arena.
+     */
+
+    Mark_t GetMark (void) const;
+
+    /**
+     * @brief Rewind method.
+     * @detail Memory allocated since the mark is reclaimed.
+     * @param mark Position previously obtained through GetMark.
+     */
+
+    void Rewind (const Mark_t& mark);
+
+    /**
+     * @brief Rewind method.
+     * @detail All allocated memory is reclaimed.
+     */
+
+    void Reset (void);
+
+    /**
+     * @brief Accessor.
+     * @return Arena associated to the calling thread.
+     */
+
+    static ArenaAllocator* GetThreadInstance (void);
+
+};
+
+// Global variables
+
+// Function declaration
+
+// Function definition
+
+} // namespace types
+
+} // namespace ccs
+
+#endif // _AnyValueAllocator_h_
+
@@ -0,0 +1,328 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/types/AnyValueBinary.cpp $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Generic type class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                                 CS 90 046
+*                                 13067 St. Paul-lez-Durance Cedex
+*                                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <vector> // std::vector
+
+#include <string.h> // memcpy, strlen, etc.
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+#include "NetTools.h" // Misc. helper functions
+
+//#define LOG_TRACE_ENABLE
+//#undef LOG_TRACE_ENABLE
+//#define LOG_DEBUG_ENABLE
+//#undef LOG_DEBUG_ENABLE
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyType.h"
+
+#include "ArrayType.h"
+#include "CompoundType.h"
+#include "ScalarType.h"
+
+#include "AnyTypeDatabase.h"
+#include "AnyTypeHelper.h"
+#include "AnyValue.h"
+#include "ByteSwapProgram.h"
+
+#include "AnyValueBinary.h"
+
+// Constants
+
+#define MAXIMUM_TYPE_DESCRIPTION 1048576u // 1MB
+
+#undef LOG_ALTERN_SRC
+#define LOG_ALTERN_SRC "ccs::types"
+
+// Type definition
+
+namespace ccs {
+
+namespace HelperTools {
+
+// Global variables
+
+// Function declaration
+
+// Function definition
+
+static inline void PutUInt16 (ccs::types::uint8 * const ref, const ccs::types::uint16 value) { ccs::types::uint16 tmp = ToNetworkByteOrder<ccs::types::uint16>(value); (void)memcpy(ref, &tmp, sizeof(ccs::types::uint16)); }
+static inline void PutUInt32 (ccs::types::uint8 * const ref, const ccs::types::uint32 value) { ccs::types::uint32 tmp = ToNetworkByteOrder<ccs::types::uint32>(value); (void)memcpy(ref, &tmp, sizeof(ccs::types::uint32)); }
+static inline void PutUInt64 (ccs::types::uint8 * const ref, const ccs::types::uint64 value) { ccs::types::uint64 tmp = ToNetworkByteOrder<ccs::types::uint64>(value); (void)memcpy(ref, &tmp, sizeof(ccs::types::uint64)); }
+
+static inline ccs::types::uint16 GetUInt16 (const ccs::types::uint8 * const ref) { ccs::types::uint16 tmp; (void)memcpy(&tmp, ref, sizeof(ccs::types::uint16)); return FromNetworkByteOrder<ccs::types::uint16>(tmp); }
+static inline ccs::types::uint32 GetUInt32 (const ccs::types::uint8 * const ref) { ccs::types::uint32 tmp; (void)memcpy(&tmp, ref, sizeof(ccs::types::uint32)); return FromNetworkByteOrder<ccs::types::uint32>(tmp); }
+static inline ccs::types::uint64 GetUInt64 (const ccs::types::uint8 * const ref) { ccs::types::uint64 tmp; (void)memcpy(&tmp, ref, sizeof(ccs::types::uint64)); return FromNetworkByteOrder<ccs::types::uint64>(tmp); }
+
+static bool SwapInstance (const std::shared_ptr<const ccs::types::AnyType>& type, void * const ref)
+{ // Native to or from network byte order
+
+  std::shared_ptr<const ccs::types::ByteSwapProgram> program = ccs::types::ByteSwapProgram::GetInstance(type);
+
+  bool status = false;
+
+  if (program)
+    {
+      status = program->Execute(ref);
+    }
+  else
+    {
+      status = type->ToNetworkByteOrder(ref);
+    }
+
+  return status;
+
+}
+
+static bool SerialiseTypeDescription (const std::shared_ptr<const ccs::types::AnyType>& type, std::vector<ccs::types::char8>& buffer)
+{
+
+  bool status = false;
+
+  buffer.resize(1024u);
+
+  while (!status && (buffer.size() <= MAXIMUM_TYPE_DESCRIPTION))
+    {
+      ccs::types::uint32 size = static_cast<ccs::types::uint32>(buffer.size());
+
+      status = Serialise(type, &buffer[0], size);
+
+      if (status)
+        { // Output filling the buffer is assumed truncated
+          status = ((strlen(&buffer[0]) + 1u) < size);
+        }
+
+      if (!status)
+        {
+          buffer.resize(2u * buffer.size());
+        }
+    }
+
+  return status;
+
+}
+
+ccs::types::uint64 GetFingerprint (const std::shared_ptr<const ccs::types::AnyType>& type)
+{
+
+  ccs::types::uint64 hash = 0ul;
+
+  if (type)
+    {
+      hash = type->GetFingerprint();
+    }
+
+  return hash;
+
+}
+
+bool SerialiseBinary (const ccs::types::AnyValue& value, std::vector<ccs::types::uint8>& buffer, const bool type, const ccs::types::Endianness order)
+{
+
+  std::shared_ptr<const ccs::types::AnyType> any_type = value.GetType();
+  std::vector<ccs::types::char8> description;
+
+  bool status = (any_type && (NULL_PTR_CAST(void*) != value.GetInstance()) &&
+                 ((GetNativeByteOrder() == order) || (ccs::types::NetworkByteOrder == order)));
+
+  if (status && type)
+    {
+      status = SerialiseTypeDescription(any_type, description);
+    }
+
+  if (status)
+    {
+      ccs::types::uint32 name_length = static_cast<ccs::types::uint32>(strlen(any_type->GetName()) + 1u);
+      ccs::types::uint32 type_length = (type ? static_cast<ccs::types::uint32>(strlen(&description[0]) + 1u) : 0u);
+      ccs::types::uint32 size = value.GetSize();
+
+      std::vector<ccs::types::uint8>::size_type offset = buffer.size();
+      buffer.resize(offset + ANYVALUE_BINARY_HEADER_SIZE + name_length + type_length + size);
+
+      ccs::types::uint8* p_buf = &buffer[offset];
+
+      (void)memcpy(p_buf, ANYVALUE_BINARY_MAGIC, 4u);
+      p_buf[4] = static_cast<ccs::types::uint8>(ANYVALUE_BINARY_VERSION);
+      p_buf[5] = static_cast<ccs::types::uint8>(order);
+      PutUInt16(p_buf + 6u, static_cast<ccs::types::uint16>(type ? ANYVALUE_BINARY_TYPE : 0u));
+      PutUInt32(p_buf + 8u, name_length);
+      PutUInt32(p_buf + 12u, type_length);
+      PutUInt32(p_buf + 16u, size);
+      PutUInt32(p_buf + 20u, 0u);
+      PutUInt64(p_buf + 24u, GetFingerprint(any_type));
+
+      p_buf += ANYVALUE_BINARY_HEADER_SIZE;
+      (void)memcpy(p_buf, any_type->GetName(), name_length); p_buf += name_length;
+
+      if (0u < type_length)
+        {
+          (void)memcpy(p_buf, &description[0], type_length); p_buf += type_length;
+        }
+
+      (void)memcpy(p_buf, value.GetInstance(), size);
+
+      if (GetNativeByteOrder() != order)
+        {
+          status = SwapInstance(any_type, p_buf);
+        }
+
+      if (!status)
+        {
+          buffer.resize(offset);
+        }
+    }
+
+  return status;
+
+}
+
+ccs::types::uint32 ParseBinary (ccs::types::AnyValue& value, const ccs::types::uint8 * const buffer, const ccs::types::uint32 size)
+{
+
+  bool status = ((NULL_PTR_CAST(const ccs::types::uint8*) != buffer) &&
+                 (ANYVALUE_BINARY_HEADER_SIZE <= size));
+
+  if (status)
+    {
+      status = ((0 == memcmp(buffer, ANYVALUE_BINARY_MAGIC, 4u)) &&
+                (ANYVALUE_BINARY_VERSION == buffer[4]));
+    }
+
+  if (!status)
+    {
+      log_error("ParseBinary - Invalid header");
+    }
+
+  ccs::types::Endianness order = ccs::types::NetworkByteOrder;
+  ccs::types::uint32 name_length = 0u;
+  ccs::types::uint32 type_length = 0u;
+  ccs::types::uint32 inst_size = 0u;
+  ccs::types::uint64 fingerprint = 0ul;
+
+  if (status)
+    {
+      order = static_cast<ccs::types::Endianness>(buffer[5]);
+      name_length = GetUInt32(buffer + 8u);
+      type_length = GetUInt32(buffer + 12u);
+      inst_size = GetUInt32(buffer + 16u);
+      fingerprint = GetUInt64(buffer + 24u);
+
+      // Only conversion from network byte order is supported
+      status = ((GetNativeByteOrder() == order) || (ccs::types::NetworkByteOrder == order));
+    }
+
+  if (status)
+    { // 64-bit arithmetics against overflowing lengths
+      status = ((0u < name_length) &&
+                ((static_cast<ccs::types::uint64>(ANYVALUE_BINARY_HEADER_SIZE) + name_length + type_length + inst_size) <= size));
+    }
+
+  const ccs::types::char8* name = NULL_PTR_CAST(const ccs::types::char8*);
+  const ccs::types::char8* description = NULL_PTR_CAST(const ccs::types::char8*);
+  const ccs::types::uint8* instance = NULL_PTR_CAST(const ccs::types::uint8*);
+
+  if (status)
+    {
+      name = reinterpret_cast<const ccs::types::char8*>(buffer + ANYVALUE_BINARY_HEADER_SIZE);
+      description = ((0u < type_length) ? name + name_length : NULL_PTR_CAST(const ccs::types::char8*));
+      instance = buffer + ANYVALUE_BINARY_HEADER_SIZE + name_length + type_length;
+
+      status = ((0 == name[name_length - 1u]) &&
+                ((NULL_PTR_CAST(const ccs::types::char8*) == description) || (0 == description[type_length - 1u])));
+    }
+
+  if (status && static_cast<bool>(value.GetType()))
+    { // Validate against type of the value
+      status = ((GetFingerprint(value.GetType()) == fingerprint) && (value.GetSize() == inst_size));
+
+      if (!status)
+        {
+          log_error("ParseBinary('%s') - Incompatible with '%s'", name, value.GetType()->GetName());
+        }
+    }
+  else if (status)
+    {
+      std::shared_ptr<const ccs::types::AnyType> type;
+
+      if (ccs::types::GlobalTypeDatabase::IsValid(name))
+        { // Validate against registered type
+          std::shared_ptr<const ccs::types::AnyType> registered = ccs::types::GlobalTypeDatabase::GetType(name);
+
+          if (GetFingerprint(registered) == fingerprint)
+            {
+              type = registered;
+            }
+        }
+
+      if (!type && (NULL_PTR_CAST(const ccs::types::char8*) != description))
+        {
+          std::shared_ptr<ccs::types::AnyType> embedded;
+
+          if ((0u < Parse(embedded, description)) && (GetFingerprint(embedded) == fingerprint))
+            {
+              type = embedded;
+            }
+        }
+
+      status = (type && (type->GetSize() == inst_size));
+
+      if (status)
+        {
+          value = ccs::types::AnyValue (type);
+          status = (NULL_PTR_CAST(void*) != value.GetInstance());
+        }
+
+      if (!status)
+        {
+          log_error("ParseBinary('%s') - Unable to resolve type", name);
+        }
+    }
+
+  if (status)
+    {
+      (void)memcpy(value.GetInstance(), instance, inst_size);
+
+      if (GetNativeByteOrder() != order)
+        {
+          status = SwapInstance(value.GetType(), value.GetInstance());
+        }
+    }
+
+  ccs::types::uint32 ret = 0u;
+
+  if (status)
+    {
+      ret = ANYVALUE_BINARY_HEADER_SIZE + name_length + type_length + inst_size;
+    }
+
+  return ret;
+
+}
+
+} // namespace HelperTools
+
+} // namespace ccs
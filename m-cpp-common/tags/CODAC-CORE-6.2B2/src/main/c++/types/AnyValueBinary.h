@@ -0,0 +1,123 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/types/AnyValueBinary.h $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Generic type class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                                 CS 90 046
+*                                 13067 St. Paul-lez-Durance Cedex
+*                                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+/**
+ * @file AnyValueBinary.h
+ * @brief Header file for binary AnyValue serialisation routines.
+ * @date 01/07/2019
+ * @author Bertrand Bauvir (IO)
+ * @copyright 2010-2019 ITER Organization
+ * @detail This header file contains the definition of the binary serialisation routines.
+ * The encoding is a fixed-size header, the type name, the optional JSON type description,
+ * and the raw instance bytes in the declared byte order:
+ *
+ *   offset  size  field
+ *        0     4  magic 'AnyV'
+ *        4     1  version
+ *        5     1  byte order of the instance, i.e. ccs::types::BigEndian or LittleEndian
+ *        6     2  flags, i.e. ANYVALUE_BINARY_TYPE if the type description is embedded
+ *        8     4  name length, including terminating character
+ *       12     4  type description length, including terminating character, 0 if absent
+ *       16     4  instance size
+ *       20     4  reserved
+ *       24     8  structural type fingerprint, see AnyType::GetFingerprint
+ *       32        name, type description, instance
+ *
+ * Header fields are in network byte order.
+ */
+
+#ifndef _AnyValueBinary_h_
+#define _AnyValueBinary_h_
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <vector> // std::vector
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+
+#include "AnyType.h"
+#include "AnyValue.h"
+
+// Constants
+
+#define ANYVALUE_BINARY_MAGIC "AnyV"
+#define ANYVALUE_BINARY_VERSION 2u // Fingerprint includes attribute names
+#define ANYVALUE_BINARY_HEADER_SIZE 32u
+
+#define ANYVALUE_BINARY_TYPE 0x0001u // Embedded type description
+
+// Type definition
+
+// Global variables
+
+// Function declaration
+
+namespace ccs {
+
+namespace HelperTools {
+
+/**
+ * @brief Structural type fingerprint.
+ * @detail Convenience wrapper to AnyType::GetFingerprint.
+ * @return Fingerprint, 0 if invalid type.
+ */
+
+ccs::types::uint64 GetFingerprint (const std::shared_ptr<const ccs::types::AnyType>& type);
+
+/**
+ * @brief Serialise binary instance.
+ * @detail The encoded value is appended to the buffer.
+ * @param value Value to serialise.
+ * @param buffer Growable output buffer.
+ * @param type Embed the type description.
+ * @param order Byte order of the encoded instance, native by default.
+ * @return True if successful.
+ */
+
+bool SerialiseBinary (const ccs::types::AnyValue& value, std::vector<ccs::types::uint8>& buffer, const bool type = false,
+                      const ccs::types::Endianness order = ccs::HelperTools::GetNativeByteOrder());
+
+/**
+ * @brief Parse binary instance.
+ * @detail The encoded instance is converted to native byte order. If the value is typed,
+ * the encoded fingerprint and size are verified against its type. Otherwise, the value is
+ * created with the registered type of the encoded name, provided the fingerprint matches,
+ * or else with the embedded type description.
+ * @param value Value to update, or to create if untyped.
+ * @param buffer Encoded value.
+ * @param size Size of the encoded value.
+ * @return Number of bytes consumed, 0 in case of error.
+ */
+
+ccs::types::uint32 ParseBinary (ccs::types::AnyValue& value, const ccs::types::uint8 * const buffer, const ccs::types::uint32 size);
+
+} // namespace HelperTools
+
+} // namespace ccs
+
+// Function definition
+
+#endif // _AnyValueBinary_h_
+
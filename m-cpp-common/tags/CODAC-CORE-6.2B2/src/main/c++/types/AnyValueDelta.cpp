@@ -0,0 +1,535 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/types/AnyValueDelta.cpp $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Generic type class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                                 CS 90 046
+*                                 13067 St. Paul-lez-Durance Cedex
+*                                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <map> // std::map
+#include <memory> // std::shared_ptr, etc.
+#include <mutex> // std::mutex
+#include <new> // std::nothrow
+#include <vector> // std::vector
+
+#include <string.h> // memcpy, memcmp, etc.
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+#include "NetTools.h" // Misc. helper functions
+
+//#define LOG_TRACE_ENABLE
+//#undef LOG_TRACE_ENABLE
+//#define LOG_DEBUG_ENABLE
+//#undef LOG_DEBUG_ENABLE
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyType.h"
+
+#include "ArrayType.h"
+#include "CompoundType.h"
+#include "ScalarType.h"
+
+#include "AnyValue.h"
+
+#include "AnyValueDelta.h"
+
+// Constants
+
+#undef LOG_ALTERN_SRC
+#define LOG_ALTERN_SRC "ccs::types"
+
+// Type definition
+
+namespace ccs {
+
+namespace types {
+
+typedef struct LeafRun {
+  uint32 offset;
+  uint32 width; // Leaf size
+  uint32 count;
+} LeafRun_t;
+
+typedef struct LeafLayout {
+  std::vector<LeafRun_t> runs;
+} LeafLayout_t;
+
+typedef struct LeafLayoutEntry {
+  std::shared_ptr<const AnyType> type; // Keep key alive
+  std::shared_ptr<const LeafLayout_t> layout;
+} LeafLayoutEntry_t;
+
+// Global variables
+
+static std::mutex __layout_mutex;
+static std::map<const AnyType*, LeafLayoutEntry_t> __layout_cache;
+
+// Function declaration
+
+// Function definition
+
+static inline void PutUInt32 (uint8 * const ref, const uint32 value) { uint32 tmp = ccs::HelperTools::ToNetworkByteOrder<uint32>(value); (void)memcpy(ref, &tmp, sizeof(uint32)); }
+static inline void PutUInt64 (uint8 * const ref, const uint64 value) { uint64 tmp = ccs::HelperTools::ToNetworkByteOrder<uint64>(value); (void)memcpy(ref, &tmp, sizeof(uint64)); }
+
+static inline uint32 GetUInt32 (const uint8 * const ref) { uint32 tmp; (void)memcpy(&tmp, ref, sizeof(uint32)); return ccs::HelperTools::FromNetworkByteOrder<uint32>(tmp); }
+static inline uint64 GetUInt64 (const uint8 * const ref) { uint64 tmp; (void)memcpy(&tmp, ref, sizeof(uint64)); return ccs::HelperTools::FromNetworkByteOrder<uint64>(tmp); }
+
+static inline uint64 LoadWord (const uint8 * const ref) { uint64 tmp; (void)memcpy(&tmp, ref, sizeof(uint64)); return tmp; }
+
+static inline void PutVarint (std::vector<uint8>& buffer, uint32 value)
+{
+
+  while (0x80u <= value)
+    {
+      buffer.push_back(static_cast<uint8>((value & 0x7Fu) | 0x80u));
+      value >>= 7;
+    }
+
+  buffer.push_back(static_cast<uint8>(value));
+
+  return;
+
+}
+
+static inline bool GetVarint (const uint8 * const buffer, const uint32 size, uint32& offset, uint32& value)
+{
+
+  bool status = false;
+
+  value = 0u;
+
+  for (uint32 shift = 0u; (!status && (offset < size) && (shift < 32u)); shift += 7u)
+    {
+      uint8 byte = buffer[offset]; offset += 1u;
+      value |= (static_cast<uint32>(byte & 0x7Fu) << shift);
+      status = (0u == (byte & 0x80u));
+    }
+
+  return status;
+
+}
+
+static void AppendRun (LeafLayout_t& layout, const uint32 offset, const uint32 width, const uint32 count)
+{
+
+  bool merged = false;
+
+  if (!layout.runs.empty())
+    {
+      LeafRun_t& last = layout.runs.back();
+      merged = ((last.width == width) && ((last.offset + last.width * last.count) == offset));
+
+      if (merged)
+        {
+          last.count += count;
+        }
+    }
+
+  if (!merged && (0u < width) && (0u < count))
+    {
+      LeafRun_t run;
+
+      run.offset = offset;
+      run.width = width;
+      run.count = count;
+
+      layout.runs.push_back(run);
+    }
+
+  return;
+
+}
+
+static void CompileLayout (LeafLayout_t& layout, const AnyType * const type, const uint32 offset)
+{
+
+  const ArrayType* array = dynamic_cast<const ArrayType*>(type);
+  const CompoundType* compound = dynamic_cast<const CompoundType*>(type);
+
+  if (NULL_PTR_CAST(const ArrayType*) != array)
+    {
+      std::shared_ptr<const AnyType> base = array->GetElementType();
+
+      if (std::dynamic_pointer_cast<const ScalarType>(base))
+        {
+          AppendRun(layout, offset, base->GetSize(), array->GetMultiplicity());
+        }
+      else if (base)
+        {
+          for (uint32 index = 0u; index < array->GetMultiplicity(); index += 1u)
+            {
+              CompileLayout(layout, base.get(), offset + array->GetElementOffset(index));
+            }
+        }
+    }
+  else if (NULL_PTR_CAST(const CompoundType*) != compound)
+    {
+      for (uint32 index = 0u; index < compound->GetAttributeNumber(); index += 1u)
+        {
+          CompileLayout(layout, compound->GetAttributeType(index).get(), offset + compound->GetAttributeOffset(index));
+        }
+    }
+  else if (NULL_PTR_CAST(const AnyType*) != type)
+    { // Scalar, or opaque type compared as a single leaf
+      AppendRun(layout, offset, type->GetSize(), 1u);
+    }
+
+  return;
+
+}
+
+static std::shared_ptr<const LeafLayout_t> GetLayout (const std::shared_ptr<const AnyType>& type)
+{
+
+  std::shared_ptr<const LeafLayout_t> layout;
+
+  {
+    std::lock_guard<std::mutex> lock (__layout_mutex);
+
+    std::map<const AnyType*, LeafLayoutEntry_t>::const_iterator it = __layout_cache.find(type.get());
+
+    if (__layout_cache.end() != it)
+      {
+        layout = it->second.layout;
+      }
+  }
+
+  if (!layout)
+    {
+      std::shared_ptr<LeafLayout_t> created (new (std::nothrow) LeafLayout_t);
+
+      if (created)
+        {
+          CompileLayout(*created, type.get(), 0u);
+          log_debug("GetLayout - Compiled '%u' runs for '%s'", static_cast<uint32>(created->runs.size()), type->GetName());
+        }
+
+      layout = created;
+
+      LeafLayoutEntry_t entry;
+
+      entry.type = type;
+      entry.layout = layout;
+
+      std::lock_guard<std::mutex> lock (__layout_mutex);
+
+      if (DEFAULT_DELTA_CACHE_SIZE <= __layout_cache.size())
+        {
+          log_debug("GetLayout - Flush cache");
+          __layout_cache.clear();
+        }
+
+      __layout_cache[type.get()] = entry;
+    }
+
+  return layout;
+
+}
+
+static bool DiffRun (const uint8 * const previous, const uint8 * const current, const LeafRun_t& run, AnyValueDelta& delta)
+{
+
+  const uint8* p_prev = previous + run.offset;
+  const uint8* p_curr = current + run.offset;
+
+  uint32 size = run.width * run.count;
+  uint32 pos = 0u;
+
+  bool status = true;
+
+  while (status && (pos < size))
+    {
+      if (((pos + sizeof(uint64)) <= size) && (LoadWord(p_prev + pos) == LoadWord(p_curr + pos)))
+        { // Skip identical words
+          pos += sizeof(uint64);
+        }
+      else if (p_prev[pos] == p_curr[pos])
+        {
+          pos += 1u;
+        }
+      else
+        { // Widen to whole leaves
+          uint32 begin = pos - (pos % run.width);
+          uint32 end = begin + run.width;
+
+          while ((end < size) && (0 != memcmp(p_prev + end, p_curr + end, run.width)))
+            {
+              end += run.width;
+            }
+
+          status = delta.Append(run.offset + begin, end - begin, p_curr + begin);
+          pos = end;
+        }
+    }
+
+  return status;
+
+}
+
+AnyValueDelta::AnyValueDelta (void) : __fingerprint(0ul), __size(0u) {}
+
+AnyValueDelta::~AnyValueDelta (void) {}
+
+void AnyValueDelta::Reset (const uint64 fingerprint, const uint32 size)
+{
+
+  __fingerprint = fingerprint;
+  __size = size;
+
+  __ranges.clear();
+  __data.clear();
+
+  return;
+
+}
+
+bool AnyValueDelta::Append (const uint32 offset, const uint32 size, const void * const ref)
+{
+
+  uint32 end = 0u;
+
+  if (!__ranges.empty())
+    {
+      end = __ranges.back().offset + __ranges.back().size;
+    }
+
+  bool status = ((NULL_PTR_CAST(const void*) != ref) && (0u < size) && (end <= offset) &&
+                 ((static_cast<uint64>(offset) + size) <= __size));
+
+  if (status)
+    {
+      if (!__ranges.empty() && (end == offset))
+        {
+          __ranges.back().size += size;
+        }
+      else
+        {
+          Range_t range;
+
+          range.offset = offset;
+          range.size = size;
+
+          __ranges.push_back(range);
+        }
+
+      const uint8* p_ref = static_cast<const uint8*>(ref);
+      __data.insert(__data.end(), p_ref, p_ref + size);
+    }
+
+  return status;
+
+}
+
+bool AnyValueDelta::IsEmpty (void) const { return __ranges.empty(); }
+
+uint64 AnyValueDelta::GetFingerprint (void) const { return __fingerprint; }
+
+uint32 AnyValueDelta::GetSize (void) const { return __size; }
+
+const std::vector<AnyValueDelta::Range_t>& AnyValueDelta::GetRanges (void) const { return __ranges; }
+
+const std::vector<uint8>& AnyValueDelta::GetData (void) const { return __data; }
+
+bool AnyValueDelta::Apply (void * const ref, const uint32 size) const
+{
+
+  bool status = ((NULL_PTR_CAST(void*) != ref) && (__size == size));
+
+  if (status)
+    {
+      const uint8* p_data = (__data.empty() ? NULL_PTR_CAST(const uint8*) : &__data[0]);
+
+      for (std::vector<Range_t>::const_iterator it = __ranges.begin(); it != __ranges.end(); ++it)
+        {
+          (void)memcpy(static_cast<uint8*>(ref) + it->offset, p_data, it->size);
+          p_data += it->size;
+        }
+    }
+
+  return status;
+
+}
+
+bool AnyValueDelta::Serialise (std::vector<uint8>& buffer) const
+{
+
+  std::vector<uint8>::size_type offset = buffer.size();
+  buffer.resize(offset + ANYVALUE_DELTA_HEADER_SIZE);
+
+  uint8* p_buf = &buffer[offset];
+
+  (void)memcpy(p_buf, ANYVALUE_DELTA_MAGIC, 4u);
+  p_buf[4] = static_cast<uint8>(ANYVALUE_DELTA_VERSION);
+  p_buf[5] = static_cast<uint8>(ccs::HelperTools::GetNativeByteOrder());
+  p_buf[6] = 0u;
+  p_buf[7] = 0u;
+  PutUInt64(p_buf + 8u, __fingerprint);
+  PutUInt32(p_buf + 16u, __size);
+  PutUInt32(p_buf + 20u, static_cast<uint32>(__ranges.size()));
+
+  buffer.reserve(buffer.size() + 2u * __ranges.size() + __data.size());
+
+  uint32 end = 0u;
+  std::vector<uint8>::const_iterator data = __data.begin();
+
+  for (std::vector<Range_t>::const_iterator it = __ranges.begin(); it != __ranges.end(); ++it)
+    {
+      PutVarint(buffer, it->offset - end);
+      PutVarint(buffer, it->size);
+      buffer.insert(buffer.end(), data, data + it->size);
+
+      end = it->offset + it->size;
+      data += it->size;
+    }
+
+  return true;
+
+}
+
+uint32 AnyValueDelta::Parse (const uint8 * const buffer, const uint32 size)
+{
+
+  bool status = ((NULL_PTR_CAST(const uint8*) != buffer) &&
+                 (ANYVALUE_DELTA_HEADER_SIZE <= size));
+
+  if (status)
+    {
+      status = ((0 == memcmp(buffer, ANYVALUE_DELTA_MAGIC, 4u)) &&
+                (ANYVALUE_DELTA_VERSION == buffer[4]) &&
+                (ccs::HelperTools::GetNativeByteOrder() == static_cast<Endianness>(buffer[5])));
+    }
+
+  uint32 number = 0u;
+  uint32 offset = ANYVALUE_DELTA_HEADER_SIZE;
+
+  if (status)
+    {
+      this->Reset(GetUInt64(buffer + 8u), GetUInt32(buffer + 16u));
+      number = GetUInt32(buffer + 20u);
+    }
+
+  uint32 end = 0u;
+
+  for (uint32 index = 0u; (status && (index < number)); index += 1u)
+    {
+      uint32 gap = 0u;
+      uint32 length = 0u;
+
+      status = (GetVarint(buffer, size, offset, gap) &&
+                GetVarint(buffer, size, offset, length));
+
+      if (status)
+        { // 64-bit arithmetics against overflowing lengths
+          status = (((static_cast<uint64>(offset) + length) <= size) &&
+                    ((static_cast<uint64>(end) + gap) <= __size));
+        }
+
+      if (status)
+        {
+          status = this->Append(end + gap, length, buffer + offset);
+        }
+
+      if (status)
+        {
+          end += gap + length;
+          offset += length;
+        }
+    }
+
+  if (!status)
+    {
+      log_error("AnyValueDelta::Parse - Invalid delta");
+      this->Reset(0ul, 0u);
+    }
+
+  return (status ? offset : 0u);
+
+}
+
+} // namespace types
+
+namespace HelperTools {
+
+bool Diff (const ccs::types::AnyValue& previous, const ccs::types::AnyValue& current, ccs::types::AnyValueDelta& delta)
+{
+
+  std::shared_ptr<const ccs::types::AnyType> type = current.GetType();
+  std::shared_ptr<const ccs::types::LeafLayout_t> layout;
+
+  bool status = (type && (NULL_PTR_CAST(void*) != previous.GetInstance()) && (NULL_PTR_CAST(void*) != current.GetInstance()));
+
+  if (status)
+    {
+      std::shared_ptr<const ccs::types::AnyType> other = previous.GetType();
+      status = ((type == other) || (other && (type->GetFingerprint() == other->GetFingerprint()) && (type->GetSize() == other->GetSize())));
+    }
+
+  if (status)
+    {
+      delta.Reset(type->GetFingerprint(), type->GetSize());
+      layout = ccs::types::GetLayout(type);
+      status = static_cast<bool>(layout);
+    }
+
+  if (status)
+    {
+      const ccs::types::uint8* p_prev = static_cast<const ccs::types::uint8*>(previous.GetInstance());
+      const ccs::types::uint8* p_curr = static_cast<const ccs::types::uint8*>(current.GetInstance());
+
+      for (std::vector<ccs::types::LeafRun_t>::const_iterator it = layout->runs.begin(); (status && (it != layout->runs.end())); ++it)
+        {
+          status = ccs::types::DiffRun(p_prev, p_curr, *it, delta);
+        }
+    }
+
+  if (!status)
+    {
+      log_error("Diff - Incompatible values");
+    }
+
+  return status;
+
+}
+
+bool Patch (ccs::types::AnyValue& value, const ccs::types::AnyValueDelta& delta)
+{
+
+  std::shared_ptr<const ccs::types::AnyType> type = value.GetType();
+
+  bool status = (type && (type->GetFingerprint() == delta.GetFingerprint()));
+
+  if (status)
+    {
+      status = delta.Apply(value.GetInstance(), value.GetSize());
+    }
+
+  if (!status)
+    {
+      log_error("Patch - Incompatible delta");
+    }
+
+  return status;
+
+}
+
+} // namespace HelperTools
+
+} // namespace ccs
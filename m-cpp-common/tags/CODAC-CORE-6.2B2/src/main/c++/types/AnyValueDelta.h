@@ -0,0 +1,248 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/types/AnyValueDelta.h $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Generic type class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                                 CS 90 046
+*                                 13067 St. Paul-lez-Durance Cedex
+*                                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+/**
+ * @file AnyValueDelta.h
+ * @brief Header file for AnyValue structural diff and patch routines.
+ * @date 01/07/2019
+ * @author Bertrand Bauvir (IO)
+ * @copyright 2010-2019 ITER Organization
+ * @detail This header file contains the definition of the AnyValueDelta class and the
+ * diff and patch routines. A delta is the ordered list of changed leaf ranges between two
+ * values of the same type, along with the new content of these ranges.
+ *
+ * The serialised delta is a fixed-size header followed by the ranges, each encoded as the
+ * gap from the end of the previous range and the range size, both as unsigned LEB128, and
+ * the range content:
+ *
+ *   offset  size  field
+ *        0     4  magic 'AnyD'
+ *        4     1  version
+ *        5     1  byte order of the content, i.e. ccs::types::BigEndian or LittleEndian
+ *        6     2  reserved
+ *        8     8  structural type fingerprint
+ *       16     4  instance size
+ *       20     4  number of ranges
+ *       24        ranges
+ *
+ * Header fields are in network byte order. The content is in native byte order and only
+ * applies to hosts of the same byte order.
+ *
+ * @code
+   ccs::types::AnyValueDelta delta;
+
+   bool status = ccs::HelperTools::Diff(previous, current, delta);
+
+   if (status && !delta.IsEmpty())
+     {
+       std::vector<ccs::types::uint8> buffer;
+       status = delta.Serialise(buffer);
+       ...
+     }
+
+   // Remote end
+   if (0u < delta.Parse(&buffer[0], static_cast<ccs::types::uint32>(buffer.size())))
+     {
+       status = ccs::HelperTools::Patch(value, delta);
+     }
+   @endcode
+ */
+
+#ifndef _AnyValueDelta_h_
+#define _AnyValueDelta_h_
+
+// Global header files
+
+#include <vector> // std::vector
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+
+#include "AnyType.h"
+#include "AnyValue.h"
+
+// Constants
+
+#define ANYVALUE_DELTA_MAGIC "AnyD"
+#define ANYVALUE_DELTA_VERSION 1u
+#define ANYVALUE_DELTA_HEADER_SIZE 24u
+
+#define DEFAULT_DELTA_CACHE_SIZE 256u // Types
+
+// Type definition
+
+namespace ccs {
+
+namespace types {
+
+/**
+ * @brief Set of changed ranges within instances of a type.
+ */
+
+class AnyValueDelta
+{
+
+  public:
+
+    typedef struct Range {
+
+      uint32 offset;
+      uint32 size;
+
+    } Range_t;
+
+  private:
+
+    uint64 __fingerprint;
+    uint32 __size; // Instance size
+
+    std::vector<Range_t> __ranges;
+    std::vector<uint8> __data; // Range content, contiguous
+
+  protected:
+
+  public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+
+    AnyValueDelta (void);
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+
+    virtual ~AnyValueDelta (void);
+
+    /**
+     * @brief Reset method.
+     * @detail Clears the ranges and associates the delta to a type.
+     * @param fingerprint Structural type fingerprint.
+     * @param size Instance size.
+     */
+
+    void Reset (const uint64 fingerprint, const uint32 size);
+
+    /**
+     * @brief Append method.
+     * @detail Ranges must be appended in ascending order and without overlap, adjacent
+     * ranges are merged.
+     * @param offset Range offset within the instance.
+     * @param size Range size.
+     * @param ref Range content.
+     * @return True if successful.
+     */
+
+    bool Append (const uint32 offset, const uint32 size, const void * const ref);
+
+    /**
+     * @brief Accessor.
+     * @return True if no range changed.
+     */
+
+    bool IsEmpty (void) const;
+
+    /**
+     * @brief Accessor.
+     * @return Structural type fingerprint, resp. instance size.
+     */
+
+    uint64 GetFingerprint (void) const;
+    uint32 GetSize (void) const;
+
+    /**
+     * @brief Accessor.
+     * @return Changed ranges, resp. their content.
+     */
+
+    const std::vector<Range_t>& GetRanges (void) const;
+    const std::vector<uint8>& GetData (void) const;
+
+    /**
+     * @brief Apply method.
+     * @detail Copies the range content into the instance.
+     * @param ref Instance of the type the delta relates to.
+     * @param size Size of the instance.
+     * @return True if successful.
+     */
+
+    bool Apply (void * const ref, const uint32 size) const;
+
+    /**
+     * @brief Serialise method.
+     * @detail The encoded delta is appended to the buffer.
+     * @return True if successful.
+     */
+
+    bool Serialise (std::vector<uint8>& buffer) const;
+
+    /**
+     * @brief Parse method.
+     * @param buffer Encoded delta.
+     * @param size Size of the encoded delta.
+     * @return Number of bytes consumed, 0 in case of error.
+     */
+
+    uint32 Parse (const uint8 * const buffer, const uint32 size);
+
+};
+
+} // namespace types
+
+// Global variables
+
+// Function declaration
+
+namespace HelperTools {
+
+/**
+ * @brief Structural diff.
+ * @detail Compares the values over the leaf layout of their type, i.e. the runs of
+ * contiguous scalars, compiled upon first request and cached thereafter. Runs are
+ * compared word-wise and differences widened to whole scalars. A string is a single leaf.
+ * @param previous Reference value.
+ * @param current Value of the same type.
+ * @param delta Changed ranges with the content of the current value.
+ * @return True if successful, false if the values are not of the same type.
+ */
+
+bool Diff (const ccs::types::AnyValue& previous, const ccs::types::AnyValue& current, ccs::types::AnyValueDelta& delta);
+
+/**
+ * @brief Structural patch.
+ * @detail The fingerprint and size recorded in the delta are verified against the type of
+ * the value.
+ * @param value Value to update.
+ * @param delta Changed ranges.
+ * @return True if successful.
+ */
+
+bool Patch (ccs::types::AnyValue& value, const ccs::types::AnyValueDelta& delta);
+
+} // namespace HelperTools
+
+} // namespace ccs
+
+// Function definition
+
+#endif // _AnyValueDelta_h_
@@ -90,6 +90,8 @@ static inline std::shared_ptr<const ccs::types::AnyType> GetAttributeType (const
  *   ccs::types::int64, ccs::types::uint64
  *   ccs::types::float32, ccs::types::float64
  *
+ * @note The path and type are checked at every call, see ccs::types::TypedView for repeated
+ * access to the same attributes.
  * @param value Instance of variable with introspectable data type definition.
  * @param name Path within type definition.
  * @param attr Reference to external variable.
@@ -150,6 +152,8 @@ static inline bool GetAttributeValue (const ccs::types::AnyValue * const value,
  *   ccs::types::int64, ccs::types::uint64
  *   ccs::types::float32, ccs::types::float64
  *
+ * @note The path and type are checked at every call, see ccs::types::TypedView for repeated
+ * access to the same attributes.
  * @param value Instance of variable with introspectable data type definition.
  * @param name Path within type definition.
  * @param attr Reference to external variable.
@@ -0,0 +1,1003 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/types/AnyValueJSON.cpp $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Generic type class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                                 CS 90 046
+*                                 13067 St. Paul-lez-Durance Cedex
+*                                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <string> // std::string
+#include <vector> // std::vector
+
+#include <stdio.h> // snprintf, etc.
+#include <stdlib.h> // strtod, strtoll, etc.
+#include <string.h> // memcpy, strncmp, etc.
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+
+//#define LOG_TRACE_ENABLE
+//#undef LOG_TRACE_ENABLE
+//#define LOG_DEBUG_ENABLE
+//#undef LOG_DEBUG_ENABLE
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyType.h"
+
+#include "ArrayType.h"
+#include "CompoundType.h"
+#include "ScalarType.h"
+
+#include "AnyValueJSON.h"
+
+// Constants
+
+#undef LOG_ALTERN_SRC
+#define LOG_ALTERN_SRC "ccs::types"
+
+// Type definition
+
+namespace ccs {
+
+namespace HelperTools {
+
+typedef enum JSONScalarKind {
+
+  JSONBoolean = 0,
+  JSONChar8,
+  JSONSigned,
+  JSONUnsigned,
+  JSONFloat32,
+  JSONFloat64,
+  JSONString,
+  JSONOpaque // Undefined scalar type, i.e. hexadecimal literal
+
+} JSONScalarKind_t;
+
+// Global variables
+
+// Function declaration
+
+static bool ParseValue (const ccs::types::AnyType * const type, ccs::types::uint8 * const ref, const ccs::types::char8 *& p_buf);
+static bool SerialiseValue (const ccs::types::AnyType * const type, const ccs::types::uint8 * const ref, std::string& buffer);
+
+// Function definition
+
+static JSONScalarKind_t GetScalarKind (const ccs::types::AnyType * const type)
+{
+
+  JSONScalarKind_t kind = JSONOpaque;
+
+  if (static_cast<const ccs::types::AnyType*>(ccs::types::Boolean.get()) == type) { kind = JSONBoolean; }
+  else if (static_cast<const ccs::types::AnyType*>(ccs::types::Character8.get()) == type) { kind = JSONChar8; }
+  else if ((static_cast<const ccs::types::AnyType*>(ccs::types::SignedInteger8.get()) == type) ||
+           (static_cast<const ccs::types::AnyType*>(ccs::types::SignedInteger16.get()) == type) ||
+           (static_cast<const ccs::types::AnyType*>(ccs::types::SignedInteger32.get()) == type) ||
+           (static_cast<const ccs::types::AnyType*>(ccs::types::SignedInteger64.get()) == type)) { kind = JSONSigned; }
+  else if ((static_cast<const ccs::types::AnyType*>(ccs::types::UnsignedInteger8.get()) == type) ||
+           (static_cast<const ccs::types::AnyType*>(ccs::types::UnsignedInteger16.get()) == type) ||
+           (static_cast<const ccs::types::AnyType*>(ccs::types::UnsignedInteger32.get()) == type) ||
+           (static_cast<const ccs::types::AnyType*>(ccs::types::UnsignedInteger64.get()) == type)) { kind = JSONUnsigned; }
+  else if (static_cast<const ccs::types::AnyType*>(ccs::types::Float32.get()) == type) { kind = JSONFloat32; }
+  else if (static_cast<const ccs::types::AnyType*>(ccs::types::Float64.get()) == type) { kind = JSONFloat64; }
+  else if (static_cast<const ccs::types::AnyType*>(ccs::types::String.get()) == type) { kind = JSONString; }
+
+  return kind;
+
+}
+
+static inline void SkipWhitespace (const ccs::types::char8 *& p_buf)
+{
+  while ((' ' == *p_buf) || ('\t' == *p_buf) || ('\n' == *p_buf) || ('\r' == *p_buf)) { p_buf++; }
+}
+
+static inline bool IsDelimiter (const ccs::types::char8 c)
+{
+  return ((0 == c) || (',' == c) || ('}' == c) || (']' == c) || (' ' == c) || ('\t' == c) || ('\n' == c) || ('\r' == c));
+}
+
+static inline void StoreInteger (ccs::types::uint8 * const ref, const ccs::types::uint32 size, const ccs::types::uint64 value)
+{
+
+  if (1u == size)
+    {
+      ccs::types::uint8 tmp = static_cast<ccs::types::uint8>(value); (void)memcpy(ref, &tmp, size);
+    }
+  else if (2u == size)
+    {
+      ccs::types::uint16 tmp = static_cast<ccs::types::uint16>(value); (void)memcpy(ref, &tmp, size);
+    }
+  else if (4u == size)
+    {
+      ccs::types::uint32 tmp = static_cast<ccs::types::uint32>(value); (void)memcpy(ref, &tmp, size);
+    }
+  else if (8u == size)
+    {
+      (void)memcpy(ref, &value, size);
+    }
+
+  return;
+
+}
+
+static inline ccs::types::uint64 LoadInteger (const ccs::types::uint8 * const ref, const ccs::types::uint32 size, const bool sign)
+{
+
+  ccs::types::uint64 value = 0ul;
+
+  if (1u == size)
+    {
+      ccs::types::uint8 tmp; (void)memcpy(&tmp, ref, size);
+      value = (sign ? static_cast<ccs::types::uint64>(static_cast<ccs::types::int8>(tmp)) : tmp);
+    }
+  else if (2u == size)
+    {
+      ccs::types::uint16 tmp; (void)memcpy(&tmp, ref, size);
+      value = (sign ? static_cast<ccs::types::uint64>(static_cast<ccs::types::int16>(tmp)) : tmp);
+    }
+  else if (4u == size)
+    {
+      ccs::types::uint32 tmp; (void)memcpy(&tmp, ref, size);
+      value = (sign ? static_cast<ccs::types::uint64>(static_cast<ccs::types::int32>(tmp)) : tmp);
+    }
+  else if (8u == size)
+    {
+      (void)memcpy(&value, ref, size);
+    }
+
+  return value;
+
+}
+
+static void AppendUTF8 (ccs::types::char8 * const dst, ccs::types::uint32& length, const ccs::types::uint32 size, const ccs::types::uint32 code, const bool raw)
+{
+
+  ccs::types::char8 tmp [4];
+  ccs::types::uint32 count = 0u;
+
+  if (raw || (code < 0x80u)) // Raw bytes copied verbatim
+    {
+      tmp[count++] = static_cast<ccs::types::char8>(code);
+    }
+  else if (code < 0x800u)
+    {
+      tmp[count++] = static_cast<ccs::types::char8>(0xC0u | (code >> 6));
+      tmp[count++] = static_cast<ccs::types::char8>(0x80u | (code & 0x3Fu));
+    }
+  else
+    {
+      tmp[count++] = static_cast<ccs::types::char8>(0xE0u | (code >> 12));
+      tmp[count++] = static_cast<ccs::types::char8>(0x80u | ((code >> 6) & 0x3Fu));
+      tmp[count++] = static_cast<ccs::types::char8>(0x80u | (code & 0x3Fu));
+    }
+
+  for (ccs::types::uint32 index = 0u; index < count; index += 1u)
+    {
+      if ((NULL_PTR_CAST(ccs::types::char8*) != dst) && ((length + 1u) < size))
+        {
+          dst[length] = tmp[index];
+        }
+
+      length += 1u;
+    }
+
+  return;
+
+}
+
+static bool ParseString (const ccs::types::char8 *& p_buf, ccs::types::char8 * const dst, const ccs::types::uint32 size, ccs::types::uint32& length)
+{ // p_buf points to opening quote, the string is truncated to size and zero-terminated
+
+  bool status = ('"' == *p_buf);
+
+  length = 0u;
+
+  if (status)
+    {
+      p_buf++;
+    }
+
+  while (status && ('"' != *p_buf))
+    {
+      ccs::types::uint32 code = static_cast<ccs::types::uint8>(*p_buf);
+      bool raw = true;
+
+      status = (0 != *p_buf);
+
+      if (status && ('\\' == *p_buf))
+        {
+          p_buf++;
+
+          switch (*p_buf)
+            {
+              case '"': code = '"'; break;
+              case '\\': code = '\\'; break;
+              case '/': code = '/'; break;
+              case 'b': code = '\b'; break;
+              case 'f': code = '\f'; break;
+              case 'n': code = '\n'; break;
+              case 'r': code = '\r'; break;
+              case 't': code = '\t'; break;
+              case 'u':
+                {
+                  ccs::types::char8 hex [5] = { 0, 0, 0, 0, 0 };
+                  status = (0 != p_buf[1]) && (0 != p_buf[2]) && (0 != p_buf[3]) && (0 != p_buf[4]);
+
+                  if (status)
+                    {
+                      (void)memcpy(hex, p_buf + 1, 4u);
+                      code = static_cast<ccs::types::uint32>(strtoul(hex, NULL_PTR_CAST(ccs::types::char8**), 16));
+                      raw = false;
+                      p_buf += 4;
+                    }
+                }
+                break;
+              default: status = false; break;
+            }
+        }
+
+      if (status)
+        {
+          AppendUTF8(dst, length, size, code, raw);
+          p_buf++;
+        }
+    }
+
+  if (status)
+    {
+      p_buf++; // Closing quote
+    }
+
+  if (status && (NULL_PTR_CAST(ccs::types::char8*) != dst) && (0u < size))
+    {
+      dst[((length < size) ? length : (size - 1u))] = 0;
+    }
+
+  return status;
+
+}
+
+static bool SkipValue (const ccs::types::char8 *& p_buf)
+{
+
+  SkipWhitespace(p_buf);
+
+  bool status = (0 != *p_buf);
+
+  if (status && ('"' == *p_buf))
+    {
+      ccs::types::uint32 length = 0u;
+      status = ParseString(p_buf, NULL_PTR_CAST(ccs::types::char8*), 0u, length);
+    }
+  else if (status && (('{' == *p_buf) || ('[' == *p_buf)))
+    {
+      ccs::types::uint32 depth = 0u;
+
+      do
+        {
+          if ('"' == *p_buf)
+            {
+              ccs::types::uint32 length = 0u;
+              status = ParseString(p_buf, NULL_PTR_CAST(ccs::types::char8*), 0u, length);
+            }
+          else
+            {
+              if (('{' == *p_buf) || ('[' == *p_buf)) { depth += 1u; }
+              if (('}' == *p_buf) || (']' == *p_buf)) { depth -= 1u; }
+
+              status = (0 != *p_buf);
+
+              if (status)
+                {
+                  p_buf++;
+                }
+            }
+        }
+      while (status && (0u < depth));
+    }
+  else if (status)
+    {
+      const ccs::types::char8 * p_start = p_buf;
+      while (!IsDelimiter(*p_buf)) { p_buf++; }
+      status = (p_start != p_buf);
+    }
+
+  return status;
+
+}
+
+static bool ParseScalar (const JSONScalarKind_t kind, const ccs::types::uint32 size, ccs::types::uint8 * const ref, const ccs::types::char8 *& p_buf)
+{
+
+  bool status = true;
+
+  if ((JSONBoolean == kind) && (0 == strncmp(p_buf, "false", 5)))
+    {
+      *(reinterpret_cast<ccs::types::boolean*>(ref)) = false; p_buf += 5;
+    }
+  else if ((JSONBoolean == kind) && (0 == strncmp(p_buf, "true", 4)))
+    {
+      *(reinterpret_cast<ccs::types::boolean*>(ref)) = true; p_buf += 4;
+    }
+  else if ((JSONBoolean == kind) && (('0' == *p_buf) || ('1' == *p_buf)))
+    {
+      *(reinterpret_cast<ccs::types::boolean*>(ref)) = ('1' == *p_buf); p_buf += 1;
+    }
+  else if (JSONBoolean == kind)
+    {
+      status = false;
+    }
+  else if ((JSONString != kind) && (0 == strncmp(p_buf, "0x", 2))) // Hexadecimal literal, also raw floating-point representation
+    {
+      ccs::types::char8* p_end = NULL_PTR_CAST(ccs::types::char8*);
+      ccs::types::uint64 value = strtoull(p_buf + 2, &p_end, 16);
+
+      status = ((p_buf + 2) != p_end);
+
+      if (status)
+        {
+          StoreInteger(ref, size, value);
+          p_buf = p_end;
+        }
+    }
+  else if (JSONChar8 == kind)
+    {
+      ccs::types::char8 tmp [2] = { 0, 0 };
+      ccs::types::uint32 length = 0u;
+
+      status = ParseString(p_buf, tmp, 2u, length);
+
+      if (status)
+        {
+          *(reinterpret_cast<ccs::types::char8*>(ref)) = tmp[0];
+        }
+    }
+  else if ((JSONSigned == kind) || (JSONUnsigned == kind))
+    {
+      ccs::types::char8* p_end = NULL_PTR_CAST(ccs::types::char8*);
+      ccs::types::uint64 value = ((JSONSigned == kind) ? static_cast<ccs::types::uint64>(strtoll(p_buf, &p_end, 10)) : strtoull(p_buf, &p_end, 10));
+
+      status = (p_buf != p_end);
+
+      if (status)
+        {
+          StoreInteger(ref, size, value);
+          p_buf = p_end;
+        }
+    }
+  else if (JSONFloat32 == kind)
+    {
+      ccs::types::char8* p_end = NULL_PTR_CAST(ccs::types::char8*);
+      ccs::types::float32 value = strtof(p_buf, &p_end);
+
+      status = (p_buf != p_end);
+
+      if (status)
+        {
+          (void)memcpy(ref, &value, sizeof(ccs::types::float32));
+          p_buf = p_end;
+        }
+    }
+  else if (JSONFloat64 == kind)
+    {
+      ccs::types::char8* p_end = NULL_PTR_CAST(ccs::types::char8*);
+      ccs::types::float64 value = strtod(p_buf, &p_end);
+
+      status = (p_buf != p_end);
+
+      if (status)
+        {
+          (void)memcpy(ref, &value, sizeof(ccs::types::float64));
+          p_buf = p_end;
+        }
+    }
+  else if ((JSONString == kind) && ('"' == *p_buf))
+    {
+      ccs::types::uint32 length = 0u;
+      status = ParseString(p_buf, reinterpret_cast<ccs::types::char8*>(ref), size, length);
+    }
+  else if (JSONString == kind) // Unquoted token
+    {
+      ccs::types::uint32 length = 0u;
+
+      while (!IsDelimiter(*p_buf))
+        {
+          if ((length + 1u) < size)
+            {
+              ref[length] = static_cast<ccs::types::uint8>(*p_buf);
+            }
+
+          length += 1u; p_buf++;
+        }
+
+      status = ((0u < length) && (0u < size));
+
+      if (status)
+        {
+          ref[((length < size) ? length : (size - 1u))] = 0u;
+        }
+    }
+  else // Undefined scalar type requires hexadecimal literal
+    {
+      status = false;
+    }
+
+  return status;
+
+}
+
+static bool ParseArray (const ccs::types::ArrayType * const type, ccs::types::uint8 * const ref, const ccs::types::char8 *& p_buf)
+{
+
+  std::shared_ptr<const ccs::types::AnyType> base = type->GetElementType();
+
+  bool status = static_cast<bool>(base);
+
+  if (status && (ccs::types::Character8 == base) && ('"' == *p_buf)) // Treat as string
+    {
+      ccs::types::uint32 length = 0u;
+      return ParseString(p_buf, reinterpret_cast<ccs::types::char8*>(ref), type->GetSize(), length);
+    }
+
+  const ccs::types::ScalarType* scalar = NULL_PTR_CAST(const ccs::types::ScalarType*);
+  JSONScalarKind_t kind = JSONOpaque;
+  ccs::types::uint32 size = 0u;
+
+  if (status)
+    {
+      scalar = dynamic_cast<const ccs::types::ScalarType*>(base.get());
+      kind = GetScalarKind(base.get());
+      size = base->GetSize();
+      status = ('[' == *p_buf);
+    }
+
+  if (status)
+    {
+      p_buf++;
+    }
+
+  for (ccs::types::uint32 index = 0u; (status && (index < type->GetElementNumber())); index += 1u)
+    {
+      ccs::types::uint8* attr = ref + type->GetElementOffset(index);
+
+      SkipWhitespace(p_buf);
+
+      if (NULL_PTR_CAST(const ccs::types::ScalarType*) != scalar)
+        {
+          status = ParseScalar(kind, size, attr, p_buf);
+        }
+      else
+        {
+          status = ParseValue(base.get(), attr, p_buf);
+        }
+
+      if (status)
+        {
+          SkipWhitespace(p_buf);
+          status = ((',' == *p_buf) || (']' == *p_buf));
+        }
+
+      if (status && (',' == *p_buf) && ((index + 1u) < type->GetElementNumber()))
+        {
+          p_buf++;
+        }
+
+      if (!status)
+        {
+          log_error("ParseJSONInstance('%s') - Failed to parse element '%u'", type->GetName(), index);
+        }
+    }
+
+  if (status && (0u == type->GetElementNumber()))
+    {
+      SkipWhitespace(p_buf);
+
+      if (']' != *p_buf) // Elements in excess
+        {
+          status = SkipValue(p_buf);
+          SkipWhitespace(p_buf);
+        }
+    }
+
+  while (status && (',' == *p_buf)) // Elements in excess
+    {
+      p_buf++;
+      status = SkipValue(p_buf);
+      SkipWhitespace(p_buf);
+    }
+
+  if (status)
+    {
+      status = (']' == *p_buf);
+    }
+
+  if (status)
+    {
+      p_buf++;
+    }
+
+  return status;
+
+}
+
+static bool ParseCompound (const ccs::types::CompoundType * const type, ccs::types::uint8 * const ref, const ccs::types::char8 *& p_buf)
+{
+
+  ccs::types::uint32 number = type->GetAttributeNumber();
+  std::vector<bool> found (number, false);
+  ccs::types::uint32 count = 0u;
+
+  bool status = ('{' == *p_buf);
+  bool done = false;
+
+  if (status)
+    {
+      p_buf++;
+      SkipWhitespace(p_buf);
+      done = ('}' == *p_buf);
+    }
+
+  while (status && !done)
+    {
+      ccs::types::char8 name [STRING_MAX_LENGTH] = STRING_UNDEFINED;
+      ccs::types::uint32 length = 0u;
+
+      SkipWhitespace(p_buf);
+      status = ParseString(p_buf, name, STRING_MAX_LENGTH, length);
+
+      if (status)
+        {
+          SkipWhitespace(p_buf);
+          status = (':' == *p_buf);
+        }
+
+      if (status)
+        {
+          p_buf++;
+          SkipWhitespace(p_buf);
+        }
+
+      ccs::types::uint32 index = number;
+
+      if (status && (length < STRING_MAX_LENGTH))
+        {
+          index = type->GetAttributeIndex(name);
+
+          if ((index >= number) || (0 != strcmp(type->GetAttributeName(index), name)))
+            {
+              index = number;
+            }
+        }
+
+      if (status && (index < number))
+        {
+          status = ParseValue(type->GetAttributeType(index).get(), ref + type->GetAttributeOffset(index), p_buf);
+
+          if (status && !found[index])
+            {
+              found[index] = true;
+              count += 1u;
+            }
+        }
+      else if (status) // Unknown member
+        {
+          status = SkipValue(p_buf);
+        }
+
+      if (status)
+        {
+          SkipWhitespace(p_buf);
+          status = ((',' == *p_buf) || ('}' == *p_buf));
+        }
+
+      if (status)
+        {
+          done = ('}' == *p_buf);
+        }
+
+      if (status && !done)
+        {
+          p_buf++;
+        }
+    }
+
+  if (status)
+    {
+      p_buf++; // Closing brace
+    }
+
+  if (status && (count != number))
+    {
+      status = false;
+
+      for (ccs::types::uint32 index = 0u; index < number; index += 1u)
+        {
+          if (!found[index])
+            {
+              log_error("ParseJSONInstance('%s') - Failed to find attribute '%s' at index '%u'", type->GetName(), type->GetAttributeName(index), index);
+              break;
+            }
+        }
+    }
+
+  return status;
+
+}
+
+static bool ParseValue (const ccs::types::AnyType * const type, ccs::types::uint8 * const ref, const ccs::types::char8 *& p_buf)
+{
+
+  const ccs::types::ArrayType* array = dynamic_cast<const ccs::types::ArrayType*>(type);
+  const ccs::types::CompoundType* compound = dynamic_cast<const ccs::types::CompoundType*>(type);
+  const ccs::types::ScalarType* scalar = dynamic_cast<const ccs::types::ScalarType*>(type);
+
+  bool status = true;
+
+  SkipWhitespace(p_buf);
+
+  if (NULL_PTR_CAST(const ccs::types::ArrayType*) != array)
+    {
+      status = ParseArray(array, ref, p_buf);
+    }
+  else if (NULL_PTR_CAST(const ccs::types::CompoundType*) != compound)
+    {
+      status = ParseCompound(compound, ref, p_buf);
+    }
+  else if (NULL_PTR_CAST(const ccs::types::ScalarType*) != scalar)
+    {
+      status = ParseScalar(GetScalarKind(type), scalar->GetSize(), ref, p_buf);
+    }
+  else
+    {
+      status = false;
+    }
+
+  return status;
+
+}
+
+static inline void AppendUnsigned (std::string& buffer, ccs::types::uint64 value)
+{
+
+  ccs::types::char8 digits [24];
+  ccs::types::uint32 count = 0u;
+
+  do
+    {
+      digits[count++] = static_cast<ccs::types::char8>('0' + (value % 10ul));
+      value /= 10ul;
+    }
+  while (0ul != value);
+
+  while (0u < count)
+    {
+      buffer.push_back(digits[--count]);
+    }
+
+  return;
+
+}
+
+static inline void AppendSigned (std::string& buffer, const ccs::types::int64 value)
+{
+
+  if (value < 0l)
+    {
+      buffer.push_back('-');
+      AppendUnsigned(buffer, (~static_cast<ccs::types::uint64>(value)) + 1ul);
+    }
+  else
+    {
+      AppendUnsigned(buffer, static_cast<ccs::types::uint64>(value));
+    }
+
+  return;
+
+}
+
+static void AppendFloat32 (std::string& buffer, const ccs::types::float32 value)
+{
+
+  ccs::types::char8 tmp [32];
+
+  (void)snprintf(tmp, 32u, "%g", value);
+
+  for (ccs::types::int32 precision = 7; ((precision <= 9) && (value == value) && (strtof(tmp, NULL_PTR_CAST(ccs::types::char8**)) != value)); precision += 1)
+    {
+      (void)snprintf(tmp, 32u, "%.*g", precision, value);
+    }
+
+  buffer.append(tmp);
+
+  return;
+
+}
+
+static void AppendFloat64 (std::string& buffer, const ccs::types::float64 value)
+{
+
+  ccs::types::char8 tmp [32];
+
+  (void)snprintf(tmp, 32u, "%g", value);
+
+  for (ccs::types::int32 precision = 7; ((precision <= 17) && (value == value) && (strtod(tmp, NULL_PTR_CAST(ccs::types::char8**)) != value)); precision += 1)
+    {
+      (void)snprintf(tmp, 32u, "%.*g", precision, value);
+    }
+
+  buffer.append(tmp);
+
+  return;
+
+}
+
+static void AppendString (std::string& buffer, const ccs::types::char8 * const value, const ccs::types::uint32 size)
+{
+
+  static const ccs::types::char8 hex [] = "0123456789abcdef";
+
+  buffer.push_back('"');
+
+  for (ccs::types::uint32 index = 0u; ((index < size) && (0 != value[index])); index += 1u)
+    {
+      ccs::types::char8 c = value[index];
+
+      if (('"' == c) || ('\\' == c))
+        {
+          buffer.push_back('\\'); buffer.push_back(c);
+        }
+      else if ('\n' == c) { buffer.append("\\n"); }
+      else if ('\r' == c) { buffer.append("\\r"); }
+      else if ('\t' == c) { buffer.append("\\t"); }
+      else if (static_cast<ccs::types::uint8>(c) < 0x20u)
+        {
+          buffer.append("\\u00"); buffer.push_back(hex[(c >> 4) & 0x0F]); buffer.push_back(hex[c & 0x0F]);
+        }
+      else
+        {
+          buffer.push_back(c);
+        }
+    }
+
+  buffer.push_back('"');
+
+  return;
+
+}
+
+static bool SerialiseScalar (const JSONScalarKind_t kind, const ccs::types::uint32 size, const ccs::types::uint8 * const ref, std::string& buffer)
+{
+
+  bool status = true;
+
+  if (JSONBoolean == kind)
+    {
+      buffer.append((*(reinterpret_cast<const ccs::types::boolean*>(ref)) ? "true" : "false"));
+    }
+  else if (JSONChar8 == kind)
+    {
+      ccs::types::char8 tmp [2] = { *(reinterpret_cast<const ccs::types::char8*>(ref)), 0 };
+
+      if (0 == tmp[0])
+        {
+          buffer.append("\"\\u0000\"");
+        }
+      else
+        {
+          AppendString(buffer, tmp, 1u);
+        }
+    }
+  else if (JSONSigned == kind)
+    {
+      AppendSigned(buffer, static_cast<ccs::types::int64>(LoadInteger(ref, size, true)));
+    }
+  else if (JSONUnsigned == kind)
+    {
+      AppendUnsigned(buffer, LoadInteger(ref, size, false));
+    }
+  else if (JSONFloat32 == kind)
+    {
+      ccs::types::float32 value; (void)memcpy(&value, ref, sizeof(ccs::types::float32));
+      AppendFloat32(buffer, value);
+    }
+  else if (JSONFloat64 == kind)
+    {
+      ccs::types::float64 value; (void)memcpy(&value, ref, sizeof(ccs::types::float64));
+      AppendFloat64(buffer, value);
+    }
+  else if (JSONString == kind)
+    {
+      AppendString(buffer, reinterpret_cast<const ccs::types::char8*>(ref), size);
+    }
+  else
+    {
+      ccs::types::char8 tmp [32];
+
+      status = ((1u == size) || (2u == size) || (4u == size) || (8u == size));
+
+      if (status)
+        {
+          (void)snprintf(tmp, 32u, "0x%*.*lx", static_cast<ccs::types::int32>(2u * size), static_cast<ccs::types::int32>(2u * size), LoadInteger(ref, size, false));
+          buffer.append(tmp);
+        }
+    }
+
+  return status;
+
+}
+
+static bool SerialiseArray (const ccs::types::ArrayType * const type, const ccs::types::uint8 * const ref, std::string& buffer)
+{
+
+  std::shared_ptr<const ccs::types::AnyType> base = type->GetElementType();
+
+  bool status = static_cast<bool>(base);
+
+  if (status && (ccs::types::Character8 == base)) // Treat as string
+    {
+      AppendString(buffer, reinterpret_cast<const ccs::types::char8*>(ref), type->GetSize());
+      return status;
+    }
+
+  const ccs::types::ScalarType* scalar = NULL_PTR_CAST(const ccs::types::ScalarType*);
+  JSONScalarKind_t kind = JSONOpaque;
+  ccs::types::uint32 size = 0u;
+
+  if (status)
+    {
+      scalar = dynamic_cast<const ccs::types::ScalarType*>(base.get());
+      kind = GetScalarKind(base.get());
+      size = base->GetSize();
+      buffer.push_back('[');
+    }
+
+  for (ccs::types::uint32 index = 0u; (status && (index < type->GetElementNumber())); index += 1u)
+    {
+      const ccs::types::uint8* attr = ref + type->GetElementOffset(index);
+
+      if (0u < index)
+        {
+          buffer.push_back(',');
+        }
+
+      if (NULL_PTR_CAST(const ccs::types::ScalarType*) != scalar)
+        {
+          status = SerialiseScalar(kind, size, attr, buffer);
+        }
+      else
+        {
+          status = SerialiseValue(base.get(), attr, buffer);
+        }
+    }
+
+  if (status)
+    {
+      buffer.push_back(']');
+    }
+
+  return status;
+
+}
+
+static bool SerialiseCompound (const ccs::types::CompoundType * const type, const ccs::types::uint8 * const ref, std::string& buffer)
+{
+
+  bool status = true;
+
+  buffer.push_back('{');
+
+  for (ccs::types::uint32 index = 0u; (status && (index < type->GetAttributeNumber())); index += 1u)
+    {
+      if (0u < index)
+        {
+          buffer.push_back(',');
+        }
+
+      buffer.push_back('"'); buffer.append(type->GetAttributeName(index)); buffer.append("\":");
+
+      status = SerialiseValue(type->GetAttributeType(index).get(), ref + type->GetAttributeOffset(index), buffer);
+    }
+
+  if (status)
+    {
+      buffer.push_back('}');
+    }
+
+  return status;
+
+}
+
+static bool SerialiseValue (const ccs::types::AnyType * const type, const ccs::types::uint8 * const ref, std::string& buffer)
+{
+
+  const ccs::types::ArrayType* array = dynamic_cast<const ccs::types::ArrayType*>(type);
+  const ccs::types::CompoundType* compound = dynamic_cast<const ccs::types::CompoundType*>(type);
+  const ccs::types::ScalarType* scalar = dynamic_cast<const ccs::types::ScalarType*>(type);
+
+  bool status = true;
+
+  if (NULL_PTR_CAST(const ccs::types::ArrayType*) != array)
+    {
+      status = SerialiseArray(array, ref, buffer);
+    }
+  else if (NULL_PTR_CAST(const ccs::types::CompoundType*) != compound)
+    {
+      status = SerialiseCompound(compound, ref, buffer);
+    }
+  else if (NULL_PTR_CAST(const ccs::types::ScalarType*) != scalar)
+    {
+      status = SerialiseScalar(GetScalarKind(type), scalar->GetSize(), ref, buffer);
+    }
+  else
+    {
+      status = false;
+    }
+
+  return status;
+
+}
+
+ccs::types::uint32 ParseJSONInstance (const std::shared_ptr<const ccs::types::AnyType>& type, void * const ref, const ccs::types::char8 * const buffer)
+{
+
+  bool status = (static_cast<bool>(type) &&
+                 (NULL_PTR_CAST(void*) != ref) &&
+                 (NULL_PTR_CAST(const ccs::types::char8*) != buffer));
+
+  const ccs::types::char8 * p_buf = buffer;
+
+  if (status)
+    {
+      status = ParseValue(type.get(), static_cast<ccs::types::uint8*>(ref), p_buf);
+    }
+
+  ccs::types::uint32 ret = 0u;
+
+  if (status)
+    {
+      ret = static_cast<ccs::types::uint32>(p_buf - buffer);
+    }
+
+  log_debug("ParseJSONInstance - Returning '%u'", ret);
+
+  return ret;
+
+}
+
+bool SerialiseJSONInstance (const std::shared_ptr<const ccs::types::AnyType>& type, const void * const ref, std::string& buffer)
+{
+
+  bool status = (static_cast<bool>(type) &&
+                 (NULL_PTR_CAST(const void*) != ref));
+
+  if (status)
+    {
+      buffer.reserve(buffer.size() + 2u * type->GetSize()); // Estimate
+      status = SerialiseValue(type.get(), static_cast<const ccs::types::uint8*>(ref), buffer);
+    }
+
+  return status;
+
+}
+
+} // namespace HelperTools
+
+} // namespace ccs
@@ -0,0 +1,99 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/types/AnyValueJSON.h $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Generic type class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                                 CS 90 046
+*                                 13067 St. Paul-lez-Durance Cedex
+*                                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+/**
+ * @file AnyValueJSON.h
+ * @brief Header file for single-pass JSON instance parsing and serialisation routines.
+ * @date 01/07/2019
+ * @author Bertrand Bauvir (IO)
+ * @copyright 2010-2019 ITER Organization
+ * @detail This header file contains the definition of streaming JSON instance routines.
+ * The parser walks the JSON text once, driven by the type definition, and stores values
+ * directly at their offset within the instance. The serialiser appends to a growable
+ * buffer and is not limited in size.
+ *
+ * The JSON representation is the one of ccs::HelperTools::ParseInstance, resp.
+ * SerialiseInstance, i.e. compound types as objects, arrays as lists, arrays of char8
+ * as strings, and undefined scalar types as hexadecimal '0x..' literals. Floating-point
+ * numbers are written with the '%g' precision if this round-trips, with the shortest
+ * round-trip precision otherwise.
+ */
+
+#ifndef _AnyValueJSON_h_
+#define _AnyValueJSON_h_
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <string> // std::string
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+
+#include "AnyType.h"
+
+// Constants
+
+// Type definition
+
+// Global variables
+
+// Function declaration
+
+namespace ccs {
+
+namespace HelperTools {
+
+/**
+ * @brief Parse JSON instance.
+ * @detail Single-pass parser. Object members are matched by name irrespective of their
+ * order and unknown members are skipped. Elements in excess of the array multiplicity
+ * are ignored. String escape sequences are supported and strings are truncated to the
+ * size of the destination attribute.
+ * @param type Introspectable type definition.
+ * @param ref Instance of the type.
+ * @param buffer Zero-terminated JSON text.
+ * @return Number of characters consumed, 0 in case of error, e.g. missing attribute or
+ * too few array elements.
+ */
+
+ccs::types::uint32 ParseJSONInstance (const std::shared_ptr<const ccs::types::AnyType>& type, void * const ref, const ccs::types::char8 * const buffer);
+
+/**
+ * @brief Serialise JSON instance.
+ * @detail The JSON text is appended to the buffer.
+ * @param type Introspectable type definition.
+ * @param ref Instance of the type.
+ * @param buffer Growable output buffer.
+ * @return True if successful.
+ */
+
+bool SerialiseJSONInstance (const std::shared_ptr<const ccs::types::AnyType>& type, const void * const ref, std::string& buffer);
+
+} // namespace HelperTools
+
+} // namespace ccs
+
+// Function definition
+
+#endif // _AnyValueJSON_h_
+
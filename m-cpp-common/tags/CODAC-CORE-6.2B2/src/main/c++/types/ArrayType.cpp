@@ -195,15 +195,35 @@ bool ArrayType::FromNetworkByteOrder (void * const ref) const
 
 }
 
+uint64 ArrayType::ComputeFingerprint (const bool names) const
+{
+
+  uint64 hash = AnyType::Fingerprint(0ul, 'A', "", __multiplicity);
+  uint64 base = 0ul;
+
+  if (__base)
+    {
+      base = (names ? __base->GetFingerprint() : __base->GetLayoutFingerprint());
+    }
+
+  return AnyType::Fingerprint(hash, 'T', "", base);
+
+}
+
 bool ArrayType::operator== (const ArrayType& type) const
 {
 
-  bool status = ((this->GetSize() == type.GetSize()) &&
-                 (this->GetMultiplicity() == type.GetMultiplicity()));
+  bool status = ((this == &type) || (this->GetLayoutFingerprint() == type.GetLayoutFingerprint())); // Walk definition only upon match
 
-  if (status)
+  if (status && (this != &type))
     {
-      status = (*(this->GetElementType()) == *(type.GetElementType()));
+      status = ((this->GetSize() == type.GetSize()) &&
+                (this->GetMultiplicity() == type.GetMultiplicity()));
+
+      if (status)
+        {
+          status = (*(this->GetElementType()) == *(type.GetElementType()));
+        }
     }
 
   return status;
@@ -213,15 +233,13 @@ bool ArrayType::operator== (const ArrayType& type) const
 bool ArrayType::operator== (const AnyType& type) const
 {
 
-  bool status = (NULL_PTR_CAST(const ArrayType*) != dynamic_cast<const ArrayType*>(&type));
+  const ArrayType* ref = dynamic_cast<const ArrayType*>(&type);
+
+  bool status = (NULL_PTR_CAST(const ArrayType*) != ref);
 
   if (status)
     {
-      const ArrayType* ref = dynamic_cast<const ArrayType*>(&type);
-
-      status = ((this->GetSize() == ref->GetSize()) &&
-                (this->GetMultiplicity() == ref->GetMultiplicity()) &&
-                (*(this->GetElementType()) == *(ref->GetElementType())));
+      status = (*this == *ref);
     }
 
   return status;
@@ -69,6 +69,14 @@ class ArrayType : public AnyType
 
   protected:
 
+    /**
+     * @brief Specialises virtual method.
+     * @detail Hashes the multiplicity and the fingerprint of the element type.
+     * @return Structural fingerprint.
+     */
+
+    virtual uint64 ComputeFingerprint (const bool names) const;
+
   public:
 
     /**
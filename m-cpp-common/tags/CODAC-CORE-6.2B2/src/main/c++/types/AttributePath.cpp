@@ -0,0 +1,193 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/types/AttributePath.cpp $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Generic type class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                                 CS 90 046
+*                                 13067 St. Paul-lez-Durance Cedex
+*                                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <string> // std::string
+#include <typeinfo> // typeid
+
+#include <string.h> // strtok_r, etc.
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+
+//#define LOG_TRACE_ENABLE
+//#undef LOG_TRACE_ENABLE
+//#define LOG_DEBUG_ENABLE
+//#undef LOG_DEBUG_ENABLE
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyType.h"
+
+#include "ArrayType.h"
+#include "CompoundType.h"
+#include "ScalarType.h"
+
+#include "AttributePath.h"
+
+// Constants
+
+#undef LOG_ALTERN_SRC
+#define LOG_ALTERN_SRC "ccs::types"
+
+// Type definition
+
+namespace ccs {
+
+namespace types {
+
+// Global variables
+
+// Function declaration
+
+// Function definition
+
+bool AttributePath::Resolve (const std::shared_ptr<const AnyType>& type, const char8 * const path)
+{
+
+  log_trace("AttributePath::Resolve('%s') - Entering method", path);
+
+  __type.reset();
+  __scalar = NULL_PTR_CAST(const std::type_info*);
+  __offset = 0u;
+  __size = 0u;
+  __extent = 0u;
+  __valid = false;
+
+  std::shared_ptr<const AnyType> curr = type;
+  uint32 offset = 0u;
+
+  bool status = static_cast<bool>(type);
+
+  if (status && (NULL_PTR_CAST(const char8*) != path))
+    {
+      std::string buffer (path); // Path length not limited
+
+      char8* p_next = NULL_PTR_CAST(char8*);
+      char8* p_token = strtok_r(&buffer[0], ".[]", &p_next);
+
+      while (status && (NULL_PTR_CAST(char8*) != p_token))
+        {
+          if (true == ccs::HelperTools::IsIntegerString(p_token)) // An integer token .. Element within array
+            {
+              std::shared_ptr<const ArrayType> array = std::dynamic_pointer_cast<const ArrayType>(curr);
+              uint32 index = static_cast<uint32>(ccs::HelperTools::ToInteger(p_token));
+
+              status = (array && array->HasElement(index));
+
+              if (status)
+                {
+                  offset += array->GetElementOffset(index);
+                  curr = array->GetElementType();
+                }
+            }
+          else // A non-integer token .. Attribute within structure
+            {
+              std::shared_ptr<const CompoundType> compound = std::dynamic_pointer_cast<const CompoundType>(curr);
+
+              status = (compound && compound->HasAttribute(p_token));
+
+              if (status)
+                {
+                  uint32 index = compound->GetAttributeIndex(p_token);
+
+                  offset += compound->GetAttributeOffset(index);
+                  curr = compound->GetAttributeType(index);
+                }
+            }
+
+          if (status)
+            {
+              status = static_cast<bool>(curr);
+            }
+
+          if (!status)
+            {
+              log_debug("AttributePath::Resolve('%s') - Invalid token '%s'", path, p_token);
+            }
+
+          if (status)
+            {
+              p_token = strtok_r(NULL_PTR_CAST(char8*), ".[]", &p_next);
+            }
+        }
+    }
+
+  if (status)
+    {
+      const AnyType* attr = curr.get();
+
+      __type = curr;
+      __scalar = ((NULL_PTR_CAST(const ScalarType*) != dynamic_cast<const ScalarType*>(attr)) ? &typeid(*attr) : NULL_PTR_CAST(const std::type_info*));
+      __offset = offset;
+      __size = curr->GetSize();
+      __extent = offset + __size;
+      __valid = true;
+    }
+
+  log_trace("AttributePath::Resolve('%s') - Leaving method", path);
+
+  return status;
+
+}
+
+bool AttributePath::IsValid (void) const { return __valid; }
+
+uint32 AttributePath::GetOffset (void) const { return __offset; }
+uint32 AttributePath::GetSize (void) const { return __size; }
+std::shared_ptr<const AnyType> AttributePath::GetType (void) const { return __type; }
+
+AttributePath::AttributePath (void)
+{
+
+  __scalar = NULL_PTR_CAST(const std::type_info*);
+  __offset = 0u;
+  __size = 0u;
+  __extent = 0u;
+  __valid = false;
+
+  return;
+
+}
+
+AttributePath::AttributePath (const std::shared_ptr<const AnyType>& type, const char8 * const path)
+{
+
+  __scalar = NULL_PTR_CAST(const std::type_info*);
+  __offset = 0u;
+  __size = 0u;
+  __extent = 0u;
+  __valid = false;
+
+  (void)this->Resolve(type, path);
+
+  return;
+
+}
+
+AttributePath::~AttributePath (void) {}
+
+} // namespace types
+
+} // namespace ccs
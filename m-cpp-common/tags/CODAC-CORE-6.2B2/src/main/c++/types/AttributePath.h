@@ -0,0 +1,254 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/types/AttributePath.h $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Generic type class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                                 CS 90 046
+*                                 13067 St. Paul-lez-Durance Cedex
+*                                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+/**
+ * @file AttributePath.h
+ * @brief Header file for AttributePath class.
+ * @date 01/07/2019
+ * @author Bertrand Bauvir (IO)
+ * @copyright 2010-2019 ITER Organization
+ * @detail This header file contains the definition of the AttributePath class.
+ */
+
+#ifndef _AttributePath_h_
+#define _AttributePath_h_
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <typeinfo> // std::type_info
+
+#include <string.h> // memcpy, etc.
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+
+#include "AnyType.h"
+#include "AnyValue.h"
+#include "ScalarType.h"
+
+// Constants
+
+// Type definition
+
+namespace ccs {
+
+namespace types {
+
+/**
+ * @brief Attribute path within an introspectable type, resolved once.
+ * @detail The path, e.g. 'a.b[3].c', is resolved against the type upon construction
+ * and the handle holds the offset, size and type of the attribute. Accesses through
+ * the handle thereafter reduce to bounds-checked pointer arithmetics, as opposed to
+ * ccs::HelperTools::GetAttributeReference, etc. which resolve the path at every call.
+ *
+ * The handle remains valid for any instance of the type it has been resolved against,
+ * or of any type with identical memory layout. Typed accesses are verified against the
+ * attribute type recorded upon resolution, i.e. a scalar attribute may only be accessed
+ * as the corresponding C++ type.
+ *
+ * @code
+   ccs::types::AttributePath path (value.GetType(), "a.b[3].c");
+
+   ccs::types::uint32 attr = 0u;
+
+   for (...) // Hot path
+     {
+       bool status = path.GetValue(value, attr);
+       ...
+     }
+   @endcode
+ */
+
+class AttributePath
+{
+
+  private:
+
+    std::shared_ptr<const AnyType> __type; // Attribute type
+    const std::type_info* __scalar; // Dynamic type of the attribute, if scalar
+
+    uint32 __offset;
+    uint32 __size;
+    uint32 __extent; // Size of the type the path has been resolved against
+
+    bool __valid;
+
+  protected:
+
+  public:
+
+    /**
+     * @brief Constructor. NOOP.
+     * @post
+     *   IsValid() == false
+     */
+
+    AttributePath (void);
+
+    /**
+     * @brief Constructor.
+     * @detail Resolves the path, see AttributePath::Resolve.
+     */
+
+    AttributePath (const std::shared_ptr<const AnyType>& type, const char8 * const path);
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+
+    virtual ~AttributePath (void);
+
+    /**
+     * @brief Resolve method.
+     * @detail Walks the path through the type definition. The empty path designates
+     * the type itself.
+     * @param type Introspectable type definition.
+     * @param path Attribute path, e.g. 'a.b[3].c'.
+     * @return True if the path is valid within the type.
+     */
+
+    bool Resolve (const std::shared_ptr<const AnyType>& type, const char8 * const path);
+
+    /**
+     * @brief Accessor.
+     * @return True if the path has been successfully resolved.
+     */
+
+    bool IsValid (void) const;
+
+    /**
+     * @brief Accessor.
+     * @return Attribute offset, size, resp. type.
+     */
+
+    uint32 GetOffset (void) const;
+    uint32 GetSize (void) const;
+    std::shared_ptr<const AnyType> GetType (void) const;
+
+    /**
+     * @brief Test method.
+     * @return True if the attribute is of the specialised scalar type.
+     */
+
+    template <typename Type> inline bool Is (void) const;
+
+    /**
+     * @brief Accessor.
+     * @param ref Instance of the type the path has been resolved against.
+     * @param size Size of the instance.
+     * @return Attribute reference, NULL if invalid path or instance too small.
+     */
+
+    inline void* GetReference (const void * const ref, const uint32 size) const;
+    inline void* GetReference (const AnyValue& value) const;
+
+    /**
+     * @brief Accessor.
+     * @detail Copies the attribute out of, resp. into, the value. Scalar attributes
+     * require the corresponding type, e.g. uint32 for an 'uint32' attribute; other
+     * attributes require a type of identical size.
+     * @return True if successful, false if invalid path or mismatched type.
+     */
+
+    template <typename Type> inline bool GetValue (const AnyValue& value, Type& attr) const;
+    template <typename Type> inline bool SetValue (AnyValue& value, const Type& attr) const;
+
+};
+
+// Global variables
+
+// Function declaration
+
+// Function definition
+
+template <typename Type> inline bool AttributePath::Is (void) const
+{
+  return (__valid && (NULL_PTR_CAST(const std::type_info*) != __scalar) && (typeid(ScalarTypeT<Type>) == *__scalar));
+}
+
+inline void* AttributePath::GetReference (const void * const ref, const uint32 size) const
+{
+
+  void* attr = NULL_PTR_CAST(void*);
+
+  if (__valid && (NULL_PTR_CAST(const void*) != ref) && (__extent <= size))
+    {
+      attr = const_cast<void*>(static_cast<const void*>(static_cast<const uint8*>(ref) + __offset));
+    }
+
+  return attr;
+
+}
+
+inline void* AttributePath::GetReference (const AnyValue& value) const { return this->GetReference(value.GetInstance(), value.GetSize()); }
+
+template <typename Type> inline bool AttributePath::GetValue (const AnyValue& value, Type& attr) const
+{
+
+  void* ref = NULL_PTR_CAST(void*);
+
+  bool status = ((static_cast<uint32>(sizeof(Type)) == __size) && ((NULL_PTR_CAST(const std::type_info*) == __scalar) || (typeid(ScalarTypeT<Type>) == *__scalar)));
+
+  if (status)
+    {
+      ref = this->GetReference(value);
+      status = (NULL_PTR_CAST(void*) != ref);
+    }
+
+  if (status)
+    {
+      (void)memcpy(&attr, ref, sizeof(Type));
+    }
+
+  return status;
+
+}
+
+template <typename Type> inline bool AttributePath::SetValue (AnyValue& value, const Type& attr) const
+{
+
+  void* ref = NULL_PTR_CAST(void*);
+
+  bool status = ((static_cast<uint32>(sizeof(Type)) == __size) && ((NULL_PTR_CAST(const std::type_info*) == __scalar) || (typeid(ScalarTypeT<Type>) == *__scalar)));
+
+  if (status)
+    {
+      ref = this->GetReference(value);
+      status = (NULL_PTR_CAST(void*) != ref);
+    }
+
+  if (status)
+    {
+      (void)memcpy(ref, &attr, sizeof(Type));
+    }
+
+  return status;
+
+}
+
+} // namespace types
+
+} // namespace ccs
+
+#endif // _AttributePath_h_
+
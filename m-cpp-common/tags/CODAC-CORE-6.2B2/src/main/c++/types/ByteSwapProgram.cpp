@@ -0,0 +1,379 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/types/ByteSwapProgram.cpp $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Generic type class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                                 CS 90 046
+*                                 13067 St. Paul-lez-Durance Cedex
+*                                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <map> // std::map
+#include <memory> // std::shared_ptr, etc.
+#include <mutex> // std::mutex
+#include <new> // std::nothrow
+
+#include <endian.h> // __BYTE_ORDER, etc.
+#include <string.h> // memcpy, etc.
+
+#if defined(__x86_64__)
+#include <tmmintrin.h> // _mm_shuffle_epi8, etc.
+#endif
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+
+//#define LOG_TRACE_ENABLE
+//#undef LOG_TRACE_ENABLE
+//#define LOG_DEBUG_ENABLE
+//#undef LOG_DEBUG_ENABLE
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyType.h"
+
+#include "ArrayType.h"
+#include "CompoundType.h"
+#include "ScalarType.h"
+
+#include "ByteSwapProgram.h"
+
+// Constants
+
+#undef LOG_ALTERN_SRC
+#define LOG_ALTERN_SRC "ccs::types"
+
+// Type definition
+
+namespace ccs {
+
+namespace types {
+
+typedef struct ByteSwapEntry {
+  std::shared_ptr<const AnyType> type; // Keep key alive
+  std::shared_ptr<const ByteSwapProgram> program;
+} ByteSwapEntry_t;
+
+// Global variables
+
+static std::mutex __swap_mutex;
+static std::map<const AnyType*, ByteSwapEntry_t> __swap_cache;
+
+// Function declaration
+
+// Function definition
+
+static inline void SwapScalar16 (uint8 * const ref, const uint32 count)
+{
+  for (uint32 index = 0u; index < count; index += 1u)
+    {
+      uint16 value; (void)memcpy(&value, ref + 2u * index, 2u);
+      value = __builtin_bswap16(value);
+      (void)memcpy(ref + 2u * index, &value, 2u);
+    }
+}
+
+static inline void SwapScalar32 (uint8 * const ref, const uint32 count)
+{
+  for (uint32 index = 0u; index < count; index += 1u)
+    {
+      uint32 value; (void)memcpy(&value, ref + 4u * index, 4u);
+      value = __builtin_bswap32(value);
+      (void)memcpy(ref + 4u * index, &value, 4u);
+    }
+}
+
+static inline void SwapScalar64 (uint8 * const ref, const uint32 count)
+{
+  for (uint32 index = 0u; index < count; index += 1u)
+    {
+      uint64 value; (void)memcpy(&value, ref + 8u * index, 8u);
+      value = __builtin_bswap64(value);
+      (void)memcpy(ref + 8u * index, &value, 8u);
+    }
+}
+
+#if defined(__x86_64__)
+__attribute__((target("ssse3"))) static uint32 SwapVector_SSSE3 (uint8 * const ref, const uint32 width, const uint32 count)
+{
+
+  __m128i mask;
+
+  if (2u == width)
+    {
+      mask = _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+    }
+  else if (4u == width)
+    {
+      mask = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    }
+  else
+    {
+      mask = _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+    }
+
+  uint32 size = (width * count) & ~15u; // Whole 128-bit words
+
+  for (uint32 index = 0u; index < size; index += 16u)
+    {
+      __m128i word = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ref + index));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(ref + index), _mm_shuffle_epi8(word, mask));
+    }
+
+  return size / width; // Elements processed
+
+}
+#endif
+
+void ByteSwapProgram::Swap (void * const ref, const uint32 width, const uint32 count)
+{
+
+  uint8* p_ref = static_cast<uint8*>(ref);
+  uint32 done = 0u;
+
+#if defined(__x86_64__)
+  static bool hw_support = __builtin_cpu_supports("ssse3");
+
+  if (__builtin_expect(hw_support, 1) && (16u <= (width * count))) // Likely
+    {
+      done = SwapVector_SSSE3(p_ref, width, count);
+      p_ref += width * done;
+    }
+#endif
+
+  if (2u == width)
+    {
+      SwapScalar16(p_ref, count - done);
+    }
+  else if (4u == width)
+    {
+      SwapScalar32(p_ref, count - done);
+    }
+  else if (8u == width)
+    {
+      SwapScalar64(p_ref, count - done);
+    }
+
+  return;
+
+}
+
+void ByteSwapProgram::Append (const uint32 offset, const uint32 width, const uint32 count)
+{
+
+  bool merged = false;
+
+  if (!__runs.empty())
+    {
+      Run_t& last = __runs.back();
+      merged = ((last.width == width) && ((last.offset + last.width * last.count) == offset));
+
+      if (merged)
+        {
+          last.count += count;
+        }
+    }
+
+  if (!merged)
+    {
+      Run_t run;
+
+      run.offset = offset;
+      run.width = width;
+      run.count = count;
+
+      __runs.push_back(run);
+    }
+
+  return;
+
+}
+
+bool ByteSwapProgram::Compile (const AnyType * const type, const uint32 offset)
+{
+
+  bool status = (NULL_PTR_CAST(const AnyType*) != type);
+
+  const ArrayType* array = NULL_PTR_CAST(const ArrayType*);
+  const CompoundType* compound = NULL_PTR_CAST(const CompoundType*);
+  const ScalarType* scalar = NULL_PTR_CAST(const ScalarType*);
+
+  if (status)
+    {
+      array = dynamic_cast<const ArrayType*>(type);
+      compound = dynamic_cast<const CompoundType*>(type);
+      scalar = dynamic_cast<const ScalarType*>(type);
+    }
+
+  if (status && (NULL_PTR_CAST(const ScalarType*) != scalar))
+    {
+      uint32 width = scalar->GetSize();
+
+      if (NULL_PTR_CAST(const ScalarTypeT<string>*) != dynamic_cast<const ScalarTypeT<string>*>(scalar))
+        {
+          // Do nothing
+        }
+      else if (1u == width)
+        {
+          // Do nothing
+        }
+      else if ((2u == width) || (4u == width) || (8u == width))
+        {
+          this->Append(offset, width, 1u);
+        }
+      else
+        {
+          status = false;
+        }
+    }
+  else if (status && (NULL_PTR_CAST(const ArrayType*) != array))
+    {
+      std::shared_ptr<const AnyType> base = array->GetElementType();
+      std::shared_ptr<const ScalarType> element = std::dynamic_pointer_cast<const ScalarType>(base);
+
+      status = static_cast<bool>(base);
+
+      if (status && element && !std::dynamic_pointer_cast<const ScalarTypeT<string>>(element) && (1u < element->GetSize()))
+        {
+          uint32 width = element->GetSize();
+
+          status = ((2u == width) || (4u == width) || (8u == width));
+
+          if (status)
+            {
+              this->Append(offset, width, array->GetMultiplicity());
+            }
+        }
+      else
+        {
+          for (uint32 index = 0u; (status && (index < array->GetMultiplicity())); index += 1u)
+            {
+              status = this->Compile(base.get(), offset + array->GetElementOffset(index));
+            }
+        }
+    }
+  else if (status && (NULL_PTR_CAST(const CompoundType*) != compound))
+    {
+      for (uint32 index = 0u; (status && (index < compound->GetAttributeNumber())); index += 1u)
+        {
+          status = this->Compile(compound->GetAttributeType(index).get(), offset + compound->GetAttributeOffset(index));
+        }
+    }
+  else
+    {
+      status = false;
+    }
+
+  return status;
+
+}
+
+bool ByteSwapProgram::IsValid (void) const { return __valid; }
+
+const std::vector<ByteSwapProgram::Run_t>& ByteSwapProgram::GetRuns (void) const { return __runs; }
+
+bool ByteSwapProgram::Execute (void * const ref) const
+{
+
+  bool status = (__valid && (NULL_PTR_CAST(void*) != ref));
+
+  if (status)
+    {
+      for (std::vector<Run_t>::const_iterator it = __runs.begin(); it != __runs.end(); ++it)
+        {
+          ByteSwapProgram::Swap(static_cast<void*>(static_cast<uint8*>(ref) + it->offset), it->width, it->count);
+        }
+    }
+
+  return status;
+
+}
+
+ByteSwapProgram::ByteSwapProgram (const AnyType * const type)
+{
+
+  __valid = this->Compile(type, 0u);
+
+#if __BYTE_ORDER == __BIG_ENDIAN
+  __runs.clear(); // Host and network byte order are identical
+#endif
+
+  if (!__valid)
+    {
+      __runs.clear();
+    }
+
+  log_debug("ByteSwapProgram::ByteSwapProgram - Compiled '%u' runs", static_cast<uint32>(__runs.size()));
+
+  return;
+
+}
+
+ByteSwapProgram::~ByteSwapProgram (void) {}
+
+std::shared_ptr<const ByteSwapProgram> ByteSwapProgram::GetInstance (const std::shared_ptr<const AnyType>& type)
+{
+
+  std::shared_ptr<const ByteSwapProgram> program;
+
+  bool status = static_cast<bool>(type);
+  bool found = false;
+
+  if (status)
+    {
+      std::lock_guard<std::mutex> lock (__swap_mutex);
+
+      std::map<const AnyType*, ByteSwapEntry_t>::const_iterator it = __swap_cache.find(type.get());
+      found = (__swap_cache.end() != it);
+
+      if (found)
+        {
+          program = it->second.program;
+        }
+    }
+
+  if (status && !found)
+    {
+      std::shared_ptr<const ByteSwapProgram> created (new (std::nothrow) ByteSwapProgram (type.get()));
+
+      if (created && created->IsValid())
+        {
+          program = created;
+        }
+
+      ByteSwapEntry_t entry;
+
+      entry.type = type;
+      entry.program = program; // Also record types which do not compile
+
+      std::lock_guard<std::mutex> lock (__swap_mutex);
+
+      if (DEFAULT_BYTESWAP_CACHE_SIZE <= __swap_cache.size())
+        {
+          log_debug("ByteSwapProgram::GetInstance - Flush cache");
+          __swap_cache.clear();
+        }
+
+      __swap_cache[type.get()] = entry;
+    }
+
+  return program;
+
+}
+
+} // namespace types
+
+} // namespace ccs
@@ -0,0 +1,163 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/types/ByteSwapProgram.h $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Generic type class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                                 CS 90 046
+*                                 13067 St. Paul-lez-Durance Cedex
+*                                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+/**
+ * @file ByteSwapProgram.h
+ * @brief Header file for ByteSwapProgram class.
+ * @date 01/07/2019
+ * @author Bertrand Bauvir (IO)
+ * @copyright 2010-2019 ITER Organization
+ * @detail This header file contains the definition of the ByteSwapProgram class.
+ */
+
+#ifndef _ByteSwapProgram_h_
+#define _ByteSwapProgram_h_
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <vector> // std::vector
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+
+#include "AnyType.h"
+
+// Constants
+
+#define DEFAULT_BYTESWAP_CACHE_SIZE 256u // Types
+
+// Type definition
+
+namespace ccs {
+
+namespace types {
+
+/**
+ * @brief Byte order conversion program for an introspectable type.
+ * @detail The program is derived once from the type definition as a list of runs of
+ * contiguous multi-byte scalars, i.e. (offset, width, count), adjacent runs of identical
+ * width being merged. Executing the program swaps bytes in place without walking the
+ * type definition, e.g. an array of 64k float32 is a single run. Long runs are swapped
+ * using SSSE3 byte shuffles if supported by the host.
+ *
+ * The conversion is an involution, i.e. the same program converts to and from network
+ * byte order. The program is empty on big-endian hosts.
+ *
+ * @note Types which do not decompose into scalars are reported invalid, in which case
+ * the AnyType::ToNetworkByteOrder, resp. FromNetworkByteOrder, virtual methods apply.
+ */
+
+class ByteSwapProgram
+{
+
+  public:
+
+    typedef struct Run {
+
+      uint32 offset;
+      uint32 width; // 2, 4 or 8 bytes
+      uint32 count;
+
+    } Run_t;
+
+  private:
+
+    std::vector<Run_t> __runs;
+    bool __valid;
+
+    bool Compile (const AnyType * const type, const uint32 offset);
+    void Append (const uint32 offset, const uint32 width, const uint32 count);
+
+    ByteSwapProgram (const ByteSwapProgram& program); // Undefined
+    ByteSwapProgram& operator= (const ByteSwapProgram& program); // Undefined
+
+  protected:
+
+  public:
+
+    /**
+     * @brief Constructor.
+     * @detail Compiles the program for the type.
+     */
+
+    explicit ByteSwapProgram (const AnyType * const type);
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+
+    virtual ~ByteSwapProgram (void);
+
+    /**
+     * @brief Accessor.
+     * @return True if the type could be compiled.
+     */
+
+    bool IsValid (void) const;
+
+    /**
+     * @brief Accessor.
+     * @return Program runs.
+     */
+
+    const std::vector<Run_t>& GetRuns (void) const;
+
+    /**
+     * @brief Execute method.
+     * @detail In-place byte order conversion of the instance.
+     * @return True if successful.
+     */
+
+    bool Execute (void * const ref) const;
+
+    /**
+     * @brief Conversion method.
+     * @detail In-place byte swap of an array of scalars.
+     * @param width Scalar width, i.e. 2, 4 or 8 bytes.
+     */
+
+    static void Swap (void * const ref, const uint32 width, const uint32 count);
+
+    /**
+     * @brief Accessor.
+     * @detail Provides the program for the type, compiled upon first request and cached
+     * thereafter.
+     * @return Program, empty if invalid type.
+     */
+
+    static std::shared_ptr<const ByteSwapProgram> GetInstance (const std::shared_ptr<const AnyType>& type);
+
+};
+
+// Global variables
+
+// Function declaration
+
+// Function definition
+
+} // namespace types
+
+} // namespace ccs
+
+#endif // _ByteSwapProgram_h_
+
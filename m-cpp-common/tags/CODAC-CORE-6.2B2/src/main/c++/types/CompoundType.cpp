@@ -38,6 +38,8 @@
 
 #include "LookUpTable.h"
 
+#include "Hash.h" // Name hashing
+
 #include "AnyType.h" // Introspectable type definition (base class) ..
 #include "AnyTypeHelper.h" // .. associated helper routines
 #include "AnyTypeDatabase.h" // .. associated helper class
@@ -64,7 +66,82 @@ namespace types {
 // Function declaration
 
 // Function definition
-  
+
+uint32 CompoundType::Find (const char8 * const name) const
+{
+
+  uint32 rank = static_cast<uint32>(__members.size());
+
+  bool status = ((false == __table.empty()) && (false == ccs::HelperTools::IsUndefinedString(name)));
+
+  if (status)
+    {
+      uint32 hash = ccs::HelperTools::Hash<uint32>(name);
+      uint32 mask = static_cast<uint32>(__table.size()) - 1u;
+
+      // Linear probing till empty slot
+      for (uint32 slot = (hash & mask); (0u != __table[slot]); slot = ((slot + 1u) & mask))
+        {
+          const Attribute_t& attr = __members[__table[slot] - 1u];
+
+          if ((attr.hash == hash) && (attr.name == name))
+            {
+              rank = __table[slot] - 1u;
+              break;
+            }
+        }
+    }
+
+  return rank;
+
+}
+
+void CompoundType::Insert (void)
+{
+
+  uint32 number = static_cast<uint32>(__members.size());
+
+  if ((2u * number) > static_cast<uint32>(__table.size()))
+    { // Grow and re-insert all attributes
+      uint32 size = 8u;
+
+      while (size < (2u * number))
+        {
+          size *= 2u;
+        }
+
+      __table.assign(size, 0u);
+
+      for (uint32 rank = 0u; rank < number; rank += 1u)
+        {
+          uint32 mask = size - 1u;
+          uint32 slot = (__members[rank].hash & mask);
+
+          while (0u != __table[slot])
+            {
+              slot = ((slot + 1u) & mask);
+            }
+
+          __table[slot] = rank + 1u;
+        }
+    }
+  else
+    {
+      uint32 mask = static_cast<uint32>(__table.size()) - 1u;
+      uint32 slot = (__members[number - 1u].hash & mask);
+
+      while (0u != __table[slot])
+        {
+          slot = ((slot + 1u) & mask);
+        }
+
+      __table[slot] = number;
+    }
+
+  return;
+
+}
+
 CompoundType* CompoundType::AddAttribute (const char8 * const name, const char8 * const type)
 { 
 
@@ -115,16 +192,23 @@ CompoundType* CompoundType::AddAttribute (const char8 * const name, const std::s
 
   if (status)
     {
-      log_debug("CompoundType::AddAttribute('%s') - Add attribute type '%s'", name, type->GetName());
-      status = __attributes.Register(name, type);
+      status = !ccs::HelperTools::IsUndefinedString(name);
     }
 
   if (status)
     {
-      // Update attributes offsets
-      uint32 size = this->GetSize();
-      log_debug("CompoundType::AddAttribute('%s') - Add attribute offset '%u'", name, size);
-      status = __offsets.Register(name, size);
+      log_debug("CompoundType::AddAttribute('%s') - Add attribute type '%s' at offset '%u'", name, type->GetName(), this->GetSize());
+
+      Attribute_t attr;
+
+      attr.name = name;
+      attr.type = type;
+      attr.offset = this->GetSize();
+      attr.size = type->GetSize();
+      attr.hash = ccs::HelperTools::Hash<uint32>(name);
+
+      __members.push_back(attr);
+      this->Insert();
     }
 
   if (status)
@@ -164,7 +248,7 @@ bool CompoundType::HasAttribute (const char8 * const name) const
 
   if (status)
     {
-      status = __attributes.IsValid(name);
+      status = (this->Find(name) < this->GetAttributeNumber());
     }
 
   log_trace("CompoundType::HasAttribute('%s') - Leaving method", name);
@@ -182,7 +266,7 @@ uint32 CompoundType::GetAttributeIndex (const char8 * const name) const
 
   if (status)
     {
-      index = __attributes.GetIndex(name);
+      index = this->Find(name);
     }
 
   return index; 
@@ -198,7 +282,7 @@ const char8* CompoundType::GetAttributeName (const uint32 index) const
 
   if (status)
     {
-      ref = __attributes.GetName(index);
+      ref = __members[index].name.c_str();
     }
 
   return ref; 
@@ -208,7 +292,7 @@ const char8* CompoundType::GetAttributeName (const uint32 index) const
 uint32 CompoundType::GetAttributeNumber (void) const
 { 
 
-  return __attributes.GetSize(); 
+  return static_cast<uint32>(__members.size()); 
 
 }
 
@@ -221,7 +305,7 @@ uint32 CompoundType::GetAttributeOffset (const uint32 index) const
 
   if (status)
     {
-      offset = __offsets.GetElement(index);
+      offset = __members[index].offset;
     }
 
   return offset; 
@@ -233,11 +317,11 @@ uint32 CompoundType::GetAttributeOffset (const char8 * const name) const
 
   uint32 offset = 0u; 
 
-  bool status = (true == this->HasAttribute(name));
+  uint32 index = this->Find(name);
 
-  if (status)
+  if (index < this->GetAttributeNumber())
     {
-      offset = __offsets.GetElement(name);
+      offset = __members[index].offset;
     }
 
   return offset; 
@@ -251,7 +335,7 @@ void* CompoundType::GetAttributeReference (const void * const ref, const uint32
 
   if ((NULL_PTR_CAST(void*) != ref) && this->HasAttribute(index)) 
     {
-      attr = const_cast<void*>(static_cast<const void*>(static_cast<const uint8_t*>(ref) + this->GetAttributeOffset(index)));
+      attr = const_cast<void*>(static_cast<const void*>(static_cast<const uint8_t*>(ref) + __members[index].offset));
     }
 
   return attr; 
@@ -263,9 +347,11 @@ void* CompoundType::GetAttributeReference (const void * const ref, const char8 *
 
   void* attr = NULL_PTR_CAST(void*); 
 
-  if ((NULL_PTR_CAST(void*) != ref) && this->HasAttribute(name)) 
+  uint32 index = this->Find(name);
+
+  if ((NULL_PTR_CAST(void*) != ref) && (index < this->GetAttributeNumber()))
     {
-      attr = const_cast<void*>(static_cast<const void*>(static_cast<const uint8_t*>(ref) + this->GetAttributeOffset(name)));
+      attr = const_cast<void*>(static_cast<const void*>(static_cast<const uint8_t*>(ref) + __members[index].offset));
     }
 
   return attr; 
@@ -281,7 +367,7 @@ uint32 CompoundType::GetAttributeSize (const uint32 index) const
 
   if (status) 
     {
-      size = this->GetAttributeType(index)->GetSize(); 
+      size = __members[index].size; 
     }
 
   return size; 
@@ -293,11 +379,11 @@ uint32 CompoundType::GetAttributeSize (const char8 * const name) const
 
   uint32 size = 0u; 
 
-  bool status = (true == this->HasAttribute(name));
+  uint32 index = this->Find(name);
 
-  if (status) 
+  if (index < this->GetAttributeNumber()) 
     {
-      size = this->GetAttributeType(name)->GetSize(); 
+      size = __members[index].size; 
     }
 
   return size; 
@@ -313,7 +399,7 @@ std::shared_ptr<const AnyType> CompoundType::GetAttributeType (const uint32 inde
 
   if (status)
     {
-      ref = __attributes.GetElement(index);
+      ref = __members[index].type;
     }
 
   return ref; 
@@ -325,11 +411,11 @@ std::shared_ptr<const AnyType> CompoundType::GetAttributeType (const char8 * con
 
   std::shared_ptr<const AnyType> ref; 
 
-  bool status = (true == this->HasAttribute(name));
+  uint32 index = this->Find(name);
 
-  if (status)
+  if (index < this->GetAttributeNumber())
     {
-      ref = __attributes.GetElement(name);
+      ref = __members[index].type;
     }
 
   return ref; 
@@ -374,15 +460,43 @@ bool CompoundType::FromNetworkByteOrder (void * const ref) const // In-place con
 
 }
 
+uint64 CompoundType::ComputeFingerprint (const bool names) const
+{
+
+  uint64 hash = AnyType::Fingerprint(0ul, 'C', "", this->GetAttributeNumber());
+
+  for (uint32 index = 0u; index < this->GetAttributeNumber(); index++)
+    {
+      std::shared_ptr<const AnyType> type = __members[index].type;
+      uint64 attr = 0ul;
+
+      if (type)
+        {
+          attr = (names ? type->GetFingerprint() : type->GetLayoutFingerprint());
+        }
+
+      hash = AnyType::Fingerprint(hash, 'M', (names ? this->GetAttributeName(index) : ""), __members[index].offset);
+      hash = AnyType::Fingerprint(hash, 'T', "", attr);
+    }
+
+  return hash;
+
+}
+
 bool CompoundType::operator== (const CompoundType& type) const
 {
 
-  bool status = ((this->GetSize() == type.GetSize()) &&
-                 (this->GetAttributeNumber() == type.GetAttributeNumber()));
+  bool status = ((this == &type) || (this->GetLayoutFingerprint() == type.GetLayoutFingerprint())); // Walk definition only upon match
 
-  for (uint32 index = 0u; (status && (index < this->GetAttributeNumber())); index++)
+  if (status && (this != &type))
     {
-      status = (*(this->GetAttributeType(index)) == *(type.GetAttributeType(index)));
+      status = ((this->GetSize() == type.GetSize()) &&
+                (this->GetAttributeNumber() == type.GetAttributeNumber()));
+
+      for (uint32 index = 0u; (status && (index < this->GetAttributeNumber())); index++)
+        {
+          status = (*(this->GetAttributeType(index)) == *(type.GetAttributeType(index)));
+        }
     }
 
   return status;
@@ -396,15 +510,7 @@ bool CompoundType::operator== (const AnyType& type) const
 
   if (status)
     {
-      const CompoundType* ref = dynamic_cast<const CompoundType*>(&type);
-
-      status = ((this->GetSize() == ref->GetSize()) &&
-                (this->GetAttributeNumber() == ref->GetAttributeNumber()));
-
-      for (uint32 index = 0u; (status && (index < this->GetAttributeNumber())); index++)
-        {
-          status = (*(this->GetAttributeType(index)) == *(ref->GetAttributeType(index)));
-        }
+      status = (*this == *dynamic_cast<const CompoundType*>(&type));
     }
 
   return status;
@@ -422,6 +528,9 @@ CompoundType& CompoundType::operator= (const CompoundType& type)
       (void)this->SetName(type.GetName());
       (void)this->SetSize(0u);
 
+      __members.clear();
+      __table.clear();
+
       // Ensure attributes are instantiated in the copy operation
       for (uint32 index = 0u; index < type.GetAttributeNumber(); index++)
         {
@@ -34,6 +34,8 @@
 // Global header files
 
 #include <memory> // std::shared_ptr, etc.
+#include <string> // std::string
+#include <vector> // std::vector
 
 // Local header files
 
@@ -61,6 +63,10 @@ class ArrayType; // Forward class declaration
 
 /**
  * @brief Introspectable type definition for compound types.
+ * @detail Attributes are held in a contiguous array in declaration order, i.e. rank,
+ * with name, type, offset and size. Name resolution uses an open-addressing hash table
+ * of ranks maintained upon AddAttribute. Accessors by rank or name are therefore O(1)
+ * and the const interface does not modify the instance.
  */
 
 class CompoundType : public AnyType
@@ -68,11 +74,45 @@ class CompoundType : public AnyType
 
   private:
 
-    ccs::base::LookUpTable<std::shared_ptr<const AnyType>> __attributes;
-    ccs::base::LookUpTable<uint32> __offsets;
+    typedef struct Attribute {
+
+      std::string name;
+      std::shared_ptr<const AnyType> type;
+      uint32 offset;
+      uint32 size;
+      uint32 hash;
+
+    } Attribute_t;
+
+    std::vector<Attribute_t> __members;
+    std::vector<uint32> __table; // Rank + 1, 0 for empty slot, power of 2 size
+
+    /**
+     * @brief Lookup method.
+     * @return Rank of attribute for name, number of attributes if not found.
+     */
+
+    uint32 Find (const char8 * const name) const;
+
+    /**
+     * @brief Insertion method.
+     * @detail Inserts the last declared attribute in the hash table, grown so as to
+     * keep the load factor under 1/2.
+     */
+
+    void Insert (void);
 
   protected:
 
+    /**
+     * @brief Specialises virtual method.
+     * @detail Hashes the attribute names, if required, offsets and the fingerprint of each
+     * attribute type.
+     * @return Structural fingerprint.
+     */
+
+    virtual uint64 ComputeFingerprint (const bool names) const;
+
   public:
 
     /**
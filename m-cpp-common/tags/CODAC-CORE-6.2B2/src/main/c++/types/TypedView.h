@@ -0,0 +1,316 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/main/c++/types/TypedView.h $
+* $Id$
+*
+* Project       : CODAC Core System
+*
+* Description   : Generic type class definition
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*                                 CS 90 046
+*                                 13067 St. Paul-lez-Durance Cedex
+*                                 France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+/**
+ * @file TypedView.h
+ * @brief Header file for TypedView class.
+ * @date 01/07/2019
+ * @author Bertrand Bauvir (IO)
+ * @copyright 2010-2019 ITER Organization
+ * @detail This header file contains the definition of the TypedView class template.
+ */
+
+#ifndef _TypedView_h_
+#define _TypedView_h_
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <type_traits> // std::is_standard_layout, etc.
+
+#include <stddef.h> // offsetof
+#include <stdint.h> // uintptr_t
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyType.h"
+#include "AnyValue.h"
+#include "AttributePath.h"
+#include "ScalarType.h"
+
+// Constants
+
+/**
+ * @brief Field descriptor for a member of a C structure, see TypedView.
+ * @detail The member designator is also the attribute path within the type definition,
+ * e.g. 'value.setpoint' or 'array[3]'.
+ */
+
+#define TYPEDVIEW_FIELD(Struct,member) { #member, \
+                                         static_cast<ccs::types::uint32>(offsetof(Struct,member)), \
+                                         static_cast<ccs::types::uint32>(sizeof(static_cast<Struct*>(0)->member)), \
+                                         &ccs::types::TypedViewField::Is<std::remove_reference<decltype(static_cast<Struct*>(0)->member)>::type> }
+
+// Type definition
+
+namespace ccs {
+
+namespace types {
+
+/**
+ * @brief Field descriptor.
+ */
+
+typedef struct TypedViewField {
+
+  const char8* path;
+  uint32 offset;
+  uint32 size;
+
+  bool (*check) (const std::shared_ptr<const AnyType>& type);
+
+  /**
+   * @brief Test method.
+   * @detail The default implementation accepts any type, the size being verified
+   * separately. Specialised for built-in scalar types.
+   * @return True if the type is compatible with the member.
+   */
+
+  template <typename Type> static inline bool Is (const std::shared_ptr<const AnyType>& type);
+
+} TypedViewField_t;
+
+/**
+ * @brief Typed view over instances of an introspectable type.
+ * @detail The view maps a C structure onto the memory of AnyValue instances. The
+ * structure is described by a compile-time list of fields which is validated once,
+ * upon construction, against the type definition. Attribute offsets, sizes and scalar
+ * types must match; as CompoundType attributes are packed, the structure must not
+ * include padding between the described fields.
+ *
+ * WARNING - The structure may include tail padding beyond the instance memory, members
+ * must be accessed individually and not the structure copied as a whole.
+ *
+ * Once validated, members are accessed directly through the structure pointer,
+ * as opposed to ccs::HelperTools::GetAttributeValue, etc. which check the attribute
+ * type and size at every call.
+ *
+ * The view remains valid for any instance of the type it has been validated against,
+ * or of any type with identical memory layout.
+ *
+ * @code
+   typedef struct MyType {
+     ccs::types::uint64 timestamp;
+     ccs::types::float64 setpoint;
+     ccs::types::uint32 counter;
+     ccs::types::boolean valid;
+   } MyType_t;
+
+   static const ccs::types::TypedViewField_t __fields [] = { TYPEDVIEW_FIELD(MyType_t, timestamp),
+                                                             TYPEDVIEW_FIELD(MyType_t, setpoint),
+                                                             TYPEDVIEW_FIELD(MyType_t, counter),
+                                                             TYPEDVIEW_FIELD(MyType_t, valid) };
+
+   ccs::types::TypedView<MyType_t> view (value.GetType(), __fields);
+
+   MyType_t* data = view.GetReference(value);
+
+   bool status = (NULL_PTR_CAST(MyType_t*) != data);
+
+   for (...) // Hot path
+     {
+       data->counter += 1u;
+       ...
+     }
+   @endcode
+ */
+
+template <typename Struct> class TypedView
+{
+
+  private:
+
+    std::shared_ptr<const AnyType> __type;
+
+    uint32 __extent; // Size of the type the view has been validated against
+
+    bool __valid;
+
+    static_assert(std::is_standard_layout<Struct>::value && std::is_trivial<Struct>::value, "TypedView requires a C structure");
+    static_assert(alignof(Struct) <= sizeof(uint64), "TypedView requires structure alignment not exceeding that of AnyValue instances");
+
+  protected:
+
+  public:
+
+    /**
+     * @brief Constructor. NOOP.
+     * @post
+     *   IsValid() == false
+     */
+
+    TypedView (void);
+
+    /**
+     * @brief Constructor.
+     * @detail Validates the field list, see TypedView::Validate.
+     */
+
+    template <uint32 Number> TypedView (const std::shared_ptr<const AnyType>& type, const TypedViewField_t (&fields) [Number]);
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+
+    virtual ~TypedView (void);
+
+    /**
+     * @brief Validate method.
+     * @detail Resolves each field within the type definition and verifies its offset,
+     * size and type. The structure must not exceed the type size but for tail padding.
+     * @param type Introspectable type definition.
+     * @param fields Field list.
+     * @param number Number of fields.
+     * @return True if the structure matches the type definition.
+     */
+
+    bool Validate (const std::shared_ptr<const AnyType>& type, const TypedViewField_t * const fields, const uint32 number);
+
+    /**
+     * @brief Accessor.
+     * @return True if the field list has been successfully validated.
+     */
+
+    bool IsValid (void) const;
+
+    /**
+     * @brief Accessor.
+     * @return Type definition the view has been validated against.
+     */
+
+    std::shared_ptr<const AnyType> GetType (void) const;
+
+    /**
+     * @brief Accessor.
+     * @detail The instance size and alignment are verified, not its type.
+     * @param ref Instance of the type the view has been validated against.
+     * @param size Size of the instance.
+     * @return Structure reference, NULL if invalid view or instance.
+     */
+
+    inline Struct* GetReference (const void * const ref, const uint32 size) const;
+    inline Struct* GetReference (const AnyValue& value) const;
+
+};
+
+// Global variables
+
+// Function declaration
+
+// Function definition
+
+template <typename Type> inline bool TypedViewField::Is (const std::shared_ptr<const AnyType>& type) { return static_cast<bool>(type); }
+
+template <> inline bool TypedViewField::Is<boolean> (const std::shared_ptr<const AnyType>& type) { return static_cast<bool>(std::dynamic_pointer_cast<const ScalarTypeT<boolean>>(type)); }
+template <> inline bool TypedViewField::Is<char8> (const std::shared_ptr<const AnyType>& type) { return static_cast<bool>(std::dynamic_pointer_cast<const ScalarTypeT<char8>>(type)); }
+template <> inline bool TypedViewField::Is<int8> (const std::shared_ptr<const AnyType>& type) { return static_cast<bool>(std::dynamic_pointer_cast<const ScalarTypeT<int8>>(type)); }
+template <> inline bool TypedViewField::Is<uint8> (const std::shared_ptr<const AnyType>& type) { return static_cast<bool>(std::dynamic_pointer_cast<const ScalarTypeT<uint8>>(type)); }
+template <> inline bool TypedViewField::Is<int16> (const std::shared_ptr<const AnyType>& type) { return static_cast<bool>(std::dynamic_pointer_cast<const ScalarTypeT<int16>>(type)); }
+template <> inline bool TypedViewField::Is<uint16> (const std::shared_ptr<const AnyType>& type) { return static_cast<bool>(std::dynamic_pointer_cast<const ScalarTypeT<uint16>>(type)); }
+template <> inline bool TypedViewField::Is<int32> (const std::shared_ptr<const AnyType>& type) { return static_cast<bool>(std::dynamic_pointer_cast<const ScalarTypeT<int32>>(type)); }
+template <> inline bool TypedViewField::Is<uint32> (const std::shared_ptr<const AnyType>& type) { return static_cast<bool>(std::dynamic_pointer_cast<const ScalarTypeT<uint32>>(type)); }
+template <> inline bool TypedViewField::Is<int64> (const std::shared_ptr<const AnyType>& type) { return static_cast<bool>(std::dynamic_pointer_cast<const ScalarTypeT<int64>>(type)); }
+template <> inline bool TypedViewField::Is<uint64> (const std::shared_ptr<const AnyType>& type) { return static_cast<bool>(std::dynamic_pointer_cast<const ScalarTypeT<uint64>>(type)); }
+template <> inline bool TypedViewField::Is<float32> (const std::shared_ptr<const AnyType>& type) { return static_cast<bool>(std::dynamic_pointer_cast<const ScalarTypeT<float32>>(type)); }
+template <> inline bool TypedViewField::Is<float64> (const std::shared_ptr<const AnyType>& type) { return static_cast<bool>(std::dynamic_pointer_cast<const ScalarTypeT<float64>>(type)); }
+template <> inline bool TypedViewField::Is<string> (const std::shared_ptr<const AnyType>& type) { return static_cast<bool>(std::dynamic_pointer_cast<const ScalarTypeT<string>>(type)); }
+
+template <typename Struct> TypedView<Struct>::TypedView (void) : __extent(0u), __valid(false) {}
+
+template <typename Struct> template <uint32 Number> TypedView<Struct>::TypedView (const std::shared_ptr<const AnyType>& type, const TypedViewField_t (&fields) [Number]) : __extent(0u), __valid(false)
+{
+  (void)this->Validate(type, fields, Number);
+}
+
+template <typename Struct> TypedView<Struct>::~TypedView (void) {}
+
+template <typename Struct> bool TypedView<Struct>::Validate (const std::shared_ptr<const AnyType>& type, const TypedViewField_t * const fields, const uint32 number)
+{
+
+  __valid = false;
+  __type = type;
+  __extent = 0u;
+
+  bool status = (static_cast<bool>(type) && (NULL_PTR_CAST(const TypedViewField_t*) != fields));
+
+  if (status)
+    {
+      __extent = type->GetSize();
+      status = (static_cast<uint32>(sizeof(Struct)) < (__extent + static_cast<uint32>(alignof(Struct))));
+
+      if (!status)
+        {
+          log_error("TypedView::Validate - Structure exceeds '%s' type size", type->GetName());
+        }
+    }
+
+  for (uint32 index = 0u; (status && (index < number)); index += 1u)
+    {
+      AttributePath path (type, fields[index].path);
+
+      status = (path.IsValid() &&
+                (fields[index].offset == path.GetOffset()) &&
+                (fields[index].size == path.GetSize()) &&
+                (fields[index].check)(path.GetType()));
+
+      if (!status)
+        {
+          log_error("TypedView::Validate - Field '%s' does not match '%s' type definition", fields[index].path, type->GetName());
+        }
+    }
+
+  __valid = status;
+
+  return status;
+
+}
+
+template <typename Struct> bool TypedView<Struct>::IsValid (void) const { return __valid; }
+
+template <typename Struct> std::shared_ptr<const AnyType> TypedView<Struct>::GetType (void) const { return __type; }
+
+template <typename Struct> inline Struct* TypedView<Struct>::GetReference (const void * const ref, const uint32 size) const
+{
+
+  Struct* data = NULL_PTR_CAST(Struct*);
+
+  if (__valid && (NULL_PTR_CAST(const void*) != ref) && (__extent <= size) &&
+      (0u == (reinterpret_cast<uintptr_t>(ref) % alignof(Struct))))
+    {
+      data = static_cast<Struct*>(const_cast<void*>(ref));
+    }
+
+  return data;
+
+}
+
+template <typename Struct> inline Struct* TypedView<Struct>::GetReference (const AnyValue& value) const { return this->GetReference(value.GetInstance(), value.GetSize()); }
+
+} // namespace types
+
+} // namespace ccs
+
+#endif // _TypedView_h_
+
@@ -21,6 +21,12 @@
 
 // Global header files
 
+#include <atomic> // std::atomic
+#include <thread> // std::thread
+
+#include <stdio.h> // snprintf
+#include <string.h> // strcmp
+
 #include <gtest/gtest.h> // Google test framework
 
 // Local header files
@@ -286,3 +292,157 @@ TEST(AnyTypeDatabase_Test, CISDemo_types)
   ASSERT_EQ(ret, true);
 }
 
+
+TEST(AnyTypeDatabase_Test, Remove)
+{
+  bool ret = !ccs::types::GlobalTypeDatabase::IsValid("test::gtdb::removed");
+
+  if (ret)
+    {
+      ret = (ccs::types::GlobalTypeDatabase::Register((new (std::nothrow) ccs::types::CompoundType ("test::gtdb::removed"))->AddAttribute<ccs::types::uint32>("first")) &&
+	     ccs::types::GlobalTypeDatabase::IsValid("test::gtdb::removed"));
+    }
+
+  if (ret)
+    {
+      ret = (ccs::types::GlobalTypeDatabase::Remove("test::gtdb::removed") &&
+	     !ccs::types::GlobalTypeDatabase::IsValid("test::gtdb::removed") &&
+	     !ccs::types::GlobalTypeDatabase::Remove("test::gtdb::removed"));
+    }
+
+  if (ret)
+    { // Register anew
+      ret = (ccs::types::GlobalTypeDatabase::Register((new (std::nothrow) ccs::types::CompoundType ("test::gtdb::removed"))->AddAttribute<ccs::types::uint64>("second")) &&
+	     ccs::types::GlobalTypeDatabase::GetAsType<ccs::types::CompoundType>("test::gtdb::removed")->HasAttribute("second"));
+    }
+
+  if (ret)
+    {
+      ret = ccs::types::GlobalTypeDatabase::Remove("test::gtdb::removed");
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AnyTypeDatabase_Test, Intern)
+{
+  std::shared_ptr<const ccs::types::AnyType> first ((new (std::nothrow) ccs::types::CompoundType ("test::gtdb::interned"))
+						    ->AddAttribute<ccs::types::boolean>("status")
+						    ->AddAttribute<ccs::types::uint64>("timestamp"));
+  std::shared_ptr<const ccs::types::AnyType> second ((new (std::nothrow) ccs::types::CompoundType ("test::gtdb::alias"))
+						     ->AddAttribute<ccs::types::boolean>("status")
+						     ->AddAttribute<ccs::types::uint64>("timestamp"));
+  std::shared_ptr<const ccs::types::AnyType> other ((new (std::nothrow) ccs::types::CompoundType ("test::gtdb::other"))
+						    ->AddAttribute<ccs::types::boolean>("status")
+						    ->AddAttribute<ccs::types::uint32>("timestamp")); // Different attribute type
+  std::shared_ptr<const ccs::types::AnyType> renamed ((new (std::nothrow) ccs::types::CompoundType ("test::gtdb::renamed"))
+						      ->AddAttribute<ccs::types::boolean>("valid") // Different attribute name
+						      ->AddAttribute<ccs::types::uint64>("timestamp"));
+
+  std::shared_ptr<const ccs::types::AnyType> canonical = ccs::types::GlobalTypeDatabase::Intern(first);
+
+  bool ret = (static_cast<bool>(canonical) &&
+	      (canonical == ccs::types::GlobalTypeDatabase::Intern(second)) &&
+	      (canonical != ccs::types::GlobalTypeDatabase::Intern(other)) &&
+	      (canonical != ccs::types::GlobalTypeDatabase::Intern(renamed)) &&
+	      (renamed == ccs::types::GlobalTypeDatabase::Intern(renamed)) &&
+	      ccs::HelperTools::HasAttribute(ccs::types::GlobalTypeDatabase::Intern(renamed), "valid") &&
+	      (ccs::types::Float64 == ccs::types::GlobalTypeDatabase::Intern(ccs::types::Float64)) &&
+	      !ccs::types::GlobalTypeDatabase::Intern(std::shared_ptr<const ccs::types::AnyType>()));
+
+  if (ret)
+    { // Registered types are canonical
+      ret = ((ccs::types::GlobalTypeDatabase::IsValid("test::struct") || ccs::types::GlobalTypeDatabase::Register((new (std::nothrow) ccs::types::CompoundType ("test::struct"))
+																 ->AddAttribute<ccs::types::boolean>("status")
+																 ->AddAttribute<ccs::types::uint64>("timestamp"))) &&
+	     (ccs::types::GlobalTypeDatabase::Intern(ccs::types::GlobalTypeDatabase::GetType("test::struct")) == ccs::types::GlobalTypeDatabase::Intern(second)));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AnyTypeDatabase_Test, Concurrent)
+{
+  std::atomic<bool> done (false);
+  std::atomic<bool> fail (false);
+
+  auto reader = [&done, &fail] (void) {
+    while (!done.load())
+      {
+	if (!ccs::types::GlobalTypeDatabase::IsValid("float64") || (ccs::types::Float64 != ccs::types::GlobalTypeDatabase::GetType("float64")))
+	  {
+	    fail.store(true);
+	  }
+      }
+  };
+
+  std::thread first (reader);
+  std::thread second (reader);
+
+  bool ret = true;
+
+  // Registrations cause the index to be re-built concurrently to readers
+  for (ccs::types::uint32 index = 0u; (ret && (index < 512u)); index += 1u)
+    {
+      ccs::types::char8 name [STRING_MAX_LENGTH];
+      (void)snprintf(name, STRING_MAX_LENGTH, "test::gtdb::concurrent_%u", index);
+
+      ret = (ccs::types::GlobalTypeDatabase::IsValid(name) ||
+	     (ccs::types::GlobalTypeDatabase::Register((new (std::nothrow) ccs::types::CompoundType (name))->AddAttribute<ccs::types::uint32>(name + 12u)) &&
+	      ccs::types::GlobalTypeDatabase::IsValid(name)));
+    }
+
+  done.store(true);
+
+  first.join();
+  second.join();
+
+  if (ret)
+    {
+      ret = !fail.load();
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AnyTypeDatabase_Test, Concurrent_remove)
+{
+  std::atomic<bool> done (false);
+  std::atomic<bool> fail (false);
+
+  auto reader = [&done, &fail] (void) {
+    while (!done.load())
+      {
+	std::shared_ptr<const ccs::types::AnyType> type = ccs::types::GlobalTypeDatabase::GetType("test::gtdb::transient");
+
+	if (type && (0 != strcmp(type->GetName(), "test::gtdb::transient")))
+	  {
+	    fail.store(true);
+	  }
+      }
+  };
+
+  std::thread first (reader);
+  std::thread second (reader);
+
+  bool ret = true;
+
+  // Removed entries and superseded tables are reclaimed concurrently to readers
+  for (ccs::types::uint32 index = 0u; (ret && (index < 512u)); index += 1u)
+    {
+      ret = (ccs::types::GlobalTypeDatabase::Register((new (std::nothrow) ccs::types::CompoundType ("test::gtdb::transient"))->AddAttribute<ccs::types::uint32>("value")) &&
+	     ccs::types::GlobalTypeDatabase::Remove("test::gtdb::transient"));
+    }
+
+  done.store(true);
+
+  first.join();
+  second.join();
+
+  if (ret)
+    {
+      ret = (!fail.load() && !ccs::types::GlobalTypeDatabase::IsValid("test::gtdb::transient"));
+    }
+
+  ASSERT_EQ(ret, true);
+}
@@ -0,0 +1,230 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/test/c++/unit/AnyValueAllocator-tests.cpp $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Unit test code
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*				  CS 90 046
+*				  13067 St. Paul-lez-Durance Cedex
+*				  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <new> // std::nothrow, etc.
+
+#include <string.h> // memset, etc.
+
+#include <gtest/gtest.h> // Google test framework
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+#include "TimeTools.h" // Misc. helper functions
+
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyTypeHelper.h"
+#include "AnyValueHelper.h"
+
+#include "AnyValueAllocator.h"
+
+// Constants
+
+// Type definition
+
+class AnyValueAllocator_Test : public ccs::types::PoolAllocator
+{
+
+  public:
+
+    ccs::types::uint32 allocated;
+    ccs::types::uint32 released;
+
+    std::shared_ptr<const ccs::types::AnyType> type;
+
+    AnyValueAllocator_Test (void) : ccs::types::PoolAllocator () {
+
+      allocated = 0u;
+      released = 0u;
+
+      type = std::shared_ptr<const ccs::types::AnyType> (ccs::HelperTools::NewArrayType("ccs::test::AllocatorArray_t", ccs::types::Float64, 32u));
+
+      return;
+
+    };
+
+    virtual ~AnyValueAllocator_Test (void) {};
+
+    virtual void* Allocate (const ccs::types::uint32 size) { allocated += 1u; return ccs::types::PoolAllocator::Allocate(size); };
+    virtual void Release (void * const ref, const ccs::types::uint32 size) { released += 1u; return ccs::types::PoolAllocator::Release(ref, size); };
+
+};
+
+// Global variables
+
+static ccs::log::Func_t __handler = ccs::log::SetStdout();
+
+// Function declaration
+
+// Function definition
+
+TEST(AnyValueAllocator_Test, Inline)
+{
+  using namespace ccs::types;
+
+  AnyValueAllocator_Test test;
+
+  AnyValueAllocator::SetDefault(&test);
+
+  AnyValue value (Float64);
+  AnyValue copy (value);
+
+  bool ret = ((NULL_PTR_CAST(void*) != value.GetInstance()) &&
+	      (static_cast<uint8*>(value.GetInstance()) >= reinterpret_cast<uint8*>(&value)) &&
+	      (static_cast<uint8*>(value.GetInstance()) < (reinterpret_cast<uint8*>(&value) + sizeof(AnyValue))) &&
+	      (value.GetInstance() != copy.GetInstance()) &&
+	      (0u == test.allocated));
+
+  if (ret)
+    {
+      value = 0.5;
+      copy = value;
+      ret = (0.5 == static_cast<float64>(copy));
+    }
+
+  AnyValueAllocator::SetDefault(NULL_PTR_CAST(AnyValueAllocator*));
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AnyValueAllocator_Test, Default)
+{
+  using namespace ccs::types;
+
+  AnyValueAllocator_Test test;
+
+  AnyValueAllocator::SetDefault(&test);
+
+  void* instance = NULL_PTR_CAST(void*);
+
+  {
+    AnyValue value (test.type);
+    instance = value.GetInstance();
+  }
+
+  bool ret = ((1u == test.allocated) && (1u == test.released));
+
+  if (ret)
+    { // Recycled through the pool
+      AnyValue value (test.type);
+      ret = ((instance == value.GetInstance()) && (2u == test.allocated));
+    }
+
+  AnyValueAllocator::SetDefault(NULL_PTR_CAST(AnyValueAllocator*));
+
+  if (ret)
+    {
+      AnyValue value (test.type);
+      ret = (2u == test.allocated);
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AnyValueAllocator_Test, Pool)
+{
+  using namespace ccs::types;
+
+  PoolAllocator pool (1u);
+
+  void* first = pool.Allocate(100u);
+  void* second = pool.Allocate(100u);
+
+  bool ret = ((NULL_PTR_CAST(void*) != first) && (NULL_PTR_CAST(void*) != second) && (first != second));
+
+  if (ret)
+    {
+      memset(first, 0xff, 128u); // Size class
+      pool.Release(first, 100u);
+      pool.Release(second, 100u); // Beyond limit
+      ret = ((first == pool.Allocate(128u)) && (first != pool.Allocate(65u)));
+    }
+
+  if (ret)
+    { // Beyond largest size class
+      void* large = pool.Allocate(1048576u);
+      ret = (NULL_PTR_CAST(void*) != large);
+      pool.Release(large, 1048576u);
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AnyValueAllocator_Test, Arena)
+{
+  using namespace ccs::types;
+
+  AnyValueAllocator_Test test;
+
+  AnyValueAllocator::SetDefault(&test);
+
+  ArenaAllocator* arena = ArenaAllocator::GetThreadInstance();
+
+  void* instance = NULL_PTR_CAST(void*);
+
+  bool ret = (NULL_PTR_CAST(ArenaAllocator*) != arena);
+
+  for (uint32 index = 0u; (ret && (index < 16u)); index += 1u)
+    {
+      ArenaAllocator::Checkpoint checkpoint (*arena);
+
+      AnyValue value (test.type, *arena);
+      AnyValue other (test.type, *arena);
+
+      ret = ((NULL_PTR_CAST(void*) != value.GetInstance()) && (value.GetInstance() != other.GetInstance()) &&
+	     (0u == (reinterpret_cast<uintptr_t>(other.GetInstance()) % DEFAULT_ARENA_ALIGNMENT)));
+
+      if (ret)
+	{ // Memory is re-used and zeroed
+	  ret = (((0u == index) || (instance == value.GetInstance())) &&
+		 (0.0 == ccs::HelperTools::GetElementValue<float64>(&value, 31u)));
+	  instance = value.GetInstance();
+	}
+
+      if (ret)
+	{
+	  ccs::HelperTools::SetElementValue<float64>(&value, 31u, 1.0);
+	}
+
+      if (ret)
+	{ // Copies use the default allocator
+	  AnyValue copy (value);
+	  ret = ((1u == test.allocated) && (1.0 == ccs::HelperTools::GetElementValue<float64>(&copy, 31u)));
+	  test.allocated = 0u;
+	}
+    }
+
+  if (ret)
+    { // Large allocations
+      ArenaAllocator::Checkpoint checkpoint (*arena);
+      void* large = arena->Allocate(4u * DEFAULT_ARENA_CHUNK_SIZE);
+      ret = ((NULL_PTR_CAST(void*) != large) && (NULL_PTR_CAST(void*) != arena->Allocate(DEFAULT_ARENA_CHUNK_SIZE)));
+    }
+
+  AnyValueAllocator::SetDefault(NULL_PTR_CAST(AnyValueAllocator*));
+
+  ASSERT_EQ(ret, true);
+}
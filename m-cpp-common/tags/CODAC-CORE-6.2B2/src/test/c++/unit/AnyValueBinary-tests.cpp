@@ -0,0 +1,260 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/test/c++/unit/AnyValueBinary-tests.cpp $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Unit test code
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*				  CS 90 046
+*				  13067 St. Paul-lez-Durance Cedex
+*				  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <new> // std::nothrow, etc.
+#include <string> // std::string
+#include <vector> // std::vector
+
+#include <string.h> // memcmp, etc.
+
+#include <gtest/gtest.h> // Google test framework
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+#include "TimeTools.h" // Misc. helper functions
+
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyTypeDatabase.h"
+#include "AnyTypeHelper.h"
+#include "AnyValueHelper.h"
+
+#include "AnyValueBinary.h"
+
+// Constants
+
+// Type definition
+
+class AnyValueBinary_Test
+{
+
+  public:
+
+    std::shared_ptr<const ccs::types::AnyType> type;
+
+    AnyValueBinary_Test (const ccs::types::char8 * const name = "ccs::test::Binary_t") {
+
+      std::shared_ptr<const ccs::types::AnyType> scalars (dynamic_cast<ccs::types::AnyType*>((new (std::nothrow) ccs::types::CompoundType ("ccs::test::BinaryScalars_t"))
+														      ->AddAttribute("boolean","bool")
+														      ->AddAttribute("uint16","uint16")
+														      ->AddAttribute("float32","float32")
+														      ->AddAttribute("string","string")
+														      ->AddAttribute("float64","float64")));
+
+      type = std::shared_ptr<const ccs::types::AnyType>(dynamic_cast<ccs::types::AnyType*>((new (std::nothrow) ccs::types::CompoundType (name))
+											   ->AddAttribute("counter", "uint64")
+											   ->AddAttribute("scalars", scalars)
+											   ->AddAttribute("array", ccs::HelperTools::NewArrayType("ccs::test::BinaryArray_t", scalars, 4u))));
+
+      return;
+
+    };
+
+    static void Fill (ccs::types::AnyValue& value) {
+
+      for (ccs::types::uint32 index = 0u; index < value.GetSize(); index += 1u)
+	{
+	  static_cast<ccs::types::uint8*>(value.GetInstance())[index] = static_cast<ccs::types::uint8>(index * 13u + 5u);
+	}
+
+      return;
+
+    };
+
+};
+
+// Global variables
+
+static ccs::log::Func_t __handler = ccs::log::SetStdout();
+
+// Function declaration
+
+// Function definition
+
+TEST(AnyValueBinary_Test, Fingerprint)
+{
+  using namespace ccs::types;
+
+  AnyValueBinary_Test test;
+  AnyValueBinary_Test other ("ccs::test::BinaryOther_t"); // Identical structure
+
+  std::shared_ptr<const AnyType> type;
+
+  bool ret = ((0ul != ccs::HelperTools::GetFingerprint(test.type)) &&
+	      (0ul == ccs::HelperTools::GetFingerprint(type)) &&
+	      (ccs::HelperTools::GetFingerprint(test.type) == ccs::HelperTools::GetFingerprint(other.type)));
+
+  if (ret)
+    {
+      std::shared_ptr<const AnyType> modified (dynamic_cast<AnyType*>((new (std::nothrow) CompoundType ("ccs::test::Binary_t"))
+								       ->AddAttribute("counter", "int64") // Different scalar type
+								       ->AddAttribute("scalars", std::dynamic_pointer_cast<const CompoundType>(test.type)->GetAttributeType("scalars"))
+								       ->AddAttribute("array", std::dynamic_pointer_cast<const CompoundType>(test.type)->GetAttributeType("array"))));
+
+      ret = (ccs::HelperTools::GetFingerprint(test.type) != ccs::HelperTools::GetFingerprint(modified));
+    }
+
+  if (ret)
+    { // Swapped attribute names
+      std::shared_ptr<const AnyType> first (dynamic_cast<AnyType*>((new (std::nothrow) CompoundType ("ccs::test::BinaryPoint_t"))
+								   ->AddAttribute("x", "float64")
+								   ->AddAttribute("y", "float64")));
+      std::shared_ptr<const AnyType> second (dynamic_cast<AnyType*>((new (std::nothrow) CompoundType ("ccs::test::BinaryPoint_t"))
+								    ->AddAttribute("y", "float64")
+								    ->AddAttribute("x", "float64")));
+
+      AnyValue value (first);
+      AnyValue copy (second);
+
+      std::vector<uint8> buffer;
+
+      ret = ((ccs::HelperTools::GetFingerprint(first) != ccs::HelperTools::GetFingerprint(second)) &&
+	     ccs::HelperTools::SerialiseBinary(value, buffer) &&
+	     (0u == ccs::HelperTools::ParseBinary(copy, &buffer[0], static_cast<uint32>(buffer.size()))));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AnyValueBinary_Test, Typed)
+{
+  using namespace ccs::types;
+
+  AnyValueBinary_Test test;
+
+  AnyValue value (test.type);
+  AnyValue copy (test.type);
+
+  AnyValueBinary_Test::Fill(value);
+
+  std::vector<uint8> buffer;
+
+  bool ret = ccs::HelperTools::SerialiseBinary(value, buffer);
+
+  if (ret)
+    {
+      ret = ((buffer.size() == ccs::HelperTools::ParseBinary(copy, &buffer[0], static_cast<uint32>(buffer.size()))) &&
+	     (0 == memcmp(value.GetInstance(), copy.GetInstance(), value.GetSize())));
+    }
+
+  if (ret)
+    { // Network byte order
+      buffer.clear();
+      memset(copy.GetInstance(), 0, copy.GetSize());
+      ret = ccs::HelperTools::SerialiseBinary(value, buffer, false, NetworkByteOrder);
+    }
+
+  if (ret)
+    {
+      ret = ((buffer.size() == ccs::HelperTools::ParseBinary(copy, &buffer[0], static_cast<uint32>(buffer.size()))) &&
+	     (0 == memcmp(value.GetInstance(), copy.GetInstance(), value.GetSize())));
+    }
+
+  if (ret)
+    { // Incompatible type
+      AnyValue other (UnsignedInteger64);
+      ret = (0u == ccs::HelperTools::ParseBinary(other, &buffer[0], static_cast<uint32>(buffer.size())));
+    }
+
+  if (ret)
+    { // Truncated buffer
+      ret = (0u == ccs::HelperTools::ParseBinary(copy, &buffer[0], static_cast<uint32>(buffer.size() - 1u)));
+    }
+
+  if (ret)
+    { // Corrupted header
+      buffer[0] = 0u;
+      ret = (0u == ccs::HelperTools::ParseBinary(copy, &buffer[0], static_cast<uint32>(buffer.size())));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AnyValueBinary_Test, Untyped)
+{
+  using namespace ccs::types;
+
+  AnyValueBinary_Test test ("ccs::test::BinaryUnregistered_t");
+
+  AnyValue value (test.type);
+
+  AnyValueBinary_Test::Fill(value);
+
+  std::vector<uint8> buffer;
+
+  bool ret = ccs::HelperTools::SerialiseBinary(value, buffer);
+
+  if (ret)
+    { // Neither registered nor embedded type
+      AnyValue copy;
+      ret = (0u == ccs::HelperTools::ParseBinary(copy, &buffer[0], static_cast<uint32>(buffer.size())));
+    }
+
+  if (ret)
+    { // Embedded type
+      buffer.clear();
+      ret = ccs::HelperTools::SerialiseBinary(value, buffer, true);
+    }
+
+  if (ret)
+    {
+      AnyValue copy;
+      ret = ((buffer.size() == ccs::HelperTools::ParseBinary(copy, &buffer[0], static_cast<uint32>(buffer.size()))) &&
+	     (ccs::HelperTools::GetFingerprint(test.type) == ccs::HelperTools::GetFingerprint(copy.GetType())) &&
+	     (0 == memcmp(value.GetInstance(), copy.GetInstance(), value.GetSize())));
+    }
+
+  if (ret)
+    { // Registered type
+      AnyValueBinary_Test registered ("ccs::test::BinaryRegistered_t");
+
+      if (!GlobalTypeDatabase::IsValid("ccs::test::BinaryRegistered_t"))
+	{
+	  ret = GlobalTypeDatabase::Register(registered.type);
+	}
+
+      AnyValue other (GlobalTypeDatabase::GetType("ccs::test::BinaryRegistered_t"));
+      AnyValueBinary_Test::Fill(other);
+
+      buffer.clear();
+
+      if (ret)
+	{
+	  ret = ccs::HelperTools::SerialiseBinary(other, buffer);
+	}
+
+      if (ret)
+	{
+	  AnyValue copy;
+	  ret = ((buffer.size() == ccs::HelperTools::ParseBinary(copy, &buffer[0], static_cast<uint32>(buffer.size()))) &&
+		 (GlobalTypeDatabase::GetType("ccs::test::BinaryRegistered_t") == copy.GetType()) &&
+		 (0 == memcmp(other.GetInstance(), copy.GetInstance(), other.GetSize())));
+	}
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
@@ -0,0 +1,220 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/test/c++/unit/AnyValueDelta-tests.cpp $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Unit test code
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*				  CS 90 046
+*				  13067 St. Paul-lez-Durance Cedex
+*				  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <new> // std::nothrow, etc.
+#include <vector> // std::vector
+
+#include <string.h> // memcmp, etc.
+
+#include <gtest/gtest.h> // Google test framework
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+#include "TimeTools.h" // Misc. helper functions
+
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyTypeHelper.h"
+#include "AnyValueHelper.h"
+
+#include "AnyValueDelta.h"
+
+// Constants
+
+// Type definition
+
+class AnyValueDelta_Test
+{
+
+  public:
+
+    std::shared_ptr<const ccs::types::AnyType> type;
+
+    AnyValueDelta_Test (void) {
+
+      std::shared_ptr<const ccs::types::AnyType> scalars (dynamic_cast<ccs::types::AnyType*>((new (std::nothrow) ccs::types::CompoundType ("ccs::test::DeltaScalars_t"))
+											     ->AddAttribute("boolean","bool")
+											     ->AddAttribute("uint16","uint16")
+											     ->AddAttribute("float32","float32")
+											     ->AddAttribute("string","string")
+											     ->AddAttribute("float64","float64")));
+
+      type = std::shared_ptr<const ccs::types::AnyType>(dynamic_cast<ccs::types::AnyType*>((new (std::nothrow) ccs::types::CompoundType ("ccs::test::Delta_t"))
+											   ->AddAttribute("counter", "uint64")
+											   ->AddAttribute("scalars", scalars)
+											   ->AddAttribute("array", ccs::HelperTools::NewArrayType("ccs::test::DeltaArray_t", ccs::types::Float32, 64u))));
+
+      return;
+
+    };
+
+};
+
+// Global variables
+
+static ccs::log::Func_t __handler = ccs::log::SetStdout();
+
+// Function declaration
+
+// Function definition
+
+TEST(AnyValueDelta_Test, Diff)
+{
+  using namespace ccs::types;
+
+  AnyValueDelta_Test test;
+
+  AnyValue previous (test.type);
+  AnyValue current (test.type);
+
+  AnyValueDelta delta;
+
+  bool ret = (ccs::HelperTools::Diff(previous, current, delta) && delta.IsEmpty() &&
+	      (test.type->GetFingerprint() == delta.GetFingerprint()) && (test.type->GetSize() == delta.GetSize()));
+
+  if (ret)
+    {
+      ret = (ccs::HelperTools::SetAttributeValue<uint64>(&current, "counter", 1ul) &&
+	     ccs::HelperTools::SetAttributeValue<boolean>(&current, "scalars.boolean", true) &&
+	     ccs::HelperTools::SetAttributeValue<uint16>(&current, "scalars.uint16", 0x0100u) &&
+	     ccs::HelperTools::SetAttributeValue(&current, "scalars.string", "\"delta\"") &&
+	     ccs::HelperTools::SetAttributeValue<float32>(&current, "array[3]", 1.0f) &&
+	     ccs::HelperTools::SetAttributeValue<float32>(&current, "array[4]", 1.0f) &&
+	     ccs::HelperTools::SetAttributeValue<float32>(&current, "array[63]", 1.0f));
+    }
+
+  if (ret)
+    {
+      ret = ccs::HelperTools::Diff(previous, current, delta);
+    }
+
+  if (ret)
+    {
+      ret = (ccs::HelperTools::Patch(previous, delta) &&
+	     (0 == memcmp(previous.GetInstance(), current.GetInstance(), current.GetSize())));
+    }
+
+  if (ret)
+    { // Incompatible type
+      AnyValue other (UnsignedInteger64);
+      ret = (!ccs::HelperTools::Diff(previous, other, delta) && !ccs::HelperTools::Patch(other, delta));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AnyValueDelta_Test, Ranges)
+{
+  using namespace ccs::types;
+
+  AnyValueDelta_Test test;
+
+  AnyValue previous (test.type);
+  AnyValue current (test.type);
+
+  AnyValueDelta delta;
+
+  bool ret = (ccs::HelperTools::SetAttributeValue<uint64>(&current, "counter", 1ul) &&
+	      ccs::HelperTools::SetAttributeValue<boolean>(&current, "scalars.boolean", true) &&
+	      ccs::HelperTools::SetAttributeValue<uint16>(&current, "scalars.uint16", 0x0100u) && // Single byte difference
+	      ccs::HelperTools::SetAttributeValue(&current, "scalars.string", "\"delta\"") &&
+	      ccs::HelperTools::SetAttributeValue<float32>(&current, "array[3]", 1.0f) &&
+	      ccs::HelperTools::SetAttributeValue<float32>(&current, "array[4]", 1.0f) &&
+	      ccs::HelperTools::SetAttributeValue<float32>(&current, "array[63]", 1.0f));
+
+  if (ret)
+    {
+      ret = ccs::HelperTools::Diff(previous, current, delta);
+    }
+
+  if (ret)
+    { // Whole leaves, adjacent ones merged
+      const std::vector<AnyValueDelta::Range_t>& ranges = delta.GetRanges();
+
+      uint32 string = ccs::HelperTools::GetAttributeOffset(&current, "scalars.string");
+      uint32 array = ccs::HelperTools::GetAttributeOffset(&current, "array");
+
+      ret = ((4u == ranges.size()) &&
+	     (0u == ranges[0].offset) && (11u == ranges[0].size) && // counter, boolean, uint16
+	     (string == ranges[1].offset) && (STRING_MAX_LENGTH == ranges[1].size) &&
+	     ((array + 12u) == ranges[2].offset) && (8u == ranges[2].size) &&
+	     ((array + 252u) == ranges[3].offset) && (4u == ranges[3].size) &&
+	     ((11u + STRING_MAX_LENGTH + 12u) == delta.GetData().size()));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AnyValueDelta_Test, Serialise)
+{
+  using namespace ccs::types;
+
+  AnyValueDelta_Test test;
+
+  AnyValue previous (test.type);
+  AnyValue current (test.type);
+
+  AnyValueDelta delta;
+  AnyValueDelta copy;
+
+  bool ret = (ccs::HelperTools::SetAttributeValue<float64>(&current, "scalars.float64", 0.1) &&
+	      ccs::HelperTools::SetAttributeValue<float32>(&current, "array[10]", 0.1f) &&
+	      ccs::HelperTools::Diff(previous, current, delta));
+
+  std::vector<uint8> buffer;
+
+  if (ret)
+    {
+      ret = (delta.Serialise(buffer) && ((ANYVALUE_DELTA_HEADER_SIZE + 4u + 12u) == buffer.size()));
+    }
+
+  if (ret)
+    {
+      ret = ((buffer.size() == copy.Parse(&buffer[0], static_cast<uint32>(buffer.size()))) &&
+	     ccs::HelperTools::Patch(previous, copy) &&
+	     (0 == memcmp(previous.GetInstance(), current.GetInstance(), current.GetSize())));
+    }
+
+  if (ret)
+    { // Truncated buffer
+      ret = (0u == copy.Parse(&buffer[0], static_cast<uint32>(buffer.size() - 1u)));
+    }
+
+  if (ret)
+    { // Range beyond instance size
+      buffer[ANYVALUE_DELTA_HEADER_SIZE] = 0xFFu;
+      ret = (0u == copy.Parse(&buffer[0], static_cast<uint32>(buffer.size())));
+    }
+
+  if (ret)
+    { // Corrupted header
+      buffer[0] = 0u;
+      ret = (0u == copy.Parse(&buffer[0], static_cast<uint32>(buffer.size())));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
@@ -0,0 +1,199 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/test/c++/unit/AnyValueJSON-tests.cpp $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Unit test code
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*				  CS 90 046
+*				  13067 St. Paul-lez-Durance Cedex
+*				  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <new> // std::nothrow, etc.
+#include <string> // std::string
+
+#include <string.h> // memcmp, etc.
+
+#include <gtest/gtest.h> // Google test framework
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+#include "TimeTools.h" // Misc. helper functions
+
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyTypeHelper.h"
+#include "AnyValueHelper.h"
+
+#include "AnyValueJSON.h"
+
+// Constants
+
+// Type definition
+
+class AnyValueJSON_Test
+{
+
+  public:
+
+    std::shared_ptr<const ccs::types::AnyType> type;
+
+    AnyValueJSON_Test (void) {
+
+      std::shared_ptr<const ccs::types::AnyType> scalars (dynamic_cast<ccs::types::AnyType*>((new (std::nothrow) ccs::types::CompoundType ("ccs::test::JSONScalars_t"))
+														      ->AddAttribute("boolean","bool")
+														      ->AddAttribute("char8","char8")
+														      ->AddAttribute("int16","int16")
+														      ->AddAttribute("uint64","uint64")
+														      ->AddAttribute("float32","float32")
+														      ->AddAttribute("float64","float64")
+														      ->AddAttribute("string","string")));
+
+      type = std::shared_ptr<const ccs::types::AnyType>(dynamic_cast<ccs::types::AnyType*>((new (std::nothrow) ccs::types::CompoundType ("ccs::test::JSONCompound_t"))
+											   ->AddAttribute("counter", "int64")
+											   ->AddAttribute("scalars", scalars)
+											   ->AddAttribute("name", ccs::HelperTools::NewArrayType("ccs::test::JSONName_t", ccs::types::Character8, 16u))
+											   ->AddAttribute("array", ccs::HelperTools::NewArrayType("ccs::test::JSONArray_t", scalars, 2u))));
+
+      return;
+
+    };
+
+};
+
+// Global variables
+
+static ccs::log::Func_t __handler = ccs::log::SetStdout();
+
+// Function declaration
+
+// Function definition
+
+TEST(AnyValueJSON_Test, Parse)
+{
+  using namespace ccs::types;
+
+  AnyValueJSON_Test test;
+
+  AnyValue value (test.type);
+
+  // Out of order, whitespace, unknown members, escape sequences, elements in excess
+  const char8* buffer = "{ \"array\" : [ {\"string\":\"a\\\"b\",\"boolean\":true,\"char8\":\"x\",\"int16\":-2,\"uint64\":0x10,\"float32\":0.5,\"float64\":-1e3},\n"
+                        "                {\"boolean\":0,\"char8\":\"y\",\"int16\":3,\"uint64\":4,\"float32\":5,\"float64\":6,\"string\":unquoted} , {\"ignored\":1} ],\n"
+                        "  \"unknown\": {\"nested\":[1,2,{\"a\":\"}\"}]},\n"
+                        "  \"name\": \"tab\\there\",\n"
+                        "  \"scalars\": {\"boolean\":false,\"char8\":\"z\",\"int16\":1,\"uint64\":18446744073709551615,\"float32\":0.1,\"float64\":0.1,\"string\":\"\"},\n"
+                        "  \"counter\": -9223372036854775807 }";
+
+  bool ret = (strlen(buffer) == ccs::HelperTools::ParseJSONInstance(test.type, value.GetInstance(), buffer));
+
+  if (ret)
+    {
+      ret = ((-9223372036854775807l == ccs::HelperTools::GetAttributeValue<int64>(&value, "counter")) &&
+             (18446744073709551615ul == ccs::HelperTools::GetAttributeValue<uint64>(&value, "scalars.uint64")) &&
+             (0.1f == ccs::HelperTools::GetAttributeValue<float32>(&value, "scalars.float32")) &&
+             (0.1 == ccs::HelperTools::GetAttributeValue<float64>(&value, "scalars.float64")) &&
+             (-2 == ccs::HelperTools::GetAttributeValue<int16>(&value, "array[0].int16")) &&
+             (16u == ccs::HelperTools::GetAttributeValue<uint64>(&value, "array[0].uint64")) &&
+             (-1e3 == ccs::HelperTools::GetAttributeValue<float64>(&value, "array[0].float64")) &&
+             ('y' == ccs::HelperTools::GetAttributeValue<char8>(&value, "array[1].char8")) &&
+             (true == ccs::HelperTools::GetAttributeValue<boolean>(&value, "array[0].boolean")) &&
+             (false == ccs::HelperTools::GetAttributeValue<boolean>(&value, "array[1].boolean")));
+    }
+
+  if (ret)
+    {
+      ret = ((0 == strcmp("a\"b", static_cast<char8*>(ccs::HelperTools::GetAttributeReference(&value, "array[0].string")))) &&
+             (0 == strcmp("unquoted", static_cast<char8*>(ccs::HelperTools::GetAttributeReference(&value, "array[1].string")))) &&
+             (0 == strcmp("tab\there", static_cast<char8*>(ccs::HelperTools::GetAttributeReference(&value, "name")))));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AnyValueJSON_Test, Parse_error)
+{
+  using namespace ccs::types;
+
+  AnyValueJSON_Test test;
+
+  AnyValue value (test.type);
+
+  const char8* buffers [] = { "{\"counter\":1}", // Missing attributes
+                              "[1,2]",
+                              "{\"counter\":1,\"scalars\":{\"boolean\":maybe}}",
+                              "{\"counter\":1,\"name\":\"unterminated" };
+
+  bool ret = true;
+
+  for (uint32 index = 0u; (ret && (index < sizeof(buffers)/sizeof(const char8*))); index += 1u)
+    {
+      ret = (0u == ccs::HelperTools::ParseJSONInstance(test.type, value.GetInstance(), buffers[index]));
+    }
+
+  if (ret)
+    { // Too few elements
+      std::shared_ptr<const AnyType> array (ccs::HelperTools::NewArrayType("ccs::test::JSONShort_t", UnsignedInteger32, 4u));
+      AnyValue other (array);
+      ret = ((0u == ccs::HelperTools::ParseJSONInstance(array, other.GetInstance(), "[1,2,3]")) &&
+             (0u < ccs::HelperTools::ParseJSONInstance(array, other.GetInstance(), "[1,2,3,4]")));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AnyValueJSON_Test, Serialise)
+{
+  using namespace ccs::types;
+
+  AnyValueJSON_Test test;
+
+  AnyValue value (test.type);
+  AnyValue copy (test.type);
+
+  ccs::HelperTools::SetAttributeValue<int64>(&value, "counter", -10l);
+  ccs::HelperTools::SetAttributeValue<float32>(&value, "scalars.float32", 3.14159265f);
+  ccs::HelperTools::SetAttributeValue<float64>(&value, "scalars.float64", 0.1 + 0.2);
+  ccs::HelperTools::SetAttributeValue<char8>(&value, "array[1].char8", '"');
+  ccs::HelperTools::SafeStringCopy(static_cast<char8*>(ccs::HelperTools::GetAttributeReference(&value, "array[0].string")), "quote\" back\\slash\nline", STRING_MAX_LENGTH);
+  ccs::HelperTools::SafeStringCopy(static_cast<char8*>(ccs::HelperTools::GetAttributeReference(&value, "name")), "name", 16u);
+
+  std::string buffer;
+
+  bool ret = value.SerialiseInstance(buffer);
+
+  if (ret)
+    {
+      log_info("TEST(AnyValueJSON_Test, Serialise) - '%s'", buffer.c_str());
+      ret = (0 == strncmp(buffer.c_str(), "{\"counter\":-10,\"scalars\":{\"boolean\":false,", 42u));
+    }
+
+  if (ret)
+    { // Round-trip
+      ret = (copy.ParseInstance(buffer.c_str()) && (0 == memcmp(value.GetInstance(), copy.GetInstance(), value.GetSize())));
+    }
+
+  if (ret)
+    { // Fixed size buffer truncates
+      char8 string [16];
+      ret = (value.SerialiseInstance(string, 16u) && (15u == strlen(string)) && (0 == strncmp(string, buffer.c_str(), 15u)));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
@@ -0,0 +1,237 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/test/c++/unit/AttributePath-tests.cpp $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Unit test code
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*				  CS 90 046
+*				  13067 St. Paul-lez-Durance Cedex
+*				  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <new> // std::nothrow, etc.
+
+#include <gtest/gtest.h> // Google test framework
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+#include "TimeTools.h" // Misc. helper functions
+
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyTypeHelper.h"
+#include "AnyValueHelper.h"
+
+#include "AttributePath.h"
+
+// Constants
+
+// Type definition
+
+typedef struct __attribute__((packed)) PathScalars {
+  ccs::types::boolean boolean;
+  ccs::types::uint32 uint32;
+  ccs::types::float64 float64;
+} PathScalars_t;
+
+class AttributePath_Test
+{
+
+  public:
+
+    std::shared_ptr<const ccs::types::AnyType> type;
+
+    AttributePath_Test (void) {
+
+      std::shared_ptr<const ccs::types::AnyType> scalars (dynamic_cast<ccs::types::AnyType*>((new (std::nothrow) ccs::types::CompoundType ("ccs::test::PathScalars_t"))
+													      ->AddAttribute("boolean","bool")
+													      ->AddAttribute("uint32","uint32")
+													      ->AddAttribute("float64","float64")));
+
+      type = std::shared_ptr<const ccs::types::AnyType>(dynamic_cast<ccs::types::AnyType*>((new (std::nothrow) ccs::types::CompoundType ("ccs::test::PathCompound_t"))
+											   ->AddAttribute("counter", "uint64")
+											   ->AddAttribute("scalars", scalars)
+											   ->AddAttribute("array", ccs::HelperTools::NewArrayType("ccs::test::PathArray_t", scalars, 4u))));
+
+      return;
+
+    };
+
+};
+
+// Global variables
+
+static ccs::log::Func_t __handler = ccs::log::SetStdout();
+
+// Function declaration
+
+// Function definition
+
+TEST(AttributePath_Test, Resolve)
+{
+  using namespace ccs::types;
+
+  AttributePath_Test test;
+
+  const char* paths [] = { "", "counter", "scalars", "scalars.float64", "array", "array[0]", "array[3].uint32", "array.2.boolean" };
+
+  bool ret = true;
+
+  for (uint32 index = 0u; (ret && (index < sizeof(paths)/sizeof(const char*))); index += 1u)
+    {
+      AttributePath path (test.type, paths[index]);
+
+      ret = path.IsValid();
+
+      if (ret)
+	{
+	  ret = ((ccs::HelperTools::GetAttributeOffset(test.type, paths[index]) == path.GetOffset()) &&
+		 (ccs::HelperTools::GetAttributeSize(test.type, paths[index]) == path.GetSize()) &&
+		 (ccs::HelperTools::GetAttributeType(test.type, paths[index]) == path.GetType()));
+	}
+
+      if (!ret)
+	{
+	  log_error("TEST(AttributePath_Test, Resolve) - Path '%s' failed", paths[index]);
+	}
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AttributePath_Test, Resolve_error)
+{
+  using namespace ccs::types;
+
+  AttributePath_Test test;
+
+  const char* paths [] = { "undefined", "counter.field", "scalars[0]", "array[4]", "array[0].undefined" };
+
+  bool ret = true;
+
+  for (uint32 index = 0u; (ret && (index < sizeof(paths)/sizeof(const char*))); index += 1u)
+    {
+      AttributePath path (test.type, paths[index]);
+      ret = !path.IsValid(); // Expect failure
+    }
+
+  if (ret)
+    {
+      std::shared_ptr<const AnyType> type;
+      AttributePath path (type, "counter");
+      ret = !path.IsValid(); // Expect failure
+    }
+
+  if (ret)
+    {
+      AttributePath path;
+      ret = (!path.IsValid() && (static_cast<void*>(NULL) == path.GetReference(static_cast<void*>(&path), sizeof(AttributePath))));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AttributePath_Test, Value)
+{
+  using namespace ccs::types;
+
+  AttributePath_Test test;
+
+  AnyValue value (test.type);
+
+  AttributePath path (test.type, "array[2].uint32");
+
+  bool ret = (path.IsValid() && path.Is<uint32>() && !path.Is<float64>());
+
+  if (ret)
+    {
+      ret = path.SetValue(value, static_cast<uint32>(10u));
+    }
+
+  if (ret)
+    {
+      uint32 attr = 0u;
+      ret = (path.GetValue(value, attr) && (10u == attr));
+    }
+
+  if (ret)
+    {
+      ret = (10u == ccs::HelperTools::GetAttributeValue<uint32>(&value, "array[2].uint32"));
+    }
+
+  if (ret)
+    {
+      ret = (ccs::HelperTools::GetAttributeReference(&value, "array[2].uint32") == path.GetReference(value));
+    }
+
+  if (ret)
+    {
+      uint64 attr = 0ul;
+      ret = (!path.GetValue(value, attr) && !path.SetValue(value, attr)); // Expect failure - Size
+    }
+
+  if (ret)
+    {
+      int32 attr = 0;
+      float32 other = 0.0f;
+      ret = (!path.GetValue(value, attr) && !path.SetValue(value, other)); // Expect failure - Type
+    }
+
+  if (ret)
+    {
+      AnyValue other (UnsignedInteger64); // Smaller instance
+      ret = (static_cast<void*>(NULL) == path.GetReference(other));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(AttributePath_Test, Value_compound)
+{
+  using namespace ccs::types;
+
+  AttributePath_Test test;
+
+  AnyValue value (test.type);
+
+  AttributePath path (test.type, "array[1]");
+
+  PathScalars_t attr = { true, 10u, 0.5 };
+
+  bool ret = (path.IsValid() && !path.Is<uint32>());
+
+  if (ret)
+    {
+      ret = path.SetValue(value, attr); // Size verified for non-scalar attributes
+    }
+
+  if (ret)
+    {
+      ret = ((10u == ccs::HelperTools::GetAttributeValue<uint32>(&value, "array[1].uint32")) &&
+	     (0.5 == ccs::HelperTools::GetAttributeValue<float64>(&value, "array[1].float64")));
+    }
+
+  if (ret)
+    {
+      PathScalars_t copy = { false, 0u, 0.0 };
+      ret = (path.GetValue(value, copy) && copy.boolean && (10u == copy.uint32) && (0.5 == copy.float64));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
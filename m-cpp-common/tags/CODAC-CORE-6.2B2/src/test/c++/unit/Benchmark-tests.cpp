@@ -0,0 +1,214 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/test/c++/unit/Benchmark-tests.cpp $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Unit test code
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*				  CS 90 046
+*				  13067 St. Paul-lez-Durance Cedex
+*				  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <new> // std::nothrow, etc.
+#include <string> // std::string
+#include <vector> // std::vector
+
+#include <stdio.h> // snprintf, etc.
+#include <string.h> // memcmp, etc.
+
+#include <gtest/gtest.h> // Google test framework
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+#include "TimeTools.h" // Misc. helper functions
+
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyTypeHelper.h"
+#include "AnyValueHelper.h"
+
+#include "AnyValueAllocator.h"
+#include "AnyValueBinary.h"
+#include "AnyValueDelta.h"
+#include "AnyValueJSON.h"
+#include "AttributePath.h"
+#include "TypedView.h"
+
+// Constants
+
+// Type definition
+
+typedef struct BenchmarkStruct {
+  ccs::types::uint64 counter;
+  ccs::types::float64 array [8];
+  ccs::types::string name;
+  ccs::types::int32 status;
+  ccs::types::uint32 index;
+} BenchmarkStruct_t;
+
+class Benchmark_Test
+{
+
+  public:
+
+    std::shared_ptr<const ccs::types::AnyType> type;
+    std::shared_ptr<const ccs::types::AnyType> large; // Approx. 150kB in memory
+
+    Benchmark_Test (void) {
+
+      type = std::shared_ptr<const ccs::types::AnyType>(dynamic_cast<ccs::types::AnyType*>((new (std::nothrow) ccs::types::CompoundType ("ccs::test::Benchmark_t"))
+											   ->AddAttribute("counter", "uint64")
+											   ->AddAttribute("array", ccs::HelperTools::NewArrayType("ccs::test::BenchmarkArray_t", ccs::types::Float64, 8u))
+											   ->AddAttribute("name", "string")
+											   ->AddAttribute("status", "int32")
+											   ->AddAttribute("index", "uint32")));
+
+      large = std::shared_ptr<const ccs::types::AnyType>(ccs::HelperTools::NewArrayType("ccs::test::BenchmarkLarge_t", type, 1024u));
+
+      return;
+
+    };
+
+};
+
+// Global variables
+
+static ccs::log::Func_t __handler = ccs::log::SetStdout();
+
+static const ccs::types::TypedViewField_t __fields [] = { TYPEDVIEW_FIELD(BenchmarkStruct_t, counter),
+							  TYPEDVIEW_FIELD(BenchmarkStruct_t, array),
+							  TYPEDVIEW_FIELD(BenchmarkStruct_t, name),
+							  TYPEDVIEW_FIELD(BenchmarkStruct_t, status),
+							  TYPEDVIEW_FIELD(BenchmarkStruct_t, index) };
+
+// Function declaration
+
+// Function definition
+
+/**
+ * @brief Average duration of the operation, repeated unless failed.
+ * @return Duration per iteration in ns.
+ */
+
+template <typename Operation> static ccs::types::uint64 Measure (Operation op, const ccs::types::uint32 count, bool& status)
+{
+
+  ccs::types::uint64 start = ccs::HelperTools::GetCurrentTime();
+
+  for (ccs::types::uint32 index = 0u; (status && (index < count)); index += 1u)
+    {
+      status = op(index);
+    }
+
+  return ((ccs::HelperTools::GetCurrentTime() - start) / count);
+
+}
+
+// Timings are only reported, the test fails upon functional error
+
+TEST(Benchmark_Test, AnyValue)
+{
+  using namespace ccs::types;
+
+  Benchmark_Test test;
+
+  AnyValue value (test.type);
+
+  AnyValue array (test.large);
+  AnyValue copy (test.large);
+
+  bool ret = true;
+
+  // Attribute access
+
+  AttributePath path (test.type, "array[3]");
+
+  ret = path.IsValid();
+
+  uint64 parsed = Measure([&](uint32 index) { return ccs::HelperTools::SetAttributeValue(&value, "array[3]", static_cast<float64>(index)); }, 100000u, ret);
+  uint64 resolved = Measure([&](uint32 index) { return path.SetValue(value, static_cast<float64>(index)); }, 100000u, ret);
+
+  TypedView<BenchmarkStruct_t> view (test.type, __fields);
+
+  BenchmarkStruct_t* data = view.GetReference(value);
+
+  ret = (ret && (NULL_PTR_CAST(BenchmarkStruct_t*) != data));
+
+  uint64 direct = Measure([&](uint32 index) { data->array[3] = static_cast<float64>(index); return true; }, 100000u, ret);
+
+  if (ret)
+    {
+      log_info("TEST(Benchmark_Test, AnyValue) - Attribute access in '%lu' ns parsed, '%lu' ns resolved, '%lu' ns typed view", parsed, resolved, direct);
+    }
+
+  // Allocation
+
+  ArenaAllocator* arena = ArenaAllocator::GetThreadInstance();
+
+  uint64 heap = Measure([&](uint32) { AnyValue instance (test.large); return (NULL_PTR_CAST(void*) != instance.GetInstance()); }, 1000u, ret);
+  uint64 pooled = Measure([&](uint32) { ArenaAllocator::Checkpoint checkpoint (*arena); AnyValue instance (test.large, *arena); return (NULL_PTR_CAST(void*) != instance.GetInstance()); }, 1000u, ret);
+
+  if (ret)
+    {
+      log_info("TEST(Benchmark_Test, AnyValue) - Construction in '%lu' ns from heap vs '%lu' ns from arena", heap, pooled);
+    }
+
+  // Serialisation
+
+  for (uint32 index = 0u; index < 1024u; index += 1u)
+    {
+      char8 name [STRING_MAX_LENGTH];
+      (void)snprintf(name, STRING_MAX_LENGTH, "[%u].counter", index);
+      ccs::HelperTools::SetAttributeValue<uint64>(&array, name, static_cast<uint64>(index) * 1000ul);
+      (void)snprintf(name, STRING_MAX_LENGTH, "[%u].array[1]", index);
+      ccs::HelperTools::SetAttributeValue<float64>(&array, name, static_cast<float64>(index) / 7.0);
+    }
+
+  std::vector<uint8> buffer;
+  std::string string;
+
+  uint64 binary = Measure([&](uint32) { buffer.clear(); return (ccs::HelperTools::SerialiseBinary(array, buffer) && (0u < ccs::HelperTools::ParseBinary(copy, &buffer[0], static_cast<uint32>(buffer.size())))); }, 10u, ret);
+
+  ret = (ret && (0 == memcmp(array.GetInstance(), copy.GetInstance(), array.GetSize())));
+
+  uint64 text = Measure([&](uint32) { string.clear(); return (array.SerialiseInstance(string) && copy.ParseInstance(string.c_str())); }, 10u, ret);
+
+  ret = (ret && (0 == memcmp(array.GetInstance(), copy.GetInstance(), array.GetSize())));
+
+  if (ret)
+    {
+      log_info("TEST(Benchmark_Test, AnyValue) - Round-trip of '%u' bytes in '%lu' ns binary vs '%lu' ns JSON", array.GetSize(), binary, text);
+    }
+
+  // Structural diff
+
+  AnyValueDelta delta;
+
+  ccs::HelperTools::SetAttributeValue<uint64>(&copy, "[512].counter", 1ul);
+
+  uint64 diff = Measure([&](uint32) { return ccs::HelperTools::Diff(array, copy, delta); }, 10u, ret);
+
+  ret = (ret && (1u == delta.GetRanges().size()));
+
+  if (ret)
+    {
+      log_info("TEST(Benchmark_Test, AnyValue) - Diff of '%u' bytes in '%lu' ns", array.GetSize(), diff);
+    }
+
+  ASSERT_EQ(ret, true);
+}
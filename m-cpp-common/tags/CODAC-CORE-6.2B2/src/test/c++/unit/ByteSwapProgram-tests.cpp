@@ -0,0 +1,209 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/test/c++/unit/ByteSwapProgram-tests.cpp $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Unit test code
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*				  CS 90 046
+*				  13067 St. Paul-lez-Durance Cedex
+*				  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <new> // std::nothrow, etc.
+
+#include <string.h> // memcmp, etc.
+
+#include <gtest/gtest.h> // Google test framework
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+#include "NetTools.h" // Misc. helper functions
+#include "TimeTools.h" // Misc. helper functions
+
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyTypeHelper.h"
+#include "AnyValueHelper.h"
+
+#include "ByteSwapProgram.h"
+
+// Constants
+
+// Type definition
+
+class ByteSwapProgram_Test
+{
+
+  public:
+
+    std::shared_ptr<const ccs::types::AnyType> type;
+
+    ByteSwapProgram_Test (void) {
+
+      std::shared_ptr<const ccs::types::AnyType> scalars (dynamic_cast<ccs::types::AnyType*>((new (std::nothrow) ccs::types::CompoundType ("ccs::test::SwapScalars_t"))
+														      ->AddAttribute("boolean","bool")
+														      ->AddAttribute("uint16","uint16")
+														      ->AddAttribute("int32","int32")
+														      ->AddAttribute("float32","float32")
+														      ->AddAttribute("string","string")
+														      ->AddAttribute("float64","float64")));
+
+      type = std::shared_ptr<const ccs::types::AnyType>(dynamic_cast<ccs::types::AnyType*>((new (std::nothrow) ccs::types::CompoundType ("ccs::test::SwapCompound_t"))
+											   ->AddAttribute("counter", "uint64")
+											   ->AddAttribute("scalars", scalars)
+											   ->AddAttribute("array", ccs::HelperTools::NewArrayType("ccs::test::SwapArray_t", scalars, 4u))
+											   ->AddAttribute("samples", ccs::HelperTools::NewArrayType("ccs::test::SwapSamples_t", ccs::types::Float32, 37u))));
+
+      return;
+
+    };
+
+};
+
+// Global variables
+
+static ccs::log::Func_t __handler = ccs::log::SetStdout();
+
+// Function declaration
+
+// Function definition
+
+TEST(ByteSwapProgram_Test, Compile)
+{
+  using namespace ccs::types;
+
+  ByteSwapProgram_Test test;
+
+  ByteSwapProgram program (test.type.get());
+
+  bool ret = program.IsValid();
+
+  if (ret && (ccs::types::LittleEndian == ccs::HelperTools::GetNativeByteOrder()))
+    {
+      ret = (0u < program.GetRuns().size());
+    }
+
+  if (ret)
+    { // Scalar array compiles into a single run
+      std::shared_ptr<const AnyType> array (ccs::HelperTools::NewArrayType("ccs::test::SwapLarge_t", Float64, 1024u));
+      ByteSwapProgram other (array.get());
+
+      ret = (other.IsValid() && ((ccs::types::LittleEndian != ccs::HelperTools::GetNativeByteOrder()) ||
+				 ((1u == other.GetRuns().size()) && (1024u == other.GetRuns()[0].count) && (8u == other.GetRuns()[0].width))));
+    }
+
+  if (ret)
+    { // Null type
+      ByteSwapProgram other (static_cast<const AnyType*>(NULL));
+      ret = (!other.IsValid() && !other.Execute(static_cast<void*>(&other)));
+    }
+
+  if (ret)
+    {
+      std::shared_ptr<const AnyType> type;
+      ret = !ByteSwapProgram::GetInstance(type);
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(ByteSwapProgram_Test, Execute)
+{
+  using namespace ccs::types;
+
+  ByteSwapProgram_Test test;
+
+  AnyValue value (test.type);
+  AnyValue legacy (test.type);
+
+  uint32 size = test.type->GetSize();
+
+  for (uint32 index = 0u; index < size; index += 1u)
+    {
+      static_cast<uint8*>(value.GetInstance())[index] = static_cast<uint8>(index * 7u + 1u);
+    }
+
+  legacy = value;
+
+  std::shared_ptr<const ByteSwapProgram> program = ByteSwapProgram::GetInstance(test.type);
+
+  bool ret = (program && (program == ByteSwapProgram::GetInstance(test.type))); // Cached
+
+  if (ret)
+    { // Compare with the type walk
+      ret = (program->Execute(value.GetInstance()) && test.type->ToNetworkByteOrder(legacy.GetInstance()));
+    }
+
+  if (ret)
+    {
+      ret = (0 == memcmp(value.GetInstance(), legacy.GetInstance(), size));
+    }
+
+  if (ret)
+    {
+      ret = (program->Execute(value.GetInstance()) && test.type->FromNetworkByteOrder(legacy.GetInstance()));
+    }
+
+  if (ret)
+    {
+      ret = (0 == memcmp(value.GetInstance(), legacy.GetInstance(), size));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(ByteSwapProgram_Test, AnyValue)
+{
+  using namespace ccs::types;
+
+  std::shared_ptr<const AnyType> type (ccs::HelperTools::NewArrayType("ccs::test::SwapFloat_t", Float32, 65536u));
+
+  AnyValue value (type);
+
+  float32* samples = static_cast<float32*>(value.GetInstance());
+
+  for (uint32 index = 0u; index < 65536u; index += 1u)
+    {
+      samples[index] = 0.5f * static_cast<float32>(index);
+    }
+
+  uint64 start = ccs::HelperTools::GetCurrentTime();
+
+  bool ret = value.ToNetworkByteOrder();
+
+  uint64 delta = ccs::HelperTools::GetCurrentTime() - start;
+
+  if (ret)
+    {
+      log_info("TEST(ByteSwapProgram_Test, AnyValue) - Converted '%u' bytes in '%lu' ns", type->GetSize(), delta);
+      float32 sample = ccs::HelperTools::ToNetworkByteOrder<float32>(0.5f * 1000.0f);
+      ret = (0 == memcmp(&sample, &samples[1000], sizeof(float32))); // Compare bit patterns
+    }
+
+  if (ret)
+    {
+      ret = (!value.ToNetworkByteOrder() && value.FromNetworkByteOrder()); // Expect failure - Already in network byte order
+    }
+
+  for (uint32 index = 0u; (ret && (index < 65536u)); index += 1u)
+    {
+      ret = ((0.5f * static_cast<float32>(index)) == samples[index]);
+    }
+
+  ASSERT_EQ(ret, true);
+}
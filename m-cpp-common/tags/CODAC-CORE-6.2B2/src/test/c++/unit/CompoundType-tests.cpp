@@ -154,6 +154,53 @@ TEST(CompoundType_Test, Operator_comparison)
   ASSERT_EQ(true, ret);
 }
 
+TEST(CompoundType_Test, Fingerprint)
+{
+  CompoundType_Test base;
+  ccs::types::CompoundType* type = (new (std::nothrow)  ccs::types::CompoundType("test::ctt::Fingerprint_t"))
+    ->AddAttribute("a", ccs::types::UnsignedInteger64)
+    ->AddAttribute("b", ccs::types::UnsignedInteger64);
+
+  // Not yet complete
+  bool ret = ((0ul != type->GetLayoutFingerprint()) && (base.GetLayoutFingerprint() != type->GetLayoutFingerprint()) && !(base == *type));
+
+  if (ret)
+    { // Fingerprint is reset upon modification
+      type->AddAttribute("c", ccs::HelperTools::NewArrayType("array:uint8", ccs::types::UnsignedInteger8)->SetMultiplicity(8u));
+      ret = ((base.GetLayoutFingerprint() == type->GetLayoutFingerprint()) && (base == *type));
+    }
+
+  if (ret)
+    { // Attribute names are significant to the fingerprint, not to the equivalence
+      ccs::types::CompoundType other ("test::ctt::Other_t");
+      other.AddAttribute("counter", ccs::types::UnsignedInteger64)
+	->AddAttribute("timestamp", ccs::types::UnsignedInteger64)
+	->AddAttribute("reserved", ccs::HelperTools::NewArrayType("array:uint8", ccs::types::UnsignedInteger8)->SetMultiplicity(8u));
+      ret = ((base.GetFingerprint() != type->GetFingerprint()) && (base.GetFingerprint() == other.GetFingerprint()));
+    }
+
+  if (ret)
+    { // Scalar types and multiplicities are significant
+      ccs::types::CompoundType other ("test::ctt::Fingerprint_t");
+      other.AddAttribute("a", ccs::types::UnsignedInteger64)
+	->AddAttribute("b", ccs::types::SignedInteger64)
+	->AddAttribute("c", ccs::HelperTools::NewArrayType("array:uint8", ccs::types::UnsignedInteger8)->SetMultiplicity(8u));
+      ret = ((base.GetSize() == other.GetSize()) && (base.GetLayoutFingerprint() != other.GetLayoutFingerprint()) && !(base == other));
+    }
+
+  if (ret)
+    {
+      ccs::types::CompoundType other ("test::ctt::Fingerprint_t");
+      other.AddAttribute("a", ccs::types::UnsignedInteger64)
+	->AddAttribute("c", ccs::HelperTools::NewArrayType("array:uint8", ccs::types::UnsignedInteger8)->SetMultiplicity(16u));
+      ret = ((base.GetSize() == other.GetSize()) && (base.GetLayoutFingerprint() != other.GetLayoutFingerprint()) && !(base == other));
+    }
+
+  delete type;
+
+  ASSERT_EQ(true, ret);
+}
+
 TEST(CompoundType_Test, Operator_copy)
 {
   CompoundType_Test base;
@@ -271,6 +318,55 @@ TEST(CompoundType_Test, AddAttribute_error)
   ASSERT_EQ(true, ret);
 }
 
+TEST(CompoundType_Test, AddAttribute_many)
+{
+  ccs::types::CompoundType type ("struct:many");
+
+  // Number of attributes causes the name table to grow several times
+  for (ccs::types::uint32 index = 0u; index < 100u; index += 1u)
+    {
+      ccs::types::string name = STRING_UNDEFINED;
+      snprintf(name, STRING_MAX_LENGTH, "attr_%u", index);
+      (void)type.AddAttribute(name, ccs::types::UnsignedInteger32);
+    }
+
+  bool ret = ((100u == type.GetAttributeNumber()) && (400u == type.GetSize()));
+
+  for (ccs::types::uint32 index = 0u; (ret && (index < 100u)); index += 1u)
+    {
+      ccs::types::string name = STRING_UNDEFINED;
+      snprintf(name, STRING_MAX_LENGTH, "attr_%u", index);
+
+      ret = (type.HasAttribute(name) &&
+             (index == type.GetAttributeIndex(name)) &&
+             (0 == strcmp(name, type.GetAttributeName(index))) &&
+             ((4u * index) == type.GetAttributeOffset(name)) &&
+             ((4u * index) == type.GetAttributeOffset(index)) &&
+             (4u == type.GetAttributeSize(name)));
+    }
+
+  if (ret)
+    {
+      ret = (!type.HasAttribute("attr_100") && !type.HasAttribute("") && (static_cast<void*>(NULL) == type.GetAttributeReference(&type, "undefined")));
+    }
+
+  if (ret)
+    { // Duplicate ignored
+      (void)type.AddAttribute("attr_0", ccs::types::UnsignedInteger64);
+      ret = ((100u == type.GetAttributeNumber()) && (400u == type.GetSize()));
+    }
+
+  if (ret)
+    { // Assignment replaces attributes
+      ccs::types::CompoundType other ("struct:other");
+      (void)other.AddAttribute("other", ccs::types::UnsignedInteger64);
+      type = other;
+      ret = ((1u == type.GetAttributeNumber()) && (8u == type.GetSize()) && type.HasAttribute("other") && !type.HasAttribute("attr_0"));
+    }
+
+  ASSERT_EQ(true, ret);
+}
+
 TEST(CompoundType_Test, AddAttribute_byTypeName)
 {
   CompoundType_Test* base = new (std::nothrow) CompoundType_Test;
@@ -146,3 +146,51 @@ FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF FF6CAB0B
   ASSERT_EQ(true, ret);
 }
 
+TEST(CyclicRedundancyCheck_Test, Castagnoli)
+{
+  ccs::types::uint8 buffer [64]; memset(buffer, 0, 64u);
+  ccs::HelperTools::SafeStringCopy(reinterpret_cast<char*>(buffer), "123456789", 64u);
+
+  log_info("TEST(CyclicRedundancyCheck_Test, Castagnoli) - CyclicRedundancyCheckCastagnoli is '0x%x'", ccs::HelperTools::CyclicRedundancyCheckCastagnoli(buffer, 9u));
+
+  bool ret = (ccs::HelperTools::CyclicRedundancyCheckCastagnoli(buffer, 9u) == 0xe3069283u); // Check value
+
+  if (ret)
+    {
+      ret = ((ccs::HelperTools::CyclicRedundancyCheckCastagnoli(buffer, 64u, 1u) != ccs::HelperTools::CyclicRedundancyCheckCastagnoli(buffer, 64u, 0u)) &&
+	     (ccs::HelperTools::CyclicRedundancyCheckCastagnoli(buffer, 64u, 1u) == ccs::HelperTools::CyclicRedundancyCheckCastagnoli(buffer, 64u, 1u)));
+    }
+
+  ASSERT_EQ(true, ret);
+}
+
+TEST(CyclicRedundancyCheck_Test, Combine)
+{
+  ccs::types::uint8 buffer [1024];
+
+  for (ccs::types::uint32 index = 0u; index < 1024u; index += 1u)
+    {
+      buffer[index] = static_cast<ccs::types::uint8>(7u * index + 3u);
+    }
+
+  bool ret = true;
+
+  for (ccs::types::uint32 split = 0u; (ret && (split <= 1024u)); split += 331u)
+    {
+      ccs::types::uint32 first = ccs::HelperTools::CyclicRedundancyCheck<ccs::types::uint32>(buffer, split, 1234u);
+      ccs::types::uint32 second = ccs::HelperTools::CyclicRedundancyCheck<ccs::types::uint32>(buffer + split, 1024u - split);
+
+      ret = (ccs::HelperTools::CombineCyclicRedundancyCheck(first, second, 1024u - split) == ccs::HelperTools::CyclicRedundancyCheck<ccs::types::uint32>(buffer, 1024u, 1234u));
+
+      if (ret)
+	{
+	  first = ccs::HelperTools::CyclicRedundancyCheckCastagnoli(buffer, split, 1234u);
+	  second = ccs::HelperTools::CyclicRedundancyCheckCastagnoli(buffer + split, 1024u - split);
+
+	  ret = (ccs::HelperTools::CombineCyclicRedundancyCheck(first, second, 1024u - split, 0x82F63B78u) == ccs::HelperTools::CyclicRedundancyCheckCastagnoli(buffer, 1024u, 1234u));
+	}
+    }
+
+  ASSERT_EQ(true, ret);
+}
+
@@ -57,3 +57,24 @@ TEST(Hash_Test, SDNTopics_map)
   ASSERT_EQ(true, ret);
 }
 
+
+TEST(Hash_Test, Buffer_uint64)
+{
+  const ccs::types::char8* msg = "Nobody inspects the spammish repetition";
+
+  log_info("TEST(Hash_Test, Buffer_uint64) - Hash of '%s' is '0x%lx'", msg, ccs::HelperTools::Hash<ccs::types::uint64>(reinterpret_cast<const ccs::types::uint8*>(msg), strlen(msg), 0ul));
+
+  // XXH64 reference values
+  bool ret = ((ccs::HelperTools::Hash<ccs::types::uint64>(reinterpret_cast<const ccs::types::uint8*>(""), 0u, 0ul) == 0xef46db3751d8e999ul) &&
+	      (ccs::HelperTools::Hash<ccs::types::uint64>(reinterpret_cast<const ccs::types::uint8*>("abc"), 3u, 0ul) == 0x44bc2cf5ad770999ul) &&
+	      (ccs::HelperTools::Hash<ccs::types::uint64>(reinterpret_cast<const ccs::types::uint8*>(msg), strlen(msg), 0ul) == 0xfbcea83c8a378bf1ul));
+
+  if (ret)
+    {
+      ret = (ccs::HelperTools::Hash<ccs::types::uint64>(reinterpret_cast<const ccs::types::uint8*>(msg), strlen(msg), 1ul) != 
+	     ccs::HelperTools::Hash<ccs::types::uint64>(reinterpret_cast<const ccs::types::uint8*>(msg), strlen(msg), 0ul));
+    }
+
+  ASSERT_EQ(true, ret);
+}
+
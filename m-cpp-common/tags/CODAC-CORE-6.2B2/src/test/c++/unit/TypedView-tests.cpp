@@ -0,0 +1,219 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/test/c++/unit/TypedView-tests.cpp $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Unit test code
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*				  CS 90 046
+*				  13067 St. Paul-lez-Durance Cedex
+*				  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <new> // std::nothrow, etc.
+
+#include <string.h> // strcmp, etc.
+
+#include <gtest/gtest.h> // Google test framework
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+#include "TimeTools.h" // Misc. helper functions
+
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyTypeHelper.h"
+#include "AnyValueHelper.h"
+
+#include "TypedView.h"
+
+// Constants
+
+// Type definition
+
+typedef struct TypedViewNested {
+  ccs::types::float64 setpoint;
+  ccs::types::uint32 array [4];
+} TypedViewNested_t;
+
+typedef struct TypedViewStruct {
+  ccs::types::uint64 counter;
+  TypedViewNested_t nested;
+  ccs::types::int32 status;
+  ccs::types::string name;
+  ccs::types::uint16 index;
+  ccs::types::boolean valid;
+} TypedViewStruct_t;
+
+typedef struct TypedViewPadded {
+  ccs::types::boolean valid;
+  ccs::types::uint32 counter; // Padded
+} TypedViewPadded_t;
+
+class TypedView_Test
+{
+
+  public:
+
+    std::shared_ptr<const ccs::types::AnyType> type;
+
+    TypedView_Test (void) {
+
+      std::shared_ptr<const ccs::types::AnyType> nested (dynamic_cast<ccs::types::AnyType*>((new (std::nothrow) ccs::types::CompoundType ("ccs::test::TypedViewNested_t"))
+											    ->AddAttribute("setpoint", "float64")
+											    ->AddAttribute("array", ccs::HelperTools::NewArrayType("ccs::test::TypedViewArray_t", ccs::types::UnsignedInteger32, 4u))));
+
+      type = std::shared_ptr<const ccs::types::AnyType>(dynamic_cast<ccs::types::AnyType*>((new (std::nothrow) ccs::types::CompoundType ("ccs::test::TypedView_t"))
+											   ->AddAttribute("counter", "uint64")
+											   ->AddAttribute("nested", nested)
+											   ->AddAttribute("status", "int32")
+											   ->AddAttribute("name", "string")
+											   ->AddAttribute("index", "uint16")
+											   ->AddAttribute("valid", "bool")));
+
+      return;
+
+    };
+
+};
+
+// Global variables
+
+static ccs::log::Func_t __handler = ccs::log::SetStdout();
+
+static const ccs::types::TypedViewField_t __fields [] = { TYPEDVIEW_FIELD(TypedViewStruct_t, counter),
+							  TYPEDVIEW_FIELD(TypedViewStruct_t, nested),
+							  TYPEDVIEW_FIELD(TypedViewStruct_t, nested.setpoint),
+							  TYPEDVIEW_FIELD(TypedViewStruct_t, nested.array[3]),
+							  TYPEDVIEW_FIELD(TypedViewStruct_t, status),
+							  TYPEDVIEW_FIELD(TypedViewStruct_t, name),
+							  TYPEDVIEW_FIELD(TypedViewStruct_t, index),
+							  TYPEDVIEW_FIELD(TypedViewStruct_t, valid) };
+
+// Function declaration
+
+// Function definition
+
+TEST(TypedView_Test, Validate)
+{
+  using namespace ccs::types;
+
+  TypedView_Test test;
+
+  TypedView<TypedViewStruct_t> view (test.type, __fields);
+
+  bool ret = (view.IsValid() && (test.type == view.GetType()));
+
+  if (ret)
+    { // Default constructor
+      TypedView<TypedViewStruct_t> other;
+      ret = (!other.IsValid() && (NULL_PTR_CAST(TypedViewStruct_t*) == other.GetReference(AnyValue (test.type))));
+    }
+
+  if (ret)
+    { // Scalar type mismatch
+      std::shared_ptr<const AnyType> other (dynamic_cast<AnyType*>((new (std::nothrow) CompoundType ("ccs::test::TypedViewOther_t"))
+								   ->AddAttribute("counter", "int64")
+								   ->AddAttribute("nested", std::dynamic_pointer_cast<const CompoundType>(test.type)->GetAttributeType("nested"))
+								   ->AddAttribute("status", "int32")
+								   ->AddAttribute("name", "string")
+								   ->AddAttribute("index", "uint16")
+								   ->AddAttribute("valid", "bool")));
+
+      ret = !view.Validate(other, __fields, sizeof(__fields) / sizeof(TypedViewField_t));
+    }
+
+  if (ret)
+    { // Unknown attribute
+      static const TypedViewField_t fields [] = { { "unknown", 0u, 8u, &TypedViewField::Is<uint64> } };
+      TypedView<TypedViewStruct_t> other (test.type, fields);
+      ret = !other.IsValid();
+    }
+
+  if (ret)
+    { // Padded structure does not match packed layout
+      static const TypedViewField_t fields [] = { TYPEDVIEW_FIELD(TypedViewPadded_t, valid),
+						  TYPEDVIEW_FIELD(TypedViewPadded_t, counter) };
+
+      std::shared_ptr<const AnyType> other (dynamic_cast<AnyType*>((new (std::nothrow) CompoundType ("ccs::test::TypedViewPadded_t"))
+								   ->AddAttribute("valid", "bool")
+								   ->AddAttribute("counter", "uint32")));
+
+      TypedView<TypedViewPadded_t> padded (other, fields);
+      ret = !padded.IsValid();
+    }
+
+  if (ret)
+    { // Structure exceeds type size
+      TypedView<TypedViewStruct_t> other (std::dynamic_pointer_cast<const CompoundType>(test.type)->GetAttributeType("nested"), __fields);
+      ret = !other.IsValid();
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(TypedView_Test, Access)
+{
+  using namespace ccs::types;
+
+  TypedView_Test test;
+
+  TypedView<TypedViewStruct_t> view (test.type, __fields);
+
+  AnyValue value (test.type);
+
+  TypedViewStruct_t* data = view.GetReference(value);
+
+  bool ret = (NULL_PTR_CAST(TypedViewStruct_t*) != data);
+
+  if (ret)
+    {
+      data->counter = 10ul;
+      data->nested.setpoint = 0.5;
+      data->nested.array[3] = 3u;
+      data->status = -1;
+      ccs::HelperTools::SafeStringCopy(data->name, "view", STRING_MAX_LENGTH);
+      data->index = 7u;
+      data->valid = true;
+
+      ret = ((10ul == ccs::HelperTools::GetAttributeValue<uint64>(&value, "counter")) &&
+	     (0.5 == ccs::HelperTools::GetAttributeValue<float64>(&value, "nested.setpoint")) &&
+	     (3u == ccs::HelperTools::GetAttributeValue<uint32>(&value, "nested.array[3]")) &&
+	     (-1 == ccs::HelperTools::GetAttributeValue<int32>(&value, "status")) &&
+	     (7u == ccs::HelperTools::GetAttributeValue<uint16>(&value, "index")) &&
+	     (true == ccs::HelperTools::GetAttributeValue<boolean>(&value, "valid")));
+    }
+
+  if (ret)
+    {
+      ret = ccs::HelperTools::SetAttributeValue<uint64>(&value, "counter", 11ul);
+    }
+
+  if (ret)
+    {
+      ret = ((11ul == data->counter) && (0 == strcmp(data->name, "view")));
+    }
+
+  if (ret)
+    { // Instance too small or misaligned
+      ret = ((NULL_PTR_CAST(TypedViewStruct_t*) == view.GetReference(value.GetInstance(), value.GetSize() - 1u)) &&
+	     (NULL_PTR_CAST(TypedViewStruct_t*) == view.GetReference(static_cast<uint8*>(value.GetInstance()) + 1u, value.GetSize())));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
@@ -0,0 +1,430 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-common/tags/CODAC-CORE-6.2B2/src/test/c++/unit/VariableCache-tests.cpp $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Unit test code
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*				  CS 90 046
+*				  13067 St. Paul-lez-Durance Cedex
+*				  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <thread> // std::thread
+
+#include <gtest/gtest.h> // Google test framework
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "tools.h" // Misc. helper functions
+
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyTypeHelper.h"
+#include "AnyValue.h"
+
+#include "VariableCache.h"
+
+// Constants
+
+// Type definition
+
+// Global variables
+
+static ccs::log::Func_t __handler = ccs::log::SetStdout();
+
+static ccs::types::uint32 __notified = 0u;
+
+// Function declaration
+
+// Function definition
+
+static void HandleUpdate (const char* name, const ccs::types::AnyValue& value)
+{
+
+  log_info("Variable '%s' updated", name);
+
+  __notified = static_cast<ccs::types::uint32>(value);
+
+  return;
+
+}
+
+TEST(VariableCache_Test, AddVariable)
+{
+  ccs::base::VariableCache cache (2u);
+
+  bool ret = cache.AddVariable("input", ccs::types::InputVariable, ccs::types::UnsignedInteger32);
+
+  if (ret)
+    {
+      ret = cache.AddVariable("output", ccs::types::OutputVariable, ccs::types::Float64);
+    }
+
+  if (ret)
+    {
+      ret = !cache.AddVariable("input", ccs::types::InputVariable, ccs::types::UnsignedInteger32); // Expect failure - Duplicate
+    }
+
+  if (ret)
+    {
+      ret = !cache.AddVariable("other", ccs::types::InputVariable, ccs::types::UnsignedInteger32); // Expect failure - Capacity
+    }
+
+  if (ret)
+    {
+      ret = ((2u == cache.GetSize()) && cache.IsValid("output") && !cache.IsValid("other"));
+    }
+
+  if (ret)
+    {
+      ret = ((1u == cache.GetHandle("output")) && (VARIABLECACHE_INVALID_HANDLE == cache.GetHandle("other")));
+    }
+
+  if (ret)
+    {
+      ret = ((ccs::types::OutputVariable == cache.GetDirection(1u)) && (0 == strcmp(cache.GetName(1u), "output")));
+    }
+
+  if (ret)
+    {
+      ret = (cache.GetType(1u) == ccs::types::Float64);
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(VariableCache_Test, SetType)
+{
+  ccs::base::VariableCache cache;
+
+  std::shared_ptr<const ccs::types::AnyType> type;
+
+  bool ret = cache.AddVariable("untyped", ccs::types::InputVariable, type);
+
+  if (ret)
+    {
+      ret = (!cache.GetType(0u) && (static_cast<ccs::types::AnyValue*>(NULL) == cache.GetSnapshot(0u)));
+    }
+
+  if (ret)
+    {
+      ccs::types::uint32 value = 0u;
+      ret = !cache.GetValue(0u, &value, sizeof(value)); // Expect failure
+    }
+
+  if (ret)
+    {
+      ret = cache.SetType(0u, ccs::types::UnsignedInteger32);
+    }
+
+  if (ret)
+    {
+      ret = !cache.SetType(0u, ccs::types::UnsignedInteger64); // Expect failure - Already typed
+    }
+
+  if (ret)
+    {
+      ccs::types::uint32 value = 1u;
+      ret = cache.SetValue(0u, &value, sizeof(value));
+    }
+
+  if (ret)
+    {
+      ccs::types::uint32 value = 0u;
+      ret = (cache.GetValue(0u, &value, sizeof(value)) && (1u == value));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(VariableCache_Test, Value)
+{
+  ccs::base::VariableCache cache;
+
+  bool ret = cache.AddVariable("variable", ccs::types::AnyputVariable, ccs::types::UnsignedInteger64);
+
+  if (ret)
+    {
+      ccs::types::uint64 value = 10ul;
+      ret = cache.SetValue(0u, &value, sizeof(value));
+    }
+
+  if (ret)
+    {
+      ccs::types::uint32 value = 0u;
+      ret = !cache.SetValue(0u, &value, sizeof(value)); // Expect failure - Size
+    }
+
+  if (ret)
+    {
+      ccs::types::uint64 value = 0ul;
+      ret = (cache.GetValue(0u, &value, sizeof(value)) && (10ul == value));
+    }
+
+  if (ret)
+    {
+      ccs::types::AnyValue value (ccs::types::UnsignedInteger64);
+      ret = (cache.GetValue(0u, value) && (10ul == static_cast<ccs::types::uint64>(value)));
+    }
+
+  if (ret)
+    {
+      ret = !cache.SetValue(1u, static_cast<const void*>(NULL), 0u); // Expect failure - Invalid handle
+    }
+
+  if (ret)
+    {
+      ccs::base::VariableCache::Statistics_t stats = cache.GetStatistics();
+      ret = ((1ul == stats.writes) && (2ul == stats.reads));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(VariableCache_Test, Snapshot)
+{
+  ccs::base::VariableCache cache;
+
+  bool ret = cache.AddVariable("variable", ccs::types::OutputVariable, ccs::types::UnsignedInteger64);
+
+  ccs::types::AnyValue* snapshot = cache.GetSnapshot(0u);
+
+  if (ret)
+    {
+      ret = (static_cast<ccs::types::AnyValue*>(NULL) != snapshot);
+    }
+
+  if (ret)
+    {
+      ccs::types::uint64 value = 10ul;
+      ret = cache.SetValue(0u, &value, sizeof(value));
+    }
+
+  if (ret)
+    {
+      ret = (0ul == static_cast<ccs::types::uint64>(*snapshot)); // Not written through the slot
+    }
+
+  if (ret)
+    {
+      ret = ((snapshot == cache.GetSnapshot(0u)) && (10ul == static_cast<ccs::types::uint64>(*snapshot)));
+    }
+
+  if (ret)
+    {
+      *snapshot = static_cast<ccs::types::uint64>(20ul);
+      ret = cache.CommitSnapshot(0u);
+    }
+
+  if (ret)
+    {
+      ccs::types::uint64 value = 0ul;
+      ret = (cache.GetValue(0u, &value, sizeof(value)) && (20ul == value));
+    }
+
+  if (ret)
+    {
+      ccs::types::uint64 value = 30ul;
+      ret = (cache.SetValue(0u, &value, sizeof(value)) && cache.CommitSnapshot(0u)); // Nothing to commit
+    }
+
+  if (ret)
+    {
+      ccs::types::uint64 value = 0ul;
+      ret = (cache.GetValue(0u, &value, sizeof(value)) && (30ul == value));
+    }
+
+  if (ret)
+    {
+      ret = ((static_cast<ccs::types::AnyValue*>(NULL) == cache.GetSnapshot(1u)) && !cache.CommitSnapshot(1u)); // Expect failure - Invalid handle
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(VariableCache_Test, Update)
+{
+  ccs::base::VariableCache cache;
+
+  bool ret = (cache.AddVariable("first", ccs::types::OutputVariable, ccs::types::UnsignedInteger32) &&
+	      cache.AddVariable("second", ccs::types::OutputVariable, ccs::types::UnsignedInteger32));
+
+  ccs::base::VariableCache::Handle_t handle = VARIABLECACHE_INVALID_HANDLE;
+
+  if (ret)
+    {
+      ret = !cache.PopUpdate(handle); // Expect failure - Empty
+    }
+
+  if (ret)
+    {
+      ret = (cache.PushUpdate(1u) && cache.PushUpdate(0u) && cache.PushUpdate(1u)); // Coalesced
+    }
+
+  if (ret)
+    {
+      ret = (cache.PopUpdate(handle) && (1u == handle));
+    }
+
+  if (ret)
+    {
+      ret = cache.PushUpdate(1u); // Queued again
+    }
+
+  if (ret)
+    {
+      ret = (cache.PopUpdate(handle) && (0u == handle));
+    }
+
+  if (ret)
+    {
+      ret = (cache.PopUpdate(handle) && (1u == handle));
+    }
+
+  if (ret)
+    {
+      ret = !cache.PopUpdate(handle);
+    }
+
+  if (ret)
+    {
+      ret = !cache.PushUpdate(2u); // Expect failure - Invalid handle
+    }
+
+  if (ret)
+    {
+      ccs::base::VariableCache::Statistics_t stats = cache.GetStatistics();
+      ret = ((3ul == stats.updates) && (1ul == stats.coalesced));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(VariableCache_Test, Update_wrap)
+{
+  ccs::base::VariableCache cache (3u);
+
+  bool ret = (cache.AddVariable("first", ccs::types::OutputVariable, ccs::types::UnsignedInteger32) &&
+	      cache.AddVariable("second", ccs::types::OutputVariable, ccs::types::UnsignedInteger32) &&
+	      cache.AddVariable("third", ccs::types::OutputVariable, ccs::types::UnsignedInteger32));
+
+  for (ccs::types::uint32 index = 0u; (ret && (index < 100u)); index += 1u)
+    {
+      ccs::base::VariableCache::Handle_t handle = VARIABLECACHE_INVALID_HANDLE;
+
+      ret = (cache.PushUpdate(index % 3u) && cache.PushUpdate((index + 1u) % 3u) && cache.PushUpdate((index + 2u) % 3u));
+
+      if (ret)
+	{
+	  ret = (cache.PopUpdate(handle) && (handle == (index % 3u)));
+	}
+
+      if (ret)
+	{
+	  ret = (cache.PopUpdate(handle) && cache.PopUpdate(handle) && !cache.PopUpdate(handle));
+	}
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(VariableCache_Test, Callback)
+{
+  ccs::base::VariableCache cache;
+
+  bool ret = cache.AddVariable("input", ccs::types::InputVariable, ccs::types::UnsignedInteger32);
+
+  if (ret)
+    {
+      ret = cache.SetCallback(0u, &HandleUpdate);
+    }
+
+  if (ret)
+    {
+      ccs::types::uint32 value = 5u;
+      ret = (cache.SetValue(0u, &value, sizeof(value)) && (0u == __notified)); // No callback
+    }
+
+  if (ret)
+    {
+      ccs::types::uint32 value = 7u;
+      ret = (cache.NotifyValue(0u, &value, sizeof(value)) && (7u == __notified));
+    }
+
+  if (ret)
+    {
+      ccs::base::VariableCache::Statistics_t stats = cache.GetStatistics();
+      ret = ((2ul == stats.writes) && (1ul == stats.notifications));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(VariableCache_Test, Concurrent)
+{
+  typedef struct Sample {
+    ccs::types::uint64 first;
+    ccs::types::uint64 payload [30];
+    ccs::types::uint64 last;
+  } Sample_t;
+
+  std::shared_ptr<const ccs::types::AnyType> type (new (std::nothrow) ccs::types::ArrayType ("Sample_t", ccs::types::UnsignedInteger64, 32u));
+
+  ccs::base::VariableCache cache;
+
+  bool ret = cache.AddVariable("variable", ccs::types::AnyputVariable, type);
+
+  volatile bool done = false;
+
+  // Writer thread
+  std::thread writer ([&cache, &done] (void) {
+      Sample_t sample;
+      for (ccs::types::uint64 count = 0ul; count < 100000ul; count += 1ul)
+	{
+	  sample.first = sample.last = count;
+	  (void)cache.SetValue(0u, &sample, sizeof(Sample_t));
+	  (void)cache.PushUpdate(0u);
+	}
+      done = true;
+    });
+
+  // Reader never observes partial write
+  while (ret && !done)
+    {
+      Sample_t sample;
+
+      ret = cache.GetValue(0u, &sample, sizeof(Sample_t));
+
+      if (ret)
+	{
+	  ret = (sample.first == sample.last);
+	}
+
+      ccs::base::VariableCache::Handle_t handle;
+      (void)cache.PopUpdate(handle);
+    }
+
+  writer.join();
+
+  if (ret)
+    {
+      ccs::base::VariableCache::Statistics_t stats = cache.GetStatistics();
+      log_info("TEST(VariableCache_Test, Concurrent) - '%lu' reads with '%lu' retries", stats.reads, stats.retries);
+      ret = ((100000ul == stats.writes) && (100000ul == (stats.updates + stats.coalesced)));
+    }
+
+  ASSERT_EQ(ret, true);
+}
@@ -27,6 +27,7 @@
 
 #include <functional> // std::function
 #include <new> // std::nothrow
+#include <vector> // std::vector
 
 #include <cadef.h> // Channel Access API definition, etc.
 
@@ -39,13 +40,13 @@
 //#undef LOG_DEBUG_ENABLE
 #include <log-api.h> // Syslog wrapper routines
 
-#include <lu-table.h> // Look-up table class definition, etc.
-
 #include <AnyObject.h> // Abstract base class definition ..
 #include <ObjectDatabase.h> // .. associated object database
 
 #include <any-thread.h> // Thread management class
 
+#include <VariableCache.h> // Variable cache shared with the application
+
 #include <AnyValue.h> // Variable with introspectable data type ..
 #include <AnyValueHelper.h> // .. associated helper routines
 
@@ -91,32 +92,33 @@ class ChannelAccessClient_Impl : public AnyObject
 
   public:
 
-    ccs::types::CompoundType* m_type; // Introspectable type definition for the variable cache ..
-    ccs::types::AnyValue* m_value; // Introspectable variable mapped to the whole cache ..
+    VariableCache* m_cache; // Variable cache shared with the application
 
     bool m_initialized;
 
     typedef struct VariableInfo {
 
       bool connected;
-      bool update;
-      ccs::types::DirIdentifier direction;
-      
-      std::function<void(const char*, const ccs::types::AnyValue&)> cb;
+      bool pending; // Put operation in flight
+      bool success; // Completion status of the last put operation
 
+      volatile ccs::types::uint32 requested; // Update requests ..
+      ccs::types::uint32 issued; // .. covered by the last put operation issued ..
+      volatile ccs::types::uint32 confirmed; // .. and confirmed
+      
       ccs::types::string name;
+      VariableCache::Handle_t handle;
       chid channel;
       chtype type; // ChannelAccess native type
       ccs::types::uint32 mult;
       
-      void* reference; // Reference in the cache
-      
-      std::shared_ptr<const ccs::types::AnyType> __type; // Introspectable type definition for the variable cache ..
-      ccs::types::AnyValue* value;
-      
+      ccs::types::AnyValue* value; // CA thread copy of the cached variable
+
+      ChannelAccessClient_Impl* self;
+
     } VariableInfo_t;
 
-    LUTable<VariableInfo_t>* m_var_table;
+    std::vector<VariableInfo_t> m_var_table; // Indexed by variable cache handle
 
     // Initializer methods
     bool AddVariable (const char* name, ccs::types::DirIdentifier direction, const std::shared_ptr<const ccs::types::AnyType>& type);
@@ -133,16 +135,18 @@ class ChannelAccessClient_Impl : public AnyObject
     ccs::types::AnyValue* GetVariable (ccs::types::uint32 id) const;
     ccs::types::AnyValue* GetVariable (const char* name) const;
 
-    template <typename Type> bool GetVariable (const char* name, Type& value) const;
+    bool GetVariable (ccs::types::uint32 id, void* buffer, ccs::types::uint32 size) const;
 
     std::shared_ptr<const ccs::types::AnyType> GetVariableType (ccs::types::uint32 id) const;
     std::shared_ptr<const ccs::types::AnyType> GetVariableType (const char* name) const;
 
-    template <typename Type> bool SetVariable (const char* name, Type& value);
+    bool SetVariable (ccs::types::uint32 id, const void* buffer, ccs::types::uint32 size);
 
     bool UpdateVariable (ccs::types::uint32 id);
     bool UpdateVariable (const char* name);
 
+    bool WaitForCompletion (ccs::types::uint32 id, ccs::types::uint64 timeout) const;
+
     // Miscellaneous methods
     bool SetCallback (ccs::types::uint32 id, std::function<void(const char*, const ccs::types::AnyValue&)> cb);
     bool SetCallback (const char* name, std::function<void(const char*, const ccs::types::AnyValue&)> cb);
@@ -183,61 +187,53 @@ void ChannelAccessInterface_Get_CB (struct event_handler_args args)
       log_warning("%s - Routine invoked with '%d'", __FUNCTION__, args.status);
     }
 
-  ccs::base::ChannelAccessClient_Impl* self = (ccs::base::ChannelAccessClient_Impl*) args.usr;
-  bool found = false;
-  
-  for (uint_t index = 0; (status && (index < (self->m_var_table)->GetSize())); index += 1)
+  // Subscription installed with the variable information
+  ccs::base::ChannelAccessClient_Impl::VariableInfo_t* varInfo = static_cast<ccs::base::ChannelAccessClient_Impl::VariableInfo_t*>(args.usr);
+
+  if (status)
     {
+      status = (static_cast<ccs::base::ChannelAccessClient_Impl::VariableInfo_t*>(NULL) != varInfo);
+    }
 
-      ccs::base::ChannelAccessClient_Impl::VariableInfo_t varInfo;
+  if (status)
+    {
+      log_debug("Notification received for '%s' channel", varInfo->name);
 
-      if ((self->m_var_table)->GetValue(varInfo, index) != STATUS_SUCCESS)
-	{
-	  log_warning("%s - LUTable<>::GetValue failed", __FUNCTION__);
-	  continue;
-	}
-      
-      char name [STRING_MAX_LENGTH] = STRING_UNDEFINED;
+      // Copy to cache and invoke callback, if any
+      status = (varInfo->self)->m_cache->NotifyValue(varInfo->handle, args.dbr, (varInfo->value)->GetSize());
 
-      if ((self->m_var_table)->GetKeyword(name, index) != STATUS_SUCCESS)
-	{
-	  log_warning("%s - LUTable<>::GetKeyword failed", __FUNCTION__);
-	  break;
-	}
+      if (varInfo->type == DBR_STRING) log_debug("Variable '%s' holds '%s'", varInfo->name, (char*) args.dbr);
+      if ((varInfo->type == DBR_CHAR) && (varInfo->mult > 1)) log_debug("Variable '%s' holds '%s'", varInfo->name, (char*) args.dbr);
+    }
 
-      if (varInfo.channel == args.chid)
-	{
-	  log_debug("Notification received for '%s' channel", (char*) name);
-#if 0
-	  ccs::HelperTools::SetAttributeValue(&(varInfo.value), name, (void*) args.dbr); // Copy to cache
-#else
-	  memcpy(varInfo.reference, (void*) args.dbr, (varInfo.__type)->GetSize());
-#endif
-	  // Invoke callback, if any
-	  if (NULL != varInfo.cb)
-	    {
-	      log_debug("%s - Invoke callback for '%s' channel", __FUNCTION__, name);
-	      varInfo.cb(name, *varInfo.value);
-	    }
+  if (!status)
+    {
+      log_warning("%s - Unable to update cache with notification", __FUNCTION__);
+    }
 
-	  if (varInfo.type == DBR_STRING) log_debug("Variable '%s' holds '%s'", name, (char*) args.dbr);
-	  if ((varInfo.type == DBR_CHAR) && (varInfo.mult > 1)) log_debug("Variable '%s' holds '%s'", name, (char*) args.dbr);
+  log_trace("Leaving '%s' routine", __FUNCTION__);
 
-	  found = true; 
-	  break; 
-	}
-      else
-	{
-	  continue;
-	}
+  return;
 
-    }
+}
+
+void ChannelAccessInterface_Put_CB (struct event_handler_args args)
+{
+
+  log_trace("Entering '%s' routine", __FUNCTION__);
+
+  ccs::base::ChannelAccessClient_Impl::VariableInfo_t* varInfo = static_cast<ccs::base::ChannelAccessClient_Impl::VariableInfo_t*>(args.usr);
+
+  varInfo->success = (args.status == ECA_NORMAL);
 
-  if (found == false)
+  if (!varInfo->success)
     {
-      log_warning("Notification received for unknown channel");
+      log_warning("%s - Put to '%s' completed with '%d'", __FUNCTION__, varInfo->name, args.status);
     }
 
+  varInfo->confirmed = varInfo->issued;
+  varInfo->pending = false;
+
   log_trace("Leaving '%s' routine", __FUNCTION__);
 
   return;
@@ -249,34 +245,25 @@ void ChannelAccessInterface_Thread_PRBL (ccs::base::ChannelAccessClient_Impl* se
 
   log_trace("Entering '%s' routine", __FUNCTION__);
 
-  // Create variable cache
-  self->m_value = new (std::nothrow) ccs::types::AnyValue (self->m_type);
-
   // CA context
   log_info("Create CA context");
   ca_context_create(ca_disable_preemptive_callback);
 
   log_info("Create CA channels");
-  for (uint_t index = 0u; index < (self->m_var_table)->GetSize(); index += 1u)
+  for (ccs::types::uint32 index = 0u; index < self->m_var_table.size(); index += 1u)
     {
 
-      ccs::types::string name;
+      // In-place access, i.e. the variable information is referenced by CA callbacks
+      ccs::base::ChannelAccessClient_Impl::VariableInfo_t* varInfo = &(self->m_var_table[index]);
 
-      if ((self->m_var_table)->GetKeyword(name, index) != STATUS_SUCCESS)
-	{
-	  log_warning("%s - LUTable<>::GetKeyword failed", __FUNCTION__);
-	  continue;
-	}
-  
-      ccs::base::ChannelAccessClient_Impl::VariableInfo_t varInfo; 
-      (self->m_var_table)->GetValue(varInfo, index);
+      const char* name = varInfo->name;
 
-      // Store cache reference
-      varInfo.reference = ccs::HelperTools::GetAttributeReference(self->m_value, name);
-      varInfo.value = new (std::nothrow) ccs::types::AnyValue (varInfo.__type, varInfo.reference);
+      // CA thread copy of the cached variable
+      varInfo->value = new (std::nothrow) ccs::types::AnyValue (self->m_cache->GetType(varInfo->handle));
+      varInfo->self = self;
   
       // Connect to channel
-      if (ca_create_channel(name, NULL, NULL, 10, &(varInfo.channel)) != ECA_NORMAL)
+      if (ca_create_channel(name, NULL, NULL, 10, &(varInfo->channel)) != ECA_NORMAL)
 	{
 	  log_error("%s - ca_create_channel failed", __FUNCTION__);
 	  continue;
@@ -294,20 +281,20 @@ void ChannelAccessInterface_Thread_PRBL (ccs::base::ChannelAccessClient_Impl* se
 	}
 
       // Verify channel
-      if (ca_state(varInfo.channel) != cs_conn) 
+      if (ca_state(varInfo->channel) != cs_conn) 
 	{
 	  log_warning("Connection to channel '%s' has not been successful", name);
 	}
       else
 	{
 	  log_debug("Connection to channel '%s' has been successfully verified", name);
-	  varInfo.connected = true;
+	  varInfo->connected = true;
 	}
 
       // Install subscription for INPUT or ANY variable
-      if (varInfo.direction != ccs::types::OutputVariable)
+      if (self->m_cache->GetDirection(varInfo->handle) != ccs::types::OutputVariable)
 	{ // Element count set to '0' to support arrays
-	  if (ca_create_subscription(varInfo.type, 0, varInfo.channel, DBE_VALUE, &ChannelAccessInterface_Get_CB, (void*) self, NULL) != ECA_NORMAL)
+	  if (ca_create_subscription(varInfo->type, 0, varInfo->channel, DBE_VALUE, &ChannelAccessInterface_Get_CB, static_cast<void*>(varInfo), NULL) != ECA_NORMAL)
 	    {
 	      log_error("%s - ca_create_subscription failed", __FUNCTION__);
 	      continue;
@@ -317,9 +304,6 @@ void ChannelAccessInterface_Thread_PRBL (ccs::base::ChannelAccessClient_Impl* se
 	      log_debug("Subscription to channel '%s' has been successfully created", name);
 	    }
 	}
-      
-      // Store for future use
-      (self->m_var_table)->SetValue(varInfo, index);
 
     }
 
@@ -337,73 +321,99 @@ void ChannelAccessInterface_Thread_CB (ccs::base::ChannelAccessClient_Impl* self
   log_trace("Entering '%s' routine", __FUNCTION__);
 
   bool status = self->m_initialized;
+  bool flush = false;
+
+  std::vector<ccs::base::VariableCache::Handle_t> deferred;
 
-  for (uint_t index = 0; (status && (index < (self->m_var_table)->GetSize())); index += 1)
+  ccs::base::VariableCache::Handle_t handle = VARIABLECACHE_INVALID_HANDLE;
+
+  // Variables queued for update by the application, at most once per cycle each
+  for (ccs::types::uint32 count = 0u; (status && (count < self->m_var_table.size()) && self->m_cache->PopUpdate(handle)); count += 1u)
     {
 
-      ccs::base::ChannelAccessClient_Impl::VariableInfo_t varInfo;
-      (self->m_var_table)->GetValue(varInfo, index);
+      // In-place access, i.e. completion callbacks and application requests update the same instance
+      ccs::base::ChannelAccessClient_Impl::VariableInfo_t* varInfo = &(self->m_var_table[handle]);
 
-      if ((varInfo.direction == ccs::types::InputVariable) || (varInfo.update != true)) // Inputs are managed through notification - Proceed only for OUTPUT or ANY variable which require update
+      if (self->m_cache->GetDirection(handle) == ccs::types::InputVariable) // Inputs are managed through notification
 	{
 	  continue; // Nothing to do for this channel
 	}
 
-      char name [STRING_MAX_LENGTH] = STRING_UNDEFINED;
+      const char* name = varInfo->name;
 
-      if ((self->m_var_table)->GetKeyword(name, index) != STATUS_SUCCESS)
+      if (ca_state(varInfo->channel) != cs_conn)
 	{
-	  // Don't care, just for display purposes
-	}
-	  
-      if (ca_state(varInfo.channel) != cs_conn)
-	{
-	  if (varInfo.connected == true) log_warning("%s - Connection to channel '%d %s' has been lost", __FUNCTION__, index, name);
-	  varInfo.connected = false; (self->m_var_table)->SetValue(varInfo, index);
+	  if (varInfo->connected == true) log_warning("%s - Connection to channel '%u %s' has been lost", __FUNCTION__, handle, name);
+	  varInfo->connected = false;
+
+	  if (varInfo->pending == true)
+	    { // Put operation will not complete
+	      varInfo->success = false;
+	      varInfo->confirmed = varInfo->issued;
+	      varInfo->pending = false;
+	    }
+
+	  deferred.push_back(handle); // Retried upon re-connection
 	  continue;
 	}
       else
 	{
-	  if (varInfo.connected == false) log_info("%s - Connection to channel '%d %s' has been re-established", __FUNCTION__, index, name);
-	  varInfo.connected = true;
+	  if (varInfo->connected == false) log_info("%s - Connection to channel '%u %s' has been re-established", __FUNCTION__, handle, name);
+	  varInfo->connected = true;
 	}
-#if 0 // Inputs are managed through notification - Always true if control reaches this section of the code
-      if ((varInfo.direction != ccs::types::InputVariable) && (varInfo.update == true)) // Proceed only for OUTPUT or ANY variable which require update
-#endif
+
+      if (varInfo->pending == true)
+	{ // Previous put in flight - Coalesced update issued upon completion
+	  deferred.push_back(handle);
+	  continue;
+	}
+
+      log_debug("%s - Channel '%s' needs update", __FUNCTION__, name);
+
+      // Consistent copy out of the cache
+      varInfo->issued = varInfo->requested;
+
+      if (!self->m_cache->GetValue(handle, *(varInfo->value)))
 	{
-	  log_debug("%s - Channel '%s' needs update", __FUNCTION__, name);
+	  log_warning("%s - VariableCache::GetValue '%s' failed", __FUNCTION__, name);
+	  continue;
+	}
 
-	  if (varInfo.type == DBR_STRING) log_debug("Variable '%s' holds '%s'", name, (char*) varInfo.reference);
-	  if ((varInfo.type == DBR_CHAR) && (varInfo.mult > 1)) log_debug("Variable '%s' holds '%s'", name, (char*) varInfo.reference);
+      if (varInfo->type == DBR_STRING) log_debug("Variable '%s' holds '%s'", name, (char*) (varInfo->value)->GetInstance());
+      if ((varInfo->type == DBR_CHAR) && (varInfo->mult > 1)) log_debug("Variable '%s' holds '%s'", name, (char*) (varInfo->value)->GetInstance());
 
-	  varInfo.update = false;
-	  
-	  if (ca_array_put(varInfo.type, varInfo.mult, varInfo.channel, varInfo.reference) != ECA_NORMAL) // Copy from cache
-	    {
-	      log_warning("%s - ca_array_put '%s' failed", __FUNCTION__, name);
-	    }
-	  else
-	    {
-	      log_debug("Update CA record '%s'", name);
-	    }
+      if (ca_array_put_callback(varInfo->type, varInfo->mult, varInfo->channel, (varInfo->value)->GetInstance(), &ChannelAccessInterface_Put_CB, static_cast<void*>(varInfo)) != ECA_NORMAL)
+	{
+	  log_warning("%s - ca_array_put_callback '%s' failed", __FUNCTION__, name);
+	  varInfo->success = false;
+	  varInfo->confirmed = varInfo->issued;
 	}
-#if 0 // Not necessary anymore - Replaced with a global ca_poll below
-      // Flush the request
-      if (ca_pend_io(1) != ECA_NORMAL)
+      else
 	{
-	  log_warning("%s - ca_pend_io failed", __FUNCTION__);
+	  log_debug("Update CA record '%s'", name);
+	  varInfo->pending = true;
+	  flush = true;
 	}
-#endif
-      // Store value for later use - Only the update request flag which has been cleared
-      (self->m_var_table)->SetValue(varInfo, index);
 
     }
 
-  // Let CA perform any necessary background activity
+  // Send all put requests at once
+  if (flush && (ca_flush_io() != ECA_NORMAL))
+    {
+      log_warning("%s - ca_flush_io failed", __FUNCTION__);
+    }
+
+  // Let CA perform any necessary background activity, incl. completion callbacks
   if (ca_poll() != ECA_TIMEOUT)
     {
       log_warning("%s - ca_poll failed", __FUNCTION__);
     }
+
+  // Queue again updates which could not be issued
+  for (std::vector<ccs::base::VariableCache::Handle_t>::iterator it = deferred.begin(); it != deferred.end(); ++it)
+    {
+      (void)self->m_cache->PushUpdate(*it);
+    }
       
   log_trace("Leaving '%s' routine", __FUNCTION__);
 
@@ -439,9 +449,14 @@ bool ChannelAccessClient_Impl::AddVariable (const char* name, ccs::types::DirIde
 
   VariableInfo_t varInfo;
 
-  varInfo.cb = NULL;
-  varInfo.update = false;
-  varInfo.direction = direction;
+  varInfo.connected = false;
+  varInfo.pending = false;
+  varInfo.success = true;
+  varInfo.requested = 0u;
+  varInfo.issued = 0u;
+  varInfo.confirmed = 0u;
+  varInfo.value = static_cast<ccs::types::AnyValue*>(NULL);
+  varInfo.self = this;
   ccs::HelperTools::SafeStringCopy(varInfo.name, name, sizeof(ccs::types::string));
 
   bool status = (ccs::HelperTools::Is<ccs::types::ScalarType>(type) || 
@@ -454,23 +469,22 @@ bool ChannelAccessClient_Impl::AddVariable (const char* name, ccs::types::DirIde
       varInfo.mult = (ccs::HelperTools::Is<ccs::types::ScalarType>(type) ?
 		      1 :
 		      std::dynamic_pointer_cast<const ccs::types::ArrayType>(type)->GetElementNumber());
-      varInfo.__type = type;
     }
 
   if (status)
     {
-      status = ((static_cast<ccs::types::CompoundType*>(NULL) != this->m_type) &&
-		(static_cast<LUTable<VariableInfo_t>*>(NULL) != this->m_var_table));
+      status = (static_cast<VariableCache*>(NULL) != this->m_cache);
     }
 
   if (status)
     {
-      status = (this->m_type)->AddAttribute(name, varInfo.__type); // Type definition for the variable cache
+      status = (this->m_cache)->AddVariable(name, direction, type);
     }
 
   if (status)
     {
-      status = (this->m_var_table)->AddPair(name, varInfo);
+      varInfo.handle = (this->m_cache)->GetHandle(name);
+      (this->m_var_table).push_back(varInfo); // Indexed by handle
     }
 
   return status;
@@ -482,28 +496,29 @@ bool ChannelAccessClient_Impl::AddVariable (const char* name, bool isInput, chty
 
   VariableInfo_t varInfo;
 
-  varInfo.update = false;
-  varInfo.direction = ((isInput == true) ? ccs::types::AnyputVariable : ccs::types::OutputVariable);
+  varInfo.connected = false;
+  varInfo.pending = false;
+  varInfo.success = true;
+  varInfo.requested = 0u;
+  varInfo.issued = 0u;
+  varInfo.confirmed = 0u;
+  varInfo.value = static_cast<ccs::types::AnyValue*>(NULL);
+  varInfo.self = this;
+  varInfo.type = type;
+  varInfo.mult = mult;
   ccs::HelperTools::SafeStringCopy(varInfo.name, name, sizeof(ccs::types::string));
 
-  bool status = ((static_cast<ccs::types::CompoundType*>(NULL) != this->m_type) &&
-		 (static_cast<LUTable<VariableInfo_t>*>(NULL) != this->m_var_table));
+  bool status = (static_cast<VariableCache*>(NULL) != this->m_cache);
 
   if (status)
     {
-      varInfo.type = type;
-      varInfo.mult = mult;
-      varInfo.__type = ccs::HelperTools::CAScalarToAnyType(type, mult);
+      status = (this->m_cache)->AddVariable(name, ((isInput == true) ? ccs::types::AnyputVariable : ccs::types::OutputVariable), ccs::HelperTools::CAScalarToAnyType(type, mult));
     }
 
   if (status)
     {
-      status = (this->m_type)->AddAttribute(name, varInfo.__type); // Type definition for the variable cache
-    }
-
-  if (status)
-    {
-      status = (this->m_var_table)->AddPair(name, varInfo);
+      varInfo.handle = (this->m_cache)->GetHandle(name);
+      (this->m_var_table).push_back(varInfo); // Indexed by handle
     }
 
   return status;
@@ -515,12 +530,9 @@ void ChannelAccessClient_Impl::Initialize (void)
 
   // Initialize resources
   this->m_sleep = DEFAULT_CAINTERFACE_THREAD_PERIOD;
-  this->m_var_table = new LUTable<VariableInfo_t> (MAXIMUM_VARIABLE_NUM); // The table will be filled with application-specific variable list
+  this->m_cache = new (std::nothrow) VariableCache (MAXIMUM_VARIABLE_NUM); // The cache will be filled with application-specific variable list
   this->m_initialized = false;
 
-  this->m_type = new (std::nothrow) ccs::types::CompoundType ("caif::VariableCache_t");
-  this->m_value = static_cast<ccs::types::AnyValue*>(NULL);
-
   this->m_thread = new ccs::base::AnyThread ("CA Interface"); 
   (this->m_thread)->SetPeriod(this->m_sleep); (this->m_thread)->SetAccuracy(this->m_sleep);
   (this->m_thread)->SetPreamble((void (*)(void*)) &ChannelAccessInterface_Thread_PRBL, (void*) this); 
@@ -539,27 +551,68 @@ bool ChannelAccessClient_Impl::Launch (void) { return ((this->m_thread)->Launch(
 
 bool ChannelAccessClient::IsValid (const char* name) const { return __impl->IsValid(name); }
 
-bool ChannelAccessClient_Impl::IsValid (uint_t id) const { return ((this->m_var_table)->IsValid(id) == STATUS_SUCCESS); }
-bool ChannelAccessClient_Impl::IsValid (const char* name) const { return ((this->m_var_table)->IsValid(name) == STATUS_SUCCESS); }
+bool ChannelAccessClient_Impl::IsValid (uint_t id) const { return (this->m_cache)->IsValid(id); }
+bool ChannelAccessClient_Impl::IsValid (const char* name) const { return (this->m_cache)->IsValid(name); }
 
-uint_t ChannelAccessClient_Impl::GetVariableId (const char* name) const { uint_t id = 0; (this->m_var_table)->GetIndex(name, id); return id; }
+uint_t ChannelAccessClient_Impl::GetVariableId (const char* name) const { return (this->m_cache)->GetHandle(name); }
 
 ccs::types::AnyValue* ChannelAccessClient::GetVariable (const char* name) const { return __impl->GetVariable(__impl->GetVariableId(name)); }
 
-ccs::types::AnyValue* ChannelAccessClient_Impl::GetVariable (uint_t id) const { VariableInfo_t varInfo; varInfo.value = static_cast<ccs::types::AnyValue*>(NULL); if (this->IsValid(id)) (this->m_var_table)->GetValue(varInfo, id); return varInfo.value; }
+ccs::types::AnyValue* ChannelAccessClient_Impl::GetVariable (uint_t id) const { return (this->m_cache)->GetSnapshot(id); }
 ccs::types::AnyValue* ChannelAccessClient_Impl::GetVariable (const char* name) const { return this->GetVariable(this->GetVariableId(name)); }
 
-std::shared_ptr<const ccs::types::AnyType> ChannelAccessClient_Impl::GetVariableType (uint_t id) const { std::shared_ptr<const ccs::types::AnyType> type; if (this->IsValid(id)) type = this->GetVariable(id)->GetType(); return type; }
+bool ChannelAccessClient::GetVariable (const char* name, void* buffer, ccs::types::uint32 size) const { return __impl->GetVariable(__impl->GetVariableId(name), buffer, size); }
+
+bool ChannelAccessClient_Impl::GetVariable (uint_t id, void* buffer, ccs::types::uint32 size) const { return (this->m_cache)->GetValue(id, buffer, size); }
+
+std::shared_ptr<const ccs::types::AnyType> ChannelAccessClient_Impl::GetVariableType (uint_t id) const { return (this->m_cache)->GetType(id); }
 std::shared_ptr<const ccs::types::AnyType> ChannelAccessClient_Impl::GetVariableType (const char* name) const { return this->GetVariableType(this->GetVariableId(name)); }
 
+bool ChannelAccessClient::SetVariable (const char* name, const void* buffer, ccs::types::uint32 size) { return __impl->SetVariable(__impl->GetVariableId(name), buffer, size); }
+
+bool ChannelAccessClient_Impl::SetVariable (uint_t id, const void* buffer, ccs::types::uint32 size) { bool status = (this->m_cache)->SetValue(id, buffer, size); if (status) { status = this->UpdateVariable(id); } return status; }
+
 bool ChannelAccessClient::UpdateVariable (const char* name) { return __impl->UpdateVariable(__impl->GetVariableId(name)); }
 
-bool ChannelAccessClient_Impl::UpdateVariable (uint_t id) { bool status = this->IsValid(id); if (status) { VariableInfo_t varInfo; (this->m_var_table)->GetValue(varInfo, id); varInfo.update = true; (this->m_var_table)->SetValue(varInfo, id); } return status; }
+bool ChannelAccessClient_Impl::UpdateVariable (uint_t id) { bool status = (this->m_cache)->CommitSnapshot(id); if (status) { (void)__sync_add_and_fetch(&(this->m_var_table[id].requested), 1u); status = (this->m_cache)->PushUpdate(id); } return status; }
 bool ChannelAccessClient_Impl::UpdateVariable (const char* name) { return this->UpdateVariable(this->GetVariableId(name)); }
 
+bool ChannelAccessClient::WaitForCompletion (const char* name, ccs::types::uint64 timeout) const { return __impl->WaitForCompletion(__impl->GetVariableId(name), timeout); }
+
+bool ChannelAccessClient_Impl::WaitForCompletion (ccs::types::uint32 id, ccs::types::uint64 timeout) const
+{
+
+  bool status = this->IsValid(id);
+
+  const VariableInfo_t* varInfo = static_cast<const VariableInfo_t*>(NULL);
+  ccs::types::uint32 target = 0u;
+
+  if (status)
+    {
+      varInfo = &(this->m_var_table[id]);
+      target = varInfo->requested; // Updates requested so far
+    }
+
+  ccs::types::uint64 till = ccs::HelperTools::GetCurrentTime() + timeout;
+
+  // Wrap-around safe comparison
+  while (status && (0 < static_cast<ccs::types::int32>(target - varInfo->confirmed)) && (ccs::HelperTools::GetCurrentTime() < till))
+    {
+      ccs::HelperTools::SleepFor(1000000ul);
+    }
+
+  if (status)
+    {
+      status = ((0 >= static_cast<ccs::types::int32>(target - varInfo->confirmed)) && varInfo->success);
+    }
+
+  return status;
+
+}
+
 bool ChannelAccessClient::SetCallback (const char* name, std::function<void(const char*, const ccs::types::AnyValue&)> cb) { return __impl->SetCallback(name, cb); }
 
-bool ChannelAccessClient_Impl::SetCallback (ccs::types::uint32 id, std::function<void(const char*, const ccs::types::AnyValue&)> cb) { VariableInfo_t varInfo; bool status = this->IsValid(id); if (status) { (this->m_var_table)->GetValue(varInfo, id); varInfo.cb = cb; (this->m_var_table)->SetValue(varInfo, id); } return status; }
+bool ChannelAccessClient_Impl::SetCallback (ccs::types::uint32 id, std::function<void(const char*, const ccs::types::AnyValue&)> cb) { return (this->m_cache)->SetCallback(id, cb); }
 bool ChannelAccessClient_Impl::SetCallback (const char* name, std::function<void(const char*, const ccs::types::AnyValue&)> cb) { return this->SetCallback(this->GetVariableId(name), cb); }
 
 // Constructor methods
@@ -613,7 +666,13 @@ ChannelAccessClient_Impl::~ChannelAccessClient_Impl (void)
 
   // Release resources
   if (this->m_thread != NULL) delete this->m_thread;
-  if (this->m_var_table != NULL) delete this->m_var_table;
+
+  for (std::vector<VariableInfo_t>::iterator it = (this->m_var_table).begin(); it != (this->m_var_table).end(); ++it)
+    {
+      if (static_cast<ccs::types::AnyValue*>(NULL) != it->value) delete it->value;
+    }
+
+  if (this->m_cache != NULL) delete this->m_cache;
 
   // Remove instance from object database
   ccs::base::GlobalObjectDatabase::Remove(DEFAULT_CAINTERFACE_INSTANCE_NAME); 
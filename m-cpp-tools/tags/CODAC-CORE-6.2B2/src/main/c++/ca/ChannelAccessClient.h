@@ -54,6 +54,8 @@
 #undef DBR_UNDEF
 #define DBR_UNDEF 1024 
 
+#define DEFAULT_CAPUT_TIMEOUT 1000000000ul // [ns]
+
 // Type definition
 
 namespace ccs {
@@ -66,13 +68,20 @@ class ChannelAccessClient_Impl; // Forward class declaration
  * @brief Interface class providing support for CA client with variable cache.
  * @detail The class provides access to a variable cache and asynchronous CA
  * update to ensure non-blocking calls on the application side. The variable
- * cache is implemented by means of ccs::types::AnyValue instances which allow
- * assignment to/from C-like structures.
+ * cache is implemented by means of ccs::base::VariableCache which holds each
+ * variable in a sequence-locked slot, i.e. the GetVariable and SetVariable
+ * methods copy consistent values to/from C-like structures without blocking
+ * the CA thread. Updated variables are queued for the CA thread rather than
+ * scanned at each cycle.
  *
  * The class also offers a callback mechanism for input or bi-directional
  * variables to allow for application-specific synchronous handling of CA
  * monitor events.
  *
+ * Updates of output or bi-directional variables are written with completion
+ * callback and flushed once per cycle. The application may wait for the
+ * confirmation of its updates using the WaitForCompletion method.
+ *
  * @note The design is based on a bridge pattern to avoid exposing CA specific
  * internals through the interface class.
  */
@@ -107,10 +116,56 @@ class ChannelAccessClient
     template <typename Type> bool GetVariable (const char* name, Type& value) const;
     template <typename Type> bool SetVariable (const char* name, Type& value);
 
+    /**
+     * @brief Accessor. GetVariable method.
+     * @detail Consistent copy of the variable held in the cache.
+     * @param name Variable identifier.
+     * @param buffer Placeholder of size equal to that of the variable type.
+     * @param size Placeholder size.
+     * @return True if successful.
+     */
+
+    bool GetVariable (const char* name, void* buffer, ccs::types::uint32 size) const;
+
+    /**
+     * @brief Accessor. SetVariable method.
+     * @detail Writes the variable held in the cache and queues the variable for
+     * update by the CA thread.
+     * @param name Variable identifier.
+     * @param buffer Value of size equal to that of the variable type.
+     * @param size Value size.
+     * @return True if successful.
+     */
+
+    bool SetVariable (const char* name, const void* buffer, ccs::types::uint32 size);
+
+    /**
+     * @brief Accessor. GetVariable method.
+     * @detail In-place access to a snapshot of the variable held in the cache, e.g. attribute
+     * level access. The snapshot is refreshed at each call and is not written by the CA thread;
+     * the UpdateVariable method has to be called to write it back and trigger CA record update.
+     * @param name Variable identifier.
+     * @return Reference to the ccs::types::AnyValue snapshot if variable exists, 
+     * NULL otherwise. 
+     */
+
     ccs::types::AnyValue* GetVariable (const char* name) const;
 
     bool UpdateVariable (const char* name);
 
+    /**
+     * @brief Accessor. WaitForCompletion method.
+     * @detail Puts are issued asynchronously by the CA thread with completion callback.
+     * The method waits until all updates requested for the variable so far have been
+     * confirmed by the server, or the timeout expires. Updates requested whilst a put is
+     * in flight are coalesced in the next put.
+     * @param name Variable identifier.
+     * @param timeout Timeout in ns.
+     * @return True if the last put completed successfully within the timeout.
+     */
+
+    bool WaitForCompletion (const char* name, ccs::types::uint64 timeout = DEFAULT_CAPUT_TIMEOUT) const;
+
     /**
      * @brief Accessor. SetCallback method.
      * @detail The method installs an application callback to be called synchronously when
@@ -166,37 +221,12 @@ template <> inline ChannelAccessClient* GetInstance<ChannelAccessClient> (void)
 
 template <typename Type> bool ChannelAccessClient::GetVariable (const char* name, Type& value) const 
 { 
-
-  const ccs::types::AnyValue* var = static_cast<ccs::types::AnyValue*>(NULL); 
-
-  bool status = this->IsValid(name); 
-
-  if (status) 
-    { 
-      var = this->GetVariable(name); 
-      value = static_cast<Type>(*var); 
-    } 
-  
-  return status; 
-  
+  return this->GetVariable(name, static_cast<void*>(&value), sizeof(Type)); 
 }
 
 template <typename Type> bool ChannelAccessClient::SetVariable (const char* name, Type& value) 
 { 
-
-  ccs::types::AnyValue* var = static_cast<ccs::types::AnyValue*>(NULL); 
-
-  bool status = this->IsValid(name); 
-
-  if (status) 
-    { 
-      var = this->GetVariable(name); 
-      *var = value; 
-      this->UpdateVariable(name); 
-    } 
-
-  return status; 
-
+  return this->SetVariable(name, static_cast<const void*>(&value), sizeof(Type)); 
 }
 
 } // namespace base
@@ -35,6 +35,8 @@
 
 #include <memory> // std::shared_ptr, etc.
 
+#include <uabase.h> // OPC UA client SDK, e.g. UaVariant
+
 #include <types.h> // Misc. type definition
 #include <tools.h> // Misc. helper functions
 
@@ -56,6 +58,99 @@
 namespace ccs {
 
 namespace HelperTools {
+
+/**
+ * @brief Conversion routines between UaVariant and cached scalar instances.
+ * @detail Resolved once per variable from its introspectable type, so as to avoid
+ * type tests upon each OPC UA notification or write.
+ */
+
+typedef void (*UAVariantToAnyType_t) (const UaVariant& value, void* ref);
+typedef void (*AnyTypeToUAVariant_t) (const void* ref, UaVariant& value);
+
+// Function declaration
+
+static inline UAVariantToAnyType_t GetUAVariantToAnyType (const std::shared_ptr<const ccs::types::AnyType>& type);
+static inline AnyTypeToUAVariant_t GetAnyTypeToUAVariant (const std::shared_ptr<const ccs::types::AnyType>& type);
+
+// Function definition
+
+static inline void UAVariantToBoolean (const UaVariant& value, void* ref) { value.toBoolean(*(static_cast<OpcUa_Boolean*>(ref))); }
+static inline void UAVariantToSInt8 (const UaVariant& value, void* ref) { value.toSByte(*(static_cast<ccs::types::int8*>(ref))); }
+static inline void UAVariantToUInt8 (const UaVariant& value, void* ref) { value.toByte(*(static_cast<ccs::types::uint8*>(ref))); }
+static inline void UAVariantToSInt16 (const UaVariant& value, void* ref) { value.toInt16(*(static_cast<ccs::types::int16*>(ref))); }
+static inline void UAVariantToUInt16 (const UaVariant& value, void* ref) { value.toUInt16(*(static_cast<ccs::types::uint16*>(ref))); }
+static inline void UAVariantToSInt32 (const UaVariant& value, void* ref) { value.toInt32(*(static_cast<ccs::types::int32*>(ref))); }
+static inline void UAVariantToUInt32 (const UaVariant& value, void* ref) { value.toUInt32(*(static_cast<ccs::types::uint32*>(ref))); }
+static inline void UAVariantToSInt64 (const UaVariant& value, void* ref) { value.toInt64(*(static_cast<ccs::types::int64*>(ref))); }
+static inline void UAVariantToUInt64 (const UaVariant& value, void* ref) { value.toUInt64(*(static_cast<ccs::types::uint64*>(ref))); }
+static inline void UAVariantToFloat32 (const UaVariant& value, void* ref) { value.toFloat(*(static_cast<ccs::types::float32*>(ref))); }
+static inline void UAVariantToFloat64 (const UaVariant& value, void* ref) { value.toDouble(*(static_cast<ccs::types::float64*>(ref))); }
+
+static inline void BooleanToUAVariant (const void* ref, UaVariant& value) { value.setBoolean(*(static_cast<const OpcUa_Boolean*>(ref))); }
+static inline void SInt8ToUAVariant (const void* ref, UaVariant& value) { value.setSByte(*(static_cast<const ccs::types::int8*>(ref))); }
+static inline void UInt8ToUAVariant (const void* ref, UaVariant& value) { value.setByte(*(static_cast<const ccs::types::uint8*>(ref))); }
+static inline void SInt16ToUAVariant (const void* ref, UaVariant& value) { value.setInt16(*(static_cast<const ccs::types::int16*>(ref))); }
+static inline void UInt16ToUAVariant (const void* ref, UaVariant& value) { value.setUInt16(*(static_cast<const ccs::types::uint16*>(ref))); }
+static inline void SInt32ToUAVariant (const void* ref, UaVariant& value) { value.setInt32(*(static_cast<const ccs::types::int32*>(ref))); }
+static inline void UInt32ToUAVariant (const void* ref, UaVariant& value) { value.setUInt32(*(static_cast<const ccs::types::uint32*>(ref))); }
+static inline void SInt64ToUAVariant (const void* ref, UaVariant& value) { value.setInt64(*(static_cast<const ccs::types::int64*>(ref))); }
+static inline void UInt64ToUAVariant (const void* ref, UaVariant& value) { value.setUInt64(*(static_cast<const ccs::types::uint64*>(ref))); }
+static inline void Float32ToUAVariant (const void* ref, UaVariant& value) { value.setFloat(*(static_cast<const ccs::types::float32*>(ref))); }
+static inline void Float64ToUAVariant (const void* ref, UaVariant& value) { value.setDouble(*(static_cast<const ccs::types::float64*>(ref))); }
+
+static inline UAVariantToAnyType_t GetUAVariantToAnyType (const std::shared_ptr<const ccs::types::AnyType>& type)
+{
+
+  UAVariantToAnyType_t conv = static_cast<UAVariantToAnyType_t>(NULL);
+
+  std::shared_ptr<const ccs::types::ScalarType> inp_type = std::dynamic_pointer_cast<const ccs::types::ScalarType>(type);
+
+  if (inp_type)
+    {
+      if (ccs::types::Boolean == inp_type) conv = &UAVariantToBoolean;
+      else if (ccs::types::SignedInteger8 == inp_type) conv = &UAVariantToSInt8;
+      else if (ccs::types::UnsignedInteger8 == inp_type) conv = &UAVariantToUInt8;
+      else if (ccs::types::SignedInteger16 == inp_type) conv = &UAVariantToSInt16;
+      else if (ccs::types::UnsignedInteger16 == inp_type) conv = &UAVariantToUInt16;
+      else if (ccs::types::SignedInteger32 == inp_type) conv = &UAVariantToSInt32;
+      else if (ccs::types::UnsignedInteger32 == inp_type) conv = &UAVariantToUInt32;
+      else if (ccs::types::SignedInteger64 == inp_type) conv = &UAVariantToSInt64;
+      else if (ccs::types::UnsignedInteger64 == inp_type) conv = &UAVariantToUInt64;
+      else if (ccs::types::Float32 == inp_type) conv = &UAVariantToFloat32;
+      else if (ccs::types::Float64 == inp_type) conv = &UAVariantToFloat64;
+    }
+
+  return conv;
+
+}
+
+static inline AnyTypeToUAVariant_t GetAnyTypeToUAVariant (const std::shared_ptr<const ccs::types::AnyType>& type)
+{
+
+  AnyTypeToUAVariant_t conv = static_cast<AnyTypeToUAVariant_t>(NULL);
+
+  std::shared_ptr<const ccs::types::ScalarType> inp_type = std::dynamic_pointer_cast<const ccs::types::ScalarType>(type);
+
+  if (inp_type)
+    {
+      if (ccs::types::Boolean == inp_type) conv = &BooleanToUAVariant;
+      else if (ccs::types::SignedInteger8 == inp_type) conv = &SInt8ToUAVariant;
+      else if (ccs::types::UnsignedInteger8 == inp_type) conv = &UInt8ToUAVariant;
+      else if (ccs::types::SignedInteger16 == inp_type) conv = &SInt16ToUAVariant;
+      else if (ccs::types::UnsignedInteger16 == inp_type) conv = &UInt16ToUAVariant;
+      else if (ccs::types::SignedInteger32 == inp_type) conv = &SInt32ToUAVariant;
+      else if (ccs::types::UnsignedInteger32 == inp_type) conv = &UInt32ToUAVariant;
+      else if (ccs::types::SignedInteger64 == inp_type) conv = &SInt64ToUAVariant;
+      else if (ccs::types::UnsignedInteger64 == inp_type) conv = &UInt64ToUAVariant;
+      else if (ccs::types::Float32 == inp_type) conv = &Float32ToUAVariant;
+      else if (ccs::types::Float64 == inp_type) conv = &Float64ToUAVariant;
+    }
+
+  return conv;
+
+}
+
 #if 0
 typedef chtype CATypeIdentifier_t;
 
@@ -27,6 +27,7 @@
 
 #include <functional> // std::function
 #include <new> // std::nothrow
+#include <vector> // std::vector
 
 #include <uabase.h> // OPC UA client SDK
 #include <uaplatformlayer.h>
@@ -42,13 +43,13 @@
 //#undef LOG_DEBUG_ENABLE
 #include <log-api.h> // Syslog wrapper routines
 
-#include <lu-table.h> // Look-up table class definition, etc.
-
 #include <AnyObject.h> // Abstract base class definition ..
 #include <ObjectDatabase.h> // .. associated object database
 
 #include <any-thread.h> // Thread management class
 
+#include <VariableCache.h> // Variable cache shared with the application
+
 #include <AnyValue.h> // Variable with introspectable data type ..
 #include <AnyValueHelper.h> // .. associated helper routines
 
@@ -104,33 +105,30 @@ class OPCUAClientImpl : public AnyObject, public UaClientSdk::UaSessionCallback,
     UaClientSdk::UaSession* __session = static_cast<UaClientSdk::UaSession*>(NULL);
     UaClientSdk::UaSubscription* __subscription = static_cast<UaClientSdk::UaSubscription*>(NULL);
 
-    ccs::types::CompoundType* m_type; // Introspectable type definition for the variable cache ..
-    ccs::types::AnyValue* m_value; // Introspectable variable mapped to the whole cache ..
+    VariableCache* m_cache; // Variable cache shared with the application
 
     bool m_initialized;
 
     typedef struct VariableInfo {
 
-      bool update;
-      ccs::types::DirIdentifier direction;
-      
-      std::function<void(const char*, const ccs::types::AnyValue&)> cb;
-
       ccs::types::string name;
+      VariableCache::Handle_t handle;
 #if 0
       chid channel;
       chtype type; // OPCUA native type
 #endif
       ccs::types::uint32 mult;
       
-      void* reference; // Reference in the cache
-      
-      std::shared_ptr<const ccs::types::AnyType> __type; // Introspectable type definition for the variable cache ..
-      ccs::types::AnyValue* value;
+      ccs::types::AnyValue* value; // Interface thread copy of the cached variable for write operations ..
+      ccs::types::AnyValue* input; // .. and data change notifications
+
+      // Conversion routines resolved from the type definition
+      ccs::HelperTools::UAVariantToAnyType_t decoder;
+      ccs::HelperTools::AnyTypeToUAVariant_t encoder;
       
     } VariableInfo_t;
 
-    LUTable<VariableInfo_t>* m_var_table;
+    std::vector<VariableInfo_t> m_var_table; // Indexed by variable cache handle
 
     // Initializer methods
     bool AddVariable (const char* name, ccs::types::DirIdentifier direction, const std::shared_ptr<const ccs::types::AnyType>& type);
@@ -148,12 +146,12 @@ class OPCUAClientImpl : public AnyObject, public UaClientSdk::UaSessionCallback,
     ccs::types::AnyValue* GetVariable (ccs::types::uint32 id) const;
     ccs::types::AnyValue* GetVariable (const char* name) const;
 
-    template <typename Type> bool GetVariable (const char* name, Type& value) const;
+    bool GetVariable (ccs::types::uint32 id, void* buffer, ccs::types::uint32 size) const;
 
     std::shared_ptr<const ccs::types::AnyType> GetVariableType (ccs::types::uint32 id) const;
     std::shared_ptr<const ccs::types::AnyType> GetVariableType (const char* name) const;
 
-    template <typename Type> bool SetVariable (const char* name, Type& value);
+    bool SetVariable (ccs::types::uint32 id, const void* buffer, ccs::types::uint32 size);
 
     bool UpdateVariable (ccs::types::uint32 id);
     bool UpdateVariable (const char* name);
@@ -196,35 +194,21 @@ void OPCUAInterface_Thread_PRBL (ccs::base::OPCUAClientImpl* self)
 
   log_info("Entering '%s' routine", __FUNCTION__);
 
-  // Create variable cache
-  self->m_value = new (std::nothrow) ccs::types::AnyValue (self->m_type);
-
   // Create subscription specification
   UaMonitoredItemCreateRequests items;
-  items.create((self->m_var_table)->GetSize());
+  items.create(self->m_var_table.size());
 
-  for (ccs::types::uint32 index = 0; index < (self->m_var_table)->GetSize(); index += 1u)
+  for (ccs::types::uint32 index = 0; index < self->m_var_table.size(); index += 1u)
     {
 
-      ccs::types::string name;
+      // In-place access, i.e. the variable information is referenced by data change notifications
+      ccs::base::OPCUAClientImpl::VariableInfo_t* varInfo = &(self->m_var_table[index]);
 
-      if ((self->m_var_table)->GetKeyword(name, index) != STATUS_SUCCESS)
-	{
-	  log_warning("%s - LUTable<>::GetKeyword failed", __FUNCTION__);
-	  continue;
-	}
-  
-      ccs::base::OPCUAClientImpl::VariableInfo_t varInfo; 
-
-      if ((self->m_var_table)->GetValue(varInfo, index) != STATUS_SUCCESS)
-	{
-	  log_warning("%s - LUTable<>::GetValue failed", __FUNCTION__);
-	  continue;
-	}
+      const char* name = varInfo->name;
 
-      // Store cache reference
-      varInfo.reference = ccs::HelperTools::GetAttributeReference(self->m_value, name);
-      varInfo.value = new (std::nothrow) ccs::types::AnyValue (varInfo.__type, varInfo.reference);
+      // Interface thread copies of the cached variable
+      varInfo->value = new (std::nothrow) ccs::types::AnyValue (self->m_cache->GetType(varInfo->handle));
+      varInfo->input = new (std::nothrow) ccs::types::AnyValue (self->m_cache->GetType(varInfo->handle));
 
       // Install subscription for all variables
       UaString variable (name); // ns=<namespace_index>;s=<fully_qualified_path>
@@ -236,9 +220,6 @@ void OPCUAInterface_Thread_PRBL (ccs::base::OPCUAClientImpl* self)
       items[index].RequestedParameters.DiscardOldest = OpcUa_True;
       items[index].MonitoringMode = OpcUa_MonitoringMode_Reporting;
 
-      // Store for future use
-      (self->m_var_table)->SetValue(varInfo, index);
-
     }
 
   bool status = (NULL != self->__subscription);
@@ -283,28 +264,26 @@ void OPCUAInterface_Thread_CB (ccs::base::OPCUAClientImpl* self)
 
   bool status = self->m_initialized;
 
-  for (ccs::types::uint32 index = 0u; (status && (index < (self->m_var_table)->GetSize())); index += 1u)
+  ccs::base::VariableCache::Handle_t handle = VARIABLECACHE_INVALID_HANDLE;
+
+  // Variables queued for update by the application, at most once per cycle each
+  for (ccs::types::uint32 count = 0u; (status && (count < self->m_var_table.size()) && self->m_cache->PopUpdate(handle)); count += 1u)
     {
 
-      ccs::types::string name;
+      ccs::base::OPCUAClientImpl::VariableInfo_t* varInfo = &(self->m_var_table[handle]);
 
-      if ((self->m_var_table)->GetKeyword(name, index) != STATUS_SUCCESS)
-	{
-	  log_warning("%s - LUTable<>::GetKeyword failed", __FUNCTION__);
-	  continue;
-	}
-  
-      ccs::base::OPCUAClientImpl::VariableInfo_t varInfo;
+      const char* name = varInfo->name;
 
-      if ((self->m_var_table)->GetValue(varInfo, index) != STATUS_SUCCESS)
+      if ((self->m_cache->GetDirection(handle) == ccs::types::InputVariable) || (NULL == varInfo->encoder))
 	{
-	  log_warning("%s - LUTable<>::GetValue failed", __FUNCTION__);
-	  continue;
+	  continue; // Nothing to do for this channel
 	}
 
-      if ((varInfo.direction == ccs::types::InputVariable) || (varInfo.update != true))
+      // Consistent copy out of the cache
+      if (!self->m_cache->GetValue(handle, *(varInfo->value)))
 	{
-	  continue; // Nothing to do for this channel
+	  log_warning("%s - VariableCache::GetValue '%s' failed", __FUNCTION__, name);
+	  continue;
 	}
 
       UaWriteValues node;
@@ -317,30 +296,7 @@ void OPCUAInterface_Thread_CB (ccs::base::OPCUAClientImpl* self)
       UaVariant value;
 
       // Set type, set value
-      if (ccs::types::Boolean == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	value.setBoolean(*(reinterpret_cast<OpcUa_Boolean*>(varInfo.reference)));
-      else if (ccs::types::SignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	value.setSByte(*(reinterpret_cast<ccs::types::int8*>(varInfo.reference)));
-      else if (ccs::types::UnsignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	value.setByte(*(reinterpret_cast<ccs::types::uint8*>(varInfo.reference)));
-      else if (ccs::types::SignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	value.setInt16(*(reinterpret_cast<ccs::types::int16*>(varInfo.reference)));
-      else if (ccs::types::UnsignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	value.setUInt16(*(reinterpret_cast<ccs::types::uint16*>(varInfo.reference)));
-      else if (ccs::types::SignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	value.setInt32(*(reinterpret_cast<ccs::types::int32*>(varInfo.reference)));
-      else if (ccs::types::UnsignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	value.setUInt32(*(reinterpret_cast<ccs::types::uint32*>(varInfo.reference)));
-      else if (ccs::types::SignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	value.setInt64(*(reinterpret_cast<ccs::types::int64*>(varInfo.reference)));
-      else if (ccs::types::UnsignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	value.setUInt64(*(reinterpret_cast<ccs::types::uint64*>(varInfo.reference)));
-      else if (ccs::types::Float32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	value.setFloat(*(reinterpret_cast<ccs::types::float32*>(varInfo.reference)));
-      else if (ccs::types::Float64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	value.setDouble(*(reinterpret_cast<ccs::types::float64*>(varInfo.reference)));
-      else
-	continue;
+      (*varInfo->encoder)((varInfo->value)->GetInstance(), value);
 
       value.copyTo(&node[0].Value.Value);
 
@@ -350,14 +306,14 @@ void OPCUAInterface_Thread_CB (ccs::base::OPCUAClientImpl* self)
 
       UaStatus result; // No copy constructor
       result = self->__session->write(settings, node, results, diagnostics);
-      status = result.isGood();
+      bool written = result.isGood();
 
-      if (status) // Write successful
+      if (written) // Write successful
 	{
-	  status = (OpcUa_IsGood(results[0]));
+	  written = (OpcUa_IsGood(results[0]));
 	}
 
-      if (status)
+      if (written)
 	{
           log_info("%s - Write successful for '%s'", __FUNCTION__, name);
         }
@@ -366,9 +322,6 @@ void OPCUAInterface_Thread_CB (ccs::base::OPCUAClientImpl* self)
           log_error("%s - Write failed for '%s' with status '%s'", __FUNCTION__, name, UaStatus(results[0]).toString().toUtf8());
         }
 
-      // Store value for later use - Only the update request flag which has been cleared
-      (self->m_var_table)->SetValue(varInfo, index);
-
     }
 
   log_trace("Leaving '%s' routine", __FUNCTION__);
@@ -450,70 +403,28 @@ void OPCUAClientImpl::dataChange (OpcUa_UInt32 clientSubscriptionHandle,
 
   OpcUa_ReferenceParameter(clientSubscriptionHandle); // Only one subscription registered for the session
   OpcUa_ReferenceParameter(diagnosticInfos);
-  
+
+  // Update cache and invoke callbacks, if any .. client handle is the variable index
   for (ccs::types::uint32 index = 0; index < dataNotifications.length(); index += 1u)
     {
-      log_info("OPCUAClientImpl::dataChange - Notification received for variable '%u' (handle) ..", dataNotifications[index].ClientHandle);
-      
-      if (OpcUa_IsGood(dataNotifications[index].Value.StatusCode))
-	{
-	  UaVariant value = dataNotifications[index].Value.Value;
-	  log_info("OPCUAClientImpl::dataChange - .. value '%s'", value.toString().toUtf8());
-
-	  ccs::types::string name;
-	  
-	  if ((this->m_var_table)->GetKeyword(name, index) != STATUS_SUCCESS)
-	    {
-	      log_warning("OPCUAClientImpl::dataChange - LUTable<>::GetKeyword failed", __FUNCTION__);
-	      continue;
-	    }
-	  
-	  // Update cache
-	  ccs::base::OPCUAClientImpl::VariableInfo_t varInfo; 
+      ccs::types::uint32 handle = dataNotifications[index].ClientHandle;
 
-	  if ((this->m_var_table)->GetValue(varInfo, dataNotifications[index].ClientHandle) != STATUS_SUCCESS)
-	    {
-	      log_warning("OPCUAClientImpl::dataChange - LUTable<>::GetValue failed");
-	      continue;
-	    }
+      if ((handle >= (this->m_var_table).size()) || (NULL == (this->m_var_table)[handle].decoder))
+	{
+	  continue; // Unknown handle or unsupported type
+	}
 
-	  // Set type, set value
-	  if (ccs::types::Boolean == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	    value.toBoolean(*(reinterpret_cast<OpcUa_Boolean*>(varInfo.reference)));
-	  else if (ccs::types::SignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	    value.toSByte(*(reinterpret_cast<ccs::types::int8*>(varInfo.reference)));
-	  else if (ccs::types::UnsignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	    value.toByte(*(reinterpret_cast<ccs::types::uint8*>(varInfo.reference)));
-	  else if (ccs::types::SignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	    value.toInt16(*(reinterpret_cast<ccs::types::int16*>(varInfo.reference)));
-	  else if (ccs::types::UnsignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	    value.toUInt16(*(reinterpret_cast<ccs::types::uint16*>(varInfo.reference)));
-	  else if (ccs::types::SignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	    value.toInt32(*(reinterpret_cast<ccs::types::int32*>(varInfo.reference)));
-	  else if (ccs::types::UnsignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	    value.toUInt32(*(reinterpret_cast<ccs::types::uint32*>(varInfo.reference)));
-	  else if (ccs::types::SignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	    value.toInt64(*(reinterpret_cast<ccs::types::int64*>(varInfo.reference)));
-	  else if (ccs::types::UnsignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	    value.toUInt64(*(reinterpret_cast<ccs::types::uint64*>(varInfo.reference)));
-	  else if (ccs::types::Float32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	    value.toFloat(*(reinterpret_cast<ccs::types::float32*>(varInfo.reference)));
-	  else if (ccs::types::Float64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(varInfo.__type))
-	    value.toDouble(*(reinterpret_cast<ccs::types::float64*>(varInfo.reference)));
-	  else
-	    continue;
+      ccs::base::OPCUAClientImpl::VariableInfo_t* varInfo = &((this->m_var_table)[handle]);
 
-	  // Invoke callback, if any
-	  if (NULL != varInfo.cb)
-	    {
-	      log_debug("%OPCUAClientImpl::dataChange -  Invoke callback for '%s' variable", name);
-	      varInfo.cb(name, *varInfo.value);
-	    }
+      if (OpcUa_IsGood(dataNotifications[index].Value.StatusCode))
+	{
+	  UaVariant value (dataNotifications[index].Value.Value);
+	  (*varInfo->decoder)(value, (varInfo->input)->GetInstance());
+	  (void)(this->m_cache)->NotifyValue(varInfo->handle, *(varInfo->input));
 	}
       else
 	{
-	  UaStatus itemError (dataNotifications[index].Value.StatusCode);
-	  log_info("OPCUAClientImpl::dataChange - .. error with status '%s'", itemError.toString().toUtf8());
+	  log_warning("OPCUAClientImpl::dataChange - Notification for '%s' with status '%s'", varInfo->name, UaStatus(dataNotifications[index].Value.StatusCode).toString().toUtf8());
 	}
     }
 
@@ -546,9 +457,8 @@ bool OPCUAClientImpl::AddVariable (const char* name, ccs::types::DirIdentifier d
 
   VariableInfo_t varInfo;
 
-  varInfo.cb = NULL;
-  varInfo.update = false;
-  varInfo.direction = direction;
+  varInfo.value = static_cast<ccs::types::AnyValue*>(NULL);
+  varInfo.input = static_cast<ccs::types::AnyValue*>(NULL);
   ccs::HelperTools::SafeStringCopy(varInfo.name, name, sizeof(ccs::types::string));
 
   bool status = (ccs::HelperTools::Is<ccs::types::ScalarType>(type) || 
@@ -560,24 +470,25 @@ bool OPCUAClientImpl::AddVariable (const char* name, ccs::types::DirIdentifier d
       varInfo.mult = (ccs::HelperTools::Is<ccs::types::ScalarType>(type) ?
 		      1 :
 		      std::dynamic_pointer_cast<const ccs::types::ArrayType>(type)->GetElementNumber());
-      varInfo.__type = type;
+      varInfo.decoder = ccs::HelperTools::GetUAVariantToAnyType(type);
+      varInfo.encoder = ccs::HelperTools::GetAnyTypeToUAVariant(type);
     }
 
   if (status)
     {
-      status = ((static_cast<ccs::types::CompoundType*>(NULL) != this->m_type) &&
-		(static_cast<LUTable<VariableInfo_t>*>(NULL) != this->m_var_table));
+      status = (static_cast<VariableCache*>(NULL) != this->m_cache);
     }
 
   if (status)
     {
       log_info("OPCUAClientImpl::AddVariable - Name '%s' and type '%s'", name, type->GetName());
-      status = (this->m_type)->AddAttribute(name, varInfo.__type); // Type definition for the variable cache
+      status = (this->m_cache)->AddVariable(name, direction, type);
     }
 
   if (status)
     {
-      status = (this->m_var_table)->AddPair(name, varInfo);
+      varInfo.handle = (this->m_cache)->GetHandle(name);
+      (this->m_var_table).push_back(varInfo); // Indexed by handle
     }
 
   return status;
@@ -589,12 +500,9 @@ bool OPCUAClientImpl::Initialise (void)
 
   // Initialize resources
   this->m_sleep = DEFAULT_OPCUAINTERFACE_THREAD_PERIOD;
-  this->m_var_table = new LUTable<VariableInfo_t> (MAXIMUM_VARIABLE_NUM); // The table will be filled with application-specific variable list
+  this->m_cache = new (std::nothrow) VariableCache (MAXIMUM_VARIABLE_NUM); // The cache will be filled with application-specific variable list
   this->m_initialized = false;
 
-  this->m_type = new (std::nothrow) ccs::types::CompoundType ("uaif::VariableCache_t");
-  this->m_value = static_cast<ccs::types::AnyValue*>(NULL);
-
   this->m_thread = new ccs::base::AnyThread ("OPC UA Interface"); 
   (this->m_thread)->SetPeriod(this->m_sleep); (this->m_thread)->SetAccuracy(this->m_sleep);
   (this->m_thread)->SetPreamble((void (*)(void*)) &OPCUAInterface_Thread_PRBL, (void*) this); 
@@ -794,27 +702,35 @@ bool OPCUAClientImpl::Launch (void) { return ((this->m_thread)->Launch() == STAT
 
 bool OPCUAClient::IsValid (const char* name) const { return __impl->IsValid(name); }
 
-bool OPCUAClientImpl::IsValid (uint_t id) const { return ((this->m_var_table)->IsValid(id) == STATUS_SUCCESS); }
-bool OPCUAClientImpl::IsValid (const char* name) const { return ((this->m_var_table)->IsValid(name) == STATUS_SUCCESS); }
+bool OPCUAClientImpl::IsValid (uint_t id) const { return (this->m_cache)->IsValid(id); }
+bool OPCUAClientImpl::IsValid (const char* name) const { return (this->m_cache)->IsValid(name); }
 
-uint_t OPCUAClientImpl::GetVariableId (const char* name) const { uint_t id = 0; (this->m_var_table)->GetIndex(name, id); return id; }
+uint_t OPCUAClientImpl::GetVariableId (const char* name) const { return (this->m_cache)->GetHandle(name); }
 
 ccs::types::AnyValue* OPCUAClient::GetVariable (const char* name) const { return __impl->GetVariable(__impl->GetVariableId(name)); }
 
-ccs::types::AnyValue* OPCUAClientImpl::GetVariable (uint_t id) const { VariableInfo_t varInfo; varInfo.value = static_cast<ccs::types::AnyValue*>(NULL); if (this->IsValid(id)) (this->m_var_table)->GetValue(varInfo, id); return varInfo.value; }
+ccs::types::AnyValue* OPCUAClientImpl::GetVariable (uint_t id) const { return (this->m_cache)->GetSnapshot(id); }
 ccs::types::AnyValue* OPCUAClientImpl::GetVariable (const char* name) const { return this->GetVariable(this->GetVariableId(name)); }
 
-std::shared_ptr<const ccs::types::AnyType> OPCUAClientImpl::GetVariableType (uint_t id) const { std::shared_ptr<const ccs::types::AnyType> type; if (this->IsValid(id)) type = this->GetVariable(id)->GetType(); return type; }
+bool OPCUAClient::GetVariable (const char* name, void* buffer, ccs::types::uint32 size) const { return __impl->GetVariable(__impl->GetVariableId(name), buffer, size); }
+
+bool OPCUAClientImpl::GetVariable (uint_t id, void* buffer, ccs::types::uint32 size) const { return (this->m_cache)->GetValue(id, buffer, size); }
+
+std::shared_ptr<const ccs::types::AnyType> OPCUAClientImpl::GetVariableType (uint_t id) const { return (this->m_cache)->GetType(id); }
 std::shared_ptr<const ccs::types::AnyType> OPCUAClientImpl::GetVariableType (const char* name) const { return this->GetVariableType(this->GetVariableId(name)); }
 
+bool OPCUAClient::SetVariable (const char* name, const void* buffer, ccs::types::uint32 size) { return __impl->SetVariable(__impl->GetVariableId(name), buffer, size); }
+
+bool OPCUAClientImpl::SetVariable (uint_t id, const void* buffer, ccs::types::uint32 size) { bool status = (this->m_cache)->SetValue(id, buffer, size); if (status) { status = this->UpdateVariable(id); } return status; }
+
 bool OPCUAClient::UpdateVariable (const char* name) { return __impl->UpdateVariable(__impl->GetVariableId(name)); }
 
-bool OPCUAClientImpl::UpdateVariable (uint_t id) { bool status = this->IsValid(id); if (status) { VariableInfo_t varInfo; (this->m_var_table)->GetValue(varInfo, id); varInfo.update = true; (this->m_var_table)->SetValue(varInfo, id); } return status; }
+bool OPCUAClientImpl::UpdateVariable (uint_t id) { return ((this->m_cache)->CommitSnapshot(id) && (this->m_cache)->PushUpdate(id)); }
 bool OPCUAClientImpl::UpdateVariable (const char* name) { return this->UpdateVariable(this->GetVariableId(name)); }
 
 bool OPCUAClient::SetCallback (const char* name, std::function<void(const char*, const ccs::types::AnyValue&)> cb) { return __impl->SetCallback(name, cb); }
 
-bool OPCUAClientImpl::SetCallback (ccs::types::uint32 id, std::function<void(const char*, const ccs::types::AnyValue&)> cb) { VariableInfo_t varInfo; bool status = this->IsValid(id); if (status) { (this->m_var_table)->GetValue(varInfo, id); varInfo.cb = cb; (this->m_var_table)->SetValue(varInfo, id); } return status; }
+bool OPCUAClientImpl::SetCallback (ccs::types::uint32 id, std::function<void(const char*, const ccs::types::AnyValue&)> cb) { return (this->m_cache)->SetCallback(id, cb); }
 bool OPCUAClientImpl::SetCallback (const char* name, std::function<void(const char*, const ccs::types::AnyValue&)> cb) { return this->SetCallback(this->GetVariableId(name), cb); }
 
 bool OPCUAClientImpl::SetService (const char* service) 
@@ -877,9 +793,16 @@ OPCUAClientImpl::~OPCUAClientImpl (void)
 
   // Release resources
   if (this->m_thread != NULL) delete this->m_thread;
-  if (this->m_var_table != NULL) delete this->m_var_table;
 
-  this->Disconnect();
+  this->Disconnect(); // No more data change notifications
+
+  for (std::vector<VariableInfo_t>::iterator it = (this->m_var_table).begin(); it != (this->m_var_table).end(); ++it)
+    {
+      if (static_cast<ccs::types::AnyValue*>(NULL) != it->value) delete it->value;
+      if (static_cast<ccs::types::AnyValue*>(NULL) != it->input) delete it->input;
+    }
+
+  if (this->m_cache != NULL) delete this->m_cache;
 
   if (NULL != __session)
     {
@@ -57,8 +57,11 @@ class OPCUAClientImpl; // Forward class declaration
  * @brief Interface class providing support for CA client with variable cache.
  * @detail The class provides access to a variable cache and asynchronous CA
  * update to ensure non-blocking calls on the application side. The variable
- * cache is implemented by means of ccs::types::AnyValue instances which allow
- * assignment to/from C-like structures.
+ * cache is implemented by means of ccs::base::VariableCache which holds each
+ * variable in a sequence-locked slot, i.e. the GetVariable and SetVariable
+ * methods copy consistent values to/from C-like structures without blocking
+ * the interface thread or the data change notifications. Updated variables
+ * are queued for the interface thread rather than scanned at each cycle.
  *
  * The class also offers a callback mechanism for input or bi-directional
  * variables to allow for application-specific synchronous handling of OPC UA
@@ -99,6 +102,39 @@ class OPCUAClient
     template <typename Type> bool GetVariable (const char* name, Type& value) const;
     template <typename Type> bool SetVariable (const char* name, Type& value);
 
+    /**
+     * @brief Accessor. GetVariable method.
+     * @detail Consistent copy of the variable held in the cache.
+     * @param name Variable identifier.
+     * @param buffer Placeholder of size equal to that of the variable type.
+     * @param size Placeholder size.
+     * @return True if successful.
+     */
+
+    bool GetVariable (const char* name, void* buffer, ccs::types::uint32 size) const;
+
+    /**
+     * @brief Accessor. SetVariable method.
+     * @detail Writes the variable held in the cache and queues the variable for
+     * update by the interface thread.
+     * @param name Variable identifier.
+     * @param buffer Value of size equal to that of the variable type.
+     * @param size Value size.
+     * @return True if successful.
+     */
+
+    bool SetVariable (const char* name, const void* buffer, ccs::types::uint32 size);
+
+    /**
+     * @brief Accessor. GetVariable method.
+     * @detail In-place access to a snapshot of the variable held in the cache. The snapshot
+     * is refreshed at each call and is not written by the interface thread; the UpdateVariable
+     * method has to be called to write it back and trigger the write operation.
+     * @param name Variable identifier.
+     * @return Reference to the ccs::types::AnyValue snapshot if variable exists, 
+     * NULL otherwise. 
+     */
+
     ccs::types::AnyValue* GetVariable (const char* name) const;
 
     bool UpdateVariable (const char* name);
@@ -140,37 +176,12 @@ class OPCUAClient
 
 template <typename Type> bool OPCUAClient::GetVariable (const char* name, Type& value) const 
 { 
-
-  const ccs::types::AnyValue* var = static_cast<ccs::types::AnyValue*>(NULL); 
-
-  bool status = this->IsValid(name); 
-
-  if (status) 
-    { 
-      var = this->GetVariable(name); 
-      value = static_cast<Type>(*var); 
-    } 
-  
-  return status; 
-  
+  return this->GetVariable(name, static_cast<void*>(&value), sizeof(Type)); 
 }
 
 template <typename Type> bool OPCUAClient::SetVariable (const char* name, Type& value) 
 { 
-
-  ccs::types::AnyValue* var = static_cast<ccs::types::AnyValue*>(NULL); 
-
-  bool status = this->IsValid(name); 
-
-  if (status) 
-    { 
-      var = this->GetVariable(name); 
-      *var = value; 
-      this->UpdateVariable(name); 
-    } 
-
-  return status; 
-
+  return this->SetVariable(name, static_cast<const void*>(&value), sizeof(Type)); 
 }
 
 } // namespace base
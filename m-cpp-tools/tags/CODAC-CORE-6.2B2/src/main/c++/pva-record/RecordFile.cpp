@@ -0,0 +1,504 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-tools/tags/CODAC-CORE-6.2B2/src/main/c++/pva-record/RecordFile.cpp $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Infrastructure tools - Prototype
+*
+* Author        : Bertrand Bauvir
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*		  CS 90 046
+*		  13067 St. Paul-lez-Durance Cedex
+*		  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <new> // std::nothrow
+#include <string> // std::string
+
+#include <stdio.h> // fopen, fwrite, etc.
+#include <string.h> // memcpy, strlen, etc.
+
+#include <BasicTypes.h> // Global type definition
+#include <SysTools.h> // Misc. helper functions
+
+//#define LOG_TRACE_ENABLE
+//#undef LOG_TRACE_ENABLE
+//#define LOG_DEBUG_ENABLE
+//#undef LOG_DEBUG_ENABLE
+#include <log-api.h> // Syslog wrapper routines
+
+#include <AtomicLock.h> // Lock used to protect the FIFO ..
+#include <BlockMemoryFIFO.h> // .. of pre-allocated records
+
+#include <AnyThread.h> // Thread management class
+
+#include <AnyType.h> // Introspectable data type ..
+#include <AnyValue.h> // Variable with introspectable data type ..
+
+// Local header files
+
+#include "RecordFile.h" // This class definition
+
+// Constants
+
+#define MAXIMUM_SERIALISATION_BUFFER 67108864u // 64MB
+
+#undef LOG_ALTERN_SRC
+#define LOG_ALTERN_SRC "pva-record"
+
+// Type definition
+
+// Global variables
+
+// Function declaration
+
+// Function definition
+
+void RecordWriter_Thread_CB (ccs::base::RecordWriter* self)
+{
+
+  (void)self->Flush();
+
+  return;
+
+}
+
+namespace ccs {
+
+namespace base {
+
+bool SerialiseWithoutTruncation (const ccs::types::AnyValue& value, std::vector<ccs::types::char8>& buffer, bool type)
+{
+
+  bool status = false;
+
+  if (buffer.size() < STRING_MAX_LENGTH)
+    {
+      buffer.resize(STRING_MAX_LENGTH);
+    }
+
+  while (!status && (buffer.size() <= MAXIMUM_SERIALISATION_BUFFER))
+    {
+      ccs::types::uint32 size = static_cast<ccs::types::uint32>(buffer.size());
+
+      status = (type ? value.SerialiseType(&buffer[0], size) : value.SerialiseInstance(&buffer[0], size));
+
+      if (status)
+	{ // Output filling the buffer is assumed truncated
+	  status = ((strlen(&buffer[0]) + 1u) < size);
+	}
+
+      if (!status)
+	{
+	  buffer.resize(2u * buffer.size());
+	}
+    }
+
+  return status;
+
+}
+
+bool RecordWriter::Initialise (const ccs::types::AnyValue& value)
+{
+
+  __type = value.GetType();
+  __size = value.GetSize();
+
+  std::vector<ccs::types::char8> buffer;
+
+  bool status = SerialiseWithoutTruncation(value, buffer, true);
+
+  RecordFileHeader_t header;
+
+  if (status)
+    {
+      memset(&header, 0, sizeof(RecordFileHeader_t));
+      ccs::HelperTools::SafeStringCopy(header.magic, RECORDFILE_MAGIC, sizeof(header.magic));
+      header.version = RECORDFILE_VERSION;
+      header.length = static_cast<ccs::types::uint32>(strlen(&buffer[0]) + 1u);
+
+      status = ((1u == fwrite(&header, sizeof(RecordFileHeader_t), 1u, __data)) &&
+		(1u == fwrite(&buffer[0], header.length, 1u, __data)));
+    }
+
+  if (status)
+    {
+      __offset = sizeof(RecordFileHeader_t) + header.length;
+
+      // Record is timestamp followed by instance
+      __fifo = new (std::nothrow) BlockMemoryFIFO (sizeof(ccs::types::uint64) + __size, __depth);
+      status = (static_cast<BlockMemoryFIFO*>(NULL) != __fifo);
+    }
+
+  if (status)
+    {
+      __worker = new (std::nothrow) SynchronisedThreadWithCallback ("pva-record");
+      status = (static_cast<SynchronisedThreadWithCallback*>(NULL) != __worker);
+    }
+
+  if (status)
+    {
+      __worker->SetPeriod(DEFAULT_RECORDWRITER_PERIOD); __worker->SetAccuracy(DEFAULT_RECORDWRITER_PERIOD);
+      __worker->SetCallback((void (*)(void*)) &RecordWriter_Thread_CB, (void*) this);
+      status = __worker->Launch();
+    }
+
+  if (!status)
+    {
+      log_error("RecordWriter::Initialise - Failed");
+    }
+
+  return status;
+
+}
+
+bool RecordWriter::IsValid (void) const
+{
+  return ((NULL != __data) && (NULL != __index));
+}
+
+bool RecordWriter::PushRecord (ccs::types::uint64 time, const ccs::types::AnyValue& value)
+{
+
+  bool status = this->IsValid();
+
+  if (status && !__type)
+    {
+      status = this->Initialise(value);
+    }
+
+  if (status)
+    {
+      status = ((static_cast<BlockMemoryFIFO*>(NULL) != __fifo) && (value.GetSize() == __size));
+    }
+
+  ccs::types::uint8* ref = static_cast<ccs::types::uint8*>(NULL);
+
+  if (status)
+    {
+      __lock->AcquireLock();
+      ref = static_cast<ccs::types::uint8*>(__fifo->GetInDataBlockReference());
+      __lock->ReleaseLock();
+      status = (static_cast<ccs::types::uint8*>(NULL) != ref);
+    }
+
+  if (status)
+    { // The block at the FIFO input is not accessed by the writer thread
+      memcpy(ref, &time, sizeof(ccs::types::uint64));
+      memcpy(ref + sizeof(ccs::types::uint64), value.GetInstance(), __size);
+
+      __lock->AcquireLock();
+      __fifo->ReleaseInDataBlockReference();
+      __lock->ReleaseLock();
+    }
+  else
+    {
+      (void)__sync_add_and_fetch(&__dropped, 1ul);
+    }
+
+  return status;
+
+}
+
+ccs::types::uint32 RecordWriter::Flush (void)
+{
+
+  ccs::types::uint32 count = 0u;
+
+  bool status = ((static_cast<BlockMemoryFIFO*>(NULL) != __fifo) && this->IsValid());
+
+  while (status)
+    {
+      ccs::types::uint8* ref = static_cast<ccs::types::uint8*>(NULL);
+
+      __lock->AcquireLock();
+      ref = static_cast<ccs::types::uint8*>(__fifo->GetOutDataBlockReference());
+      __lock->ReleaseLock();
+
+      status = (static_cast<ccs::types::uint8*>(NULL) != ref);
+
+      if (status)
+	{ // The block at the FIFO output is not accessed by the producer
+	  RecordIndexEntry_t entry;
+
+	  memcpy(&entry.time, ref, sizeof(ccs::types::uint64));
+	  entry.offset = __offset;
+
+	  status = ((1u == fwrite(ref, sizeof(ccs::types::uint64), 1u, __data)) &&
+		    (1u == fwrite(&__size, sizeof(ccs::types::uint32), 1u, __data)) &&
+		    (1u == fwrite(ref + sizeof(ccs::types::uint64), __size, 1u, __data)) &&
+		    (1u == fwrite(&entry, sizeof(RecordIndexEntry_t), 1u, __index)));
+
+	  __lock->AcquireLock();
+	  __fifo->ReleaseOutDataBlockReference();
+	  __lock->ReleaseLock();
+
+	  if (!status)
+	    {
+	      log_error("RecordWriter::Flush - Write failed");
+	    }
+	}
+
+      if (status)
+	{
+	  __offset += sizeof(ccs::types::uint64) + sizeof(ccs::types::uint32) + __size;
+	  __written += 1ul;
+	  count += 1u;
+	}
+    }
+
+  return count;
+
+}
+
+ccs::types::uint64 RecordWriter::GetWritten (void) const { return __written; }
+ccs::types::uint64 RecordWriter::GetDropped (void) const { return __dropped; }
+
+RecordWriter::RecordWriter (const ccs::types::char8 * const file, ccs::types::uint32 depth)
+{
+
+  // Initialise attributes
+  __size = 0u;
+  __depth = depth;
+  __fifo = static_cast<BlockMemoryFIFO*>(NULL);
+  __lock = new (std::nothrow) AtomicLock ();
+  __worker = static_cast<SynchronisedThreadWithCallback*>(NULL);
+  __offset = 0ul;
+  __written = 0ul;
+  __dropped = 0ul;
+
+  std::string index = std::string(file) + std::string(".index");
+
+  __data = fopen(file, "wb");
+  __index = fopen(index.c_str(), "wb");
+
+  // Large buffers to limit the number of system calls
+  if (NULL != __data) (void)setvbuf(__data, NULL, _IOFBF, DEFAULT_RECORDWRITER_BUFFER);
+  if (NULL != __index) (void)setvbuf(__index, NULL, _IOFBF, DEFAULT_RECORDWRITER_BUFFER / 8u);
+
+  if (!this->IsValid())
+    {
+      log_error("RecordWriter::RecordWriter - Unable to open '%s'", file);
+    }
+
+  return;
+
+}
+
+RecordWriter::~RecordWriter (void)
+{
+
+  // Stop writer thread ..
+  if (static_cast<SynchronisedThreadWithCallback*>(NULL) != __worker)
+    {
+      delete __worker;
+    }
+
+  // .. and write pending records
+  (void)this->Flush();
+
+  log_info("RecordWriter::~RecordWriter - Written '%lu' records, dropped '%lu'", __written, __dropped);
+
+  if (NULL != __data) (void)fclose(__data);
+  if (NULL != __index) (void)fclose(__index);
+
+  if (static_cast<BlockMemoryFIFO*>(NULL) != __fifo)
+    {
+      delete __fifo;
+    }
+
+  if (static_cast<AtomicLock*>(NULL) != __lock)
+    {
+      delete __lock;
+    }
+
+  return;
+
+}
+
+bool RecordReader::IsValid (void) const
+{
+  return ((NULL != __data) && (static_cast<ccs::types::AnyValue*>(NULL) != __value) && __value->GetType());
+}
+
+ccs::types::uint64 RecordReader::GetCount (void) const
+{
+
+  ccs::types::uint64 count = 0ul;
+
+  if (NULL != __index)
+    {
+      long position = ftell(__index);
+
+      if (0 == fseek(__index, 0l, SEEK_END))
+	{
+	  count = static_cast<ccs::types::uint64>(ftell(__index)) / sizeof(RecordIndexEntry_t);
+	}
+
+      (void)fseek(__index, position, SEEK_SET);
+    }
+
+  return count;
+
+}
+
+std::shared_ptr<const ccs::types::AnyType> RecordReader::GetType (void) const
+{
+
+  std::shared_ptr<const ccs::types::AnyType> type;
+
+  if (this->IsValid())
+    {
+      type = __value->GetType();
+    }
+
+  return type;
+
+}
+
+bool RecordReader::Seek (ccs::types::uint64 record)
+{
+
+  bool status = (this->IsValid() && (NULL != __index) && (record < this->GetCount()));
+
+  RecordIndexEntry_t entry;
+
+  if (status)
+    {
+      status = ((0 == fseek(__index, static_cast<long>(record * sizeof(RecordIndexEntry_t)), SEEK_SET)) &&
+		(1u == fread(&entry, sizeof(RecordIndexEntry_t), 1u, __index)));
+    }
+
+  if (status)
+    {
+      status = (0 == fseek(__data, static_cast<long>(entry.offset), SEEK_SET));
+    }
+
+  return status;
+
+}
+
+const ccs::types::AnyValue* RecordReader::ReadRecord (ccs::types::uint64& time)
+{
+
+  bool status = this->IsValid();
+
+  ccs::types::uint32 size = 0u;
+
+  if (status)
+    {
+      status = ((1u == fread(&time, sizeof(ccs::types::uint64), 1u, __data)) &&
+		(1u == fread(&size, sizeof(ccs::types::uint32), 1u, __data)));
+    }
+
+  if (status)
+    {
+      status = (size == __value->GetSize());
+
+      if (!status)
+	{
+	  log_error("RecordReader::ReadRecord - Size mismatch '%u'", size);
+	}
+    }
+
+  if (status)
+    {
+      status = (1u == fread(__value->GetInstance(), size, 1u, __data));
+    }
+
+  return (status ? __value : static_cast<ccs::types::AnyValue*>(NULL));
+
+}
+
+const ccs::types::char8* RecordReader::Export (void)
+{
+
+  bool status = this->IsValid();
+
+  if (status)
+    {
+      status = SerialiseWithoutTruncation(*__value, __buffer, false);
+    }
+
+  return (status ? &__buffer[0] : static_cast<ccs::types::char8*>(NULL));
+
+}
+
+RecordReader::RecordReader (const ccs::types::char8 * const file)
+{
+
+  // Initialise attributes
+  __value = static_cast<ccs::types::AnyValue*>(NULL);
+
+  std::string index = std::string(file) + std::string(".index");
+
+  __data = fopen(file, "rb");
+  __index = fopen(index.c_str(), "rb"); // Optional
+
+  RecordFileHeader_t header;
+
+  bool status = (NULL != __data);
+
+  if (status)
+    {
+      status = (1u == fread(&header, sizeof(RecordFileHeader_t), 1u, __data));
+    }
+
+  if (status)
+    {
+      status = ((0 == strncmp(header.magic, RECORDFILE_MAGIC, sizeof(header.magic))) &&
+		(RECORDFILE_VERSION == header.version)); // Also detects byte order mismatch
+    }
+
+  std::vector<ccs::types::char8> type;
+
+  if (status)
+    {
+      type.resize(header.length + 1u, '\0');
+      status = (1u == fread(&type[0], header.length, 1u, __data));
+    }
+
+  if (status)
+    {
+      __value = new (std::nothrow) ccs::types::AnyValue (static_cast<const ccs::types::char8*>(&type[0]));
+      status = this->IsValid();
+    }
+
+  if (!status)
+    {
+      log_error("RecordReader::RecordReader - Invalid record file '%s'", file);
+    }
+
+  return;
+
+}
+
+RecordReader::~RecordReader (void)
+{
+
+  if (NULL != __data) (void)fclose(__data);
+  if (NULL != __index) (void)fclose(__index);
+
+  if (static_cast<ccs::types::AnyValue*>(NULL) != __value)
+    {
+      delete __value;
+    }
+
+  return;
+
+}
+
+} // namespace base
+
+} // namespace ccs
+
+#undef LOG_ALTERN_SRC
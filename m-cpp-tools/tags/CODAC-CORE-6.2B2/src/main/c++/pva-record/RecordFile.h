@@ -0,0 +1,288 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-tools/tags/CODAC-CORE-6.2B2/src/main/c++/pva-record/RecordFile.h $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Infrastructure tools - Prototype
+*
+* Author        : Bertrand Bauvir
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*		  CS 90 046
+*		  13067 St. Paul-lez-Durance Cedex
+*		  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+/**
+ * @file RecordFile.h
+ * @brief Header file for RecordWriter and RecordReader classes.
+ * @date 01/07/2019
+ * @author Bertrand Bauvir (IO)
+ * @copyright 2010-2019 ITER Organization
+ * @detail This header file contains the definition of the binary record file
+ * format and of the RecordWriter and RecordReader classes.
+ *
+ * The record file starts with a header holding the magic number, the format
+ * version and the JSON serialised type of the recorded channel. The header is
+ * followed by records, each made of the uint64 timestamp [ns], the uint32 size
+ * and the raw instance, in native byte order.
+ *
+ * The index file, i.e. '<file>.index', holds one entry per record with the
+ * record timestamp and offset in the record file, for random access.
+ */
+
+#ifndef _RecordFile_h_
+#define _RecordFile_h_
+
+// Global header files
+
+#include <stdio.h> // FILE, etc.
+
+#include <memory> // std::shared_ptr
+#include <vector> // std::vector
+
+#include <BasicTypes.h> // Global type definition
+
+#include <AnyType.h> // Introspectable data type ..
+#include <AnyValue.h> // Variable with introspectable data type ..
+
+// Local header files
+
+// Constants
+
+#define RECORDFILE_MAGIC "CCSPVAR" // Including nil-termination
+#define RECORDFILE_VERSION 1u
+
+#define DEFAULT_RECORDWRITER_DEPTH 4096u // Records
+#define DEFAULT_RECORDWRITER_PERIOD 1000000ul // 1kHz
+#define DEFAULT_RECORDWRITER_BUFFER 1048576u // Bytes
+
+// Type definition
+
+namespace ccs {
+
+namespace base {
+
+class SynchronisedThreadWithCallback; // Forward class declaration
+class AtomicLock;
+class BlockMemoryFIFO;
+
+typedef struct RecordFileHeader {
+
+  ccs::types::char8 magic [8];
+  ccs::types::uint32 version; // Also identifies byte order
+  ccs::types::uint32 length; // Serialised type, including nil-termination
+
+} RecordFileHeader_t;
+
+typedef struct RecordIndexEntry {
+
+  ccs::types::uint64 time;
+  ccs::types::uint64 offset; // Of the record in the record file
+
+} RecordIndexEntry_t;
+
+/**
+ * @brief Binary record file writer.
+ * @detail Records are copied in a pre-allocated FIFO by the producer, i.e. the
+ * monitor callback, and written to file by a separate thread through a large
+ * stdio buffer. The producer never waits on file I/O; records are dropped and
+ * counted if the FIFO is full.
+ *
+ * The type is known only upon first record and the header is written lazily.
+ */
+
+class RecordWriter
+{
+
+  private:
+
+    FILE* __data;
+    FILE* __index;
+
+    std::shared_ptr<const ccs::types::AnyType> __type;
+    ccs::types::uint32 __size; // Instance size
+
+    ccs::types::uint32 __depth;
+
+    BlockMemoryFIFO* __fifo;
+    AtomicLock* __lock;
+    SynchronisedThreadWithCallback* __worker;
+
+    ccs::types::uint64 __offset;
+
+    volatile ccs::types::uint64 __written;
+    volatile ccs::types::uint64 __dropped;
+
+    bool Initialise (const ccs::types::AnyValue& value);
+
+    RecordWriter (const RecordWriter& writer); // Undefined
+    RecordWriter& operator= (const RecordWriter& writer); // Undefined
+
+  protected:
+
+  public:
+
+    /**
+     * @brief Constructor.
+     * @param file Record file path, the index file is '<file>.index'.
+     * @param depth FIFO depth.
+     */
+
+    RecordWriter (const ccs::types::char8 * const file, ccs::types::uint32 depth = DEFAULT_RECORDWRITER_DEPTH);
+
+    /**
+     * @brief Destructor.
+     * @detail Stops the writer thread, writes pending records and closes files.
+     */
+
+    virtual ~RecordWriter (void);
+
+    /**
+     * @brief Accessor.
+     * @return True if files are open.
+     */
+
+    bool IsValid (void) const;
+
+    /**
+     * @brief PushRecord method.
+     * @detail Copies the record in the FIFO. Non-blocking.
+     * @param time Record timestamp [ns].
+     * @param value Record, of the same type for the lifetime of the writer.
+     * @return True if successful, false if dropped.
+     */
+
+    bool PushRecord (ccs::types::uint64 time, const ccs::types::AnyValue& value);
+
+    /**
+     * @brief Flush method.
+     * @detail Writes FIFO content to file. Called by the writer thread.
+     * @return Number of records written.
+     */
+
+    ccs::types::uint32 Flush (void);
+
+    /**
+     * @brief Accessor.
+     * @return Number of records written, resp. dropped.
+     */
+
+    ccs::types::uint64 GetWritten (void) const;
+    ccs::types::uint64 GetDropped (void) const;
+
+};
+
+/**
+ * @brief Binary record file reader.
+ * @detail Records are read in sequence or at random through the index file.
+ */
+
+class RecordReader
+{
+
+  private:
+
+    FILE* __data;
+    FILE* __index;
+
+    ccs::types::AnyValue* __value;
+
+    std::vector<ccs::types::char8> __buffer; // Serialisation buffer
+
+    RecordReader (const RecordReader& reader); // Undefined
+    RecordReader& operator= (const RecordReader& reader); // Undefined
+
+  protected:
+
+  public:
+
+    /**
+     * @brief Constructor.
+     * @detail Opens files and parses the header.
+     * @param file Record file path.
+     */
+
+    RecordReader (const ccs::types::char8 * const file);
+
+    /**
+     * @brief Destructor.
+     */
+
+    virtual ~RecordReader (void);
+
+    /**
+     * @brief Accessor.
+     * @return True if the header is valid.
+     */
+
+    bool IsValid (void) const;
+
+    /**
+     * @brief Accessor.
+     * @return Number of records in the index file, 0 if missing.
+     */
+
+    ccs::types::uint64 GetCount (void) const;
+
+    /**
+     * @brief Accessor.
+     * @return Recorded type.
+     */
+
+    std::shared_ptr<const ccs::types::AnyType> GetType (void) const;
+
+    /**
+     * @brief Seek method.
+     * @detail Positions the reader on the record through the index file.
+     * @return True if successful.
+     */
+
+    bool Seek (ccs::types::uint64 record);
+
+    /**
+     * @brief ReadRecord method.
+     * @detail Reads the next record.
+     * @param time Placeholder for the record timestamp.
+     * @return Record, NULL at end of file.
+     */
+
+    const ccs::types::AnyValue* ReadRecord (ccs::types::uint64& time);
+
+    /**
+     * @brief Export method.
+     * @detail Serialises the last record read to JSON, without truncation.
+     * @return JSON serialised instance, NULL if failed.
+     */
+
+    const ccs::types::char8* Export (void);
+
+};
+
+// Global variables
+
+// Function declaration
+
+/**
+ * @brief Serialisation helper.
+ * @detail Serialises the instance, resp. type, to JSON in a buffer grown as necessary
+ * to avoid truncation.
+ * @return True if successful.
+ */
+
+bool SerialiseWithoutTruncation (const ccs::types::AnyValue& value, std::vector<ccs::types::char8>& buffer, bool type = false);
+
+// Function definition
+
+} // namespace base
+
+} // namespace ccs
+
+#endif // _RecordFile_h_
+
@@ -21,9 +21,11 @@
 
 /* Global header files */
 
-#include <fstream> // File access
+#include <mutex> // std::mutex, etc.
+#include <vector> // std::vector
 
 #include <signal.h> /* sigset, etc. */
+#include <stdio.h> /* fopen, etc. */
 
 #include <BasicTypes.h> /* Misc. type definition */
 #include <SysTools.h> /* Misc. helper functions */
@@ -35,6 +37,8 @@
 
 #include "PVAccessMonitor.h"
 
+#include "RecordFile.h"
+
 /* Constants */
 
 #define DEFAULT_AFFINITY       0u
@@ -49,15 +53,21 @@ class PVAccessMonitorImpl : public ccs::base::PVAccessMonitor
   private:
 
     ccs::types::uint32 __count;
-    std::ofstream __file;
+
+    FILE* __file; // JSON mode ..
+    std::vector<ccs::types::char8> __buffer;
+
+    ccs::base::RecordWriter* __writer; // .. or binary mode
+
+    mutable std::mutex __mutex; // Monitor callbacks vs. destructor
 
   public:
 
-    PVAccessMonitorImpl (const char* name);
+    PVAccessMonitorImpl (const char* name, bool binary = false, ccs::types::uint32 depth = DEFAULT_RECORDWRITER_DEPTH);
     virtual ~PVAccessMonitorImpl (void);
 
-    bool IsComplete (void) { return (0u == __count); };
-    bool SetCount (ccs::types::uint32 count) { __count = count; return true; };
+    bool IsComplete (void) const { std::lock_guard<std::mutex> lock (__mutex); return (0u == __count); };
+    bool SetCount (ccs::types::uint32 count) { std::lock_guard<std::mutex> lock (__mutex); __count = count; return true; };
 
     virtual void HandleMonitor (const ccs::types::AnyValue& value);
 
@@ -72,18 +82,23 @@ bool _terminate = false;
 void PVAccessMonitorImpl::HandleMonitor (const ccs::types::AnyValue& value)
 {
 
-  bool status = (0u != __count);
+  std::lock_guard<std::mutex> lock (__mutex);
 
-  char buffer [4096u] = STRING_UNDEFINED;
+  bool status = (0u != __count);
 
-  if (status)
-    {
-      status = value.SerialiseInstance(buffer, 4096u);
+  if (status && (static_cast<ccs::base::RecordWriter*>(NULL) != __writer))
+    { // Record dropped if the writer FIFO is full
+      (void)__writer->PushRecord(ccs::HelperTools::GetCurrentTime(), value);
     }
-
-  if (status)
+  else if (status && (NULL != __file))
     {
-      __file << buffer << std::endl;
+      status = ccs::base::SerialiseWithoutTruncation(value, __buffer);
+
+      if (status)
+	{ // Buffered, no flush per record
+	  status = (EOF != fputs(&__buffer[0], __file));
+	  (void)fputc('\n', __file);
+	}
     }
 
   if (status)
@@ -95,15 +110,29 @@ void PVAccessMonitorImpl::HandleMonitor (const ccs::types::AnyValue& value)
 
 }
 
-PVAccessMonitorImpl::PVAccessMonitorImpl (const char* name) : ccs::base::PVAccessMonitor(name)
+PVAccessMonitorImpl::PVAccessMonitorImpl (const char* name, bool binary, ccs::types::uint32 depth) : ccs::base::PVAccessMonitor(name, binary) // Queued in binary mode
 {
 
+  __count = 0u;
+  __file = NULL;
+  __writer = static_cast<ccs::base::RecordWriter*>(NULL);
+
   ccs::types::uint64 time = ccs::HelperTools::Floor(ccs::HelperTools::GetCurrentTime()); // Current time with second resolution
   ccs::types::string iso8601; ccs::HelperTools::ToISO8601(time, iso8601);
 
-  std::string file = std::string("/tmp/") + std::string(this->GetChannel()) + std::string("_") + std::string(iso8601) + std::string(".record");
+  std::string file = std::string("/tmp/") + std::string(name) + std::string("_") + std::string(iso8601) + std::string(".record");
 
-  __file.open(file, { std::ios::out | std::ios::trunc });
+  if (binary)
+    {
+      file += std::string(".bin");
+      __writer = new (std::nothrow) ccs::base::RecordWriter (file.c_str(), depth);
+    }
+  else
+    {
+      __file = fopen(file.c_str(), "w");
+    }
+
+  log_info("Recording to '%s'", file.c_str());
 
   return;
 
@@ -112,12 +141,60 @@ PVAccessMonitorImpl::PVAccessMonitorImpl (const char* name) : ccs::base::PVAcces
 PVAccessMonitorImpl::~PVAccessMonitorImpl (void)
 {
 
-  __file.close();
+  FILE* file = NULL;
+  ccs::base::RecordWriter* writer = static_cast<ccs::base::RecordWriter*>(NULL);
+
+  { // The base class channel monitor is cancelled only after this destructor .. detach resources from monitor callbacks
+    std::lock_guard<std::mutex> lock (__mutex);
+
+    __count = 0u;
+
+    file = __file;
+    __file = NULL;
+
+    writer = __writer;
+    __writer = static_cast<ccs::base::RecordWriter*>(NULL);
+  }
+
+  if (NULL != file)
+    {
+      (void)fclose(file);
+    }
+
+  if (static_cast<ccs::base::RecordWriter*>(NULL) != writer)
+    {
+      delete writer;
+    }
 
   return;
 
 }
 
+bool export_records (const char* file)
+{
+
+  ccs::base::RecordReader reader (file);
+
+  bool status = reader.IsValid();
+
+  ccs::types::uint64 time = 0ul;
+
+  while (status && (static_cast<const ccs::types::AnyValue*>(NULL) != reader.ReadRecord(time)))
+    {
+      const ccs::types::char8* buffer = reader.Export();
+
+      status = (static_cast<const ccs::types::char8*>(NULL) != buffer);
+
+      if (status)
+	{
+	  fprintf(stdout, "%s\n", buffer);
+	}
+    }
+
+  return status;
+
+}
+
 void print_usage (void)
 {
 
@@ -128,7 +205,10 @@ void print_usage (void)
   fprintf(stdout, "Usage: %s <options>\n", prog_name);
   fprintf(stdout, "Options: -h|--help: Print usage.\n");
   fprintf(stdout, "         -a|--affinity <core_id>: Run thread on <core_id> CPU core, defaults to 0.\n");
+  fprintf(stdout, "         -b|--binary: Binary recording mode, with index file for random access.\n");
   fprintf(stdout, "         -c|--count <cycle_nb>: Stop after <cycle_nb> cycles, defaults to 10000.\n");
+  fprintf(stdout, "         -d|--depth <record_nb>: Binary recording buffer depth, defaults to 4096.\n");
+  fprintf(stdout, "         -e|--export <file>: Export binary record file to JSON on stdout, and exit.\n");
   fprintf(stdout, "         -n|--name <channel>: Channel name, defaults to 'TEST-TPL-CFG:STRUCT'.\n");
   fprintf(stdout, "         -v|--verbose: Verbose mode, statistics and measurmeent data are printed on stdout.\n");
   fprintf(stdout, "\n");
@@ -160,6 +240,9 @@ int main(int argc, char **argv)
 
   uint32 core = DEFAULT_AFFINITY;
   uint32 count = DEFAULT_RECORD_COUNT;
+  uint32 depth = DEFAULT_RECORDWRITER_DEPTH;
+
+  bool binary = false;
 
   char name [STRING_MAX_LENGTH] = DEFAULT_CHANNEL_NAME;
 
@@ -187,6 +270,12 @@ int main(int argc, char **argv)
 	      else { /* Display usage */ print_usage(); return (0); }
 	      index += 1;
             
+	    }
+	  else if ((strcmp(argv[index], "-b") == 0) || (strcmp(argv[index], "--binary") == 0))
+	    {
+	      // Set binary mode
+	      binary = true;
+            
 	    }
 	  else if ((strcmp(argv[index], "-c") == 0) || (strcmp(argv[index], "--count") == 0))
 	    {
@@ -195,6 +284,21 @@ int main(int argc, char **argv)
 	      else { /* Display usage */ print_usage(); return (0); }
 	      index += 1;
             
+	    }
+	  else if ((strcmp(argv[index], "-d") == 0) || (strcmp(argv[index], "--depth") == 0))
+	    {
+	      // Get buffer depth
+	      if ((index + 1) < (uint_t) argc) sscanf(argv[index + 1], "%u", &depth);
+	      else { /* Display usage */ print_usage(); return (0); }
+	      index += 1;
+            
+	    }
+	  else if ((strcmp(argv[index], "-e") == 0) || (strcmp(argv[index], "--export") == 0))
+	    {
+	      // Export record file
+	      if ((index + 1) < (uint_t) argc) return (export_records(argv[index + 1]) ? 0 : 1);
+	      else { /* Display usage */ print_usage(); return (0); }
+            
 	    }
 	  else if ((strcmp(argv[index], "-n") == 0) || (strcmp(argv[index], "--name") == 0))
 	    {
@@ -219,7 +323,7 @@ int main(int argc, char **argv)
     }
 
   // PVAccess client and cache
-  PVAccessMonitorImpl monitor (name);
+  PVAccessMonitorImpl monitor (name, binary, depth);
   monitor.SetCount(count);
 
   while ((_terminate == false) && (monitor.IsComplete() == false)) { uint64 curr_time = ccs::HelperTools::SleepFor(100000000ul); }
@@ -34,6 +34,7 @@
 // Global header files
 
 #include <memory> // std::shared_ptr, etc.
+#include <string.h> // memcpy
 
 #include <pv/pvData.h>
 
@@ -50,6 +51,8 @@
 #include "AnyTypeToPVA.h"
 #include "PVAToAnyType.h"
 
+#include "PVAConversionPlan.h"
+
 // Constants
 
 // Type definition
@@ -69,6 +72,21 @@ template <typename Type> inline bool AnyValueToPVArray (const ccs::types::AnyVal
 static inline bool AnyValueToPVStruct (const ccs::types::AnyValue* inp_value,
 				       std::shared_ptr<epics::pvData::PVStructure> out_value);
 
+/**
+ * @brief AnyValue to PVAccess conversion method.
+ * @detail Partial conversion limited to the attributes which differ from the reference
+ * instance, e.g. last posted copy of the variable. Unchanged fields are not written and
+ * therefore not posted to the PVA record monitors.
+ * @param inp_value ccs::types::AnyValue instance
+ * @param out_value epics::pvData::PVStructure instance
+ * @param reference Reference instance with the same memory layout as inp_value.
+ * @return True if conversion successful.
+ */
+
+static inline bool AnyValueToPVStruct (const ccs::types::AnyValue* inp_value,
+				       std::shared_ptr<epics::pvData::PVStructure> out_value,
+				       const void* reference);
+
 // Function definition
 
 #define ANYSCALARTOPVSCALAR(INP_BASIC_TYPE,INP_INTRO_TYPE,OUT_TYPE) \
@@ -194,9 +212,18 @@ template <> inline bool AnyValueToPVArray<std::shared_ptr<OUT_TYPE>> (const ccs:
 \
       OUT_TYPE::svector out_array (inp_type->GetElementNumber()); \
 \
-      for (ccs::types::uint32 index = 0u; (status && (index < inp_type->GetElementNumber())); index += 1u) \
+      if (sizeof(OUT_TYPE::value_type) == sizeof(INP_BASIC_TYPE)) /* Bulk transfer */ \
 	{ \
-	  out_array[index] = ccs::HelperTools::GetElementValue<INP_BASIC_TYPE>(inp_value, index); \
+	  memcpy(out_array.data(), inp_value->GetInstance(), inp_type->GetElementNumber() * sizeof(INP_BASIC_TYPE)); \
+	} \
+      else \
+	{ \
+	  const INP_BASIC_TYPE* inp_array = static_cast<const INP_BASIC_TYPE*>(inp_value->GetInstance()); \
+\
+	  for (ccs::types::uint32 index = 0u; index < inp_type->GetElementNumber(); index += 1u) \
+	    { \
+	      out_array[index] = inp_array[index]; \
+	    } \
 	} \
 \
       out_value->replace(freeze(out_array)); \
@@ -323,149 +350,218 @@ template <> inline bool AnyValueToPVArray<std::shared_ptr<epics::pvData::PVStruc
 
 }
 
-static inline bool AnyValueToPVStruct (const ccs::types::AnyValue* inp_value,
-				       std::shared_ptr<epics::pvData::PVStructure> out_value)
+static inline bool AnyValueToPVAttribute (const ccs::types::AnyValue* nst_value,
+					  std::shared_ptr<epics::pvData::PVStructure> out_value,
+					  const char* attr_name)
 {
 
-  std::shared_ptr<const ccs::types::AnyType> type = inp_value->GetType();
-  std::shared_ptr<const ccs::types::CompoundType> inp_type;
+  std::shared_ptr<const ccs::types::AnyType> attr_type = nst_value->GetType();
 
-  bool status = ccs::HelperTools::Is<ccs::types::CompoundType>(type);
+  bool status = true;
 
-  if (status)
+  if (ccs::HelperTools::Is<ccs::types::ScalarType>(attr_type))
     {
-      inp_type = std::dynamic_pointer_cast<const ccs::types::CompoundType>(type);
-      status = (inp_type ? true : false);
+      log_debug("AnyValueToPVStruct - .. is scalar");
+      if (ccs::types::Boolean == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVBoolean>>(nst_value, out_value->getSubField<epics::pvData::PVBoolean>(std::string(attr_name)));
+      if (ccs::types::SignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVByte>>(nst_value, out_value->getSubField<epics::pvData::PVByte>(std::string(attr_name)));
+      if (ccs::types::UnsignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVUByte>>(nst_value, out_value->getSubField<epics::pvData::PVUByte>(std::string(attr_name)));
+      if (ccs::types::SignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVShort>>(nst_value, out_value->getSubField<epics::pvData::PVShort>(std::string(attr_name)));
+      if (ccs::types::UnsignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVUShort>>(nst_value, out_value->getSubField<epics::pvData::PVUShort>(std::string(attr_name)));
+      if (ccs::types::SignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVInt>>(nst_value, out_value->getSubField<epics::pvData::PVInt>(std::string(attr_name)));
+      if (ccs::types::UnsignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVUInt>>(nst_value, out_value->getSubField<epics::pvData::PVUInt>(std::string(attr_name)));
+      if (ccs::types::SignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVLong>>(nst_value, out_value->getSubField<epics::pvData::PVLong>(std::string(attr_name)));
+      if (ccs::types::UnsignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVULong>>(nst_value, out_value->getSubField<epics::pvData::PVULong>(std::string(attr_name)));
+      if (ccs::types::Float32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVFloat>>(nst_value, out_value->getSubField<epics::pvData::PVFloat>(std::string(attr_name)));
+      if (ccs::types::Float64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVDouble>>(nst_value, out_value->getSubField<epics::pvData::PVDouble>(std::string(attr_name)));
+      if (ccs::types::String == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVString>>(nst_value, out_value->getSubField<epics::pvData::PVString>(std::string(attr_name)));
     }
-
-  for (ccs::types::uint32 index = 0u; (status && (index < inp_type->GetAttributeNumber())); index += 1u)
+#if 0
+  else if (ccs::HelperTools::Is<ccs::types::ScalarArray>(attr_type))
     {
-      const char* attr_name = inp_type->GetAttributeName(index);
-      std::shared_ptr<const ccs::types::AnyType> attr_type = ccs::HelperTools::GetAttributeType(inp_value, attr_name);
-
-      log_debug("AnyValueToPVStruct - Attribute '%s' with type '%s' ..", attr_name, attr_type->GetName());
-      ccs::types::AnyValue attr_value = ccs::HelperTools::GetAttributeValue<ccs::types::AnyValue>(inp_value, attr_name);
-      const ccs::types::AnyValue* nst_value = &attr_value;
+      log_debug("AnyValueToPVStruct - .. is array of scalar");
+      if (ccs::types::Boolean == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVBooleanArray>>(nst_value, out_value->getSubField<epics::pvData::PVBooleanArray>(attr_name));
+      if (ccs::types::SignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVByteArray>>(nst_value, out_value->getSubField<epics::pvData::PVByteArray>(attr_name));
+      if (ccs::types::UnsignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVUByteArray>>(nst_value, out_value->getSubField<epics::pvData::PVUByteArray>(attr_name));
+      if (ccs::types::SignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVShortArray>>(nst_value, out_value->getSubField<epics::pvData::PVShortArray>(attr_name));
+      if (ccs::types::UnsignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVUShortArray>>(nst_value, out_value->getSubField<epics::pvData::PVUShortArray>(attr_name));
+      if (ccs::types::SignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVIntArray>>(nst_value, out_value->getSubField<epics::pvData::PVIntArray>(attr_name));
+      if (ccs::types::UnsignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVUIntArray>>(nst_value, out_value->getSubField<epics::pvData::PVUIntArray>(attr_name));
+      if (ccs::types::SignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVLongArray>>(nst_value, out_value->getSubField<epics::pvData::PVLongArray>(attr_name));
+      if (ccs::types::UnsignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVULongArray>>(nst_value, out_value->getSubField<epics::pvData::PVULongArray>(attr_name));
+      if (ccs::types::Float32 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVFloatArray>>(nst_value, out_value->getSubField<epics::pvData::PVFloatArray>(attr_name));
+      if (ccs::types::Float64 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVDoubleArray>>(nst_value, out_value->getSubField<epics::pvData::PVDoubleArray>(attr_name));
+      if (ccs::types::String == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVStringArray>>(nst_value, out_value->getSubField<epics::pvData::PVStringArray>(attr_name));
+    }
+  else if (ccs::HelperTools::Is<ccs::types::CompoundArray>(attr_type))
+    {
+      log_debug("AnyValueToPVStruct - .. is array of struct");
+      status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVStructureArray>>(nst_value, out_value->getSubField<epics::pvData::PVStructureArray>(attr_name));
+    }
+#else
+  else if (ccs::HelperTools::Is<ccs::types::ArrayType>(attr_type))
+    {
+      std::shared_ptr<const ccs::types::AnyType> elem_type = std::dynamic_pointer_cast<const ccs::types::ArrayType>(attr_type)->GetElementType();
 
-      if (ccs::HelperTools::Is<ccs::types::ScalarType>(attr_type))
+      if (ccs::HelperTools::Is<ccs::types::CompoundType>(elem_type))
 	{
-	  log_debug("AnyValueToPVStruct - .. is scalar");
-	  if (ccs::types::Boolean == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVBoolean>>(nst_value, out_value->getSubField<epics::pvData::PVBoolean>(std::string(attr_name)));
-	  if (ccs::types::SignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVByte>>(nst_value, out_value->getSubField<epics::pvData::PVByte>(std::string(attr_name)));
-	  if (ccs::types::UnsignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVUByte>>(nst_value, out_value->getSubField<epics::pvData::PVUByte>(std::string(attr_name)));
-	  if (ccs::types::SignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVShort>>(nst_value, out_value->getSubField<epics::pvData::PVShort>(std::string(attr_name)));
-	  if (ccs::types::UnsignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVUShort>>(nst_value, out_value->getSubField<epics::pvData::PVUShort>(std::string(attr_name)));
-	  if (ccs::types::SignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVInt>>(nst_value, out_value->getSubField<epics::pvData::PVInt>(std::string(attr_name)));
-	  if (ccs::types::UnsignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVUInt>>(nst_value, out_value->getSubField<epics::pvData::PVUInt>(std::string(attr_name)));
-	  if (ccs::types::SignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVLong>>(nst_value, out_value->getSubField<epics::pvData::PVLong>(std::string(attr_name)));
-	  if (ccs::types::UnsignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVULong>>(nst_value, out_value->getSubField<epics::pvData::PVULong>(std::string(attr_name)));
-	  if (ccs::types::Float32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVFloat>>(nst_value, out_value->getSubField<epics::pvData::PVFloat>(std::string(attr_name)));
-	  if (ccs::types::Float64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVDouble>>(nst_value, out_value->getSubField<epics::pvData::PVDouble>(std::string(attr_name)));
-	  if (ccs::types::String == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = AnyValueToPVScalar<std::shared_ptr<epics::pvData::PVString>>(nst_value, out_value->getSubField<epics::pvData::PVString>(std::string(attr_name)));
+	  log_debug("AnyValueToPVStruct - .. is array of struct");
+	  status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVStructureArray>>(nst_value, out_value->getSubField<epics::pvData::PVStructureArray>(attr_name));
 	}
-#if 0
-      else if (ccs::HelperTools::Is<ccs::types::ScalarArray>(attr_type))
+      else
 	{
 	  log_debug("AnyValueToPVStruct - .. is array of scalar");
-	  if (ccs::types::Boolean == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  if (ccs::types::Boolean == elem_type) 
 	    status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVBooleanArray>>(nst_value, out_value->getSubField<epics::pvData::PVBooleanArray>(attr_name));
-	  if (ccs::types::SignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::SignedInteger8 == elem_type) 
 	    status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVByteArray>>(nst_value, out_value->getSubField<epics::pvData::PVByteArray>(attr_name));
-	  if (ccs::types::UnsignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::UnsignedInteger8 == elem_type) 
 	    status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVUByteArray>>(nst_value, out_value->getSubField<epics::pvData::PVUByteArray>(attr_name));
-	  if (ccs::types::SignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::SignedInteger16 == elem_type) 
 	    status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVShortArray>>(nst_value, out_value->getSubField<epics::pvData::PVShortArray>(attr_name));
-	  if (ccs::types::UnsignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::UnsignedInteger16 == elem_type) 
 	    status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVUShortArray>>(nst_value, out_value->getSubField<epics::pvData::PVUShortArray>(attr_name));
-	  if (ccs::types::SignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::SignedInteger32 == elem_type) 
 	    status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVIntArray>>(nst_value, out_value->getSubField<epics::pvData::PVIntArray>(attr_name));
-	  if (ccs::types::UnsignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::UnsignedInteger32 == elem_type) 
 	    status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVUIntArray>>(nst_value, out_value->getSubField<epics::pvData::PVUIntArray>(attr_name));
-	  if (ccs::types::SignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::SignedInteger64 == elem_type) 
 	    status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVLongArray>>(nst_value, out_value->getSubField<epics::pvData::PVLongArray>(attr_name));
-	  if (ccs::types::UnsignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::UnsignedInteger64 == elem_type) 
 	    status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVULongArray>>(nst_value, out_value->getSubField<epics::pvData::PVULongArray>(attr_name));
-	  if (ccs::types::Float32 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::Float32 == elem_type) 
 	    status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVFloatArray>>(nst_value, out_value->getSubField<epics::pvData::PVFloatArray>(attr_name));
-	  if (ccs::types::Float64 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::Float64 == elem_type) 
 	    status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVDoubleArray>>(nst_value, out_value->getSubField<epics::pvData::PVDoubleArray>(attr_name));
-	  if (ccs::types::String == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::String == elem_type) 
 	    status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVStringArray>>(nst_value, out_value->getSubField<epics::pvData::PVStringArray>(attr_name));
+	  else
+	    status = false;
 	}
-      else if (ccs::HelperTools::Is<ccs::types::CompoundArray>(attr_type))
+    }
+#endif
+  else if (ccs::HelperTools::Is<ccs::types::CompoundType>(attr_type))
+    {
+      log_debug("AnyValueToPVStruct - .. is struct");
+      status = AnyValueToPVStruct(nst_value, out_value->getSubField<epics::pvData::PVStructure>(attr_name));
+    }
+  else
+    {
+      log_error("AnyValueToPVStruct - .. is of unknown type");
+      status = false;
+    }
+
+  return status;
+
+}
+
+static inline bool AnyValueToPVStruct (const ccs::types::AnyValue* inp_value,
+				       std::shared_ptr<epics::pvData::PVStructure> out_value)
+{
+
+  std::shared_ptr<const ccs::types::AnyType> type = inp_value->GetType();
+  std::shared_ptr<const ccs::types::CompoundType> inp_type;
+
+  bool status = ccs::HelperTools::Is<ccs::types::CompoundType>(type);
+
+  if (status)
+    {
+      inp_type = std::dynamic_pointer_cast<const ccs::types::CompoundType>(type);
+      status = (inp_type ? true : false);
+    }
+
+  std::shared_ptr<const ccs::base::PVAConversionPlan> plan;
+
+  if (status && out_value)
+    { // Cached conversion plan for this pair of types
+      plan = ccs::base::PVAConversionPlan::GetInstance(out_value->getStructure(), type);
+    }
+
+  bool planned = (status && plan);
+
+  if (planned)
+    {
+      status = plan->ToPVStruct(inp_value->GetInstance(), *out_value);
+    }
+
+  for (ccs::types::uint32 index = 0u; (status && !planned && (index < inp_type->GetAttributeNumber())); index += 1u)
+    {
+      const char* attr_name = inp_type->GetAttributeName(index);
+      std::shared_ptr<const ccs::types::AnyType> attr_type = ccs::HelperTools::GetAttributeType(inp_value, attr_name);
+
+      log_debug("AnyValueToPVStruct - Attribute '%s' with type '%s' ..", attr_name, attr_type->GetName());
+      ccs::types::AnyValue attr_value = ccs::HelperTools::GetAttributeValue<ccs::types::AnyValue>(inp_value, attr_name);
+      const ccs::types::AnyValue* nst_value = &attr_value;
+
+      status = AnyValueToPVAttribute(nst_value, out_value, attr_name);
+    }
+
+  return status;
+
+}
+
+static inline bool AnyValueToPVStruct (const ccs::types::AnyValue* inp_value,
+				       std::shared_ptr<epics::pvData::PVStructure> out_value,
+				       const void* reference)
+{
+
+  std::shared_ptr<const ccs::types::CompoundType> inp_type = std::dynamic_pointer_cast<const ccs::types::CompoundType>(inp_value->GetType());
+
+  bool status = (inp_type ? true : false);
+
+  for (ccs::types::uint32 index = 0u; (status && (index < inp_type->GetAttributeNumber())); index += 1u)
+    {
+      const char* attr_name = inp_type->GetAttributeName(index);
+      std::shared_ptr<const ccs::types::AnyType> attr_type = ccs::HelperTools::GetAttributeType(inp_value, attr_name);
+
+      void* attr_inst = ccs::HelperTools::GetAttributeReference(inp_value, attr_name);
+      const void* attr_ref = static_cast<const void*>(static_cast<const ccs::types::uint8*>(reference) + 
+						      (static_cast<ccs::types::uint8*>(attr_inst) - static_cast<ccs::types::uint8*>(inp_value->GetInstance())));
+
+      if (0 == memcmp(attr_inst, attr_ref, attr_type->GetSize()))
 	{
-	  log_debug("AnyValueToPVStruct - .. is array of struct");
-	  status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVStructureArray>>(nst_value, out_value->getSubField<epics::pvData::PVStructureArray>(attr_name));
+	  continue; // Attribute unchanged
 	}
-#else
-      else if (ccs::HelperTools::Is<ccs::types::ArrayType>(attr_type))
-	{
-	  std::shared_ptr<const ccs::types::AnyType> elem_type = std::dynamic_pointer_cast<const ccs::types::ArrayType>(attr_type)->GetElementType();
 
-	  if (ccs::HelperTools::Is<ccs::types::CompoundType>(elem_type))
-	    {
-	      log_debug("AnyValueToPVStruct - .. is array of struct");
-	      status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVStructureArray>>(nst_value, out_value->getSubField<epics::pvData::PVStructureArray>(attr_name));
-	    }
-	  else
-	    {
-	      log_debug("AnyValueToPVStruct - .. is array of scalar");
-	      if (ccs::types::Boolean == elem_type) 
-		status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVBooleanArray>>(nst_value, out_value->getSubField<epics::pvData::PVBooleanArray>(attr_name));
-	      else if (ccs::types::SignedInteger8 == elem_type) 
-		status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVByteArray>>(nst_value, out_value->getSubField<epics::pvData::PVByteArray>(attr_name));
-	      else if (ccs::types::UnsignedInteger8 == elem_type) 
-		status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVUByteArray>>(nst_value, out_value->getSubField<epics::pvData::PVUByteArray>(attr_name));
-	      else if (ccs::types::SignedInteger16 == elem_type) 
-		status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVShortArray>>(nst_value, out_value->getSubField<epics::pvData::PVShortArray>(attr_name));
-	      else if (ccs::types::UnsignedInteger16 == elem_type) 
-		status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVUShortArray>>(nst_value, out_value->getSubField<epics::pvData::PVUShortArray>(attr_name));
-	      else if (ccs::types::SignedInteger32 == elem_type) 
-		status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVIntArray>>(nst_value, out_value->getSubField<epics::pvData::PVIntArray>(attr_name));
-	      else if (ccs::types::UnsignedInteger32 == elem_type) 
-		status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVUIntArray>>(nst_value, out_value->getSubField<epics::pvData::PVUIntArray>(attr_name));
-	      else if (ccs::types::SignedInteger64 == elem_type) 
-		status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVLongArray>>(nst_value, out_value->getSubField<epics::pvData::PVLongArray>(attr_name));
-	      else if (ccs::types::UnsignedInteger64 == elem_type) 
-		status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVULongArray>>(nst_value, out_value->getSubField<epics::pvData::PVULongArray>(attr_name));
-	      else if (ccs::types::Float32 == elem_type) 
-		status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVFloatArray>>(nst_value, out_value->getSubField<epics::pvData::PVFloatArray>(attr_name));
-	      else if (ccs::types::Float64 == elem_type) 
-		status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVDoubleArray>>(nst_value, out_value->getSubField<epics::pvData::PVDoubleArray>(attr_name));
-	      else if (ccs::types::String == elem_type) 
-		status = AnyValueToPVArray<std::shared_ptr<epics::pvData::PVStringArray>>(nst_value, out_value->getSubField<epics::pvData::PVStringArray>(attr_name));
-	      else
-		status = false;
-	    }
-	}
-#endif
-      else if (ccs::HelperTools::Is<ccs::types::CompoundType>(attr_type))
+      ccs::types::AnyValue attr_value (attr_type, attr_inst); // Sub-structure reference
+
+      if (ccs::HelperTools::Is<ccs::types::CompoundType>(attr_type))
 	{
-	  log_debug("AnyValueToPVStruct - .. is struct");
-	  status = AnyValueToPVStruct(nst_value, out_value->getSubField<epics::pvData::PVStructure>(attr_name));
+	  status = AnyValueToPVStruct(&attr_value, out_value->getSubField<epics::pvData::PVStructure>(attr_name), attr_ref);
 	}
       else
 	{
-	  log_error("AnyValueToPVStruct - .. is of unknown type");
-	  status = false;
+	  status = AnyValueToPVAttribute(&attr_value, out_value, attr_name);
 	}
     }
 
   return status;
 
 }
+
   
 } // namespace HelperTools
 
@@ -0,0 +1,597 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-tools/tags/CODAC-CORE-6.2B2/src/main/c++/pva/PVAConversionPlan.cpp $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Infrastructure tools - Prototype
+*
+* Author        : Bertrand Bauvir
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*		  CS 90 046
+*		  13067 St. Paul-lez-Durance Cedex
+*		  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <new> // std::nothrow
+#include <map> // std::multimap
+#include <mutex> // std::mutex
+
+#include <string.h> // strcmp
+
+#include <pv/pvData.h>
+
+#include <BasicTypes.h> // Global type definition
+#include <SysTools.h> // Misc. helper functions
+
+//#define LOG_TRACE_ENABLE
+//#undef LOG_TRACE_ENABLE
+//#define LOG_DEBUG_ENABLE
+//#undef LOG_DEBUG_ENABLE
+#include <log-api.h> // Syslog wrapper routines
+
+#include <AnyType.h> // Introspectable data type ..
+#include <AnyTypeHelper.h> // .. associated helper routines
+
+#include <AnyValue.h> // Variable with introspectable data type ..
+#include <AnyValueHelper.h> // .. associated helper routines
+
+// Local header files
+
+#include "AnyTypeToPVA.h" // .. associated helper routines
+#include "AnyValueToPVA.h" // .. associated helper routines
+#include "PVAToAnyValue.h" // .. associated helper routines
+
+#include "PVAConversionPlan.h" // This class definition
+
+// Constants
+
+#undef LOG_ALTERN_SRC
+#define LOG_ALTERN_SRC "pva-if"
+
+// Type definition
+
+namespace ccs {
+
+namespace base {
+
+typedef struct PVAConversionEntry {
+  std::shared_ptr<const epics::pvData::Structure> pv_type; // Keep key alive
+  std::shared_ptr<const ccs::types::AnyType> any_type; // Keep key alive
+  std::shared_ptr<const PVAConversionPlan> plan;
+} PVAConversionEntry_t;
+
+typedef struct PVAStructureEntry {
+  std::shared_ptr<const ccs::types::AnyType> any_type; // Keep key alive
+  std::shared_ptr<const epics::pvData::Structure> pv_type;
+} PVAStructureEntry_t;
+
+// Global variables
+
+static std::mutex __pva_plan_mutex;
+static std::multimap<ccs::types::uint64, PVAConversionEntry_t> __pva_plan_cache; // Keyed by type fingerprint
+static std::multimap<ccs::types::uint64, PVAStructureEntry_t> __pva_struct_cache; // Keyed by type fingerprint
+static ccs::types::uint64 __pva_cache_hits = 0ul;
+
+// Function declaration
+
+// Function definition
+
+static inline bool IsSameType (const std::shared_ptr<const ccs::types::AnyType>& type, const std::shared_ptr<const ccs::types::AnyType>& other) // Fingerprints match
+{
+  return ((type == other) || (*type == *other));
+}
+
+static inline bool IsSameType (const std::shared_ptr<const epics::pvData::Structure>& type, const std::shared_ptr<const epics::pvData::Structure>& other)
+{
+  return ((type == other) || (*type == *other));
+}
+
+static bool HasSameTypeNames (const std::shared_ptr<const ccs::types::AnyType>& type, const std::shared_ptr<const ccs::types::AnyType>& other) // Identical types, used as structure identifiers
+{
+
+  bool status = (0 == strcmp(type->GetName(), other->GetName()));
+
+  if (status && ccs::HelperTools::Is<ccs::types::ArrayType>(type))
+    {
+      status = HasSameTypeNames(std::dynamic_pointer_cast<const ccs::types::ArrayType>(type)->GetElementType(), 
+			       std::dynamic_pointer_cast<const ccs::types::ArrayType>(other)->GetElementType());
+    }
+  else if (status && ccs::HelperTools::Is<ccs::types::CompoundType>(type))
+    {
+      std::shared_ptr<const ccs::types::CompoundType> compound = std::dynamic_pointer_cast<const ccs::types::CompoundType>(type);
+      std::shared_ptr<const ccs::types::CompoundType> ref = std::dynamic_pointer_cast<const ccs::types::CompoundType>(other);
+
+      for (ccs::types::uint32 index = 0u; (status && (index < compound->GetAttributeNumber())); index += 1u)
+	{
+	  status = HasSameTypeNames(compound->GetAttributeType(index), ref->GetAttributeType(index));
+	}
+    }
+
+  return status;
+
+}
+
+template <typename Type, typename PVType> static bool PVScalarToMemory (const PVAConversionPlan::Step_t& step, void* ref, const std::shared_ptr<epics::pvData::PVField>& field)
+{
+  *static_cast<Type*>(ref) = static_cast<Type>(static_cast<const PVType*>(field.get())->get());
+  return true;
+}
+
+template <typename Type, typename PVType> static bool MemoryToPVScalar (const PVAConversionPlan::Step_t& step, const void* ref, const std::shared_ptr<epics::pvData::PVField>& field)
+{
+  static_cast<PVType*>(field.get())->put(*static_cast<const Type*>(ref));
+  return true;
+}
+
+static bool PVStringToMemory (const PVAConversionPlan::Step_t& step, void* ref, const std::shared_ptr<epics::pvData::PVField>& field)
+{
+  ccs::HelperTools::SafeStringCopy(static_cast<char*>(ref), static_cast<const epics::pvData::PVString*>(field.get())->get().c_str(), STRING_MAX_LENGTH);
+  return true;
+}
+
+static bool MemoryToPVString (const PVAConversionPlan::Step_t& step, const void* ref, const std::shared_ptr<epics::pvData::PVField>& field)
+{
+  static_cast<epics::pvData::PVString*>(field.get())->put(std::string(static_cast<const char*>(ref)));
+  return true;
+}
+
+template <typename PVType> static bool PVArrayToMemory (const PVAConversionPlan::Step_t& step, void* ref, const std::shared_ptr<epics::pvData::PVField>& field)
+{
+  ccs::types::AnyValue value (step.type, ref); // Attribute reference
+  return ccs::HelperTools::PVArrayToAnyValue<std::shared_ptr<const PVType>>(&value, std::static_pointer_cast<const PVType>(field));
+}
+
+template <typename PVType> static bool MemoryToPVArray (const PVAConversionPlan::Step_t& step, const void* ref, const std::shared_ptr<epics::pvData::PVField>& field)
+{
+  ccs::types::AnyValue value (step.type, const_cast<void*>(ref)); // Attribute reference
+  return ccs::HelperTools::AnyValueToPVArray<std::shared_ptr<PVType>>(&value, std::static_pointer_cast<PVType>(field));
+}
+
+static bool PVStructToMemory (const PVAConversionPlan::Step_t& step, void* ref, const std::shared_ptr<epics::pvData::PVField>& field)
+{
+  return (step.nested)->ToAnyValue(ref, *static_cast<const epics::pvData::PVStructure*>(field.get()));
+}
+
+static bool MemoryToPVStruct (const PVAConversionPlan::Step_t& step, const void* ref, const std::shared_ptr<epics::pvData::PVField>& field)
+{
+  return (step.nested)->ToPVStruct(ref, *static_cast<epics::pvData::PVStructure*>(field.get()));
+}
+
+static bool ResolveScalar (PVAConversionPlan::Step_t& step, const epics::pvData::ScalarType type)
+{
+
+  bool status = (ccs::HelperTools::AnyTypeToPVScalar(step.type) == type);
+
+  if (status)
+    {
+      switch (type)
+	{
+	  case epics::pvData::pvBoolean:
+	    step.to_any = &PVScalarToMemory<ccs::types::boolean, epics::pvData::PVBoolean>;
+	    step.to_pva = &MemoryToPVScalar<ccs::types::boolean, epics::pvData::PVBoolean>;
+	    break;
+	  case epics::pvData::pvByte:
+	    step.to_any = &PVScalarToMemory<ccs::types::int8, epics::pvData::PVByte>;
+	    step.to_pva = &MemoryToPVScalar<ccs::types::int8, epics::pvData::PVByte>;
+	    break;
+	  case epics::pvData::pvUByte:
+	    step.to_any = &PVScalarToMemory<ccs::types::uint8, epics::pvData::PVUByte>;
+	    step.to_pva = &MemoryToPVScalar<ccs::types::uint8, epics::pvData::PVUByte>;
+	    break;
+	  case epics::pvData::pvShort:
+	    step.to_any = &PVScalarToMemory<ccs::types::int16, epics::pvData::PVShort>;
+	    step.to_pva = &MemoryToPVScalar<ccs::types::int16, epics::pvData::PVShort>;
+	    break;
+	  case epics::pvData::pvUShort:
+	    step.to_any = &PVScalarToMemory<ccs::types::uint16, epics::pvData::PVUShort>;
+	    step.to_pva = &MemoryToPVScalar<ccs::types::uint16, epics::pvData::PVUShort>;
+	    break;
+	  case epics::pvData::pvInt:
+	    step.to_any = &PVScalarToMemory<ccs::types::int32, epics::pvData::PVInt>;
+	    step.to_pva = &MemoryToPVScalar<ccs::types::int32, epics::pvData::PVInt>;
+	    break;
+	  case epics::pvData::pvUInt:
+	    step.to_any = &PVScalarToMemory<ccs::types::uint32, epics::pvData::PVUInt>;
+	    step.to_pva = &MemoryToPVScalar<ccs::types::uint32, epics::pvData::PVUInt>;
+	    break;
+	  case epics::pvData::pvLong:
+	    step.to_any = &PVScalarToMemory<ccs::types::int64, epics::pvData::PVLong>;
+	    step.to_pva = &MemoryToPVScalar<ccs::types::int64, epics::pvData::PVLong>;
+	    break;
+	  case epics::pvData::pvULong:
+	    step.to_any = &PVScalarToMemory<ccs::types::uint64, epics::pvData::PVULong>;
+	    step.to_pva = &MemoryToPVScalar<ccs::types::uint64, epics::pvData::PVULong>;
+	    break;
+	  case epics::pvData::pvFloat:
+	    step.to_any = &PVScalarToMemory<ccs::types::float32, epics::pvData::PVFloat>;
+	    step.to_pva = &MemoryToPVScalar<ccs::types::float32, epics::pvData::PVFloat>;
+	    break;
+	  case epics::pvData::pvDouble:
+	    step.to_any = &PVScalarToMemory<ccs::types::float64, epics::pvData::PVDouble>;
+	    step.to_pva = &MemoryToPVScalar<ccs::types::float64, epics::pvData::PVDouble>;
+	    break;
+	  case epics::pvData::pvString:
+	    step.to_any = &PVStringToMemory;
+	    step.to_pva = &MemoryToPVString;
+	    break;
+	  default:
+	    status = false;
+	    break;
+	}
+    }
+
+  return status;
+
+}
+
+static bool ResolveScalarArray (PVAConversionPlan::Step_t& step, const epics::pvData::ScalarType type)
+{
+
+  std::shared_ptr<const ccs::types::ArrayType> array_type = std::dynamic_pointer_cast<const ccs::types::ArrayType>(step.type);
+
+  bool status = (array_type ? true : false);
+
+  if (status)
+    {
+      status = (ccs::HelperTools::Is<ccs::types::ScalarType>(array_type->GetElementType()) &&
+		(ccs::HelperTools::AnyTypeToPVScalar(array_type->GetElementType()) == type));
+    }
+
+  if (status)
+    {
+      switch (type)
+	{
+	  case epics::pvData::pvBoolean:
+	    step.to_any = &PVArrayToMemory<epics::pvData::PVBooleanArray>;
+	    step.to_pva = &MemoryToPVArray<epics::pvData::PVBooleanArray>;
+	    break;
+	  case epics::pvData::pvByte:
+	    step.to_any = &PVArrayToMemory<epics::pvData::PVByteArray>;
+	    step.to_pva = &MemoryToPVArray<epics::pvData::PVByteArray>;
+	    break;
+	  case epics::pvData::pvUByte:
+	    step.to_any = &PVArrayToMemory<epics::pvData::PVUByteArray>;
+	    step.to_pva = &MemoryToPVArray<epics::pvData::PVUByteArray>;
+	    break;
+	  case epics::pvData::pvShort:
+	    step.to_any = &PVArrayToMemory<epics::pvData::PVShortArray>;
+	    step.to_pva = &MemoryToPVArray<epics::pvData::PVShortArray>;
+	    break;
+	  case epics::pvData::pvUShort:
+	    step.to_any = &PVArrayToMemory<epics::pvData::PVUShortArray>;
+	    step.to_pva = &MemoryToPVArray<epics::pvData::PVUShortArray>;
+	    break;
+	  case epics::pvData::pvInt:
+	    step.to_any = &PVArrayToMemory<epics::pvData::PVIntArray>;
+	    step.to_pva = &MemoryToPVArray<epics::pvData::PVIntArray>;
+	    break;
+	  case epics::pvData::pvUInt:
+	    step.to_any = &PVArrayToMemory<epics::pvData::PVUIntArray>;
+	    step.to_pva = &MemoryToPVArray<epics::pvData::PVUIntArray>;
+	    break;
+	  case epics::pvData::pvLong:
+	    step.to_any = &PVArrayToMemory<epics::pvData::PVLongArray>;
+	    step.to_pva = &MemoryToPVArray<epics::pvData::PVLongArray>;
+	    break;
+	  case epics::pvData::pvULong:
+	    step.to_any = &PVArrayToMemory<epics::pvData::PVULongArray>;
+	    step.to_pva = &MemoryToPVArray<epics::pvData::PVULongArray>;
+	    break;
+	  case epics::pvData::pvFloat:
+	    step.to_any = &PVArrayToMemory<epics::pvData::PVFloatArray>;
+	    step.to_pva = &MemoryToPVArray<epics::pvData::PVFloatArray>;
+	    break;
+	  case epics::pvData::pvDouble:
+	    step.to_any = &PVArrayToMemory<epics::pvData::PVDoubleArray>;
+	    step.to_pva = &MemoryToPVArray<epics::pvData::PVDoubleArray>;
+	    break;
+	  case epics::pvData::pvString:
+	    step.to_any = &PVArrayToMemory<epics::pvData::PVStringArray>;
+	    step.to_pva = &MemoryToPVArray<epics::pvData::PVStringArray>;
+	    break;
+	  default:
+	    status = false;
+	    break;
+	}
+    }
+
+  return status;
+
+}
+
+bool PVAConversionPlan::Initialise (const std::shared_ptr<const epics::pvData::Structure>& pv_type, const std::shared_ptr<const ccs::types::AnyType>& any_type)
+{
+
+  std::shared_ptr<const ccs::types::CompoundType> inp_type = std::dynamic_pointer_cast<const ccs::types::CompoundType>(any_type);
+
+  bool status = (pv_type && inp_type);
+
+  for (ccs::types::uint32 index = 0u; (status && (index < inp_type->GetAttributeNumber())); index += 1u)
+    {
+      Step_t step;
+
+      step.type = inp_type->GetAttributeType(index);
+      step.offset = inp_type->GetAttributeOffset(index);
+      step.to_any = NULL;
+      step.to_pva = NULL;
+
+      size_t field = pv_type->getFieldIndex(std::string(inp_type->GetAttributeName(index)));
+
+      status = (static_cast<size_t>(-1) != field);
+
+      std::shared_ptr<const epics::pvData::Field> field_type;
+
+      if (status)
+	{
+	  step.field = static_cast<ccs::types::uint32>(field);
+	  field_type = pv_type->getField(field);
+	  status = (field_type ? true : false);
+	}
+
+      if (status)
+	{
+	  switch (field_type->getType())
+	    {
+	      case epics::pvData::scalar:
+		status = (ccs::HelperTools::Is<ccs::types::ScalarType>(step.type) &&
+			  ResolveScalar(step, std::static_pointer_cast<const epics::pvData::Scalar>(field_type)->getScalarType()));
+		break;
+	      case epics::pvData::scalarArray:
+		status = (ccs::HelperTools::Is<ccs::types::ArrayType>(step.type) &&
+			  ResolveScalarArray(step, std::static_pointer_cast<const epics::pvData::ScalarArray>(field_type)->getElementType()));
+		break;
+	      case epics::pvData::structure:
+		status = ccs::HelperTools::Is<ccs::types::CompoundType>(step.type);
+		if (status)
+		  {
+		    step.nested = PVAConversionPlan::GetInstance(std::static_pointer_cast<const epics::pvData::Structure>(field_type), step.type);
+		    status = (step.nested ? true : false);
+		  }
+		if (status)
+		  {
+		    step.to_any = &PVStructToMemory;
+		    step.to_pva = &MemoryToPVStruct;
+		  }
+		break;
+	      case epics::pvData::structureArray:
+		status = (ccs::HelperTools::Is<ccs::types::ArrayType>(step.type) &&
+			  ccs::HelperTools::Is<ccs::types::CompoundType>(std::dynamic_pointer_cast<const ccs::types::ArrayType>(step.type)->GetElementType()));
+		if (status)
+		  {
+		    step.to_any = &PVArrayToMemory<epics::pvData::PVStructureArray>;
+		    step.to_pva = &MemoryToPVArray<epics::pvData::PVStructureArray>;
+		  }
+		break;
+	      default:
+		status = false;
+		break;
+	    }
+	}
+
+      if (status)
+	{
+	  __steps.push_back(step);
+	}
+      else
+	{
+	  log_debug("PVAConversionPlan::Initialise - Attribute '%s' does not map", inp_type->GetAttributeName(index));
+	}
+    }
+
+  return status;
+
+}
+
+std::shared_ptr<const PVAConversionPlan> PVAConversionPlan::GetInstance (const std::shared_ptr<const epics::pvData::Structure>& pv_type, const std::shared_ptr<const ccs::types::AnyType>& any_type)
+{
+
+  std::shared_ptr<const PVAConversionPlan> plan;
+
+  bool status = (pv_type && any_type);
+  bool found = false;
+
+  ccs::types::uint64 key = 0ul;
+
+  if (status)
+    { // Structural identity .. types are created anew e.g. for each RPC request or reply
+      key = any_type->GetFingerprint();
+
+      std::lock_guard<std::mutex> lock (__pva_plan_mutex);
+
+      typedef std::multimap<ccs::types::uint64, PVAConversionEntry_t>::const_iterator Iterator_t;
+      std::pair<Iterator_t, Iterator_t> range = __pva_plan_cache.equal_range(key);
+
+      for (Iterator_t it = range.first; (!found && (it != range.second)); ++it)
+	{
+	  found = (IsSameType(it->second.any_type, any_type) && IsSameType(it->second.pv_type, pv_type));
+
+	  if (found)
+	    {
+	      plan = it->second.plan;
+	      __pva_cache_hits += 1ul;
+	    }
+	}
+    }
+
+  if (status && !found)
+    { // Created outside the lock since nested structures are resolved recursively
+      std::shared_ptr<PVAConversionPlan> created (new (std::nothrow) PVAConversionPlan ());
+
+      if (created && created->Initialise(pv_type, any_type))
+	{
+	  plan = created;
+	}
+
+      PVAConversionEntry_t entry;
+
+      entry.pv_type = pv_type;
+      entry.any_type = any_type;
+      entry.plan = plan; // Also record types which do not map
+
+      std::lock_guard<std::mutex> lock (__pva_plan_mutex);
+
+      if (DEFAULT_PVACONVERSION_CACHE_SIZE <= __pva_plan_cache.size())
+	{
+	  log_debug("PVAConversionPlan::GetInstance - Flush cache");
+	  __pva_plan_cache.clear();
+	}
+
+      __pva_plan_cache.insert(std::make_pair(key, entry));
+    }
+
+  return plan;
+
+}
+
+std::shared_ptr<const epics::pvData::Structure> PVAConversionPlan::GetStructure (const std::shared_ptr<const ccs::types::AnyType>& any_type)
+{
+
+  std::shared_ptr<const epics::pvData::Structure> pv_type;
+
+  bool status = (any_type ? true : false);
+  bool found = false;
+
+  ccs::types::uint64 key = 0ul;
+
+  if (status)
+    {
+      key = any_type->GetFingerprint();
+
+      std::lock_guard<std::mutex> lock (__pva_plan_mutex);
+
+      typedef std::multimap<ccs::types::uint64, PVAStructureEntry_t>::const_iterator Iterator_t;
+      std::pair<Iterator_t, Iterator_t> range = __pva_struct_cache.equal_range(key);
+
+      for (Iterator_t it = range.first; (!found && (it != range.second)); ++it)
+	{
+	  found = ((it->second.any_type == any_type) || 
+		   (IsSameType(it->second.any_type, any_type) && HasSameTypeNames(it->second.any_type, any_type)));
+
+	  if (found)
+	    {
+	      pv_type = it->second.pv_type;
+	      __pva_cache_hits += 1ul;
+	    }
+	}
+    }
+
+  if (status && !found)
+    {
+      pv_type = ccs::HelperTools::AnyTypeToPVStruct(any_type);
+
+      PVAStructureEntry_t entry;
+
+      entry.any_type = any_type;
+      entry.pv_type = pv_type;
+
+      std::lock_guard<std::mutex> lock (__pva_plan_mutex);
+
+      if (DEFAULT_PVACONVERSION_CACHE_SIZE <= __pva_struct_cache.size())
+	{
+	  log_debug("PVAConversionPlan::GetStructure - Flush cache");
+	  __pva_struct_cache.clear();
+	}
+
+      __pva_struct_cache.insert(std::make_pair(key, entry));
+    }
+
+  return pv_type;
+
+}
+
+ccs::types::uint64 PVAConversionPlan::GetCacheHits (void)
+{
+
+  std::lock_guard<std::mutex> lock (__pva_plan_mutex);
+
+  return __pva_cache_hits;
+
+}
+
+bool PVAConversionPlan::ToAnyValue (void* out_ref, const epics::pvData::PVStructure& inp_value) const
+{
+
+  const epics::pvData::PVFieldPtrArray& fields = inp_value.getPVFields();
+
+  bool status = (static_cast<void*>(NULL) != out_ref);
+
+  for (std::vector<Step_t>::const_iterator it = __steps.begin(); (status && (it != __steps.end())); ++it)
+    {
+      status = (it->to_any)(*it, static_cast<void*>(static_cast<ccs::types::uint8*>(out_ref) + it->offset), fields[it->field]);
+    }
+
+  return status;
+
+}
+
+bool PVAConversionPlan::ToAnyValue (void* out_ref, const epics::pvData::PVStructure& inp_value, const epics::pvData::BitSet& changed) const
+{
+
+  const epics::pvData::PVFieldPtrArray& fields = inp_value.getPVFields();
+
+  bool status = (static_cast<void*>(NULL) != out_ref);
+  bool whole = (status && changed.get(inp_value.getFieldOffset()));
+
+  if (whole)
+    { // Whole structure changed
+      status = ToAnyValue(out_ref, inp_value);
+    }
+
+  for (std::vector<Step_t>::const_iterator it = __steps.begin(); (status && !whole && (it != __steps.end())); ++it)
+    {
+      const std::shared_ptr<epics::pvData::PVField>& field = fields[it->field];
+
+      ccs::types::uint32 offset = static_cast<ccs::types::uint32>(field->getFieldOffset());
+      ccs::types::int32 next = changed.nextSetBit(offset);
+
+      if ((next < 0) || (static_cast<ccs::types::uint32>(next) >= static_cast<ccs::types::uint32>(field->getNextFieldOffset())))
+	{
+	  continue; // Attribute unchanged
+	}
+
+      void* ref = static_cast<void*>(static_cast<ccs::types::uint8*>(out_ref) + it->offset);
+
+      if ((static_cast<ccs::types::uint32>(next) > offset) && (it->nested))
+	{ // Some nested attributes changed
+	  status = (it->nested)->ToAnyValue(ref, *static_cast<const epics::pvData::PVStructure*>(field.get()), changed);
+	}
+      else
+	{
+	  status = (it->to_any)(*it, ref, field);
+	}
+    }
+
+  return status;
+
+}
+
+bool PVAConversionPlan::ToPVStruct (const void* inp_ref, epics::pvData::PVStructure& out_value) const
+{
+
+  const epics::pvData::PVFieldPtrArray& fields = out_value.getPVFields();
+
+  bool status = (static_cast<const void*>(NULL) != inp_ref);
+
+  for (std::vector<Step_t>::const_iterator it = __steps.begin(); (status && (it != __steps.end())); ++it)
+    {
+      status = (it->to_pva)(*it, static_cast<const void*>(static_cast<const ccs::types::uint8*>(inp_ref) + it->offset), fields[it->field]);
+    }
+
+  return status;
+
+}
+
+} // namespace base
+
+} // namespace ccs
+
+#undef LOG_ALTERN_SRC
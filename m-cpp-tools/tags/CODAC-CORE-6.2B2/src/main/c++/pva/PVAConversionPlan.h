@@ -0,0 +1,189 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-tools/tags/CODAC-CORE-6.2B2/src/main/c++/pva/PVAConversionPlan.h $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Infrastructure tools - Prototype
+*
+* Author        : Bertrand Bauvir
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*		  CS 90 046
+*		  13067 St. Paul-lez-Durance Cedex
+*		  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+/**
+ * @file PVAConversionPlan.h
+ * @brief Header file for PVAConversionPlan class.
+ * @date 24/06/2019
+ * @author Bertrand Bauvir (IO)
+ * @copyright 2010-2019 ITER Organization
+ * @detail This header file contains the definition of the PVAConversionPlan class.
+ */
+
+#ifndef _PVAConversionPlan_h_
+#define _PVAConversionPlan_h_
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <vector> // std::vector
+
+#include <pv/pvData.h>
+
+#include <BasicTypes.h>
+
+#include <AnyType.h> // Introspectable data type definition ..
+
+// Local header files
+
+// Constants
+
+#define DEFAULT_PVACONVERSION_CACHE_SIZE 256u // Entries
+
+// Type definition
+
+namespace ccs {
+
+namespace base {
+
+/**
+ * @brief Precomputed mapping between an epics::pvData::Structure and a ccs::types::CompoundType.
+ * @detail The plan records, for each attribute of the CompoundType, the index of the
+ * corresponding field in the PVStructure and the attribute offset in the AnyValue instance,
+ * along with the conversion routine resolved for the pair of types. Repeated conversions
+ * between instances of the same types therefore skip field name resolution and type
+ * identification.
+ *
+ * Plans are cached and keyed by the structure of both introspection objects, i.e. the
+ * ccs::types::AnyType fingerprint, and entries matching the fingerprint are compared for
+ * equivalence. Types created anew with the same definition, e.g. for each RPC request or
+ * reply, therefore share plans. The cache is bounded and flushed when full.
+ *
+ * A plan is only provided if all attributes map to fields of compatible type; the caller
+ * otherwise falls back to the name-based conversion.
+ */
+
+class PVAConversionPlan
+{
+
+  public:
+
+    /**
+     * @brief Conversion step for one attribute.
+     */
+
+    typedef struct Step {
+
+      ccs::types::uint32 field; // Index in epics::pvData::PVStructure::getPVFields()
+      ccs::types::uint32 offset; // Attribute offset in the ccs::types::AnyValue instance
+      std::shared_ptr<const ccs::types::AnyType> type; // Attribute type
+      std::shared_ptr<const PVAConversionPlan> nested; // Structure attributes
+
+      bool (*to_any) (const Step& step, void* ref, const std::shared_ptr<epics::pvData::PVField>& field);
+      bool (*to_pva) (const Step& step, const void* ref, const std::shared_ptr<epics::pvData::PVField>& field);
+
+    } Step_t;
+
+  private:
+
+    std::vector<Step_t> __steps;
+
+    /**
+     * @brief Initialiser.
+     * @return True if all attributes map to fields of compatible type.
+     */
+
+    bool Initialise (const std::shared_ptr<const epics::pvData::Structure>& pv_type, const std::shared_ptr<const ccs::types::AnyType>& any_type);
+
+  protected:
+
+  public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+
+    PVAConversionPlan (void) {};
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+
+    virtual ~PVAConversionPlan (void) {};
+
+    /**
+     * @brief Accessor.
+     * @detail Provides the cached plan for the pair of types, created upon first access.
+     * @return Conversion plan, or empty shared pointer if the types do not map.
+     */
+
+    static std::shared_ptr<const PVAConversionPlan> GetInstance (const std::shared_ptr<const epics::pvData::Structure>& pv_type, const std::shared_ptr<const ccs::types::AnyType>& any_type);
+
+    /**
+     * @brief Accessor.
+     * @detail Provides the cached epics::pvData::Structure for the type, created with
+     * ccs::HelperTools::AnyTypeToPVStruct upon first access. Types of the same definition,
+     * including type names, share the structure.
+     * @return Structure introspection interface.
+     */
+
+    static std::shared_ptr<const epics::pvData::Structure> GetStructure (const std::shared_ptr<const ccs::types::AnyType>& any_type);
+
+    /**
+     * @brief Accessor.
+     * @return Number of lookups served from the plan and structure caches.
+     */
+
+    static ccs::types::uint64 GetCacheHits (void);
+
+    /**
+     * @brief Conversion method.
+     * @param out_ref Reference to the ccs::types::AnyValue instance.
+     * @param inp_value PVStructure of the type the plan was created with.
+     * @return True if successful.
+     */
+
+    bool ToAnyValue (void* out_ref, const epics::pvData::PVStructure& inp_value) const;
+
+    /**
+     * @brief Conversion method.
+     * @detail Partial conversion limited to the fields identified in the bitset.
+     * @param out_ref Reference to the ccs::types::AnyValue instance.
+     * @param inp_value PVStructure of the type the plan was created with.
+     * @param changed Changed fields, indexed by field offset.
+     * @return True if successful.
+     */
+
+    bool ToAnyValue (void* out_ref, const epics::pvData::PVStructure& inp_value, const epics::pvData::BitSet& changed) const;
+
+    /**
+     * @brief Conversion method.
+     * @param inp_ref Reference to the ccs::types::AnyValue instance.
+     * @param out_value PVStructure of the type the plan was created with.
+     * @return True if successful.
+     */
+
+    bool ToPVStruct (const void* inp_ref, epics::pvData::PVStructure& out_value) const;
+
+};
+
+// Global variables
+
+// Function declaration
+
+// Function definition
+
+} // namespace base
+
+} // namespace ccs
+
+#endif // _PVAConversionPlan_h_
+
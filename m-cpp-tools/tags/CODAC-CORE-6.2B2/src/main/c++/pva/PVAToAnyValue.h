@@ -34,8 +34,10 @@
 // Global header files
 
 #include <memory> // std::shared_ptr, etc.
+#include <string.h> // memcpy
 
 #include <pv/pvData.h>
+#include <pv/bitSet.h>
 
 #include <types.h> // Misc. type definition
 #include <tools.h> // Misc. helper functions
@@ -50,6 +52,8 @@
 #include "AnyTypeToPVA.h"
 #include "PVAToAnyType.h"
 
+#include "PVAConversionPlan.h"
+
 // Constants
 
 // Type definition
@@ -93,6 +97,20 @@ template <typename Type> inline bool PVArrayToAnyValue (ccs::types::AnyValue* ou
 static inline bool PVStructToAnyValue (ccs::types::AnyValue* out_value,
 				       const std::shared_ptr<const epics::pvData::PVStructure>& inp_value);
 
+/**
+ * @brief PVAccess to AnyValue conversion method.
+ * @detail Partial conversion limited to the fields identified in the bitset, e.g.
+ * monitor changedBitSet. Unchanged attributes of the destination are preserved.
+ * @param out_value ccs::types::AnyValue instance
+ * @param inp_value epics::pvData::PVStructure instance
+ * @param changed Changed fields, indexed by field offset.
+ * @return True if conversion successful.
+ */
+
+static inline bool PVStructToAnyValue (ccs::types::AnyValue* out_value,
+				       const std::shared_ptr<const epics::pvData::PVStructure>& inp_value,
+				       const epics::pvData::BitSet& changed);
+
 // Function definition
 
 #define PVSCALARTOANYSCALAR(OUT_BASIC_TYPE,OUT_INTRO_TYPE,INP_TYPE) \
@@ -228,10 +246,23 @@ template <> inline bool PVArrayToAnyValue<std::shared_ptr<const INP_TYPE>> (ccs:
 \
       INP_TYPE::const_svector inp_array = inp_value->view(); \
 \
-      for (ccs::types::uint32 index = 0u; (status && (index < inp_array.size())); index += 1u) \
+      ccs::types::uint32 number = ((inp_array.size() < out_type->GetElementNumber()) ? inp_array.size() : out_type->GetElementNumber()); \
+\
+      if (sizeof(INP_TYPE::value_type) == sizeof(OUT_BASIC_TYPE)) /* Bulk transfer */ \
+	{ \
+	  memcpy(out_value->GetInstance(), inp_array.data(), number * sizeof(OUT_BASIC_TYPE)); \
+	} \
+      else \
 	{ \
-	  status = ccs::HelperTools::SetElementValue<OUT_BASIC_TYPE>(out_value, index, inp_array[index]); \
+	  OUT_BASIC_TYPE* out_array = static_cast<OUT_BASIC_TYPE*>(out_value->GetInstance()); \
+\
+	  for (ccs::types::uint32 index = 0u; index < number; index += 1u) \
+	    { \
+	      out_array[index] = inp_array[index]; \
+	    } \
 	} \
+\
+      status = (inp_array.size() <= out_type->GetElementNumber()); \
 \
     } \
 \
@@ -356,150 +387,252 @@ template <> inline bool PVArrayToAnyValue<std::shared_ptr<const epics::pvData::P
 
 }
 
-static inline bool PVStructToAnyValue (ccs::types::AnyValue* out_value,
-				       const std::shared_ptr<const epics::pvData::PVStructure>& inp_value)
+static inline bool PVAttributeToAnyValue (ccs::types::AnyValue& attr_value,
+					  const std::shared_ptr<const epics::pvData::PVStructure>& inp_value,
+					  const char* attr_name)
 {
 
-  std::shared_ptr<const ccs::types::AnyType> type = out_value->GetType();
-  std::shared_ptr<const ccs::types::CompoundType> out_type;
+  std::shared_ptr<const ccs::types::AnyType> attr_type = attr_value.GetType();
 
-  bool status = ccs::HelperTools::Is<ccs::types::CompoundType>(type);
+  bool status = true;
 
-  if (status)
+  if (ccs::HelperTools::Is<ccs::types::ScalarType>(attr_type))
     {
-      out_type = std::dynamic_pointer_cast<const ccs::types::CompoundType>(type);
-      status = (out_type ? true : false);
+      log_debug("PVStructToAnyValue - .. is scalar");
+      if (ccs::types::Boolean == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVBoolean>>(&attr_value, inp_value->getSubField<epics::pvData::PVBoolean>(std::string(attr_name)));
+      else if (ccs::types::SignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVByte>>(&attr_value, inp_value->getSubField<epics::pvData::PVByte>(std::string(attr_name)));
+      else if (ccs::types::UnsignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVUByte>>(&attr_value, inp_value->getSubField<epics::pvData::PVUByte>(std::string(attr_name)));
+      else if (ccs::types::SignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVShort>>(&attr_value, inp_value->getSubField<epics::pvData::PVShort>(std::string(attr_name)));
+      else if (ccs::types::UnsignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVUShort>>(&attr_value, inp_value->getSubField<epics::pvData::PVUShort>(std::string(attr_name)));
+      else if (ccs::types::SignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVInt>>(&attr_value, inp_value->getSubField<epics::pvData::PVInt>(std::string(attr_name)));
+      else if (ccs::types::UnsignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVUInt>>(&attr_value, inp_value->getSubField<epics::pvData::PVUInt>(std::string(attr_name)));
+      else if (ccs::types::SignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVLong>>(&attr_value, inp_value->getSubField<epics::pvData::PVLong>(std::string(attr_name)));
+      else if (ccs::types::UnsignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVULong>>(&attr_value, inp_value->getSubField<epics::pvData::PVULong>(std::string(attr_name)));
+      else if (ccs::types::Float32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVFloat>>(&attr_value, inp_value->getSubField<epics::pvData::PVFloat>(std::string(attr_name)));
+      else if (ccs::types::Float64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVDouble>>(&attr_value, inp_value->getSubField<epics::pvData::PVDouble>(std::string(attr_name)));
+      else if (ccs::types::String == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
+	status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVString>>(&attr_value, inp_value->getSubField<epics::pvData::PVString>(std::string(attr_name)));
     }
-
-  for (ccs::types::uint32 index = 0u; (status && (index < out_type->GetAttributeNumber())); index += 1u)
+#if 0
+  else if (ccs::HelperTools::Is<ccs::types::ScalarArray>(attr_type))
     {
-      const char* attr_name = out_type->GetAttributeName(index);
-      void* attr_inst = ccs::HelperTools::GetAttributeReference(out_value, attr_name);
-      std::shared_ptr<const ccs::types::AnyType> attr_type = ccs::HelperTools::GetAttributeType(out_value, attr_name);
-
-      log_debug("PVStructToAnyValue - Attribute '%s' with type '%s' ..", attr_name, attr_type->GetName());
-
-      ccs::types::AnyValue attr_value (attr_type, attr_inst); // Sub-structure reference
+      log_debug("PVStructToAnyValue - .. is array of scalar");
+      if (ccs::types::Boolean == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVBooleanArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVBooleanArray>(attr_name));
+      else if (ccs::types::SignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVByteArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVByteArray>(attr_name));
+      else if (ccs::types::UnsignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVUByteArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVUByteArray>(attr_name));
+      else if (ccs::types::SignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVShortArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVShortArray>(attr_name));
+      else if (ccs::types::UnsignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVUShortArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVUShortArray>(attr_name));
+      else if (ccs::types::SignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVIntArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVIntArray>(attr_name));
+      else if (ccs::types::UnsignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVUIntArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVUIntArray>(attr_name));
+      else if (ccs::types::SignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVLongArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVLongArray>(attr_name));
+      else if (ccs::types::UnsignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVULongArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVULongArray>(attr_name));
+      else if (ccs::types::Float32 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVFloatArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVFloatArray>(attr_name));
+      else if (ccs::types::Float64 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVDoubleArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVDoubleArray>(attr_name));
+      else if (ccs::types::String == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVStringArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVStringArray>(attr_name));
+    }
+  else if (ccs::HelperTools::Is<ccs::types::CompoundArray>(attr_type))
+    {
+      log_debug("PVStructToAnyValue - .. is array of struct");
+      status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVStructureArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVStructureArray>(attr_name));
+    }
+#else
+  else if (ccs::HelperTools::Is<ccs::types::ArrayType>(attr_type))
+    {
+      std::shared_ptr<const ccs::types::AnyType> elem_type = std::dynamic_pointer_cast<const ccs::types::ArrayType>(attr_type)->GetElementType();
 
-      if (ccs::HelperTools::Is<ccs::types::ScalarType>(attr_type))
+      if (ccs::HelperTools::Is<ccs::types::CompoundType>(elem_type))
 	{
-	  log_debug("PVStructToAnyValue - .. is scalar");
-	  if (ccs::types::Boolean == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVBoolean>>(&attr_value, inp_value->getSubField<epics::pvData::PVBoolean>(std::string(attr_name)));
-	  else if (ccs::types::SignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVByte>>(&attr_value, inp_value->getSubField<epics::pvData::PVByte>(std::string(attr_name)));
-	  else if (ccs::types::UnsignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVUByte>>(&attr_value, inp_value->getSubField<epics::pvData::PVUByte>(std::string(attr_name)));
-	  else if (ccs::types::SignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVShort>>(&attr_value, inp_value->getSubField<epics::pvData::PVShort>(std::string(attr_name)));
-	  else if (ccs::types::UnsignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVUShort>>(&attr_value, inp_value->getSubField<epics::pvData::PVUShort>(std::string(attr_name)));
-	  else if (ccs::types::SignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVInt>>(&attr_value, inp_value->getSubField<epics::pvData::PVInt>(std::string(attr_name)));
-	  else if (ccs::types::UnsignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVUInt>>(&attr_value, inp_value->getSubField<epics::pvData::PVUInt>(std::string(attr_name)));
-	  else if (ccs::types::SignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVLong>>(&attr_value, inp_value->getSubField<epics::pvData::PVLong>(std::string(attr_name)));
-	  else if (ccs::types::UnsignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVULong>>(&attr_value, inp_value->getSubField<epics::pvData::PVULong>(std::string(attr_name)));
-	  else if (ccs::types::Float32 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVFloat>>(&attr_value, inp_value->getSubField<epics::pvData::PVFloat>(std::string(attr_name)));
-	  else if (ccs::types::Float64 == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVDouble>>(&attr_value, inp_value->getSubField<epics::pvData::PVDouble>(std::string(attr_name)));
-	  else if (ccs::types::String == std::dynamic_pointer_cast<const ccs::types::ScalarType>(attr_type)) 
-	    status = PVScalarToAnyValue<std::shared_ptr<const epics::pvData::PVString>>(&attr_value, inp_value->getSubField<epics::pvData::PVString>(std::string(attr_name)));
+	  log_debug("PVStructToAnyValue - .. is array of struct");
+	  status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVStructureArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVStructureArray>(attr_name));
 	}
-#if 0
-      else if (ccs::HelperTools::Is<ccs::types::ScalarArray>(attr_type))
+      else 
 	{
 	  log_debug("PVStructToAnyValue - .. is array of scalar");
-	  if (ccs::types::Boolean == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  if (ccs::types::Boolean == elem_type)
 	    status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVBooleanArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVBooleanArray>(attr_name));
-	  else if (ccs::types::SignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::SignedInteger8 == elem_type) 
 	    status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVByteArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVByteArray>(attr_name));
-	  else if (ccs::types::UnsignedInteger8 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::UnsignedInteger8 == elem_type) 
 	    status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVUByteArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVUByteArray>(attr_name));
-	  else if (ccs::types::SignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::SignedInteger16 == elem_type) 
 	    status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVShortArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVShortArray>(attr_name));
-	  else if (ccs::types::UnsignedInteger16 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::UnsignedInteger16 == elem_type) 
 	    status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVUShortArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVUShortArray>(attr_name));
-	  else if (ccs::types::SignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::SignedInteger32 == elem_type) 
 	    status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVIntArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVIntArray>(attr_name));
-	  else if (ccs::types::UnsignedInteger32 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::UnsignedInteger32 == elem_type) 
 	    status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVUIntArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVUIntArray>(attr_name));
-	  else if (ccs::types::SignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::SignedInteger64 == elem_type) 
 	    status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVLongArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVLongArray>(attr_name));
-	  else if (ccs::types::UnsignedInteger64 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::UnsignedInteger64 == elem_type) 
 	    status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVULongArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVULongArray>(attr_name));
-	  else if (ccs::types::Float32 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::Float32 == elem_type) 
 	    status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVFloatArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVFloatArray>(attr_name));
-	  else if (ccs::types::Float64 == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::Float64 == elem_type) 
 	    status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVDoubleArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVDoubleArray>(attr_name));
-	  else if (ccs::types::String == std::dynamic_pointer_cast<const ccs::types::ScalarArray>(attr_type)->GetElementType()) 
+	  else if (ccs::types::String == elem_type) 
 	    status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVStringArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVStringArray>(attr_name));
+	  else
+	    status = false;
 	}
-      else if (ccs::HelperTools::Is<ccs::types::CompoundArray>(attr_type))
+    }
+#endif
+  else if (ccs::HelperTools::Is<ccs::types::CompoundType>(attr_type))
+    {
+      log_debug("PVStructToAnyValue - .. is struct");
+      status = PVStructToAnyValue(&attr_value, inp_value->getSubField<epics::pvData::PVStructure>(attr_name));
+    }
+  else
+    {
+      log_error("PVStructToAnyValue - .. is of unknown type");
+      status = false;
+    }
+
+  return status;
+
+}
+
+static inline bool PVStructToAnyValue (ccs::types::AnyValue* out_value,
+				       const std::shared_ptr<const epics::pvData::PVStructure>& inp_value)
+{
+
+  std::shared_ptr<const ccs::types::AnyType> type = out_value->GetType();
+  std::shared_ptr<const ccs::types::CompoundType> out_type;
+
+  bool status = ccs::HelperTools::Is<ccs::types::CompoundType>(type);
+
+  if (status)
+    {
+      out_type = std::dynamic_pointer_cast<const ccs::types::CompoundType>(type);
+      status = (out_type ? true : false);
+    }
+
+  std::shared_ptr<const ccs::base::PVAConversionPlan> plan;
+
+  if (status)
+    { // Cached conversion plan for this pair of types
+      plan = ccs::base::PVAConversionPlan::GetInstance(inp_value->getStructure(), type);
+    }
+
+  bool planned = (status && plan);
+
+  if (planned)
+    {
+      status = plan->ToAnyValue(out_value->GetInstance(), *inp_value);
+    }
+
+  for (ccs::types::uint32 index = 0u; (status && !planned && (index < out_type->GetAttributeNumber())); index += 1u)
+    {
+      const char* attr_name = out_type->GetAttributeName(index);
+      void* attr_inst = ccs::HelperTools::GetAttributeReference(out_value, attr_name);
+      std::shared_ptr<const ccs::types::AnyType> attr_type = ccs::HelperTools::GetAttributeType(out_value, attr_name);
+
+      log_debug("PVStructToAnyValue - Attribute '%s' with type '%s' ..", attr_name, attr_type->GetName());
+
+      ccs::types::AnyValue attr_value (attr_type, attr_inst); // Sub-structure reference
+
+      status = PVAttributeToAnyValue(attr_value, inp_value, attr_name);
+    }
+
+  return status;
+
+}
+
+static inline bool PVStructToAnyValue (ccs::types::AnyValue* out_value,
+				       const std::shared_ptr<const epics::pvData::PVStructure>& inp_value,
+				       const epics::pvData::BitSet& changed)
+{
+
+  bool status = (inp_value ? true : false);
+
+  std::shared_ptr<const ccs::base::PVAConversionPlan> plan;
+
+  if (status)
+    { // Cached conversion plan for this pair of types
+      plan = ccs::base::PVAConversionPlan::GetInstance(inp_value->getStructure(), out_value->GetType());
+    }
+
+  bool planned = (status && plan);
+
+  if (planned)
+    {
+      status = plan->ToAnyValue(out_value->GetInstance(), *inp_value, changed);
+    }
+
+  bool whole = (status && !planned && changed.get(inp_value->getFieldOffset()));
+
+  if (whole)
+    { // Whole structure changed
+      status = PVStructToAnyValue(out_value, inp_value);
+    }
+
+  std::shared_ptr<const ccs::types::CompoundType> out_type;
+
+  if (status && !planned && !whole)
+    {
+      out_type = std::dynamic_pointer_cast<const ccs::types::CompoundType>(out_value->GetType());
+      status = (out_type ? true : false);
+    }
+
+  for (ccs::types::uint32 index = 0u; (status && !planned && !whole && (index < out_type->GetAttributeNumber())); index += 1u)
+    {
+      const char* attr_name = out_type->GetAttributeName(index);
+      std::shared_ptr<const epics::pvData::PVField> field = inp_value->getSubField(attr_name);
+
+      status = (field ? true : false);
+
+      if (!status)
 	{
-	  log_debug("PVStructToAnyValue - .. is array of struct");
-	  status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVStructureArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVStructureArray>(attr_name));
+	  break;
 	}
-#else
-      else if (ccs::HelperTools::Is<ccs::types::ArrayType>(attr_type))
+
+      ccs::types::uint32 offset = static_cast<ccs::types::uint32>(field->getFieldOffset());
+      ccs::types::int32 next = changed.nextSetBit(offset);
+
+      if ((next < 0) || (static_cast<ccs::types::uint32>(next) >= static_cast<ccs::types::uint32>(field->getNextFieldOffset())))
 	{
-	  std::shared_ptr<const ccs::types::AnyType> elem_type = std::dynamic_pointer_cast<const ccs::types::ArrayType>(attr_type)->GetElementType();
-
-	  if (ccs::HelperTools::Is<ccs::types::CompoundType>(elem_type))
-	    {
-	      log_debug("PVStructToAnyValue - .. is array of struct");
-	      status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVStructureArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVStructureArray>(attr_name));
-	    }
-	  else 
-	    {
-	      log_debug("PVStructToAnyValue - .. is array of scalar");
-	      if (ccs::types::Boolean == elem_type)
-		status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVBooleanArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVBooleanArray>(attr_name));
-	      else if (ccs::types::SignedInteger8 == elem_type) 
-		status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVByteArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVByteArray>(attr_name));
-	      else if (ccs::types::UnsignedInteger8 == elem_type) 
-		status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVUByteArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVUByteArray>(attr_name));
-	      else if (ccs::types::SignedInteger16 == elem_type) 
-		status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVShortArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVShortArray>(attr_name));
-	      else if (ccs::types::UnsignedInteger16 == elem_type) 
-		status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVUShortArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVUShortArray>(attr_name));
-	      else if (ccs::types::SignedInteger32 == elem_type) 
-		status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVIntArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVIntArray>(attr_name));
-	      else if (ccs::types::UnsignedInteger32 == elem_type) 
-		status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVUIntArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVUIntArray>(attr_name));
-	      else if (ccs::types::SignedInteger64 == elem_type) 
-		status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVLongArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVLongArray>(attr_name));
-	      else if (ccs::types::UnsignedInteger64 == elem_type) 
-		status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVULongArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVULongArray>(attr_name));
-	      else if (ccs::types::Float32 == elem_type) 
-		status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVFloatArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVFloatArray>(attr_name));
-	      else if (ccs::types::Float64 == elem_type) 
-		status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVDoubleArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVDoubleArray>(attr_name));
-	      else if (ccs::types::String == elem_type) 
-		status = PVArrayToAnyValue<std::shared_ptr<const epics::pvData::PVStringArray>>(&attr_value, inp_value->getSubField<epics::pvData::PVStringArray>(attr_name));
-	      else
-		status = false;
-	    }
+	  continue; // Attribute unchanged
 	}
-#endif
-      else if (ccs::HelperTools::Is<ccs::types::CompoundType>(attr_type))
-	{
-	  log_debug("PVStructToAnyValue - .. is struct");
-	  status = PVStructToAnyValue(&attr_value, inp_value->getSubField<epics::pvData::PVStructure>(attr_name));
+
+      ccs::types::AnyValue attr_value (ccs::HelperTools::GetAttributeType(out_value, attr_name), ccs::HelperTools::GetAttributeReference(out_value, attr_name)); // Sub-structure reference
+
+      if ((static_cast<ccs::types::uint32>(next) > offset) && ccs::HelperTools::Is<ccs::types::CompoundType>(attr_value.GetType()))
+	{ // Some nested attributes changed
+	  status = PVStructToAnyValue(&attr_value, inp_value->getSubField<epics::pvData::PVStructure>(attr_name), changed);
 	}
       else
 	{
-	  log_error("PVStructToAnyValue - .. is of unknown type");
-	  status = false;
+	  status = PVAttributeToAnyValue(attr_value, inp_value, attr_name);
 	}
     }
 
   return status;
 
 }
+
   
 } // namespace HelperTools
 
@@ -25,7 +25,9 @@
 
 // Global header files
 
+#include <atomic> // std::atomic
 #include <new> // std::nothrow
+#include <vector> // std::vector
 
 #include <pv/pvData.h>
 #include <pva/client.h>
@@ -42,13 +44,13 @@
 //#undef LOG_DEBUG_ENABLE
 #include <log-api.h> // Syslog wrapper routines
 
-#include <lu-table.h> // Look-up table class definition, etc.
-
 #include <AnyObject.h> // Abstract base class definition ..
 #include <ObjectDatabase.h> // .. associated object database
 
 #include <any-thread.h> // Thread management class
 
+#include <VariableCache.h> // Variable cache shared with the application
+
 #include <AnyValue.h> // Variable with introspectable data type ..
 #include <AnyValueHelper.h> // .. associated helper routines
 
@@ -63,6 +65,7 @@
 
 #define DEFAULT_PVAINTERFACE_THREAD_PERIOD 10000000ul // 100Hz
 #define DEFAULT_PVAINTERFACE_INSTANCE_NAME "pvac-if"
+#define DEFAULT_PVAINTERFACE_OPER_TIMEOUT 3000000000ul // 3s, as synchronous get operations
 
 #define MAXIMUM_VARIABLE_NUM 256
 
@@ -79,6 +82,8 @@ namespace ccs {
 
 namespace base {
 
+struct MonitorCallback; // Forward declaration
+
 class PVAccessClient_Impl : public AnyObject
 {
 
@@ -97,24 +102,30 @@ class PVAccessClient_Impl : public AnyObject
 
     pvac::ClientProvider* channelProvider;
 
+    VariableCache* m_cache; // Variable cache shared with the application
+
     bool m_initialized;
 
     typedef struct VariableInfo {
 
-      bool update;
       ccs::types::DirIdentifier direction;
       
       ccs::types::string name;
-      ccs::types::AnyValue* value; // Introspectable structured variable
+      VariableCache::Handle_t handle;
+      ccs::types::AnyValue* value; // PVA thread copy of the cached variable for put operations ..
+      ccs::types::AnyValue* input; // .. and get or monitor notifications
       std::shared_ptr<epics::pvData::PVStructure> pvvalue; // Equivalent PVA introspectable structure
       pvac::ClientChannel* channel; 
+      MonitorCallback* monitor; // Input variables are updated through monitor, if possible
+
+      PVAccessClient_Impl* self;
 
     } VariableInfo_t;
 
-    LUTable<VariableInfo_t>* m_var_table;
+    std::vector<VariableInfo_t> m_var_table; // Indexed by variable cache handle
 
     // Initializer methods
-    bool AddVariable (const char* name, ccs::types::DirIdentifier direction, const ccs::types::AnyType* type);
+    bool AddVariable (const char* name, ccs::types::DirIdentifier direction, const std::shared_ptr<const ccs::types::AnyType>& type);
     bool AddVariable (const char* name, ccs::types::DirIdentifier direction, const ccs::types::AnyValue* value);
 
     bool SetPeriod (ccs::types::uint64 period);
@@ -129,9 +140,13 @@ class PVAccessClient_Impl : public AnyObject
     ccs::types::AnyValue* GetVariable (ccs::types::uint32 id) const;
     ccs::types::AnyValue* GetVariable (const char* name) const;
 
+    bool GetVariable (ccs::types::uint32 id, void* buffer, ccs::types::uint32 size) const;
+
     std::shared_ptr<const ccs::types::AnyType> GetVariableType (ccs::types::uint32 id) const;
     std::shared_ptr<const ccs::types::AnyType> GetVariableType (const char* name) const;
 
+    bool SetVariable (ccs::types::uint32 id, const void* buffer, ccs::types::uint32 size);
+
     void UpdateVariable (ccs::types::uint32 id);
     void UpdateVariable (const char* name);
 
@@ -148,15 +163,17 @@ class PVAccessClient_Impl : public AnyObject
 struct PutCallback : public pvac::ClientChannel::PutCallback
 {
 
-  ccs::base::PVAccessClient_Impl::VariableInfo_t __variable;
+  ccs::base::PVAccessClient_Impl::VariableInfo_t* __variable; // In-place access
   pvac::Operation* __oper;
-  bool __done;
+  std::atomic<bool> __done; // Set by the PVA callback
   bool __stat;
 
   PutCallback (ccs::base::PVAccessClient_Impl::VariableInfo_t& variable);
   virtual ~PutCallback (void);
 
   bool Put (void); // Synchronous put operation
+  bool Start (void); // Issue put operation ..
+  bool Wait (const ccs::types::uint64 timeout = DEFAULT_PVAINTERFACE_OPER_TIMEOUT); // .. and wait for completion
 
   // The callbacks
   virtual void putBuild(const std::shared_ptr<const epics::pvData::Structure>& build, pvac::ClientChannel::PutCallback::Args& args);
@@ -164,6 +181,41 @@ struct PutCallback : public pvac::ClientChannel::PutCallback
 
 };
 
+struct GetCallback : public pvac::ClientChannel::GetCallback
+{
+
+  ccs::base::PVAccessClient_Impl::VariableInfo_t* __variable; // In-place access
+  pvac::Operation* __oper;
+  std::atomic<bool> __done; // Set by the PVA callback
+  bool __stat;
+
+  GetCallback (ccs::base::PVAccessClient_Impl::VariableInfo_t& variable);
+  virtual ~GetCallback (void);
+
+  bool Start (void); // Issue get operation ..
+  bool Wait (const ccs::types::uint64 timeout = DEFAULT_PVAINTERFACE_OPER_TIMEOUT); // .. and wait for completion
+
+  // The callbacks
+  virtual void getDone(const pvac::GetEvent& evt);
+
+};
+
+struct MonitorCallback : public pvac::ClientChannel::MonitorCallback
+{
+
+  ccs::base::PVAccessClient_Impl::VariableInfo_t* __variable; // In-place access
+  pvac::Monitor __monitor;
+
+  MonitorCallback (ccs::base::PVAccessClient_Impl::VariableInfo_t& variable);
+  virtual ~MonitorCallback (void);
+
+  bool Start (void); // Install monitor
+
+  // The callbacks
+  virtual void monitorEvent(const pvac::MonitorEvent& evt);
+
+};
+
 // Global variables
 
 namespace PVAccessInterface {
@@ -176,13 +228,22 @@ PVAccessClient* __pvac_if = static_cast<PVAccessClient*>(NULL);
 
 // Function definition
 
+static inline ccs::types::uint64 GetRemaining (const ccs::types::uint64 till)
+{
+
+  ccs::types::uint64 time = ccs::HelperTools::GetCurrentTime();
+
+  return ((time < till) ? (till - time) : 0ul);
+
+}
+
 PutCallback::PutCallback (ccs::base::PVAccessClient_Impl::VariableInfo_t& variable)
 {
 
   __done = false;
   __stat = false;
   __oper = static_cast<pvac::Operation*>(NULL);
-  __variable = variable;
+  __variable = &variable;
 
   return;
 
@@ -193,8 +254,9 @@ PutCallback::~PutCallback (void)
  
   if (static_cast<pvac::Operation*>(NULL) != __oper) 
     {
-      __oper->cancel(); 
-      while (static_cast<pvac::Operation*>(NULL) != __oper) ccs::HelperTools::SleepFor(10000ul);
+      __oper->cancel(); // No callback past this point
+      delete __oper;
+      __oper = static_cast<pvac::Operation*>(NULL);
     }
 
   return;
@@ -202,20 +264,62 @@ PutCallback::~PutCallback (void)
 }
 
 bool PutCallback::Put (void) // Synchronous put operation
+{
+
+  bool status = this->Start();
+
+  if (status)
+    {
+      status = this->Wait();
+    }
+
+  return status;
+
+}
+
+bool PutCallback::Start (void)
 {
 
   bool status = (static_cast<pvac::Operation*>(NULL) == __oper);
 
   if (status)
     {
-      __oper = new (std::nothrow) pvac::Operation ((__variable.channel)->put(this));
+      __done = false;
+      __stat = false;
+      try
+	{
+	  __oper = new (std::nothrow) pvac::Operation ((__variable->channel)->put(this));
+	}
+      catch (std::exception& e)
+	{
+	  log_warning("Put '%s' failed with '%s'", __variable->name, e.what());
+	}
+
       status = (static_cast<pvac::Operation*>(NULL) != __oper);
     }
 
+  return status;
+
+}
+
+bool PutCallback::Wait (const ccs::types::uint64 timeout)
+{
+
+  bool status = (static_cast<pvac::Operation*>(NULL) != __oper);
+
   if (status)
     {
-      while (false == __done) ccs::HelperTools::SleepFor(10000ul);
-      status = (true == __stat);
+      ccs::types::uint64 till = ccs::HelperTools::GetCurrentTime() + timeout;
+
+      while ((false == __done) && (ccs::HelperTools::GetCurrentTime() < till)) ccs::HelperTools::SleepFor(10000ul);
+
+      if (false == __done)
+	{
+	  log_warning("Put '%s' timed out", __variable->name);
+	  __oper->cancel(); // No callback past this point
+	}
+
+      status = ((true == __done) && (true == __stat));
     }
 
   delete __oper;
@@ -235,10 +339,10 @@ void PutCallback::putBuild(const std::shared_ptr<const epics::pvData::Structure>
   //   - build, the type returned for the channel from the server .. we already have it in case the channel was added to the cache without type specification
   //   - args, the structure to write
 
-  //std::shared_ptr<epics::pvData::PVStructure> pvvalue = epics::pvData::getPVDataCreate()->createPVStructure(ccs::HelperTools::AnyTypeToPVStruct((__variable.value)->GetType()));
+  //std::shared_ptr<epics::pvData::PVStructure> pvvalue = epics::pvData::getPVDataCreate()->createPVStructure(ccs::HelperTools::AnyTypeToPVStruct((__variable->value)->GetType()));
   //std::shared_ptr<epics::pvData::PVStructure> pvvalue = epics::pvData::getPVDataCreate()->createPVStructure(build);
 
-  args.root = __variable.pvvalue;
+  args.root = __variable->pvvalue;
   args.tosend.set(0);
 
   return;
@@ -270,6 +374,189 @@ void PutCallback::putDone(const pvac::PutEvent& evt)
 
 }
 
+GetCallback::GetCallback (ccs::base::PVAccessClient_Impl::VariableInfo_t& variable)
+{
+
+  __done = false;
+  __stat = false;
+  __oper = static_cast<pvac::Operation*>(NULL);
+  __variable = &variable;
+
+  return;
+
+}
+
+GetCallback::~GetCallback (void) 
+{
+ 
+  if (static_cast<pvac::Operation*>(NULL) != __oper) 
+    {
+      __oper->cancel(); // No callback past this point
+      delete __oper;
+      __oper = static_cast<pvac::Operation*>(NULL);
+    }
+
+  return;
+
+}
+
+bool GetCallback::Start (void)
+{
+
+  bool status = (static_cast<pvac::Operation*>(NULL) == __oper);
+
+  if (status)
+    {
+      __done = false;
+      __stat = false;
+      try
+	{
+	  __oper = new (std::nothrow) pvac::Operation ((__variable->channel)->get(this));
+	}
+      catch (std::exception& e)
+	{
+	  log_warning("Get '%s' failed with '%s'", __variable->name, e.what());
+	}
+
+      status = (static_cast<pvac::Operation*>(NULL) != __oper);
+    }
+
+  return status;
+
+}
+
+bool GetCallback::Wait (const ccs::types::uint64 timeout)
+{
+
+  bool status = (static_cast<pvac::Operation*>(NULL) != __oper);
+
+  if (status)
+    {
+      ccs::types::uint64 till = ccs::HelperTools::GetCurrentTime() + timeout;
+
+      while ((false == __done) && (ccs::HelperTools::GetCurrentTime() < till)) ccs::HelperTools::SleepFor(10000ul);
+
+      if (false == __done)
+	{
+	  log_warning("Get '%s' timed out", __variable->name);
+	  __oper->cancel(); // No callback past this point
+	}
+
+      status = ((true == __done) && (true == __stat));
+    }
+
+  delete __oper;
+
+  __done = false;
+  __stat = false;
+  __oper = static_cast<pvac::Operation*>(NULL);
+
+  return status;
+
+}
+
+void GetCallback::getDone(const pvac::GetEvent& evt)
+{
+
+  __stat = false;
+
+  switch(evt.event) 
+    {
+      case pvac::GetEvent::Fail:
+	log_warning("Get '%s' failed with '%s'", __variable->name, evt.message.c_str());
+	break;
+      case pvac::GetEvent::Cancel:
+	log_warning("Get '%s' cancelled", __variable->name);
+	break;
+      case pvac::GetEvent::Success:
+	// Update variable cache
+	__stat = ccs::HelperTools::PVStructToAnyValue(__variable->input, evt.value);
+
+	if (__stat)
+	  {
+	    __stat = ((__variable->self)->m_cache)->NotifyValue(__variable->handle, *(__variable->input));
+	  }
+	break;
+    }
+
+  __done = true;
+
+  return;
+
+}
+
+MonitorCallback::MonitorCallback (ccs::base::PVAccessClient_Impl::VariableInfo_t& variable)
+{
+
+  __variable = &variable;
+
+  return;
+
+}
+
+MonitorCallback::~MonitorCallback (void) 
+{
+ 
+  __monitor.cancel(); 
+
+  return;
+
+}
+
+bool MonitorCallback::Start (void)
+{
+
+  bool status = (static_cast<ccs::types::AnyValue*>(NULL) != __variable->input);
+
+  if (status)
+    {
+      try
+	{
+	  __monitor = (__variable->channel)->monitor(this); // pvac::ClientChannel::MonitorCallback (this)
+	}
+      catch (std::exception& e)
+	{
+	  status = false;
+	}
+    }
+
+  return status;
+
+}
+
+void MonitorCallback::monitorEvent(const pvac::MonitorEvent& evt)
+{
+
+  switch (evt.event)
+    {
+      case pvac::MonitorEvent::Fail:
+	log_warning("Monitor '%s' failed with '%s'", __variable->name, evt.message.c_str());
+	break;
+      case pvac::MonitorEvent::Cancel:
+	break;
+      case pvac::MonitorEvent::Disconnect:
+	log_warning("Monitor '%s' disconnected", __variable->name);
+	break;
+      case pvac::MonitorEvent::Data:
+	// Update variable cache with queued updates
+	while (__monitor.poll())
+	  {
+	    if (!ccs::HelperTools::PVStructToAnyValue(__variable->input, __monitor.root))
+	      {
+		log_warning("ccs::HelperTools::PVStructToAnyValue failed for '%s'", __variable->name);
+	      }
+	    else
+	      {
+		(void)((__variable->self)->m_cache)->NotifyValue(__variable->handle, *(__variable->input));
+	      }
+	  }
+	break;
+    }
+
+  return;
+
+}
+
 } // namespace base
 
 } // namespace ccs
@@ -286,20 +573,22 @@ void PVAccessInterface_Thread_PRBL (ccs::base::PVAccessClient_Impl* self)
   bool status = (static_cast<pvac::ClientProvider*>(NULL) != self->channelProvider);
 
   log_info("Create PVA channels");
-  for (ccs::types::uint32 index = 0u; (status && (index < (self->m_var_table)->GetSize())); index += 1u)
+  for (ccs::types::uint32 index = 0u; (status && (index < self->m_var_table.size())); index += 1u)
     {
 
-      ccs::base::PVAccessClient_Impl::VariableInfo_t varInfo; 
-      (self->m_var_table)->GetValue(varInfo, index);
+      // In-place access, i.e. the variable information is referenced by PVA callbacks
+      ccs::base::PVAccessClient_Impl::VariableInfo_t* varInfo = &(self->m_var_table[index]);
 
-      varInfo.channel = new (std::nothrow) pvac::ClientChannel ((self->channelProvider)->connect(varInfo.name));
+      varInfo->channel = new (std::nothrow) pvac::ClientChannel ((self->channelProvider)->connect(varInfo->name));
 
-      status = (static_cast<pvac::ClientChannel*>(NULL) != varInfo.channel);
+      status = (static_cast<pvac::ClientChannel*>(NULL) != varInfo->channel);
 
-      if (static_cast<ccs::types::AnyValue*>(NULL) != varInfo.value)
+      std::shared_ptr<const ccs::types::AnyType> type = self->m_cache->GetType(varInfo->handle);
+
+      if (type)
 	{
-	  varInfo.pvvalue = epics::pvData::getPVDataCreate()->createPVStructure(ccs::HelperTools::AnyTypeToPVStruct((varInfo.value)->GetType()));
-	  status = (varInfo.pvvalue ? true : false);
+	  varInfo->pvvalue = epics::pvData::getPVDataCreate()->createPVStructure(ccs::HelperTools::AnyTypeToPVStruct(type));
+	  status = (varInfo->pvvalue ? true : false);
 	}
       else
 	{
@@ -307,9 +596,9 @@ void PVAccessInterface_Thread_PRBL (ccs::base::PVAccessClient_Impl* self)
 	  try
 	    {
 	      // Retrieve channel type
-	      log_info("Try and retrieve channel '%s' type ..", varInfo.name);
-	      varInfo.pvvalue = std::const_pointer_cast<epics::pvData::PVStructure>((varInfo.channel)->get());
-	      varInfo.value = new (std::nothrow) ccs::types::AnyValue (ccs::HelperTools::PVStructToAnyType((varInfo.pvvalue)->getStructure()));
+	      log_info("Try and retrieve channel '%s' type ..", varInfo->name);
+	      varInfo->pvvalue = std::const_pointer_cast<epics::pvData::PVStructure>((varInfo->channel)->get());
+	      type = ccs::HelperTools::PVStructToAnyType((varInfo->pvvalue)->getStructure());
 	    }
 	  catch (std::exception& e)
 	    {
@@ -317,10 +606,38 @@ void PVAccessInterface_Thread_PRBL (ccs::base::PVAccessClient_Impl* self)
 	      log_warning(".. exception caught");
 	      continue;
 	    }
+
+	  // Type the cached variable
+	  if (!self->m_cache->SetType(varInfo->handle, type))
+	    {
+	      log_warning(".. unable to type variable '%s'", varInfo->name);
+	      varInfo->pvvalue.reset();
+	      continue;
+	    }
+	}
+
+      // PVA thread copies of the cached variable
+      if (status)
+	{
+	  varInfo->value = new (std::nothrow) ccs::types::AnyValue (type);
+	  varInfo->input = new (std::nothrow) ccs::types::AnyValue (type);
+	  status = ((static_cast<ccs::types::AnyValue*>(NULL) != varInfo->value) && 
+		    (static_cast<ccs::types::AnyValue*>(NULL) != varInfo->input));
 	}
 
-      // Store for future use
-      (self->m_var_table)->SetValue(varInfo, index);
+      // Serve input variables through monitor
+      if (status && (varInfo->direction != ccs::types::OutputVariable))
+	{
+	  log_info("Install monitor for channel '%s'", varInfo->name);
+	  varInfo->monitor = new (std::nothrow) ccs::base::MonitorCallback (*varInfo);
+
+	  if ((static_cast<ccs::base::MonitorCallback*>(NULL) != varInfo->monitor) && !(varInfo->monitor)->Start())
+	    {
+	      log_warning(".. failed - Revert to get operations");
+	      delete varInfo->monitor;
+	      varInfo->monitor = static_cast<ccs::base::MonitorCallback*>(NULL);
+	    }
+	}
 
     }
 
@@ -339,63 +656,111 @@ void PVAccessInterface_Thread_CB (ccs::base::PVAccessClient_Impl* self)
 
   bool status = self->m_initialized;
 
-  for (ccs::types::uint32 index = 0; (status && (index < (self->m_var_table)->GetSize())); index += 1)
+  std::vector<ccs::base::PutCallback*> puts;
+  std::vector<ccs::base::GetCallback*> gets;
+
+  std::vector<ccs::base::VariableCache::Handle_t> deferred;
+
+  ccs::base::VariableCache::Handle_t handle = VARIABLECACHE_INVALID_HANDLE;
+
+  // Issue put operations for variables queued for update by the application, at most once per cycle each ..
+  for (ccs::types::uint32 count = 0u; (status && (count < self->m_var_table.size()) && self->m_cache->PopUpdate(handle)); count += 1u)
     {
 
-      ccs::base::PVAccessClient_Impl::VariableInfo_t varInfo;
-      (self->m_var_table)->GetValue(varInfo, index);
+      ccs::base::PVAccessClient_Impl::VariableInfo_t* varInfo = &(self->m_var_table[handle]);
+
+      if (varInfo->direction == ccs::types::InputVariable)
+	{
+	  continue; // Inputs are managed through monitor or get operations
+	}
 
-      if ((varInfo.direction != ccs::types::InputVariable) && varInfo.update)
+      if ((static_cast<ccs::types::AnyValue*>(NULL) == varInfo->value) || !varInfo->pvvalue)
 	{
+	  deferred.push_back(handle); // Channel not (yet) typed
+	  continue;
+	}
 
-	  log_info("Update PVA record '%s'", varInfo.name);
+      log_debug("Update PVA record '%s'", varInfo->name);
 
-	  status = ccs::HelperTools::AnyValueToPVStruct(varInfo.value, varInfo.pvvalue);
+      ccs::base::PutCallback* cb = static_cast<ccs::base::PutCallback*>(NULL);
 
-	  if (status)
-	    {
-	      ccs::base::PutCallback cb (varInfo);
-	      status = cb.Put();
-	    }
+      // Consistent copy out of the cache
+      if (self->m_cache->GetValue(handle, *(varInfo->value)) && 
+	  ccs::HelperTools::AnyValueToPVStruct(varInfo->value, varInfo->pvvalue))
+	{
+	  cb = new (std::nothrow) ccs::base::PutCallback (*varInfo);
+	}
 
-	  varInfo.update = false;
+      if ((static_cast<ccs::base::PutCallback*>(NULL) != cb) && cb->Start())
+	{
+	  puts.push_back(cb);
+	}
+      else
+	{
+	  log_warning("Unable to update PVA record '%s'", varInfo->name);
+	  delete cb;
+	}
+
+    }
 
-	  // Store for future use
-	  (self->m_var_table)->SetValue(varInfo, index);
+  // .. and get operations for input variables without monitor
+  for (ccs::types::uint32 index = 0u; (status && (index < self->m_var_table.size())); index += 1u)
+    {
+
+      ccs::base::PVAccessClient_Impl::VariableInfo_t* varInfo = &(self->m_var_table[index]);
 
+      if ((static_cast<ccs::types::AnyValue*>(NULL) == varInfo->input) || !varInfo->pvvalue)
+	{
+	  continue; // Channel not (yet) typed
 	}
 
-      if (varInfo.direction != ccs::types::OutputVariable)
+      if ((varInfo->direction != ccs::types::OutputVariable) && (static_cast<ccs::base::MonitorCallback*>(NULL) == varInfo->monitor))
 	{
-	  log_debug("Read PVA record '%s' ..", varInfo.name);
+	  log_debug("Read PVA record '%s' ..", varInfo->name);
 
-	  try
+	  ccs::base::GetCallback* cb = new (std::nothrow) ccs::base::GetCallback (*varInfo);
+
+	  if ((static_cast<ccs::base::GetCallback*>(NULL) != cb) && cb->Start())
 	    {
-	      // Update variable cache
-	      varInfo.pvvalue = std::const_pointer_cast<epics::pvData::PVStructure>((varInfo.channel)->get());
-
-	      status = ccs::HelperTools::PVStructToAnyValue(varInfo.value, varInfo.pvvalue);
-
-	      if (status)
-		{
-		  char buffer [1024];
-		  (varInfo.value)->SerialiseInstance(buffer, 1024u);
-		  log_debug(".. '%s'", buffer);
-		}
-	      else
-		{
-		  log_warning("ccs::HelperTools::PVStructToAnyValue failed for '%s'", varInfo.name);
-		}
+	      gets.push_back(cb);
 	    }
-	  catch (std::exception& e)
+	  else
 	    {
-	      //status = false;
-	      continue;
+	      delete cb;
 	    }
 	}
 
     }
 
+  // .. and wait for completion, the cycle being bounded by a single deadline
+  ccs::types::uint64 till = ccs::HelperTools::GetCurrentTime() + DEFAULT_PVAINTERFACE_OPER_TIMEOUT;
+
+  for (std::vector<ccs::base::PutCallback*>::iterator it = puts.begin(); it != puts.end(); ++it)
+    {
+      if (!(*it)->Wait(GetRemaining(till)))
+	{
+	  log_warning("Put failed for '%s'", ((*it)->__variable)->name);
+	}
+
+      delete *it;
+    }
+
+  for (std::vector<ccs::base::GetCallback*>::iterator it = gets.begin(); it != gets.end(); ++it)
+    {
+      if (!(*it)->Wait(GetRemaining(till)))
+	{
+	  log_debug("Get failed for '%s'", ((*it)->__variable)->name);
+	}
+
+      delete *it;
+    }
+
+  // Queue again updates which could not be issued
+  for (std::vector<ccs::base::VariableCache::Handle_t>::iterator it = deferred.begin(); it != deferred.end(); ++it)
+    {
+      (void)self->m_cache->PushUpdate(*it);
+    }
+
   log_trace("Leaving '%s' routine", __FUNCTION__);
 
   return;
@@ -417,34 +782,42 @@ namespace base {
  
 bool PVAccessClient::AddVariable (const char* name, ccs::types::DirIdentifier direction, const ccs::types::AnyType* type)
 {
-  return __impl->AddVariable(name, direction, type);
+
+  std::shared_ptr<const ccs::types::AnyType> __type; // Untyped variable, if NULL
+
+  if (static_cast<const ccs::types::AnyType*>(NULL) != type)
+    {
+      __type = std::shared_ptr<const ccs::types::AnyType> (type);
+    }
+
+  return __impl->AddVariable(name, direction, __type);
+
 }
 
-bool PVAccessClient_Impl::AddVariable (const char* name, ccs::types::DirIdentifier direction, const ccs::types::AnyType* type)
+bool PVAccessClient_Impl::AddVariable (const char* name, ccs::types::DirIdentifier direction, const std::shared_ptr<const ccs::types::AnyType>& type)
 {
 
   VariableInfo_t varInfo;
 
-  varInfo.update = false;
   varInfo.direction = direction;
+  varInfo.value = static_cast<ccs::types::AnyValue*>(NULL);
+  varInfo.input = static_cast<ccs::types::AnyValue*>(NULL);
+  varInfo.channel = static_cast<pvac::ClientChannel*>(NULL);
+  varInfo.monitor = static_cast<MonitorCallback*>(NULL);
+  varInfo.self = this;
   ccs::HelperTools::SafeStringCopy(varInfo.name, name, sizeof(ccs::types::string));
 
-  bool status = (static_cast<const ccs::types::AnyType*>(NULL) != type);
+  bool status = (static_cast<VariableCache*>(NULL) != this->m_cache);
 
   if (status)
     {
-      varInfo.value = new (std::nothrow) ccs::types::AnyValue (type);
-      status = (static_cast<ccs::types::AnyValue*>(NULL) != varInfo.value);
-    }
-  else
-    {
-      varInfo.value = static_cast<ccs::types::AnyValue*>(NULL);
-      status = true;
+      status = (this->m_cache)->AddVariable(name, direction, type);
     }
 
   if (status)
     {
-      status = (this->m_var_table)->AddPair(name, varInfo);
+      varInfo.handle = (this->m_cache)->GetHandle(name);
+      (this->m_var_table).push_back(varInfo); // Indexed by handle
     }
 
   return status;
@@ -454,14 +827,19 @@ bool PVAccessClient_Impl::AddVariable (const char* name, ccs::types::DirIdentifi
 bool PVAccessClient_Impl::AddVariable (const char* name, ccs::types::DirIdentifier direction, const ccs::types::AnyValue* value)
 {
 
-  VariableInfo_t varInfo;
+  bool status = (static_cast<const ccs::types::AnyValue*>(NULL) != value);
 
-  varInfo.update = false;
-  varInfo.direction = direction;
-  ccs::HelperTools::SafeStringCopy(varInfo.name, name, sizeof(ccs::types::string));
-  varInfo.value = const_cast<ccs::types::AnyValue*>(value);
+  if (status)
+    {
+      status = this->AddVariable(name, direction, value->GetType());
+    }
+
+  if (status)
+    { // Initial value
+      status = (this->m_cache)->SetValue(this->GetVariableId(name), *value);
+    }
 
-  return (this->m_var_table)->AddPair(name, varInfo);
+  return status;
 
 }
 
@@ -470,7 +848,7 @@ void PVAccessClient_Impl::Initialize (void)
 
   // Initialize resources
   this->m_sleep = DEFAULT_PVAINTERFACE_THREAD_PERIOD;
-  this->m_var_table = new LUTable<VariableInfo_t> (MAXIMUM_VARIABLE_NUM); // The table will be filled with application-specific variable list
+  this->m_cache = new (std::nothrow) VariableCache (MAXIMUM_VARIABLE_NUM); // The cache will be filled with application-specific variable list
   this->m_initialized = false;
 
   this->m_thread = new ccs::base::AnyThread ("PVA Interface"); 
@@ -494,22 +872,30 @@ bool PVAccessClient_Impl::Launch (void) { return ((this->m_thread)->Launch() ==
 
 bool PVAccessClient::IsValid (const char* name) const { return __impl->IsValid(name); }
 
-bool PVAccessClient_Impl::IsValid (ccs::types::uint32 id) const { return ((this->m_var_table)->IsValid(id) == STATUS_SUCCESS); }
-bool PVAccessClient_Impl::IsValid (const char* name) const { return ((this->m_var_table)->IsValid(name) == STATUS_SUCCESS); }
+bool PVAccessClient_Impl::IsValid (ccs::types::uint32 id) const { return (this->m_cache)->IsValid(id); }
+bool PVAccessClient_Impl::IsValid (const char* name) const { return (this->m_cache)->IsValid(name); }
 
-ccs::types::uint32 PVAccessClient_Impl::GetVariableId (const char* name) const { ccs::types::uint32 id = 0; (this->m_var_table)->GetIndex(name, id); return id; }
+ccs::types::uint32 PVAccessClient_Impl::GetVariableId (const char* name) const { return (this->m_cache)->GetHandle(name); }
 
 ccs::types::AnyValue* PVAccessClient::GetVariable (const char* name) const { return __impl->GetVariable(__impl->GetVariableId(name)); }
 
-ccs::types::AnyValue* PVAccessClient_Impl::GetVariable (ccs::types::uint32 id) const { VariableInfo_t varInfo; varInfo.value = static_cast<ccs::types::AnyValue*>(NULL); if (this->IsValid(id)) (this->m_var_table)->GetValue(varInfo, id); return varInfo.value; }
+ccs::types::AnyValue* PVAccessClient_Impl::GetVariable (ccs::types::uint32 id) const { return (this->m_cache)->GetSnapshot(id); }
 ccs::types::AnyValue* PVAccessClient_Impl::GetVariable (const char* name) const { return this->GetVariable(this->GetVariableId(name)); }
 
-std::shared_ptr<const ccs::types::AnyType> PVAccessClient_Impl::GetVariableType (ccs::types::uint32 id) const { std::shared_ptr<const ccs::types::AnyType> type; if (this->IsValid(id)) type = this->GetVariable(id)->GetType(); return type; };
+bool PVAccessClient::GetVariable (const char* name, void* buffer, ccs::types::uint32 size) const { return __impl->GetVariable(__impl->GetVariableId(name), buffer, size); }
+
+bool PVAccessClient_Impl::GetVariable (ccs::types::uint32 id, void* buffer, ccs::types::uint32 size) const { return (this->m_cache)->GetValue(id, buffer, size); }
+
+std::shared_ptr<const ccs::types::AnyType> PVAccessClient_Impl::GetVariableType (ccs::types::uint32 id) const { return (this->m_cache)->GetType(id); };
 std::shared_ptr<const ccs::types::AnyType> PVAccessClient_Impl::GetVariableType (const char* name) const { return this->GetVariableType(this->GetVariableId(name)); };
 
+bool PVAccessClient::SetVariable (const char* name, const void* buffer, ccs::types::uint32 size) { return __impl->SetVariable(__impl->GetVariableId(name), buffer, size); }
+
+bool PVAccessClient_Impl::SetVariable (ccs::types::uint32 id, const void* buffer, ccs::types::uint32 size) { bool status = (this->m_cache)->SetValue(id, buffer, size); if (status) { this->UpdateVariable(id); } return status; }
+
 void PVAccessClient::UpdateVariable (const char* name) { return __impl->UpdateVariable(__impl->GetVariableId(name)); return; }
 
-void PVAccessClient_Impl::UpdateVariable (ccs::types::uint32 id) { VariableInfo_t varInfo; if (this->IsValid(id)) { (this->m_var_table)->GetValue(varInfo, id); varInfo.update = true; (this->m_var_table)->SetValue(varInfo, id); } return; }
+void PVAccessClient_Impl::UpdateVariable (ccs::types::uint32 id) { if ((this->m_cache)->CommitSnapshot(id)) { (void)(this->m_cache)->PushUpdate(id); } return; }
 void PVAccessClient_Impl::UpdateVariable (const char* name) { return this->UpdateVariable(this->GetVariableId(name)); return; }
 
 // Constructor methods
@@ -563,7 +949,20 @@ PVAccessClient_Impl::~PVAccessClient_Impl (void)
 
   // Release resources
   if (this->m_thread != NULL) delete this->m_thread;
-  if (this->m_var_table != NULL) delete this->m_var_table;
+
+  for (std::vector<VariableInfo_t>::iterator it = (this->m_var_table).begin(); it != (this->m_var_table).end(); ++it)
+    {
+      if (static_cast<MonitorCallback*>(NULL) != it->monitor)
+	{
+	  delete it->monitor; // Cancel monitor
+	  it->monitor = static_cast<MonitorCallback*>(NULL);
+	}
+
+      if (static_cast<ccs::types::AnyValue*>(NULL) != it->value) delete it->value;
+      if (static_cast<ccs::types::AnyValue*>(NULL) != it->input) delete it->input;
+    }
+
+  if (this->m_cache != NULL) delete this->m_cache;
 
   // Remove instance from object database
   ccs::base::GlobalObjectDatabase::Remove(DEFAULT_PVAINTERFACE_INSTANCE_NAME); 
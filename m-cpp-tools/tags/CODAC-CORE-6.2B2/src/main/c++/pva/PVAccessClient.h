@@ -56,8 +56,11 @@ class PVAccessClient_Impl; // Forward class declaration
  * @brief Interface class providing support for PVA client with variable cache.
  * @detail The class provides access to a variable cache and asynchronous PVA
  * update to ensure non-blocking calls on the application side. The variable
- * cache is implemented by means of ccs::types::AnyValue instances which allow
- * assignment to/from C-like structures.
+ * cache is implemented by means of ccs::base::VariableCache which holds each
+ * variable in a sequence-locked slot, i.e. the GetVariable and SetVariable
+ * methods copy consistent values to/from C-like structures without blocking
+ * the PVA thread. Updated variables are queued for the PVA thread rather than
+ * scanned at each cycle.
  *
  * @note The design is based on a bridge pattern to avoid exposing PVA specific
  * internals through the interface class.
@@ -98,7 +101,10 @@ class PVAccessClient
      * record. The direction instructs the asynchronous thread on the intended use of the variable
      * by the application, either as input variable, output variable or bi-directional. This version
      * does not perform any synchronous update; rather, the asynchronous handling thread is using the
-     * direction attribute to perform either a get, put, or put/get operation at each cycle.
+     * direction attribute to install a monitor for input variables, and to issue put operations for
+     * updated output variables at each cycle. Operations are issued across all channels and awaited
+     * together. Input variables for which a monitor can not be installed are read with a get operation
+     * at each cycle.
      * @param name Variable name to be used as PVA record name.
      * @param direction Variable direction, see ccs::types::DirIdentifier.
      * @param type Introspectable type definition, see ccs::types::AnyType.
@@ -227,15 +233,40 @@ class PVAccessClient
 
     /**
      * @brief Accessor. GetVariable method.
-     * @detail The method allows to manipulate the variable cache from the application-side,
-     * e.g. attribute level access for structured variables, etc. The UpdateVariable method
-     * has to be called by the application to trigger PVA record update, when necessary.
+     * @detail Consistent copy of the variable held in the cache.
      * @param name Variable identifier.
-     * @return Reference to the ccs::types::AnyValue instance in the cache if variable exists, 
+     * @param buffer Placeholder of size equal to that of the variable type.
+     * @param size Placeholder size.
+     * @return True if successful.
+     */
+
+    bool GetVariable (const char* name, void* buffer, ccs::types::uint32 size) const;
+
+    /**
+     * @brief Accessor. SetVariable method.
+     * @detail Writes the variable held in the cache and queues the variable for
+     * update by the PVA thread.
+     * @param name Variable identifier.
+     * @param buffer Value of size equal to that of the variable type.
+     * @param size Value size.
+     * @return True if successful.
+     */
+
+    bool SetVariable (const char* name, const void* buffer, ccs::types::uint32 size);
+
+    /**
+     * @brief Accessor. GetVariable method.
+     * @detail The method allows to manipulate a snapshot of the cached variable from the
+     * application-side, e.g. attribute level access for structured variables, etc. The snapshot
+     * is refreshed at each call and is not written by the PVA thread. The UpdateVariable method
+     * has to be called by the application to write it back and trigger PVA record update, when
+     * necessary.
+     * @param name Variable identifier.
+     * @return Reference to the ccs::types::AnyValue snapshot if variable exists, 
      * NULL otherwise. 
      *
      * @code
-       // Get variable reference in the cache
+       // Get variable snapshot
        ccs::types::AnyValue* var = ccs::base::PVAccessInterface::GetInstance<ccs::base::PVAccessClient>()
          ->GetVariable("MyVariable");
 
@@ -260,12 +291,12 @@ class PVAccessClient
 
     /**
      * @brief Accessor. UpdateVariable method.
-     * @detail The method allows to trigger PVA record update, after variable cache is modified
-     * by the application. For output or bi-directional variable.
+     * @detail The method allows to trigger PVA record update, after the variable snapshot is
+     * modified by the application. For output or bi-directional variable.
      * @param name Variable identifier.
      *
      * @code
-       // Get variable reference in the cache
+       // Get variable snapshot
        ccs::types::AnyValue* var = ccs::base::PVAccessInterface::GetInstance<ccs::base::PVAccessClient>()
          ->GetVariable("MyVariable");
 
@@ -320,37 +351,12 @@ template <> inline PVAccessClient* GetInstance<PVAccessClient> (void)
 
 template <typename Type> bool PVAccessClient::GetVariable (const char* name, Type& value) const 
 { 
-
-  ccs::types::AnyValue* var = static_cast<ccs::types::AnyValue*>(NULL); 
-
-  bool status = this->IsValid(name); 
-
-  if (status) 
-    { 
-      var = this->GetVariable(name); 
-      value = static_cast<Type>(*var); 
-    } 
-
-  return status; 
-
+  return this->GetVariable(name, static_cast<void*>(&value), sizeof(Type)); 
 }
 
 template <typename Type> bool PVAccessClient::SetVariable (const char* name, Type& value) 
 { 
-
-  const ccs::types::AnyValue* var = static_cast<ccs::types::AnyValue*>(NULL); 
-
-  bool status = this->IsValid(name); 
-
-  if (status) 
-    { 
-      var = this->GetVariable(name); 
-      *var = value; 
-      this->UpdateVariable(name); 
-    } 
-
-  return status; 
-
+  return this->SetVariable(name, static_cast<const void*>(&value), sizeof(Type)); 
 }
 
 } // namespace base
@@ -27,8 +27,12 @@
 
 #include <new> // std::nothrow
 #include <functional> // std::function
+#include <vector> // std::vector
+
+#include <stdio.h> // snprintf
 
 #include <pv/pvData.h>
+#include <pv/createRequest.h>
 #include <pva/client.h>
 
 #include <BasicTypes.h> // Global type definition
@@ -57,6 +61,8 @@
 
 // Constants
 
+#define DEFAULT_PVAMONITOR_QUEUE_SIZE 64u // Queue-preserving mode
+
 #undef LOG_ALTERN_SRC
 #define LOG_ALTERN_SRC "pva-if"
 
@@ -76,6 +82,10 @@ class PVAccessMonitor_Impl : public pvac::ClientChannel::MonitorCallback
     ccs::types::string __name;
     std::function<void(const ccs::base::PVAccessMonitor::Event&)> __ecb;
     std::function<void(const ccs::types::AnyValue&)> __dcb;
+    std::function<void(const ccs::types::AnyValue*, const ccs::types::uint32)> __qcb;
+
+    bool __queued; // Deliver every queued element
+    std::vector<ccs::types::AnyValue> __queue; // Persistent batch buffer
 
     pvac::ClientProvider* __provider;
     pvac::ClientChannel* __channel;
@@ -98,12 +108,14 @@ class PVAccessMonitor_Impl : public pvac::ClientChannel::MonitorCallback
     bool SetChannel (const char* name) { ccs::HelperTools::SafeStringCopy(__name, name, ccs::types::MaxStringLength); return true; };
     bool RegisterEventHandler(std::function<void(const ccs::base::PVAccessMonitor::Event&)> cb) { __ecb = cb; return true; };
     bool RegisterDataHandler(std::function<void(const ccs::types::AnyValue&)> cb) { __dcb = cb; return true; };
+    bool RegisterQueueHandler(std::function<void(const ccs::types::AnyValue*, const ccs::types::uint32)> cb) { __qcb = cb; return true; };
+    bool SetQueueMode (bool queued) { __queued = queued; return true; };
 
     // Miscellaneous methods
     virtual void monitorEvent (const pvac::MonitorEvent& event); // Specialise virtual method
 
     // Constructor methods
-    PVAccessMonitor_Impl (void) { __initialised = false; __connected = false; };
+    PVAccessMonitor_Impl (void) { __initialised = false; __connected = false; __queued = false; };
 
     // Destructor method
     virtual ~PVAccessMonitor_Impl (void); 
@@ -132,11 +144,18 @@ bool PVAccessMonitor_Impl::Initialise (void)
       status = (static_cast<pvac::ClientChannel*>(NULL) != __channel);
     }
 
-  if (status)
+  if (status && !__queued)
     {
       __monitor = __channel->monitor(this); // pvac::ClientChannel::MonitorCallback (this)
     }
 
+  if (status && __queued)
+    {
+      char request [64];
+      snprintf(request, 64, "record[queueSize=%u]field()", DEFAULT_PVAMONITOR_QUEUE_SIZE);
+      __monitor = __channel->monitor(this, epics::pvData::createRequest(request)); // Larger server-side queue
+    }
+
   if (status)
     {
       __initialised = true;
@@ -170,10 +189,22 @@ void PVAccessMonitor::HandleEvent (const PVAccessMonitor::Event& event)
 
 }
 
+void PVAccessMonitor::HandleMonitor (const ccs::types::AnyValue* values, const ccs::types::uint32 number)
+{
+
+  for (ccs::types::uint32 index = 0u; index < number; index += 1u)
+    {
+      this->HandleMonitor(values[index]);
+    }
+
+  return;
+
+}
+
 void PVAccessMonitor_Impl::monitorEvent (const pvac::MonitorEvent& event) // Specialise virtual method (pvac::ClientChannel::MonitorCallback)
 {
 
-  bool status = false;
+  bool data = false;
 
   switch (event.event)
     {
@@ -204,54 +235,82 @@ void PVAccessMonitor_Impl::monitorEvent (const pvac::MonitorEvent& event) // Spe
 	  }
 
 	__connected = true;
-	status = true;
+	data = true;
 	break;
     }
 
-  if (status)
-    {
-      // Empty event queue
-      while (__monitor.poll()) {}
-    }
+  ccs::types::uint32 count = 0u;
 
-  if (status)
+  // Process every queued element .. changed fields only
+  while (data && __monitor.poll())
     {
+      bool status = false;
+
       if (static_cast<ccs::types::AnyValue*>(NULL) == __value)
 	{
-#if 0
-	  __value = new (std::nothrow) ccs::types::AnyValue (ccs::HelperTools::PVStructToAnyType((__monitor.root)->getStructure())); // Introspection interface
-#else
 	  __type = ccs::HelperTools::PVStructToAnyType<std::shared_ptr<const epics::pvData::PVStructure>>(__monitor.root); // In order to support arrays of structure
-	  status = (__type ? true : false);
 
-	  if (status)
+	  if (__type)
 	    {
-	      __value = new (std::nothrow) ccs::types::AnyValue (__type); // Actual variable
+	      __value = new (std::nothrow) ccs::types::AnyValue (__type); // Actual variable, persistent
 	    }
 	  else
 	    {
 	      log_error("Unable to extract type from server monitor");
 	    }
-#endif
+
+	  if (static_cast<ccs::types::AnyValue*>(NULL) != __value)
+	    { // First update is complete
+	      status = ccs::HelperTools::PVStructToAnyValue(__value, __monitor.root);
+	    }
+	}
+      else
+	{
+	  status = ccs::HelperTools::PVStructToAnyValue(__value, __monitor.root, __monitor.changed);
 	}
 
-      status = (static_cast<ccs::types::AnyValue*>(NULL) != __value);
-    }
+      if (!status)
+	{ // Skip the element, the rest of the queue is still drained
+	  log_error("Monitor '%s' unable to convert update", this->GetChannel());
+	}
+      else if (__queued)
+	{
+	  if (count < __queue.size())
+	    {
+	      __queue[count] = *__value;
+	    }
+	  else
+	    {
+	      __queue.push_back(*__value);
+	    }
 
-  if (status)
-    {
-      // Update variable
-      status = ccs::HelperTools::PVStructToAnyValue(__value, __monitor.root);
+	  count += 1u;
+
+	  if (DEFAULT_PVAMONITOR_QUEUE_SIZE == count)
+	    { // Deliver batch
+	      __qcb(&__queue[0], count);
+	      count = 0u;
+	    }
+	}
+      else
+	{
+	  count = 1u; // Latest value
+	}
     }
 #ifdef LOG_DEBUG_ENABLE
-  if (status)
+  if (0u < count)
     {
       char buffer [1024];
       __value->SerialiseInstance(buffer, 1024u);
       log_debug(".. '%s'", buffer);
     }
 #endif
-  if (status)
+  if ((0u < count) && __queued)
+    {
+      // Call handler method
+      __qcb(&__queue[0], count);
+    }
+  else if (0u < count)
     {
       // Call handler method
       __dcb(*__value);
@@ -263,7 +322,7 @@ void PVAccessMonitor_Impl::monitorEvent (const pvac::MonitorEvent& event) // Spe
 
 // Constructor methods
 
-PVAccessMonitor::PVAccessMonitor (const char* channel)
+PVAccessMonitor::PVAccessMonitor (const char* channel, bool queued)
 { 
 
   // Instantiate implementation class
@@ -280,7 +339,13 @@ PVAccessMonitor::PVAccessMonitor (const char* channel)
   if (status)
     {
       using namespace std::placeholders;
-      status = __impl->RegisterDataHandler(std::bind(&PVAccessMonitor::HandleMonitor, this, _1));
+      status = __impl->RegisterDataHandler(std::bind(static_cast<void (PVAccessMonitor::*)(const ccs::types::AnyValue&)>(&PVAccessMonitor::HandleMonitor), this, _1));
+    }
+
+  if (status)
+    {
+      using namespace std::placeholders;
+      status = __impl->RegisterQueueHandler(std::bind(static_cast<void (PVAccessMonitor::*)(const ccs::types::AnyValue*, const ccs::types::uint32)>(&PVAccessMonitor::HandleMonitor), this, _1, _2));
     }
 
   if (status)
@@ -288,6 +353,11 @@ PVAccessMonitor::PVAccessMonitor (const char* channel)
       status = __impl->SetChannel(channel);
     }
 
+  if (status)
+    {
+      status = __impl->SetQueueMode(queued);
+    }
+
   if (status)
     {
       status = __impl->Initialise();
@@ -117,11 +117,14 @@ class PVAccessMonitor
     /**
      * @brief Constructor.
      * @detail Client PVA channel is instantiated and connection
-     * established.
+     * established. By default, only the latest value is delivered
+     * upon monitor events. The queue-preserving mode requests a larger
+     * server-side queue and delivers every queued element, in batches.
      * @param channel Channel name (nil-terminated character array).
+     * @param queued Queue-preserving mode.
      */
 
-    PVAccessMonitor (const char* channel);
+    PVAccessMonitor (const char* channel, bool queued = false);
 
     /**
      * @brief Destructor.
@@ -163,6 +166,17 @@ class PVAccessMonitor
 
     virtual void HandleMonitor (const ccs::types::AnyValue& value) = 0; // Pure virtual method
 
+    /**
+     * @brief Virtual data handler method.
+     * @detail Called in queue-preserving mode with the batch of queued updates, in
+     * order. Elements which fail conversion are logged and left out of the batch.
+     * The default implementation calls HandleMonitor for each element.
+     * @param values Array of buffers associated to an introspectable type definition.
+     * @param number Number of elements in the batch.
+     */
+
+    virtual void HandleMonitor (const ccs::types::AnyValue* values, const ccs::types::uint32 number); // Virtual method
+
 };
 
 // Global variables
@@ -22,11 +22,17 @@
 // Global header files
 
 #include <new> // std::nothrow
+#include <future> // std::future, std::promise
+#include <mutex> // std::mutex
+#include <condition_variable> // std::condition_variable
+#include <chrono> // std::chrono::duration
+#include <atomic> // std::atomic
+#include <string> // std::string
+#include <vector> // std::vector
 
 #include <pv/pvData.h>
-#include <pv/rpcClient.h>
-//#include <pv/rpcServer.h>
 #include <pv/clientFactory.h>
+#include <pva/client.h>
 
 #include <BasicTypes.h> // Global type definition
 #include <SysTools.h> // Misc. helper functions
@@ -54,6 +60,8 @@
 #include "AnyValueToPVA.h" // .. associated helper routines
 #include "PVAToAnyValue.h" // .. associated helper routines
 
+#include "PVAConversionPlan.h" // Cached type mapping
+
 #include "PVAccessRPCClient.h" // This class definition
 
 // Constants
@@ -67,121 +75,531 @@ namespace ccs {
 
 namespace base {
 
+struct PVAccessRPCChannel; // Forward declaration
+
+/**
+ * @brief Callback class for RPC operations.
+ * @detail Instances are owned by the channel until completion. The reply is provided
+ * through a promise fulfilled upon completion, cancellation or failure.
+ */
+
+struct PVAccessRPCOperation : public pvac::ClientChannel::GetCallback
+{
+
+  std::mutex __mutex;
+
+  bool __done;
+  std::promise<ccs::types::AnyValue> __promise;
+
+  std::string __service;
+  std::weak_ptr<PVAccessRPCChannel> __channel;
+
+  std::chrono::steady_clock::time_point __deadline; // Cancelled past then
+
+  pvac::Operation __oper; // Declared last, i.e. cancelled first upon destruction
+
+  PVAccessRPCOperation (const std::string& service, const std::shared_ptr<PVAccessRPCChannel>& channel);
+  virtual ~PVAccessRPCOperation (void);
+
+  bool IsDone (void);
+  void Complete (const std::shared_ptr<const epics::pvData::PVStructure>& reply); // Fulfil promise, idempotent
+
+  virtual void getDone (const pvac::GetEvent& evt);
+
+};
+
+/**
+ * @brief Channel shared between the client and its pending operations.
+ * @detail The connection state is tracked through a connection listener. Pending operations
+ * are cancelled when past their deadline or upon destruction of the channel.
+ */
+
+struct PVAccessRPCChannel : public pvac::ClientChannel::ConnectCallback, public std::enable_shared_from_this<PVAccessRPCChannel>
+{
+
+  std::mutex __mutex;
+  std::condition_variable __cond;
+
+  std::atomic<bool> __connected;
+  std::atomic<bool> __dropped; // Dropped from the cache, to be re-created
+
+  std::chrono::steady_clock::time_point __deadline; // Connection expected by then
+
+  std::vector<std::shared_ptr<PVAccessRPCOperation>> __pending;
+
+  std::string __service;
+  pvac::ClientChannel __channel;
+
+  PVAccessRPCChannel (const std::string& service);
+  virtual ~PVAccessRPCChannel (void);
+
+  bool Connect (void); // Issue connection, does not wait
+  bool WaitConnected (void); // Wait for connection, up to the deadline
+
+  std::future<ccs::types::AnyValue> Issue (const epics::pvData::PVStructure::shared_pointer& request);
+  void Reap (void); // Forget completed operations and cancel expired ones
+
+  virtual void connectEvent (const pvac::ConnectEvent& evt);
+
+};
+
 // Global variables
 
 // Function declaration
 
 // Function definition
 
-bool PVAccessRPCClient::Initialise (void)
-{ 
+static pvac::ClientProvider& GetProvider (void)
+{
 
-  epics::pvAccess::ClientFactory::start(); 
-  __client = epics::pvAccess::RPCClient::create(std::string(GetService())); 
+  epics::pvAccess::ClientFactory::start(); // Idempotent
 
-  __initialised = true; 
-  __connected = false; 
+  // Single provider shared by all instances, i.e. channel cache
+  static pvac::ClientProvider __provider ("pva");
 
-  return true; 
+  return __provider;
 
 }
 
-bool PVAccessRPCClient::Launch (void)
-{ 
+static std::chrono::steady_clock::time_point GetDeadline (const ccs::types::float64 timeout)
+{
+
+  return std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<ccs::types::float64>(timeout));
+
+}
+
+static ccs::types::AnyValue GetReply (const char* service, const std::shared_ptr<const epics::pvData::PVStructure>& __reply)
+{
+
+  bool status = (__reply ? true : false);
+
+  std::shared_ptr<const ccs::types::CompoundType> reply_type;
 
-  if (true != __initialised) 
+  if (status)
+    {
+      //reply_type = ccs::HelperTools::PVStructToAnyType(__reply->getStructure());
+      reply_type = ccs::HelperTools::PVStructToAnyType<std::shared_ptr<const epics::pvData::PVStructure>>(__reply); // In order to support arrays of structure
+      status = (reply_type ? true : false);
+    }
+  else
     {
-      this->Initialise(); 
+      reply_type = ccs::base::RPCTypes::Reply_int; // Default RPC reply type
     }
 
-  __client->issueConnect(); 
+  ccs::types::AnyValue reply (std::dynamic_pointer_cast<const ccs::types::AnyType>(reply_type));
 
-  return true; 
+  if (status)
+    {
+      status = ccs::HelperTools::PVStructToAnyValue(&reply, __reply);
+    }
+
+  if (!status)
+    {
+      ccs::base::RPCTypes::Reply_t reply_error;
+
+      reply_error.timestamp = ccs::HelperTools::GetCurrentTime();
+      reply_error.status = status;
+
+      ccs::HelperTools::SafeStringCopy(reply_error.qualifier, "error", STRING_MAX_LENGTH);
+      snprintf(reply_error.reason, STRING_MAX_LENGTH, "Error with '%s' RPC service", service);
+
+      reply = reply_error;
+    }
+
+  char buffer [1024];
+
+  if (status)
+    {
+      status = reply.SerialiseInstance(buffer, 1024u);
+    }
+
+  if (status)
+    {
+      log_debug("PVAccessRPCClient::SendRequest - .. reply '%s'", buffer);
+    }
+
+  return reply;
 
 }
 
-bool PVAccessRPCClient::IsConnected (void) const
-{ 
+PVAccessRPCOperation::PVAccessRPCOperation (const std::string& service, const std::shared_ptr<PVAccessRPCChannel>& channel) : __service(service), __channel(channel)
+{
+
+  __done = false;
+  __deadline = GetDeadline(DEFAULT_PVARPC_TIMEOUT);
+
+  return;
+
+}
+
+PVAccessRPCOperation::~PVAccessRPCOperation (void)
+{
+
+  __oper.cancel();
+
+  // Future ready in any case
+  this->Complete(std::shared_ptr<const epics::pvData::PVStructure>());
+
+  return;
+
+}
+
+bool PVAccessRPCOperation::IsDone (void)
+{
+
+  std::lock_guard<std::mutex> lock (__mutex);
+
+  return __done;
+
+}
+
+void PVAccessRPCOperation::Complete (const std::shared_ptr<const epics::pvData::PVStructure>& reply)
+{
 
-  if (true != __connected)
+  std::lock_guard<std::mutex> lock (__mutex);
+
+  if (!__done)
     {
-      *(const_cast<bool*>(&__connected)) = __client->waitConnect(0.001); 
+      __promise.set_value(GetReply(__service.c_str(), reply));
     }
 
-  return __connected; 
+  __done = true;
+
+  return;
 
 }
 
-ccs::types::AnyValue PVAccessRPCClient::SendRequest (const ccs::types::AnyValue& request) const
+void PVAccessRPCOperation::getDone (const pvac::GetEvent& evt)
+{
+
+  bool status = (pvac::GetEvent::Success == evt.event);
+
+  if (!status)
+    {
+      log_error("PVAccessRPCClient::SendRequest - .. '%s' request failed with '%s'", __service.c_str(), ((pvac::GetEvent::Cancel == evt.event) ? "cancelled" : evt.message.c_str()));
+    }
+
+  std::shared_ptr<PVAccessRPCChannel> channel = __channel.lock();
+
+  if ((pvac::GetEvent::Fail == evt.event) && channel && !channel->__connected)
+    {
+      // Drop disconnected channel from the cache, re-created upon next request
+      GetProvider().disconnect(__service);
+      channel->__dropped = true;
+    }
+
+  this->Complete((status ? evt.value : std::shared_ptr<const epics::pvData::PVStructure>()));
+
+  return;
+
+}
+
+PVAccessRPCChannel::PVAccessRPCChannel (const std::string& service) : __service(service)
+{
+
+  __connected = false;
+  __dropped = false;
+
+  // Connection expected by then, i.e. shared by all requests issued meanwhile
+  __deadline = GetDeadline(DEFAULT_PVARPC_CONNECT_TIMEOUT);
+
+  return;
+
+}
+
+PVAccessRPCChannel::~PVAccessRPCChannel (void)
+{
+
+  __channel.removeConnectListener(this);
+
+  // Pending operations cancelled upon destruction
+  __pending.clear();
+
+  return;
+
+}
+
+bool PVAccessRPCChannel::Connect (void)
 {
 
-  log_debug("PVAccessRPCClient::SendRequest - Create PVA RPC request with appropriate type");
-  epics::pvData::PVStructure::shared_pointer __request = epics::pvData::getPVDataCreate()->createPVStructure(ccs::HelperTools::AnyTypeToPVStruct(request.GetType()));
+  bool status = true;
+
+  try
+    {
+      // Reuse cached channel, if any
+      __channel = GetProvider().connect(__service);
+      __channel.addConnectListener(this);
+    }
+  catch (const std::exception& e)
+    {
+      log_error("PVAccessRPCChannel::Connect - .. '%s' exception caught", e.what());
+      status = false;
+    }
+
+  return status;
+
+}
+
+bool PVAccessRPCChannel::WaitConnected (void)
+{
+
+  std::unique_lock<std::mutex> lock (__mutex);
+
+  return __cond.wait_until(lock, __deadline, [this] (void) { return __connected.load(); });
+
+}
+
+std::future<ccs::types::AnyValue> PVAccessRPCChannel::Issue (const epics::pvData::PVStructure::shared_pointer& request)
+{
 
-  bool status = ccs::HelperTools::AnyValueToPVStruct(&request, __request);
+  this->Reap();
 
-  epics::pvData::PVStructure::shared_pointer __reply;
+  std::shared_ptr<PVAccessRPCOperation> oper (new (std::nothrow) PVAccessRPCOperation (__service, shared_from_this()));
+
+  std::future<ccs::types::AnyValue> future;
+
+  bool status = (oper ? true : false);
+
+  if (status)
+    {
+      future = oper->__promise.get_future();
+    }
+
+  if (status)
+    {
+      std::lock_guard<std::mutex> lock (__mutex);
+      __pending.push_back(oper);
+    }
 
   if (status)
     {
       try
 	{
-	  log_debug("PVAccessRPCClient::SendRequest - Send PVA RPC request ..");
-	  __reply = __client->request(__request, 10.0);
+	  log_debug("PVAccessRPCChannel::Issue - Send PVA RPC request ..");
+	  oper->__oper = __channel.rpc(oper.get(), request);
 	}
       catch (const std::exception& e)
 	{
-	  log_error("PVAccessRPCClient::SendRequest - .. '%s' exception caught", e.what());
-	  *(const_cast<bool*>(&__connected)) = false;
-	  status = false;
+	  log_error("PVAccessRPCChannel::Issue - .. '%s' exception caught", e.what());
+	  oper->Complete(std::shared_ptr<const epics::pvData::PVStructure>());
 	}
     }
 
-  std::shared_ptr<const ccs::types::CompoundType> reply_type;
+  return future;
 
-  if (status)
+}
+
+void PVAccessRPCChannel::Reap (void)
+{
+
+  std::vector<std::shared_ptr<PVAccessRPCOperation>> expired;
+
+  {
+    std::lock_guard<std::mutex> lock (__mutex);
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    std::vector<std::shared_ptr<PVAccessRPCOperation>>::iterator iter = __pending.begin();
+
+    while (iter != __pending.end())
+      {
+	if ((*iter)->IsDone() || ((*iter)->__deadline <= now))
+	  {
+	    expired.push_back(*iter);
+	    iter = __pending.erase(iter);
+	  }
+	else
+	  {
+	    ++iter;
+	  }
+      }
+  }
+
+  // Expired operations, if any, cancelled outside the lock
+  expired.clear();
+
+  return;
+
+}
+
+void PVAccessRPCChannel::connectEvent (const pvac::ConnectEvent& evt)
+{
+
+  {
+    std::lock_guard<std::mutex> lock (__mutex);
+
+    __connected = evt.connected;
+
+    if (!evt.connected)
+      {
+	// Leave time for re-connection
+	__deadline = GetDeadline(DEFAULT_PVARPC_CONNECT_TIMEOUT);
+      }
+  }
+
+  __cond.notify_all();
+
+  if (evt.connected)
     {
-      //reply_type = ccs::HelperTools::PVStructToAnyType(__reply->getStructure());
-      reply_type = ccs::HelperTools::PVStructToAnyType<std::shared_ptr<const epics::pvData::PVStructure>>(__reply); // In order to support arrays of structure
-      status = (reply_type ? true : false);
+      log_debug("PVAccessRPCChannel::connectEvent - Service '%s' connected to '%s'", __service.c_str(), evt.peerName.c_str());
     }
   else
     {
-      reply_type = ccs::base::RPCTypes::Reply_int; // Default RPC reply type
+      log_debug("PVAccessRPCChannel::connectEvent - Service '%s' disconnected", __service.c_str());
     }
 
-  ccs::types::AnyValue reply (std::dynamic_pointer_cast<const ccs::types::AnyType>(reply_type));
+  return;
+
+}
+
+bool PVAccessRPCClient::Initialise (void)
+{ 
+
+  std::shared_ptr<PVAccessRPCChannel> channel (new (std::nothrow) PVAccessRPCChannel (std::string(GetService())));
+
+  bool status = (channel ? true : false);
 
   if (status)
     {
-      status = ccs::HelperTools::PVStructToAnyValue(&reply, __reply);
+      status = channel->Connect();
     }
-  else
+
+  if (status)
     {
-      ccs::base::RPCTypes::Reply_t reply_error;
+      __channel = channel;
+    }
 
-      reply_error.timestamp = ccs::HelperTools::GetCurrentTime();
-      reply_error.status = status;
+  return status; 
 
-      ccs::HelperTools::SafeStringCopy(reply_error.qualifier, "error", STRING_MAX_LENGTH);
-      snprintf(reply_error.reason, STRING_MAX_LENGTH, "Error with '%s' RPC service", this->GetService());
+}
 
-      reply = reply_error;
+bool PVAccessRPCClient::Launch (void)
+{ 
+
+  std::lock_guard<std::mutex> lock (__mutex);
+
+  bool status = (__channel ? true : false);
+
+  if (!status) 
+    {
+      status = this->Initialise(); 
     }
 
-  char buffer [1024];
+  return status; 
+
+}
+
+bool PVAccessRPCClient::Terminate (void)
+{ 
+
+  std::shared_ptr<PVAccessRPCChannel> channel;
+
+  {
+    std::lock_guard<std::mutex> lock (__mutex);
+    channel.swap(__channel);
+  }
+
+  // Pending operations, if any, cancelled outside the lock
+  channel.reset();
+
+  return true; 
+
+}
+
+bool PVAccessRPCClient::IsConnected (void) const
+{
+
+  std::lock_guard<std::mutex> lock (__mutex);
+
+  return (__channel && __channel->__connected);
+
+}
+
+std::shared_ptr<PVAccessRPCChannel> PVAccessRPCClient::GetChannel (void) const
+{
+
+  std::shared_ptr<PVAccessRPCChannel> dropped;
+  std::shared_ptr<PVAccessRPCChannel> channel;
+
+  {
+    std::lock_guard<std::mutex> lock (__mutex);
+
+    PVAccessRPCClient* self = const_cast<PVAccessRPCClient*>(this); // Serialised through the lock
+
+    // Health check .. re-create channel dropped from the cache
+    if (__channel && __channel->__dropped)
+      {
+	dropped.swap(self->__channel);
+      }
+
+    if (!__channel)
+      {
+	self->Initialise();
+      }
+
+    channel = __channel;
+  }
+
+  return channel;
+
+}
+
+std::future<ccs::types::AnyValue> PVAccessRPCClient::SendRequestAsync (const ccs::types::AnyValue& request) const
+{
+
+  std::shared_ptr<PVAccessRPCChannel> channel = GetChannel();
+
+  bool status = (channel ? true : false);
+
+  // .. and leave some time for connection, i.e. up to the deadline set upon launch or disconnection
+  if (status && !channel->WaitConnected())
+    {
+      log_warning("PVAccessRPCClient::SendRequestAsync - Service '%s' not yet connected", GetService());
+    }
+
+  log_debug("PVAccessRPCClient::SendRequestAsync - Create PVA RPC request with appropriate type");
+  epics::pvData::PVStructure::shared_pointer __request = epics::pvData::getPVDataCreate()->createPVStructure(ccs::base::PVAConversionPlan::GetStructure(request.GetType())); // Cached introspection interface
 
   if (status)
     {
-      status = reply.SerialiseInstance(buffer, 1024u);
+      status = ccs::HelperTools::AnyValueToPVStruct(&request, __request);
     }
 
+  std::future<ccs::types::AnyValue> future;
+
   if (status)
     {
-      log_debug("PVAccessRPCClient::SendRequest - .. reply '%s'", buffer);
+      future = channel->Issue(__request);
+      status = future.valid();
+    }
+
+  if (!status)
+    { // Ready future with error reply
+      std::promise<ccs::types::AnyValue> promise;
+      promise.set_value(GetReply(GetService(), std::shared_ptr<const epics::pvData::PVStructure>()));
+      future = promise.get_future();
+    }
+
+  return future;
+
+}
+
+ccs::types::AnyValue PVAccessRPCClient::SendRequest (const ccs::types::AnyValue& request) const
+{
+
+  std::future<ccs::types::AnyValue> future = SendRequestAsync(request);
+
+  if (std::future_status::ready != future.wait_for(std::chrono::duration<ccs::types::float64>(DEFAULT_PVARPC_TIMEOUT)))
+    {
+      // Cancel expired operation, i.e. future ready with error reply
+      std::shared_ptr<PVAccessRPCChannel> channel = GetChannel();
+
+      if (channel)
+	{
+	  channel->Reap();
+	}
     }
 
- return reply;
+  return future.get();
 
 }
 
@@ -34,11 +34,11 @@
 // Global header files
 
 #include <memory> // std::shared_ptr
+#include <future> // std::future
+#include <mutex> // std::mutex
 
 #include <pv/pvData.h>
-#include <pv/rpcClient.h>
-//#include <pv/rpcServer.h>
-#include <pv/clientFactory.h>
+#include <pva/client.h>
 
 #include <AnyValue.h> // Variable with introspectable data type ..
 #include <AnyValueHelper.h> // .. associated helper routines
@@ -49,6 +49,9 @@
 
 // Constants
 
+#define DEFAULT_PVARPC_TIMEOUT 10.0 // [s]
+#define DEFAULT_PVARPC_CONNECT_TIMEOUT 1.0 // [s]
+
 // Type definition
 
 namespace ccs {
@@ -57,41 +60,57 @@ namespace base {
 
 /**
  * @brief Implementation class providing support for PVA RPC client.
- * @detail ToDo.
+ * @detail The implementation uses the pvAccess client API (pvac) with a provider shared by all
+ * instances, i.e. channels are cached by the provider and reused by all clients of the same
+ * service. The channel connection state is tracked through a connection listener; requests
+ * wait for connection up to DEFAULT_PVARPC_CONNECT_TIMEOUT after the channel was launched or
+ * last disconnected, i.e. clients launched together share the same connection deadline. A
+ * channel found disconnected after a failed request is dropped from the cache so as to be
+ * re-created upon the next request.
+ *
+ * Requests are issued asynchronously and several requests may be in flight concurrently over
+ * the same channel. The returned futures are fulfilled by the pvac callback and may be waited
+ * upon with a timeout. Requests pending past DEFAULT_PVARPC_TIMEOUT are cancelled upon the next
+ * request or synchronous timeout, and all pending requests are cancelled upon termination; the
+ * future then holds an error reply.
  */
 
+struct PVAccessRPCChannel; // Forward declaration
+
 class PVAccessRPCClient : public RPCClientImpl
 {
 
   private:
 
-    bool __initialised;
-    bool __connected;
-
-    std::shared_ptr<epics::pvAccess::RPCClient> __client;
+    mutable std::mutex __mutex; // Serialises channel re-creation
+    std::shared_ptr<PVAccessRPCChannel> __channel;
 
     // Initialiser methods
     bool Initialise (void);
 
+    // Accessor methods
+    std::shared_ptr<PVAccessRPCChannel> GetChannel (void) const; // Re-create dropped channel, if necessary
+
   protected:
 
   public:
 
     // Initialiser methods
     virtual bool Launch (void);
-    virtual bool Terminate (void) { return true; };
+    virtual bool Terminate (void);
 
     // Accessor methods
     virtual bool IsConnected (void) const;
 
     // Miscellaneous methods
     virtual ccs::types::AnyValue SendRequest (const ccs::types::AnyValue& request) const;
+    virtual std::future<ccs::types::AnyValue> SendRequestAsync (const ccs::types::AnyValue& request) const;
 
     // Constructor methods
-    PVAccessRPCClient (void) { __initialised = false; __connected = false; RPCTypes::Initialise(); };
+    PVAccessRPCClient (void) { RPCTypes::Initialise(); };
 
     // Destructor method
-    virtual ~PVAccessRPCClient (void) {}; 
+    virtual ~PVAccessRPCClient (void) { Terminate(); }; 
 
 };
 
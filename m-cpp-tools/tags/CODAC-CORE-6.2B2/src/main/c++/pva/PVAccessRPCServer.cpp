@@ -55,6 +55,8 @@
 #include "AnyValueToPVA.h" // .. associated helper routines
 #include "PVAToAnyValue.h" // .. associated helper routines
 
+#include "PVAConversionPlan.h" // Cached type mapping
+
 #include "PVAccessRPCServer.h" // This class definition
 
 // Constants
@@ -80,7 +82,7 @@ bool PVAccessRPCServer::Initialise (void)
   __context = epics::pvAccess::startPVAServer(epics::pvAccess::PVACCESS_ALL_PROVIDERS, 0, true, true); 
   __server = std::shared_ptr<epics::pvAccess::RPCServer>(new epics::pvAccess::RPCServer ()); 
 
-  __server->registerService(std::string(this->GetService()), std::shared_ptr<epics::pvAccess::RPCService>(this)); 
+  __server->registerService(std::string(this->GetService()), std::shared_ptr<epics::pvAccess::RPCServiceAsync>(this)); 
 
   __initialised = true; 
 
@@ -102,12 +104,16 @@ bool PVAccessRPCServer::Launch (void)
 
 }
 
-std::shared_ptr<epics::pvData::PVStructure> PVAccessRPCServer::request (std::shared_ptr<epics::pvData::PVStructure> const & __request)
-  throw (epics::pvAccess::RPCRequestException)
+void PVAccessRPCServer::request (std::shared_ptr<epics::pvData::PVStructure> const & __request,
+				 std::shared_ptr<epics::pvAccess::RPCResponseCallback> const & __callback)
 {
 
   bool status = true;
 
+  // The request is discarded upon return, its memory is reclaimed altogether
+  ccs::types::ArenaAllocator* arena = ccs::types::ArenaAllocator::GetThreadInstance();
+  ccs::types::ArenaAllocator::Checkpoint checkpoint (*arena);
+
   std::shared_ptr<const ccs::types::CompoundType> request_type;
 
   if (status)
@@ -117,34 +123,52 @@ std::shared_ptr<epics::pvData::PVStructure> PVAccessRPCServer::request (std::sha
       status = (request_type ? true : false);
     }
 
-  ccs::types::AnyValue request (std::dynamic_pointer_cast<const ccs::types::AnyType>(request_type));
+  ccs::types::AnyValue request (std::dynamic_pointer_cast<const ccs::types::AnyType>(request_type), *arena);
 
   if (status)
     {
       status = ccs::HelperTools::PVStructToAnyValue(&request, __request);
     }
 
-  std::shared_ptr<epics::pvData::PVStructure> __reply;
-
   if (status)
     {
-      log_debug("PVAccessRPCServer::request - Calling registered handler .. ");
-      ccs::types::AnyValue reply = CallHandler(request);
+      std::shared_ptr<epics::pvAccess::RPCResponseCallback> callback (__callback);
+
+      log_debug("PVAccessRPCServer::request - Dispatching request .. ");
+      Dispatch(request, [callback] (const ccs::types::AnyValue& reply) {
+
+	  std::shared_ptr<epics::pvData::PVStructure> __reply;
+	  bool status = true;
+
+	  try
+	    {
+	      __reply = epics::pvData::getPVDataCreate()->createPVStructure(ccs::base::PVAConversionPlan::GetStructure(reply.GetType())); // Cached introspection interface
+	      status = ccs::HelperTools::AnyValueToPVStruct(&reply, __reply);
+	    }
+	  catch (const std::exception& e)
+	    {
+	      log_error("PVAccessRPCServer::request - .. exception caught");
+	      status = false;
+	    }
+
+	  if (status)
+	    {
+	      callback->requestDone(epics::pvData::Status::Ok, __reply);
+	    }
+	  else
+	    {
+	      callback->requestDone(epics::pvData::Status(epics::pvData::Status::STATUSTYPE_ERROR, "Unable to convert reply"), std::shared_ptr<epics::pvData::PVStructure>());
+	    }
+
+	});
       log_debug("PVAccessRPCServer::request - .. returned");
+    }
+  else
+    {
+      __callback->requestDone(epics::pvData::Status(epics::pvData::Status::STATUSTYPE_ERROR, "Unable to convert request"), std::shared_ptr<epics::pvData::PVStructure>());
+    }
 
-      try
-	{
-	  __reply = epics::pvData::getPVDataCreate()->createPVStructure(ccs::HelperTools::AnyTypeToPVStruct(reply.GetType()));
-	  status = ccs::HelperTools::AnyValueToPVStruct(&reply, __reply);
-	}
-      catch (const std::exception& e)
-	{
-	  log_error("PVAccessRPCServer::request - .. exception caught");
-	  status = false;
-	}
-     }
-
-  return __reply;
+  return;
 
 }
 
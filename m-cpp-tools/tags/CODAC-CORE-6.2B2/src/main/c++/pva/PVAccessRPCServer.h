@@ -53,9 +53,11 @@ namespace base {
 
 /**
  * @brief Class providing implementation for PVA RPC server.
+ * @detail The asynchronous pvAccess service interface is implemented so that requests
+ * handed over to the worker pool do not hold the pvAccess server thread.
  */
 
-class PVAccessRPCServer : public RPCServerImpl, public epics::pvAccess::RPCService
+class PVAccessRPCServer : public RPCServerImpl, public epics::pvAccess::RPCServiceAsync
 {
 
   private:
@@ -74,13 +76,13 @@ class PVAccessRPCServer : public RPCServerImpl, public epics::pvAccess::RPCServi
 
     // Initialiser methods
     virtual bool Launch (void);
-    virtual bool Terminate (void) { return true; };
+    virtual bool Terminate (void) { return RPCServerImpl::Terminate(); };
 
     // Accessor methods
 
-    // Overloaded method called upon client request 
-    std::shared_ptr<epics::pvData::PVStructure> request (std::shared_ptr<epics::pvData::PVStructure> const & __request)
-      throw (epics::pvAccess::RPCRequestException);
+    // Overloaded method called upon client request, reply provided through the callback
+    virtual void request (std::shared_ptr<epics::pvData::PVStructure> const & __request,
+			  std::shared_ptr<epics::pvAccess::RPCResponseCallback> const & __callback);
 
     // Constructor methods
     PVAccessRPCServer (void) : RPCServerImpl() { __initialised = false; };
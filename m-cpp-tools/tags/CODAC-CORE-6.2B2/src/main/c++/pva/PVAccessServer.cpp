@@ -28,6 +28,8 @@
 #include <functional> // std::function
 #include <new> // std::nothrow
 
+#include <string.h> // memcpy
+
 #include <pv/pvData.h>
 #include <pv/pvDatabase.h>
 #include <pv/serverContext.h>
@@ -134,6 +136,10 @@ class PVAccessServer_Impl : public AnyObject
       //std::shared_ptr<epics::pvDatabase::PVRecord> pvrecord;
       std::shared_ptr<ccs::base::Record> pvrecord;
       std::shared_ptr<epics::pvData::PVStructure> pvvalue;
+
+      ccs::types::uint8* posted; // Copy of the instance last posted to the record
+      ccs::types::uint64 period; // Minimum period between posts [ns]
+      ccs::types::uint64 last; // Time of last post
       
     } VariableInfo_t;
 
@@ -164,6 +170,9 @@ class PVAccessServer_Impl : public AnyObject
     bool SetCallback (ccs::types::uint32 id, std::function<void(const ccs::types::AnyValue&)> cb);
     bool SetCallback (const char* name, std::function<void(const ccs::types::AnyValue&)> cb);
 
+    bool SetPostPeriod (ccs::types::uint32 id, ccs::types::uint64 period);
+    bool SetPostPeriod (const char* name, ccs::types::uint64 period);
+
     // Constructor methods
     PVAccessServer_Impl (void);
 
@@ -240,7 +249,18 @@ void PVAInterface_Thread_CB (ccs::base::PVAccessServer_Impl* self)
       ccs::base::PVAccessServer_Impl::VariableInfo_t varInfo;
       (self->m_var_table)->GetValue(varInfo, index);
 
-      if ((varInfo.direction != ccs::types::InputVariable) && varInfo.update)
+      // Coalesce updates .. post at most once per period
+      bool post = ((varInfo.direction != ccs::types::InputVariable) && varInfo.update);
+
+      ccs::types::uint64 time = 0ul;
+
+      if (post && (0ul < varInfo.period))
+	{
+	  time = ccs::HelperTools::GetCurrentTime();
+	  post = (time >= (varInfo.last + varInfo.period));
+	}
+
+      if (post)
 	{
 
 	  log_debug("Update PVA record '%s'", varInfo.name);
@@ -249,7 +269,20 @@ void PVAInterface_Thread_CB (ccs::base::PVAccessServer_Impl* self)
 	  varInfo.pvrecord->lock();
 	  varInfo.pvrecord->beginGroupPut();
 
-	  status = ccs::HelperTools::AnyValueToPVStruct(varInfo.value, varInfo.pvvalue);
+	  if (static_cast<ccs::types::uint8*>(NULL) == varInfo.posted)
+	    { // First post
+	      status = ccs::HelperTools::AnyValueToPVStruct(varInfo.value, varInfo.pvvalue);
+	      varInfo.posted = new (std::nothrow) ccs::types::uint8 [(varInfo.value)->GetSize()];
+	    }
+	  else
+	    { // Changed fields only
+	      status = ccs::HelperTools::AnyValueToPVStruct(varInfo.value, varInfo.pvvalue, varInfo.posted);
+	    }
+
+	  if (status && (static_cast<ccs::types::uint8*>(NULL) != varInfo.posted))
+	    {
+	      memcpy(varInfo.posted, (varInfo.value)->GetInstance(), (varInfo.value)->GetSize());
+	    }
 
 	  if (status)
 	    {
@@ -263,18 +296,18 @@ void PVAInterface_Thread_CB (ccs::base::PVAccessServer_Impl* self)
 	      log_warning("ccs::HelperTools::AnyValueToPVStruct failed for '%s'", varInfo.name);
 	    }
 
-	  varInfo.pvrecord->process();
 	  varInfo.pvrecord->endGroupPut();
 	  varInfo.pvrecord->unlock();
 
 	  varInfo.update = false;
+	  varInfo.last = time;
 
 	  // Store for future use
 	  (self->m_var_table)->SetValue(varInfo, index);
 
 	}
 
-      if ((varInfo.direction != ccs::types::OutputVariable) && varInfo.update)
+      if ((varInfo.direction == ccs::types::InputVariable) && varInfo.update) // Bi-directional variables may have a post pending
 	{
 	  log_debug("Read PVA record '%s'", varInfo.name);
 
@@ -355,6 +388,11 @@ void Record::process (void)
       status = ccs::HelperTools::PVStructToAnyValue(varInfo.value, varInfo.pvvalue);
     }
 
+  if (status && (static_cast<ccs::types::uint8*>(NULL) != varInfo.posted))
+    { // Record content is what was last posted .. called with the record locked
+      memcpy(varInfo.posted, (varInfo.value)->GetInstance(), (varInfo.value)->GetSize());
+    }
+
   if (status && (NULL != varInfo.cb))
     {
       log_debug("Record::process('%s') - Invoke callback '%s'", name.c_str());
@@ -392,6 +430,9 @@ bool PVAccessServer_Impl::AddVariable (const char* name, ccs::types::DirIdentifi
   varInfo.direction = direction;
   ccs::HelperTools::SafeStringCopy(varInfo.name, name, sizeof(ccs::types::string));
   varInfo.value = new (std::nothrow) ccs::types::AnyValue (type);
+  varInfo.posted = static_cast<ccs::types::uint8*>(NULL);
+  varInfo.period = 0ul;
+  varInfo.last = 0ul;
 
   return (this->m_var_table)->AddPair(name, varInfo);
 
@@ -406,6 +447,9 @@ bool PVAccessServer_Impl::AddVariable (const char* name, ccs::types::DirIdentifi
   varInfo.direction = direction;
   ccs::HelperTools::SafeStringCopy(varInfo.name, name, sizeof(ccs::types::string));
   varInfo.value = const_cast<ccs::types::AnyValue*>(value);
+  varInfo.posted = static_cast<ccs::types::uint8*>(NULL);
+  varInfo.period = 0ul;
+  varInfo.last = 0ul;
 
   return (this->m_var_table)->AddPair(name, varInfo);
 
@@ -463,6 +507,11 @@ bool PVAccessServer::SetCallback (const char* name, std::function<void(const ccs
 bool PVAccessServer_Impl::SetCallback (ccs::types::uint32 id, std::function<void(const ccs::types::AnyValue&)> cb) { VariableInfo_t varInfo; bool status = this->IsValid(id); if (status) { (this->m_var_table)->GetValue(varInfo, id); varInfo.cb = cb; (this->m_var_table)->SetValue(varInfo, id); } return status; }
 bool PVAccessServer_Impl::SetCallback (const char* name, std::function<void(const ccs::types::AnyValue&)> cb) { return this->SetCallback(this->GetVariableId(name), cb); }
 
+bool PVAccessServer::SetPostPeriod (const char* name, ccs::types::uint64 period) { return __impl->SetPostPeriod(name, period); }
+
+bool PVAccessServer_Impl::SetPostPeriod (ccs::types::uint32 id, ccs::types::uint64 period) { VariableInfo_t varInfo; bool status = this->IsValid(id); if (status) { (this->m_var_table)->GetValue(varInfo, id); varInfo.period = period; (this->m_var_table)->SetValue(varInfo, id); } return status; }
+bool PVAccessServer_Impl::SetPostPeriod (const char* name, ccs::types::uint64 period) { return this->SetPostPeriod(this->GetVariableId(name), period); }
+
 // Constructor methods
 
 PVAccessServer::PVAccessServer (void)
@@ -514,6 +563,18 @@ PVAccessServer_Impl::~PVAccessServer_Impl (void)
 
   // Release resources
   if (this->m_thread != NULL) delete this->m_thread;
+
+  for (ccs::types::uint32 index = 0u; ((this->m_var_table != NULL) && (index < (this->m_var_table)->GetSize())); index += 1u)
+    {
+      VariableInfo_t* varInfo = (this->m_var_table)->GetReference(index);
+
+      if ((static_cast<VariableInfo_t*>(NULL) != varInfo) && (static_cast<ccs::types::uint8*>(NULL) != varInfo->posted))
+	{
+	  delete [] varInfo->posted;
+	  varInfo->posted = static_cast<ccs::types::uint8*>(NULL);
+	}
+    }
+
   if (this->m_var_table != NULL) delete this->m_var_table;
 
   // Remove instance from object database
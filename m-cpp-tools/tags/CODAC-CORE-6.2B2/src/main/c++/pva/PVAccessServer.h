@@ -291,6 +291,19 @@ class PVAccessServer
 
     void UpdateVariable (const char* name);
 
+    /**
+     * @brief Accessor. SetPostPeriod method.
+     * @detail The method limits the rate at which updates of an output or bi-directional
+     * variable are posted to the PVA record. Successive calls to UpdateVariable within the
+     * period are coalesced into a single post. Only the fields which changed since the last
+     * post are written to the record, so that monitoring clients receive modified fields only.
+     * @param name Variable identifier.
+     * @param period Minimum period between successive posts [ns], 0 to post at every cycle.
+     * @return True if successful.
+     */ 
+
+    bool SetPostPeriod (const char* name, ccs::types::uint64 period);
+
     /**
      * @brief Accessor. SetCallback method.
      * @detail The method installs an application callback to be called synchronously when
@@ -22,6 +22,10 @@
 // Global header files
 
 #include <new> // std::nothrow
+#include <future> // std::future
+#include <chrono> // std::chrono::steady_clock
+#include <memory> // std::shared_ptr
+#include <vector> // std::vector
 
 #include <BasicTypes.h> // Global type definition
 #include <SysTools.h> // Misc. helper functions
@@ -72,6 +76,65 @@ const char * RPCClient::GetService (void) const { return __impl->GetService(); }
 bool RPCClient::SetService (const char* service) { return __impl->SetService(service); }
 
 ccs::types::AnyValue RPCClient::SendRequest (const ccs::types::AnyValue& request) const { return __impl->SendRequest(request); }
+std::future<ccs::types::AnyValue> RPCClient::SendRequestAsync (const ccs::types::AnyValue& request) const { return __impl->SendRequestAsync(request); }
+
+bool RPCClient::SendRequests (const char * const * services, const ccs::types::AnyValue* requests, ccs::types::AnyValue* replies, const ccs::types::uint32 number)
+{
+
+  bool status = ((static_cast<const char * const *>(NULL) != services) &&
+		 (static_cast<const ccs::types::AnyValue*>(NULL) != requests) &&
+		 (static_cast<ccs::types::AnyValue*>(NULL) != replies));
+
+  std::vector<std::shared_ptr<RPCClient>> clients;
+  std::vector<std::future<ccs::types::AnyValue>> futures;
+
+  // Launch all clients, i.e. connections proceed concurrently ..
+  for (ccs::types::uint32 index = 0u; (status && (index < number)); index += 1u)
+    {
+      clients.push_back(std::make_shared<RPCClient>(services[index]));
+    }
+
+  // .. issue all requests ..
+  for (ccs::types::uint32 index = 0u; (status && (index < number)); index += 1u)
+    {
+      futures.push_back(clients[index]->SendRequestAsync(requests[index]));
+    }
+
+  // .. and collect replies, all requests being bounded by the same deadline
+  std::chrono::steady_clock::time_point till = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<ccs::types::float64>(DEFAULT_PVARPC_TIMEOUT));
+
+  bool ok = status;
+
+  for (ccs::types::uint32 index = 0u; (index < futures.size()); index += 1u)
+    {
+      if (std::future_status::ready != futures[index].wait_until(till))
+	{
+	  // Cancel pending request, i.e. future ready with error reply
+	  clients[index]->__impl->Terminate();
+	}
+
+      replies[index] = futures[index].get();
+
+      bool reply = ccs::HelperTools::HasAttribute(&replies[index], "status");
+
+      if (reply)
+	{
+	  reply = ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&replies[index], "status");
+	}
+
+      if (!reply)
+	{
+	  log_warning("RPCClient::SendRequests - Request to '%s' failed", services[index]);
+	}
+
+      ok = ok && reply;
+    }
+
+  status = ok;
+
+  return status;
+
+}
 
 RPCClient::RPCClient (void) { __impl = dynamic_cast<RPCClientImpl*>(new (std::nothrow) PVAccessRPCClient ()); return; }
 
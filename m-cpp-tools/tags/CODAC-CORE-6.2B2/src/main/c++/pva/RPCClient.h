@@ -33,6 +33,8 @@
 
 // Global header files
 
+#include <future> // std::future
+
 #include <AnyValue.h> // Variable with introspectable data type ..
 
 // Local header files
@@ -49,7 +51,9 @@ class RPCClientImpl; // Forward class declaration
 
 /**
  * @brief Interface class providing support for RPC client.
- * @detail ToDo.
+ * @detail The RPC client provides synchronous and asynchronous requests to a named
+ * service, as well as a batch method to issue requests concurrently to several services.
+ * Connections are reused across instances associated to the same service.
  *
  * @note The design is based on a bridge pattern to avoid exposing technology-specific
  * internals through the interface class.
@@ -131,6 +135,33 @@ class RPCClient
 
     ccs::types::AnyValue SendRequest (const ccs::types::AnyValue& request) const;
 
+    /**
+     * @brief SendRequestAsync method.
+     * @detail The request is sent to the RPC server and the method returns without waiting
+     * for the reply. Several requests may be in flight concurrently.
+     * @return Future reply from the RPC server.
+     * @note The returned future may be waited upon with a timeout. Pending requests are
+     * cancelled upon destruction of the RPCClient instance, the future then holds an error
+     * reply.
+     */
+
+    std::future<ccs::types::AnyValue> SendRequestAsync (const ccs::types::AnyValue& request) const;
+
+    /**
+     * @brief SendRequests method.
+     * @detail The clients are all launched before the requests are issued concurrently to
+     * the respective RPC services, the replies are then collected. The overall duration,
+     * connection included, is therefore that of the slowest request rather than the sum
+     * over all requests.
+     * @param services Array of RPC service names.
+     * @param requests Array of requests, one per service.
+     * @param replies Array of replies, one per service.
+     * @param number Number of requests.
+     * @return True if all replies were received with a true 'status' attribute.
+     */
+
+    static bool SendRequests (const char * const * services, const ccs::types::AnyValue* requests, ccs::types::AnyValue* replies, const ccs::types::uint32 number);
+
 };
 
 // Global variables
@@ -22,6 +22,7 @@
 // Global header files
 
 #include <new> // std::nothrow
+#include <future> // std::async
 
 #include <BasicTypes.h> // Global type definition
 #include <SysTools.h> // Misc. helper functions
@@ -63,6 +64,15 @@ namespace base {
 const char * RPCClientImpl::GetService (void) const { return __service; }
 bool RPCClientImpl::SetService (const char* service) { ccs::HelperTools::SafeStringCopy(__service, service, STRING_MAX_LENGTH); return true; }
 
+std::future<ccs::types::AnyValue> RPCClientImpl::SendRequestAsync (const ccs::types::AnyValue& request) const
+{
+
+  ccs::types::AnyValue copy (request);
+
+  return std::async(std::launch::async, [this, copy] (void) { return this->SendRequest(copy); });
+
+}
+
 bool RPCClientImpl::Terminate (void) { return true; }
 
 RPCClientImpl::RPCClientImpl (void)
@@ -33,6 +33,8 @@
 
 // Global header files
 
+#include <future> // std::future
+
 #include <AnyValue.h> // Variable with introspectable data type ..
 
 // Local header files
@@ -126,6 +128,16 @@ class RPCClientImpl
 
     virtual ccs::types::AnyValue SendRequest (const ccs::types::AnyValue& request) const = 0;
 
+    /**
+     * @brief Virtual method.
+     * @detail The request is sent to the server and the reply is provided through the
+     * returned future. The default implementation calls SendRequest() in a separate thread.
+     * May be overloaded to provide implementation-specific behaviour.
+     * @return Future reply from the server.
+     */
+
+    virtual std::future<ccs::types::AnyValue> SendRequestAsync (const ccs::types::AnyValue& request) const;
+
 };
 
 // Global variables
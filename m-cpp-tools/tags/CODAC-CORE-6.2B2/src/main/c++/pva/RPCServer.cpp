@@ -79,6 +79,60 @@ const char* RPCServer::GetService (void) const
 
 }
 
+bool RPCServer::SetWorkers (const ccs::types::uint32 workers, const ccs::types::uint32 depth)
+{
+
+  bool status = (static_cast<RPCServerImpl*>(NULL) != __impl);
+
+  if (status)
+    {
+      status = __impl->SetWorkers(workers, depth);
+    }
+
+  return status;
+
+}
+
+bool RPCServer::SetConcurrent (const bool concurrent, const ccs::types::uint32 limit)
+{
+
+  bool status = (static_cast<RPCServerImpl*>(NULL) != __impl);
+
+  if (status)
+    {
+      status = __impl->SetConcurrent(concurrent, limit);
+    }
+
+  return status;
+
+}
+
+bool RPCServer::GetStatistics (RPCTypes::ServerStatistics_t& statistics) const
+{
+
+  bool status = (static_cast<RPCServerImpl*>(NULL) != __impl);
+
+  if (status)
+    {
+      status = __impl->GetStatistics(statistics);
+    }
+
+  return status;
+
+}
+
+void RPCServer::Terminate (void)
+{
+
+  if (static_cast<RPCServerImpl*>(NULL) != __impl)
+    {
+      (void)__impl->Terminate();
+    }
+
+  return;
+
+}
+
 RPCServer::RPCServer (const char* service)
 { 
 
@@ -117,6 +171,9 @@ RPCServer::~RPCServer (void)
 
   if (static_cast<RPCServerImpl*>(NULL) != __impl)
     { 
+      // WARNING - The implementation class is already destroyed, its destructor is expected to
+      // have called Terminate .. in which case this is a NOOP
+      (void)__impl->Terminate();
       delete __impl; 
     }
 
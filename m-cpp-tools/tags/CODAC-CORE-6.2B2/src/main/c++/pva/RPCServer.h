@@ -38,6 +38,8 @@
 
 // Local header files
 
+#include "RPCTypes.h" // ccs::base::RPCTypes::ServerStatistics_t
+
 // Constants
 
 // Type definition
@@ -87,7 +89,7 @@ class RPCServerImpl; // Forward class declaration
 	   ->AddAttribute<ccs::types::string>("reason"));
        };
 
-       virtual ~SpecialisedRPCHandler (void) {};
+       virtual ~SpecialisedRPCHandler (void) { Terminate(); };
 
        virtual ccs::types::AnyValue HandleRequest (const ccs::types::AnyValue& request) {
 
@@ -111,6 +113,14 @@ class RPCServerImpl; // Forward class declaration
 
    @endcode
  *
+ * By default, the HandleRequest method is called in the context of the transport thread.
+ * A pool of worker threads with a bounded request queue may be configured through the
+ * SetWorkers method, e.g. in the constructor of the implementation class. Requests are then
+ * handled by one worker at a time unless the implementation declares HandleRequest safe for
+ * concurrent execution through the SetConcurrent method. Requests received whilst the queue is
+ * full are replied to with a 'failure' qualifier. The implementation class destructor must
+ * call the Terminate method so that no request is handled during its destruction.
+ *
  * @note The design is based on a bridge pattern to avoid exposing server-specific
  * internals through the interface class, e.g. transport technology, etc.
  *
@@ -131,6 +141,16 @@ class RPCServer
 
   protected:
 
+    /**
+     * @brief Terminate method.
+     * @detail Stops the worker pool, if any, and replies with a 'failure' qualifier to
+     * requests pending or received thereafter. The HandleRequest method is not called
+     * anymore upon return. Implementation classes must call this method from their own
+     * destructor, i.e. before HandleRequest goes away.
+     */
+
+    void Terminate (void);
+
   public:
 
     /**
@@ -155,6 +175,38 @@ class RPCServer
 
     const char* GetService (void) const;
 
+    /**
+     * @brief Accessor.
+     * @detail Starts a pool of worker threads calling the HandleRequest method. The pool
+     * can be started once.
+     * @param workers Number of worker threads.
+     * @param depth Maximum number of requests pending in the queue.
+     * @return True if successful, false otherwise.
+     */
+
+    bool SetWorkers (const ccs::types::uint32 workers, const ccs::types::uint32 depth = DEFAULT_RPC_QUEUE_DEPTH);
+
+    /**
+     * @brief Accessor.
+     * @detail Declares the HandleRequest method safe for concurrent execution by the
+     * worker pool.
+     * @param concurrent True if HandleRequest is reentrant.
+     * @param limit Maximum number of concurrent HandleRequest calls, 0 for as many as workers.
+     * @return True if successful, false otherwise.
+     */
+
+    bool SetConcurrent (const bool concurrent, const ccs::types::uint32 limit = 0u);
+
+    /**
+     * @brief Accessor.
+     * @detail Provides request counters as well as cumulative and maximum time spent
+     * in queue and from reception to reply, in ns.
+     * @param statistics Server statistics.
+     * @return True if successful, false otherwise.
+     */
+
+    bool GetStatistics (RPCTypes::ServerStatistics_t& statistics) const;
+
     /**
      * @brief Virtual handler method.
      * @param request Received structure associated to an introspectable type definition.
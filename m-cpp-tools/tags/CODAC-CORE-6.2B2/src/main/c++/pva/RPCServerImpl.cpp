@@ -23,6 +23,7 @@
 
 #include <new> // std::nothrow
 #include <functional> // std::function
+#include <algorithm> // std::min
 
 #include <BasicTypes.h> // Global type definition
 #include <SysTools.h> // Misc. helper functions
@@ -61,6 +62,23 @@ namespace base {
 
 // Function definition
 
+static ccs::types::AnyValue GetFailureReply (const char* reason)
+{
+
+  // Copy the base reply type ..
+  ccs::types::CompoundType __reply_type (*ccs::base::RPCTypes::Reply_int); // Default RPC reply type
+  // Instantiate RPC reply ..
+  ccs::types::AnyValue __reply_value (__reply_type);
+  
+  ccs::HelperTools::SetAttributeValue<ccs::types::uint64>(&__reply_value, "timestamp", ccs::HelperTools::GetCurrentTime());
+  ccs::HelperTools::SetAttributeValue<ccs::types::boolean>(&__reply_value, "status", false);
+  ccs::HelperTools::SetAttributeValue(&__reply_value, "qualifier", "failure");
+  ccs::HelperTools::SetAttributeValue(&__reply_value, "reason", reason);
+
+  return __reply_value;
+
+}
+
 const char* RPCServerImpl::GetService (void) const { return __service; }
 bool RPCServerImpl::SetService (const char* service) { ccs::HelperTools::SafeStringCopy(__service, service, STRING_MAX_LENGTH); return true; }
 
@@ -88,30 +106,285 @@ ccs::types::AnyValue RPCServerImpl::CallHandler (const ccs::types::AnyValue& req
 
   if (!status)
     {
-      // Copy the base reply type ..
-      ccs::types::CompoundType __reply_type (*ccs::base::RPCTypes::Reply_int); // Default RPC reply type
-      // Instantiate RPC reply ..
-      ccs::types::AnyValue __reply_value (__reply_type);
-  
-      ccs::HelperTools::SetAttributeValue<ccs::types::uint64>(&__reply_value, "timestamp", ccs::HelperTools::GetCurrentTime());
-      ccs::HelperTools::SetAttributeValue<ccs::types::boolean>(&__reply_value, "status", status);
-      ccs::HelperTools::SetAttributeValue(&__reply_value, "qualifier", "failure");
-      ccs::HelperTools::SetAttributeValue(&__reply_value, "reason", "Unregistered handler or exception caught");
-
       // Provide error reply
-      reply = __reply_value;
+      reply = GetFailureReply("Unregistered handler or exception caught");
     }
 
   return reply;
 
 }
 
-bool RPCServerImpl::Terminate (void) { return true; }
+void RPCServerImpl::Account (const ccs::types::uint64 received, const ccs::types::uint64 dequeued)
+{
+
+  ccs::types::uint64 replied = ccs::HelperTools::GetCurrentTime();
+
+  std::lock_guard<std::mutex> lock (__mutex);
+
+  __statistics.completed += 1ul;
+  __statistics.queue_time += (dequeued - received);
+  __statistics.latency += (replied - received);
+
+  if (__statistics.queue_time_max < (dequeued - received))
+    {
+      __statistics.queue_time_max = (dequeued - received);
+    }
+
+  if (__statistics.latency_max < (replied - received))
+    {
+      __statistics.latency_max = (replied - received);
+    }
+
+  return;
+
+}
+
+bool RPCServerImpl::Dispatch (const ccs::types::AnyValue& request, std::function<void(const ccs::types::AnyValue&)> reply)
+{
+
+  ccs::types::uint64 received = ccs::HelperTools::GetCurrentTime();
+
+  bool pooled = false;
+  bool status = true;
+
+  {
+    std::lock_guard<std::mutex> lock (__mutex);
+
+    status = !__terminate; // Handler may be going away
+    pooled = (status && (0u < __pool.size()));
+
+    if (pooled)
+      {
+	status = (__queue.size() < __depth);
+      }
+
+    if (!pooled && status)
+      {
+	__running += 1u; // Waited for upon termination
+      }
+
+    if (pooled && status)
+      {
+	Pending_t pending;
+
+	pending.request = request;
+	pending.reply = reply;
+	pending.received = received;
+
+	__queue.push_back(pending);
+      }
+
+    if (status)
+      {
+	__statistics.accepted += 1ul;
+      }
+    else
+      {
+	__statistics.rejected += 1ul;
+      }
+  }
+
+  if (pooled && status)
+    {
+      __cond.notify_one();
+    }
+
+  if (!pooled && status)
+    {
+      // Call handler in the context of the caller
+      reply(CallHandler(request));
+      Account(received, received);
+
+      {
+	std::lock_guard<std::mutex> lock (__mutex);
+	__running -= 1u;
+      }
+
+      __cond.notify_all();
+    }
+
+  if (!status && pooled)
+    {
+      log_warning("RPCServerImpl::Dispatch - Request queue full");
+      reply(GetFailureReply("Request queue full"));
+    }
+  else if (!status)
+    {
+      reply(GetFailureReply("Server terminating"));
+    }
+
+  return status;
+
+}
+
+void RPCServerImpl::Process (void)
+{
+
+  std::unique_lock<std::mutex> lock (__mutex);
+
+  while (!__terminate)
+    {
+      ccs::types::uint32 limit = (__concurrent ? __limit : 1u);
+
+      if (__queue.empty() || (__running >= limit))
+	{
+	  __cond.wait(lock);
+	  continue;
+	}
+
+      Pending_t pending = __queue.front();
+      __queue.pop_front();
+      __running += 1u;
+
+      lock.unlock();
+
+      ccs::types::uint64 dequeued = ccs::HelperTools::GetCurrentTime();
+      pending.reply(CallHandler(pending.request));
+      Account(pending.received, dequeued);
+
+      lock.lock();
+
+      __running -= 1u;
+      __cond.notify_all();
+    }
+
+  return;
+
+}
+
+void RPCServerImpl::StopWorkers (void)
+{
+
+  std::deque<Pending_t> pending;
+
+  {
+    std::lock_guard<std::mutex> lock (__mutex);
+    __terminate = true;
+  }
+
+  __cond.notify_all();
+
+  for (std::vector<std::thread>::iterator it = __pool.begin(); it != __pool.end(); ++it)
+    {
+      if (it->joinable())
+	{
+	  it->join();
+	}
+    }
+
+  {
+    std::unique_lock<std::mutex> lock (__mutex);
+
+    while (0u < __running)
+      { // Handler called in the context of the transport thread
+	__cond.wait(lock);
+      }
+
+    __pool.clear();
+    __queue.swap(pending);
+  }
+
+  // Reply to requests left in queue
+  for (std::deque<Pending_t>::iterator it = pending.begin(); it != pending.end(); ++it)
+    {
+      it->reply(GetFailureReply("Server terminating"));
+    }
+
+  return;
+
+}
+
+bool RPCServerImpl::SetWorkers (const ccs::types::uint32 workers, const ccs::types::uint32 depth)
+{
+
+  std::lock_guard<std::mutex> lock (__mutex);
+
+  bool status = (__pool.empty() && !__terminate);
+
+  if (!status)
+    {
+      log_error("RPCServerImpl::SetWorkers - Worker pool already started");
+    }
+
+  if (status)
+    {
+      status = ((0u < workers) && (0u < depth));
+    }
+
+  if (status)
+    {
+      __depth = depth;
+
+      if (0u == __limit)
+	{
+	  __limit = workers;
+	}
+
+      __limit = std::min(__limit, workers);
+
+      for (ccs::types::uint32 index = 0u; index < workers; index += 1u)
+	{
+	  __pool.push_back(std::thread(&RPCServerImpl::Process, this));
+	}
+
+      log_info("RPCServerImpl::SetWorkers - Started '%u' workers with queue depth '%u'", workers, depth);
+    }
+
+  return status;
+
+}
+
+bool RPCServerImpl::SetConcurrent (const bool concurrent, const ccs::types::uint32 limit)
+{
+
+  {
+    std::lock_guard<std::mutex> lock (__mutex);
+
+    __concurrent = concurrent;
+
+    if (0u == limit)
+      {
+	__limit = static_cast<ccs::types::uint32>(__pool.size());
+      }
+    else if (__pool.empty())
+      {
+	__limit = limit;
+      }
+    else
+      {
+	__limit = std::min(limit, static_cast<ccs::types::uint32>(__pool.size()));
+      }
+  }
+
+  __cond.notify_all();
+
+  return true;
+
+}
+
+bool RPCServerImpl::GetStatistics (RPCTypes::ServerStatistics_t& statistics) const
+{
+
+  std::lock_guard<std::mutex> lock (__mutex);
+
+  statistics = __statistics;
+
+  return true;
+
+}
+
+bool RPCServerImpl::Terminate (void) { StopWorkers(); return true; }
 
 RPCServerImpl::RPCServerImpl (void)
 { 
   // Initialise attributes
   __cb = NULL;
+
+  __depth = DEFAULT_RPC_QUEUE_DEPTH;
+  __limit = 0u;
+  __running = 0u;
+  __concurrent = false;
+  __terminate = false;
   ccs::HelperTools::SafeStringCopy(__service, STRING_UNDEFINED, STRING_MAX_LENGTH); 
 
   // Register types in GlobalTypeDatabase
@@ -124,7 +397,7 @@ RPCServerImpl::RPCServerImpl (void)
 RPCServerImpl::~RPCServerImpl (void)
 { 
 
-  Terminate();
+  StopWorkers();
 
   return;
 
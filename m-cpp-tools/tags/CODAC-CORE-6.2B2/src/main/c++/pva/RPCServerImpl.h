@@ -34,11 +34,18 @@
 // Global header files
 
 #include <functional> // std::function
+#include <condition_variable> // std::condition_variable
+#include <deque> // std::deque
+#include <mutex> // std::mutex
+#include <thread> // std::thread
+#include <vector> // std::vector
 
 #include <AnyValue.h> // Variable with introspectable data type ..
 
 // Local header files
 
+#include "RPCTypes.h"
+
 // Constants
 
 // Type definition
@@ -58,6 +65,13 @@ namespace base {
  *
  * The base class provides a mechanism to externally define a handler callback.
  *
+ * The base class also provides an optional pool of worker threads. Transport implementations
+ * hand requests over through the Dispatch() method, which either calls the handler in the
+ * context of the caller (no pool configured, default) or appends the request to a bounded
+ * queue served by the pool. Requests received whilst the queue is full are replied to with a
+ * failure reply. The handler is called by at most one worker at a time unless it is declared
+ * safe for concurrent execution, in which case the concurrency limit applies.
+ *
  * @code
    class PVAccessRPCServer : public ccs::base::RPCServerImpl, public epics::pvAccess::RPCService
    {
@@ -135,6 +149,54 @@ class RPCServerImpl
 
     std::function<ccs::types::AnyValue(const ccs::types::AnyValue&)> __cb;
 
+    /**
+     * @brief Attribute. 
+     * @detail Request pending in the worker pool queue.
+     */
+
+    typedef struct Pending {
+      ccs::types::AnyValue request;
+      std::function<void(const ccs::types::AnyValue&)> reply;
+      ccs::types::uint64 received;
+    } Pending_t;
+
+    ccs::types::uint32 __depth; // Queue bound
+    ccs::types::uint32 __limit; // Concurrency limit, if handler declared concurrent-safe
+    ccs::types::uint32 __running; // Handler calls in progress
+    bool __concurrent;
+    bool __terminate;
+
+    std::deque<Pending_t> __queue;
+    std::vector<std::thread> __pool;
+
+    mutable std::mutex __mutex;
+    std::condition_variable __cond;
+
+    RPCTypes::ServerStatistics_t __statistics;
+
+    /**
+     * @brief Worker thread method.
+     * @detail Dequeues requests as long as the concurrency limit allows, calls the handler,
+     * and provides the reply through the callback attached to the request.
+     */
+
+    void Process (void);
+
+    /**
+     * @brief Accessor.
+     * @detail Stops and joins the worker threads. Pending requests are replied to with
+     * a failure reply.
+     */
+
+    void StopWorkers (void);
+
+    /**
+     * @brief Accessor.
+     * @detail Updates statistics upon reply.
+     */
+
+    void Account (const ccs::types::uint64 received, const ccs::types::uint64 dequeued);
+
   protected:
 
   public:
@@ -197,6 +259,48 @@ class RPCServerImpl
 
     ccs::types::AnyValue CallHandler (const ccs::types::AnyValue& request) const;
 
+    /**
+     * @brief Accessor.
+     * @param request Request received as input for RPC.
+     * @param reply Function callback called with the RPC reply.
+     * @detail Hands the request over to the worker pool, if any, or calls the RPC handler
+     * in the context of the caller otherwise. The reply callback is called in any condition,
+     * possibly from a worker thread and with a failure reply if the request is rejected.
+     * @return True if the request is accepted, false if rejected due to a full queue.
+     */
+
+    bool Dispatch (const ccs::types::AnyValue& request, std::function<void(const ccs::types::AnyValue&)> reply);
+
+    /**
+     * @brief Accessor.
+     * @detail Starts the worker pool. Without pool, the handler is called in the context
+     * of the transport thread.
+     * @param workers Number of worker threads.
+     * @param depth Maximum number of requests pending in the queue.
+     * @return True if successful, false if the pool is already started or parameters are invalid.
+     */
+
+    bool SetWorkers (const ccs::types::uint32 workers, const ccs::types::uint32 depth = DEFAULT_RPC_QUEUE_DEPTH);
+
+    /**
+     * @brief Accessor.
+     * @detail Declares the handler safe for concurrent execution. The handler is otherwise
+     * called by one worker at a time.
+     * @param concurrent True if the handler is reentrant.
+     * @param limit Maximum number of concurrent handler calls, 0 for as many as workers.
+     * @return True in any condition.
+     */
+
+    bool SetConcurrent (const bool concurrent, const ccs::types::uint32 limit = 0u);
+
+    /**
+     * @brief Accessor.
+     * @param statistics Request counters and cumulative/maximum queue time and latency.
+     * @return True in any condition.
+     */
+
+    bool GetStatistics (RPCTypes::ServerStatistics_t& statistics) const;
+
 };
 
 // Global variables
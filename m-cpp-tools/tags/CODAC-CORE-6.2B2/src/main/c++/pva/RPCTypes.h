@@ -43,6 +43,8 @@
 #define RPCReply_TypeName "ccs::RPCReply_t/v1.0"
 #define RPCRequest_TypeName "ccs::RPCRequest_t/v1.0"
 
+#define DEFAULT_RPC_QUEUE_DEPTH 64u // Pending requests in the server worker pool
+
 // Type definition
 
 namespace ccs {
@@ -71,6 +73,16 @@ template <typename Type> struct __attribute__((packed)) ReplyWithValue : public
   Type value;
 };
 
+typedef struct ServerStatistics {
+  ccs::types::uint64 accepted = 0ul; // Requests accepted for processing
+  ccs::types::uint64 rejected = 0ul; // Requests rejected due to a full queue
+  ccs::types::uint64 completed = 0ul; // Requests replied to
+  ccs::types::uint64 queue_time = 0ul; // Cumulative time spent waiting in queue [ns]
+  ccs::types::uint64 queue_time_max = 0ul; // [ns]
+  ccs::types::uint64 latency = 0ul; // Cumulative time from reception to reply [ns]
+  ccs::types::uint64 latency_max = 0ul; // [ns]
+} ServerStatistics_t;
+
 // Global variables
 
 extern std::shared_ptr<const ccs::types::CompoundType> Request_int; // Introspectable type definition
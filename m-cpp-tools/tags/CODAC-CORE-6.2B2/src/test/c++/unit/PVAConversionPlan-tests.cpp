@@ -0,0 +1,132 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-tools/tags/CODAC-CORE-6.2B2/src/test/c++/unit/PVAConversionPlan-tests.cpp $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Unit test code
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*				  CS 90 046
+*				  13067 St. Paul-lez-Durance Cedex
+*				  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <new> // std::nothrow, etc.
+
+#include <gtest/gtest.h> // Google test framework
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+#include "TimeTools.h" // Misc. helper functions
+
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyTypeHelper.h"
+#include "AnyValueHelper.h"
+
+#include "RPCClient.h"
+#include "RPCServer.h"
+
+#include "PVAConversionPlan.h"
+
+// Constants
+
+#define RPC_TEST_SERVICE "ccs::test::plan"
+#define RPC_TEST_REQUESTS 10u
+
+// Type definition
+
+class PVAConversionPlan_Test : public ccs::base::RPCServer
+{
+
+  public:
+
+    PVAConversionPlan_Test (const char* service) : ccs::base::RPCServer(service) {};
+    virtual ~PVAConversionPlan_Test (void) { Terminate(); };
+
+    virtual ccs::types::AnyValue HandleRequest (const ccs::types::AnyValue& request) {
+
+      // Reply type created anew upon each request
+      ccs::types::CompoundType reply_type ("ccs::test::PlanReply_t");
+      reply_type.AddAttribute<ccs::types::uint64>("timestamp");
+      reply_type.AddAttribute<ccs::types::string>("qualifier");
+      reply_type.AddAttribute<ccs::types::boolean>("status");
+      reply_type.AddAttribute<ccs::types::uint32>("value");
+
+      ccs::types::AnyValue reply (reply_type);
+
+      ccs::HelperTools::SetAttributeValue<ccs::types::uint64>(&reply, "timestamp", ccs::HelperTools::GetCurrentTime());
+      ccs::HelperTools::SetAttributeValue(&reply, "qualifier", "reply");
+      ccs::HelperTools::SetAttributeValue<ccs::types::boolean>(&reply, "status", true);
+      ccs::HelperTools::SetAttributeValue<ccs::types::uint32>(&reply, "value", ccs::HelperTools::GetAttributeValue<ccs::types::uint32>(&request, "value"));
+
+      return reply;
+
+    };
+
+};
+
+// Global variables
+
+static ccs::log::Func_t __handler = ccs::log::SetStdout();
+
+// Function declaration
+
+// Function definition
+
+TEST(PVAConversionPlan_Test, RPC_CacheHits)
+{
+  using namespace ccs::types;
+
+  PVAConversionPlan_Test server (RPC_TEST_SERVICE);
+
+  ccs::base::RPCClient client (RPC_TEST_SERVICE);
+
+  bool ret = client.Launch();
+
+  uint64 hits = ccs::base::PVAConversionPlan::GetCacheHits();
+
+  for (uint32 index = 0u; (ret && (index < RPC_TEST_REQUESTS)); index += 1u)
+    {
+      // Request type created anew upon each request
+      CompoundType request_type ("ccs::test::PlanRequest_t");
+      request_type.AddAttribute<uint64>("timestamp");
+      request_type.AddAttribute<string>("qualifier");
+      request_type.AddAttribute<uint32>("value");
+
+      AnyValue request (request_type);
+
+      ret = (ccs::HelperTools::SetAttributeValue(&request, "qualifier", "request") &&
+	     ccs::HelperTools::SetAttributeValue<uint32>(&request, "value", index));
+
+      if (ret)
+	{
+	  AnyValue reply = client.SendRequest(request);
+	  ret = (ccs::HelperTools::HasAttribute(&reply, "value") &&
+		 (index == ccs::HelperTools::GetAttributeValue<uint32>(&reply, "value")));
+	}
+    }
+
+  if (ret)
+    { // Request and reply structures on either end, i.e. at least 3 lookups per request after the first
+      hits = ccs::base::PVAConversionPlan::GetCacheHits() - hits;
+      log_info("TEST(PVAConversionPlan_Test, RPC_CacheHits) - '%lu' cache hits over '%u' requests", hits, RPC_TEST_REQUESTS);
+      ret = ((3u * (RPC_TEST_REQUESTS - 1u)) <= hits);
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
@@ -0,0 +1,279 @@
+/******************************************************************************
+* $HeadURL: https://svnpub.iter.org/codac/iter/codac/dev/units/m-cpp-tools/tags/CODAC-CORE-6.2B2/src/test/c++/unit/PVAccessServer-tests.cpp $
+* $Id$
+*
+* Project	: CODAC Core System
+*
+* Description	: Unit test code
+*
+* Author        : Bertrand Bauvir (IO)
+*
+* Copyright (c) : 2010-2019 ITER Organization,
+*				  CS 90 046
+*				  13067 St. Paul-lez-Durance Cedex
+*				  France
+*
+* This file is part of ITER CODAC software.
+* For the terms and conditions of redistribution or use of this software
+* refer to the file ITER-LICENSE.TXT located in the top level directory
+* of the distribution package.
+******************************************************************************/
+
+// Global header files
+
+#include <memory> // std::shared_ptr, etc.
+#include <new> // std::nothrow, etc.
+
+#include <pv/pvData.h>
+
+#include <gtest/gtest.h> // Google test framework
+
+// Local header files
+
+#include "BasicTypes.h" // Misc. type definition
+#include "SysTools.h" // Misc. helper functions
+#include "TimeTools.h" // Misc. helper functions
+
+#include "log-api.h" // Syslog wrapper routines
+
+#include "AnyTypeHelper.h"
+#include "AnyValueHelper.h"
+
+#include "AnyTypeToPVA.h"
+#include "AnyValueToPVA.h"
+
+#include "PVAccessServer.h"
+#include "PVAccessClient.h"
+#include "PVAccessMonitor.h"
+
+// Constants
+
+#define PVA_TEST_SETTLE 1000000000ul // 1s
+#define PVA_TEST_UPDATES 100u
+
+// Type definition
+
+class PVAccessServer_Test : public ccs::base::PVAccessMonitor
+{
+
+  public:
+
+    volatile ccs::types::uint32 count;
+    volatile ccs::types::uint32 last;
+
+    PVAccessServer_Test (const char* channel) : ccs::base::PVAccessMonitor(channel, true), count(0u), last(0u) {};
+    virtual ~PVAccessServer_Test (void) {};
+
+    virtual void HandleMonitor (const ccs::types::AnyValue& value) {
+
+      count += 1u;
+      last = ccs::HelperTools::GetAttributeValue<ccs::types::uint32>(&value, "counter");
+
+    };
+
+};
+
+// Global variables
+
+static ccs::log::Func_t __handler = ccs::log::SetStdout();
+
+// Function declaration
+
+// Function definition
+
+/**
+ * @brief Server records are created when the server is launched, the
+ * variables of every test are therefore registered upon first call.
+ */
+
+static ccs::base::PVAccessServer* LaunchServer (void)
+{
+
+  using namespace ccs::types;
+
+  static ccs::base::PVAccessServer* server = static_cast<ccs::base::PVAccessServer*>(NULL);
+
+  if (static_cast<ccs::base::PVAccessServer*>(NULL) != server)
+    {
+      return server;
+    }
+
+  std::shared_ptr<const AnyType> writeback (dynamic_cast<AnyType*>((new (std::nothrow) CompoundType ("ccs::test::WriteBack_t"))
+								  ->AddAttribute("value", "uint32")));
+
+  std::shared_ptr<const AnyType> postperiod (dynamic_cast<AnyType*>((new (std::nothrow) CompoundType ("ccs::test::PostPeriod_t"))
+								   ->AddAttribute("counter", "uint32")));
+
+  ccs::base::PVAccessServer* instance = ccs::base::PVAccessInterface::GetInstance<ccs::base::PVAccessServer>();
+
+  bool status = (static_cast<ccs::base::PVAccessServer*>(NULL) != instance);
+
+  if (status)
+    {
+      status = (instance->AddVariable("ccs::test::writeback", AnyputVariable, writeback.get()) &&
+		instance->AddVariable("ccs::test::postperiod", OutputVariable, postperiod.get()) &&
+		instance->SetPostPeriod("ccs::test::postperiod", 200000000ul) && // 200ms
+		instance->SetPeriod(10000000ul) &&
+		instance->Launch());
+    }
+
+  if (status)
+    {
+      server = instance;
+    }
+
+  return server;
+
+}
+
+TEST(PVAccessServer_Test, WriteBack)
+{
+  using namespace ccs::types;
+
+  std::shared_ptr<const AnyType> type (dynamic_cast<AnyType*>((new (std::nothrow) CompoundType ("ccs::test::WriteBack_t"))
+							     ->AddAttribute("value", "uint32")));
+
+  ccs::base::PVAccessServer* server = LaunchServer();
+  ccs::base::PVAccessClient* client = ccs::base::PVAccessInterface::GetInstance<ccs::base::PVAccessClient>();
+
+  bool ret = ((static_cast<ccs::base::PVAccessServer*>(NULL) != server) &&
+	      (static_cast<ccs::base::PVAccessClient*>(NULL) != client));
+
+  if (ret)
+    {
+      ret = (client->AddVariable("ccs::test::writeback", AnyputVariable, type.get()) &&
+	     client->SetPeriod(10000000ul) &&
+	     client->Launch());
+      ccs::HelperTools::SleepFor(PVA_TEST_SETTLE);
+    }
+
+  uint32 value = 1u;
+
+  if (ret)
+    { // Server post
+      ret = server->SetVariable("ccs::test::writeback", value);
+      ccs::HelperTools::SleepFor(PVA_TEST_SETTLE);
+    }
+
+  if (ret)
+    {
+      ret = (client->GetVariable("ccs::test::writeback", value) && (1u == value));
+    }
+
+  if (ret)
+    { // Client put
+      value = 2u;
+      ret = client->SetVariable("ccs::test::writeback", value);
+      ccs::HelperTools::SleepFor(PVA_TEST_SETTLE);
+    }
+
+  if (ret)
+    {
+      value = 0u;
+      ret = (server->GetVariable("ccs::test::writeback", value) && (2u == value));
+    }
+
+  if (ret)
+    { // Server write-back of the value it posted before the client put
+      value = 1u;
+      ret = server->SetVariable("ccs::test::writeback", value);
+      ccs::HelperTools::SleepFor(PVA_TEST_SETTLE);
+    }
+
+  if (ret)
+    {
+      value = 0u;
+      ret = (client->GetVariable("ccs::test::writeback", value) && (1u == value));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(PVAccessServer_Test, PostPeriod)
+{
+  using namespace ccs::types;
+
+  ccs::base::PVAccessServer* server = LaunchServer();
+
+  bool ret = (static_cast<ccs::base::PVAccessServer*>(NULL) != server);
+
+  // Queue-preserving monitor, i.e. one handler call per post
+  PVAccessServer_Test monitor ("ccs::test::postperiod");
+
+  if (ret)
+    {
+      ccs::HelperTools::SleepFor(PVA_TEST_SETTLE);
+      ret = monitor.IsConnected();
+    }
+
+  uint32 count = monitor.count;
+
+  for (uint32 index = 1u; (ret && (index <= PVA_TEST_UPDATES)); index += 1u)
+    { // Updates every 1ms
+      ret = server->SetVariable("ccs::test::postperiod", index);
+      ccs::HelperTools::SleepFor(1000000ul);
+    }
+
+  if (ret)
+    { // Pending update posted after the period
+      ccs::HelperTools::SleepFor(PVA_TEST_SETTLE);
+      count = monitor.count - count;
+      log_info("TEST(PVAccessServer_Test, PostPeriod) - '%u' posts for '%u' updates", count, PVA_TEST_UPDATES);
+      ret = ((0u < count) && (count < (PVA_TEST_UPDATES / 10u)) && (PVA_TEST_UPDATES == monitor.last));
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
+TEST(PVAccessServer_Test, ChangedFields)
+{
+  using namespace ccs::types;
+
+  std::shared_ptr<const AnyType> nested (dynamic_cast<AnyType*>((new (std::nothrow) CompoundType ("ccs::test::ChangedNested_t"))
+							       ->AddAttribute("first", "uint32")
+							       ->AddAttribute("second", "uint32")));
+
+  std::shared_ptr<const AnyType> type (dynamic_cast<AnyType*>((new (std::nothrow) CompoundType ("ccs::test::Changed_t"))
+							     ->AddAttribute("counter", "uint32")
+							     ->AddAttribute("status", "uint32")
+							     ->AddAttribute("nested", nested)));
+
+  AnyValue value (type);
+  AnyValue posted (type); // Reference, i.e. copy of the last post
+
+  std::shared_ptr<epics::pvData::PVStructure> record = epics::pvData::getPVDataCreate()->createPVStructure(ccs::HelperTools::AnyTypeToPVStruct(type));
+
+  bool ret = (record ? true : false);
+
+  if (ret)
+    { // First post is complete
+      ret = ccs::HelperTools::AnyValueToPVStruct(&value, record);
+    }
+
+  if (ret)
+    { // Record fields altered in order to detect which ones are written
+      record->getSubField<epics::pvData::PVUInt>("status")->put(10u);
+      record->getSubField<epics::pvData::PVUInt>("nested.second")->put(10u);
+
+      posted = value;
+
+      ret = (ccs::HelperTools::SetAttributeValue<uint32>(&value, "counter", 1u) &&
+	     ccs::HelperTools::SetAttributeValue<uint32>(&value, "nested.first", 2u));
+    }
+
+  if (ret)
+    { // Changed fields only
+      ret = ccs::HelperTools::AnyValueToPVStruct(&value, record, posted.GetInstance());
+    }
+
+  if (ret)
+    {
+      ret = ((1u == record->getSubField<epics::pvData::PVUInt>("counter")->get()) &&
+	     (2u == record->getSubField<epics::pvData::PVUInt>("nested.first")->get()) &&
+	     (10u == record->getSubField<epics::pvData::PVUInt>("status")->get()) && // Not written
+	     (10u == record->getSubField<epics::pvData::PVUInt>("nested.second")->get())); // Not written
+    }
+
+  ASSERT_EQ(ret, true);
+}
+
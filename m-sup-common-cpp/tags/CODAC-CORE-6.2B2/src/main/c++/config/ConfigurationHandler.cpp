@@ -35,6 +35,7 @@
 
 // Local header files
 
+#include "ConfigurationHasher.h" // Checksum algorithms
 #include "ConfigurationHandler.h"
 
 // Constants
@@ -54,6 +55,27 @@ namespace core {
 
 // Function definition
   
+bool ConfigurationHandler::IsSupported (const std::string& algorithm) const
+{
+
+  return (algorithm == CONFIGURATION_HASH_CRC32);
+
+}
+
+bool ConfigurationHandler::LoadConfiguration (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const std::string& algorithm, const ccs::types::uint64 checksum)
+{
+
+  bool status = ((algorithm == CONFIGURATION_HASH_CRC32) && (static_cast<ccs::types::uint64>(static_cast<ccs::types::uint32>(checksum)) == checksum));
+
+  if (status)
+    {
+      status = LoadConfiguration(name, value, seed, static_cast<ccs::types::uint32>(checksum));
+    }
+
+  return status;
+
+}
+
 bool ConfigurationHandler::GetSeed (const std::string& name, ccs::types::uint32& seed) const
 {
 
@@ -260,6 +260,34 @@ class ConfigurationHandler : public ccs::base::AnyObject
 
     virtual bool LoadConfiguration (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const ccs::types::uint32 checksum) = 0;
 
+    /**
+     * @brief Accessor. 
+     * @detail Tests if the implementation accepts the named checksum algorithm in place of the CRC-32
+     * of the data set, see ConfigurationHasher::IsSupported. sup::core::ConfigurationService otherwise
+     * computes the CRC-32 of data sets transferred with another algorithm before calling the above
+     * LoadConfiguration method.
+     *
+     * The default implementation provided by the base class only accepts CONFIGURATION_HASH_CRC32.
+     * @param algorithm Named checksum algorithm.
+     * @return True if supported, false otherwise.
+     */
+
+    virtual bool IsSupported (const std::string& algorithm) const;
+
+    /**
+     * @brief Accessor. 
+     * @detail Variant of the above LoadConfiguration method called with the checksum negotiated with,
+     * and verified against, the client, if the implementation supports the algorithm. 
+     *
+     * The default implementation provided by the base class delegates CONFIGURATION_HASH_CRC32 to
+     * the above LoadConfiguration method.
+     * @param algorithm Named checksum algorithm.
+     * @param checksum Checksum computed using the named algorithm, the configuration data set and the seed.
+     * @return True in case of success, false otherwise.
+     */
+
+    virtual bool LoadConfiguration (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const std::string& algorithm, const ccs::types::uint64 checksum);
+
     /**
      * @brief Accessor. 
      * @detail Provides optional capability for the implementation to deliver the seed for the client-side
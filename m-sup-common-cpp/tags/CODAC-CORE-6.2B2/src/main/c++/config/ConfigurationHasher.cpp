@@ -21,12 +21,20 @@
 
 // Global header files
 
+#include <condition_variable> // std::condition_variable
+#include <deque> // std::deque
+#include <functional> // std::function
+#include <mutex> // std::mutex
+#include <thread> // std::thread
+#include <vector> // std::vector
+
 #include <BasicTypes.h> // Misc. type definition
 #include <SysTools.h> // ccs::HelperTools::SafeStringCopy, etc.
 
 #include <AnyObject.h>
 
 #include <CyclicRedundancyCheck.h>
+#include <Hash.h>
 
 #include <log-api.h> // Logging helper functions
 
@@ -39,17 +47,203 @@
 #undef LOG_ALTERN_SRC
 #define LOG_ALTERN_SRC "sup::core"
 
+#define PARALLEL_CHECKSUM_MAX_THREADS 8u
+
 // Type definition
 
 namespace sup {
 
 namespace core {
 
+struct ConfigurationHasherPool
+{
+
+  typedef struct Task {
+    std::function<void(void)> run;
+    ccs::types::uint32* pending; // Decremented upon completion, with the lock held
+  } Task_t;
+
+  std::mutex __mutex;
+  std::condition_variable __cond;
+
+  bool __terminate;
+
+  std::deque<Task_t> __queue;
+  std::vector<std::thread> __pool;
+
+  ConfigurationHasherPool (const ccs::types::uint32 workers);
+  ~ConfigurationHasherPool (void);
+
+  void Process (void);
+
+};
+
 // Function declaration
 
 // Global variables
 
 // Function definition
+
+ConfigurationHasherPool::ConfigurationHasherPool (const ccs::types::uint32 workers)
+{
+
+  __terminate = false;
+
+  for (ccs::types::uint32 index = 0u; index < workers; index += 1u)
+    {
+      __pool.push_back(std::thread(&ConfigurationHasherPool::Process, this));
+    }
+
+  return;
+
+}
+
+ConfigurationHasherPool::~ConfigurationHasherPool (void)
+{
+
+  {
+    std::lock_guard<std::mutex> lock (__mutex);
+    __terminate = true;
+  }
+
+  __cond.notify_all();
+
+  for (std::vector<std::thread>::iterator it = __pool.begin(); it != __pool.end(); ++it)
+    {
+      if (it->joinable())
+	{
+	  it->join();
+	}
+    }
+
+  return;
+
+}
+
+void ConfigurationHasherPool::Process (void)
+{
+
+  std::unique_lock<std::mutex> lock (__mutex);
+
+  while (!__terminate)
+    {
+      if (__queue.empty())
+	{
+	  __cond.wait(lock);
+	  continue;
+	}
+
+      Task_t task = __queue.front();
+      __queue.pop_front();
+
+      lock.unlock();
+      task.run();
+      lock.lock();
+
+      *(task.pending) -= 1u;
+      __cond.notify_all();
+    }
+
+  return;
+
+}
+
+ccs::types::uint32 ConfigurationHasher::ComputeChecksum (const ccs::types::uint8 * const buffer, const ccs::types::uint32 size, const ccs::types::uint32 seed, const bool castagnoli) const
+{
+
+  ccs::types::uint32 threads = ((size > PARALLEL_CHECKSUM_THRESHOLD) ? __parallelism : 1u);
+
+  if (threads > (size / (PARALLEL_CHECKSUM_THRESHOLD / 4u)))
+    { // Not less than 1MB per thread
+      threads = size / (PARALLEL_CHECKSUM_THRESHOLD / 4u);
+    }
+
+  ccs::types::uint32 checksum = 0u;
+
+  if (threads < 2u)
+    {
+      checksum = (castagnoli ? ccs::HelperTools::CyclicRedundancyCheckCastagnoli(buffer, size, seed) : 
+		  ccs::HelperTools::CyclicRedundancyCheck<ccs::types::uint32>(buffer, size, seed));
+    }
+  else
+    {
+      // Initialise lookup tables before sharing them across threads
+      (void)ccs::HelperTools::CyclicRedundancyCheck<ccs::types::uint32>(buffer, 0u);
+      (void)ccs::HelperTools::CyclicRedundancyCheckCastagnoli(buffer, 0u);
+
+      ccs::types::uint32 chunk = size / threads;
+
+      std::vector<ccs::types::uint32> partial (threads, 0u);
+
+      ConfigurationHasherPool* pool = static_cast<ConfigurationHasherPool*>(NULL);
+
+      {
+	static std::mutex __startup; // Concurrent computations on the same instance
+
+	std::lock_guard<std::mutex> lock (__startup);
+
+	if (static_cast<ConfigurationHasherPool*>(NULL) == __pool)
+	  { // Started upon first use and reused thereafter
+	    const_cast<ConfigurationHasher*>(this)->__pool = new (std::nothrow) ConfigurationHasherPool (__parallelism - 1u);
+	  }
+
+	pool = __pool;
+      }
+
+      ccs::types::uint32 pending = 0u;
+
+      // Last chunks queued first, i.e. the first chunk computed by the calling thread meanwhile
+      for (ccs::types::uint32 count = threads; 0u < count; count--)
+	{
+	  ccs::types::uint32 index = count - 1u;
+	  ccs::types::uint32 offset = index * chunk;
+	  ccs::types::uint32 length = ((index + 1u) < threads) ? chunk : (size - offset);
+	  ccs::types::uint32 start = ((0u == index) ? seed : 0u); // Seed applies to the first chunk only
+
+	  std::function<void(void)> task = [=, &partial] (void) {
+	    partial[index] = (castagnoli ? ccs::HelperTools::CyclicRedundancyCheckCastagnoli(buffer + offset, length, start) : 
+			      ccs::HelperTools::CyclicRedundancyCheck<ccs::types::uint32>(buffer + offset, length, start));
+	  };
+
+	  if ((0u == index) || (static_cast<ConfigurationHasherPool*>(NULL) == pool))
+	    {
+	      task();
+	      continue;
+	    }
+
+	  ConfigurationHasherPool::Task_t pooled;
+
+	  pooled.run = task;
+	  pooled.pending = &pending;
+
+	  std::lock_guard<std::mutex> lock (pool->__mutex);
+	  pending += 1u;
+	  pool->__queue.push_back(pooled);
+	  pool->__cond.notify_all();
+	}
+
+      if (static_cast<ConfigurationHasherPool*>(NULL) != pool)
+	{
+	  std::unique_lock<std::mutex> lock (pool->__mutex);
+
+	  while (0u < pending)
+	    {
+	      pool->__cond.wait(lock);
+	    }
+	}
+
+      checksum = partial[0];
+
+      for (ccs::types::uint32 index = 1u; index < threads; index++)
+	{
+	  ccs::types::uint32 length = ((index + 1u) < threads) ? chunk : (size - index * chunk);
+	  checksum = ccs::HelperTools::CombineCyclicRedundancyCheck(checksum, partial[index], length, (castagnoli ? 0x82F63B78u : 0xEDB88320u));
+	}
+    }
+
+  return checksum;
+
+}
   
 bool ConfigurationHasher::ComputeChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, ccs::types::uint32& checksum) const
 {
@@ -58,13 +252,51 @@ bool ConfigurationHasher::ComputeChecksum (const std::string& name, const ccs::t
   
   if (status)
     {
-      checksum = ccs::HelperTools::CyclicRedundancyCheck<ccs::types::uint32>(reinterpret_cast<ccs::types::uint8*>(value.GetInstance()), value.GetSize(), seed);
+      checksum = ComputeChecksum(reinterpret_cast<ccs::types::uint8*>(value.GetInstance()), value.GetSize(), seed, false);
     }
   
   return status;
 
 }
 
+bool ConfigurationHasher::IsSupported (const std::string& algorithm) const
+{
+
+  bool status = ((algorithm == CONFIGURATION_HASH_CRC32) || 
+		 (algorithm == CONFIGURATION_HASH_CRC32C) || 
+		 (algorithm == CONFIGURATION_HASH_HASH64));
+
+  return status;
+
+}
+
+bool ConfigurationHasher::ComputeChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const std::string& algorithm, ccs::types::uint64& checksum) const
+{
+
+  bool status = ((NULL != value.GetInstance()) && IsSupported(algorithm));
+
+  if (status)
+    {
+      if (algorithm == CONFIGURATION_HASH_CRC32)
+	{
+	  ccs::types::uint32 sum = 0u;
+	  status = ComputeChecksum(name, value, seed, sum);
+	  checksum = static_cast<ccs::types::uint64>(sum);
+	}
+      else if (algorithm == CONFIGURATION_HASH_CRC32C)
+	{
+	  checksum = static_cast<ccs::types::uint64>(ComputeChecksum(reinterpret_cast<ccs::types::uint8*>(value.GetInstance()), value.GetSize(), seed, true));
+	}
+      else
+	{
+	  checksum = ccs::HelperTools::Hash<ccs::types::uint64>(reinterpret_cast<ccs::types::uint8*>(value.GetInstance()), value.GetSize(), static_cast<ccs::types::uint64>(seed));
+	}
+    }
+
+  return status;
+
+}
+
 bool ConfigurationHasher::VerifyChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const ccs::types::uint32 checksum) const
 {
 
@@ -86,16 +318,76 @@ bool ConfigurationHasher::VerifyChecksum (const std::string& name, const ccs::ty
 
 }
 
+bool ConfigurationHasher::VerifyChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const std::string& algorithm, const ccs::types::uint64 checksum) const
+{
+
+  bool status = (NULL != value.GetInstance());
+  
+  ccs::types::uint64 sum;
+
+  if (status)
+    {
+      status = ComputeChecksum(name, value, seed, algorithm, sum);
+    }
+
+  if (status)
+    {
+      status = (sum == checksum);
+    }
+  
+  return status;
+
+}
+
+bool ConfigurationHasher::SetParallelism (const ccs::types::uint32 threads)
+{
+
+  bool status = (0u < threads);
+
+  if (status)
+    {
+      __parallelism = threads;
+    }
+
+  return status;
+
+}
+
 ConfigurationHasher::ConfigurationHasher (void)
 {
 
+  __parallelism = std::thread::hardware_concurrency();
+  __pool = static_cast<ConfigurationHasherPool*>(NULL);
+
+  if (__parallelism > PARALLEL_CHECKSUM_MAX_THREADS)
+    {
+      __parallelism = PARALLEL_CHECKSUM_MAX_THREADS;
+    }
+
+  if (__parallelism < 1u)
+    {
+      __parallelism = 1u;
+    }
+
   ccs::base::AnyObject::SetInstanceType("sup::core::ConfigurationHasher");
 
   return;
 
 }  
 
-ConfigurationHasher::~ConfigurationHasher (void) {}
+ConfigurationHasher::~ConfigurationHasher (void)
+{
+
+  if (static_cast<ConfigurationHasherPool*>(NULL) != __pool)
+    {
+      delete __pool;
+    }
+
+  __pool = static_cast<ConfigurationHasherPool*>(NULL);
+
+  return;
+
+}
 
 } // namespace core
 
@@ -48,12 +48,20 @@
 
 // Constants
 
+#define CONFIGURATION_HASH_CRC32 "crc32" // Default, backward compatible
+#define CONFIGURATION_HASH_CRC32C "crc32c" // CRC-32C, hardware-assisted when supported
+#define CONFIGURATION_HASH_HASH64 "hash64" // 64-bit non-cryptographic hash
+
+#define PARALLEL_CHECKSUM_THRESHOLD 4194304u // Instances above 4MB are checksummed in parallel chunks
+
 // Type definition
 
 namespace sup {
 
 namespace core {
 
+struct ConfigurationHasherPool; // Forward declaration
+
 /**
  * @brief Interface class providing support for configuration related function.
  * @detail Interface adaptation is provided by inheriting from this base class and
@@ -81,8 +89,37 @@ class ConfigurationHasher : public ccs::base::AnyObject
 
   private:
 
+    /**
+     * @brief Attribute. 
+     * @detail Maximum number of threads used to compute CRCs over large instances.
+     */
+
+    ccs::types::uint32 __parallelism;
+
+    /**
+     * @brief Attribute. 
+     * @detail Persistent worker threads, started upon first chunked computation.
+     */
+
+    ConfigurationHasherPool* __pool;
+
+    // Non-copyable, i.e. the pool is owned
+    ConfigurationHasher (const ConfigurationHasher& hasher);
+    ConfigurationHasher& operator= (const ConfigurationHasher& hasher);
+
   protected:
 
+    /**
+     * @brief ComputeChecksum method. 
+     * @detail Computes the CRC of a sized buffer, split in chunks computed in parallel
+     * and combined in case the buffer is larger than PARALLEL_CHECKSUM_THRESHOLD. Chunks
+     * are computed by persistent worker threads, smaller buffers by the calling thread.
+     * @param castagnoli Selects CRC-32C instead of CRC-32.
+     * @return The CRC over the sized buffer, identical to the sequential computation.
+     */
+
+    ccs::types::uint32 ComputeChecksum (const ccs::types::uint8 * const buffer, const ccs::types::uint32 size, const ccs::types::uint32 seed, const bool castagnoli) const;
+
   public:
 
     /**
@@ -147,6 +184,38 @@ class ConfigurationHasher : public ccs::base::AnyObject
     virtual bool ComputeChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, ccs::types::uint32& checksum) const; 
     virtual bool VerifyChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const ccs::types::uint32 checksum) const; 
 
+    /**
+     * @brief Accessor. 
+     * @detail Tests if the named checksum algorithm is supported. The algorithm is negotiated
+     * between sup::core::ConfigurationLoader and sup::core::ConfigurationService, i.e. the
+     * loader proposes an algorithm with the seed request and the service replies with the
+     * algorithm it accepts, falling back to CONFIGURATION_HASH_CRC32.
+     * @param algorithm One of CONFIGURATION_HASH_CRC32, CONFIGURATION_HASH_CRC32C, or CONFIGURATION_HASH_HASH64.
+     * @return True if supported, false otherwise.
+     */
+
+    virtual bool IsSupported (const std::string& algorithm) const;
+
+    /**
+     * @brief ComputeChecksum method. 
+     * @detail Computes the checksum using the named algorithm. CONFIGURATION_HASH_CRC32 delegates
+     * to the above ComputeChecksum method so as to preserve specialised implementations.
+     * @param algorithm Named checksum algorithm.
+     * @param checksum Placeholder for the returned value, the CRC-32 variants occupy the lower 32 bits.
+     * @return True if successful, false otherwise.
+     */
+
+    virtual bool ComputeChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const std::string& algorithm, ccs::types::uint64& checksum) const; 
+    virtual bool VerifyChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const std::string& algorithm, const ccs::types::uint64 checksum) const; 
+
+    /**
+     * @brief Accessor. 
+     * @param threads Maximum number of threads used for chunked computation, 1u to disable.
+     * @return True if valid number.
+     */
+
+    bool SetParallelism (const ccs::types::uint32 threads);
+
 };
 
 // Global variables
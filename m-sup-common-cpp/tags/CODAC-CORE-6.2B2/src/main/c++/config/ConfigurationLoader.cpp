@@ -43,6 +43,10 @@
 
 // Constants
 
+#define CHUNKED_TRANSFER_MAX_RETRIES 3u // Resume attempts upon connection loss
+#define CHUNKED_TRANSFER_RECONNECT_TIMEOUT 5000000000ul // 5s
+#define CHUNKED_TRANSFER_RECONNECT_PERIOD 100000000ul // 100ms
+
 #undef LOG_ALTERN_SRC
 #define LOG_ALTERN_SRC "sup::core"
 
@@ -59,7 +63,27 @@ class ConfigurationLoaderImpl : public ccs::base::RPCClient
 
     ConfigurationHasher* __hasher = static_cast<ConfigurationHasher*>(NULL);
 
-    bool ComputeChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, ccs::types::uint32& checksum);
+    ccs::types::uint32 __chunk = DEFAULT_CONFIGURATION_CHUNK_SIZE;
+
+    std::string __algorithm = CONFIGURATION_HASH_CRC32; // Proposed checksum algorithm
+
+    bool GetHasher (void);
+    bool ComputeChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const std::string& algorithm, ccs::types::uint64& checksum);
+
+    // Legacy requests convey CRC-32 as uint32 'hash' attribute
+    void AddChecksumAttributes (ccs::types::CompoundType& type, const std::string& algorithm) const;
+    void SetChecksumAttributes (ccs::types::AnyValue& request, const std::string& algorithm, const ccs::types::uint64 checksum) const;
+
+    bool GetSeed (const std::string& name, ccs::types::uint32& seed, std::string& algorithm);
+
+    // Chunked transfer
+    bool WaitForConnection (void) const;
+    bool OpenStaging (const std::string& name, const ccs::types::uint32 seed, const ccs::types::uint32 size, ccs::types::uint32& offset);
+    bool SendChunk (ccs::types::AnyValue& request, const ccs::types::uint32 sequence, const ccs::types::uint8 * const buffer, const ccs::types::uint32 offset, const ccs::types::uint32 size, ccs::types::uint32& next);
+    bool CommitStaging (const std::string& name, const ccs::types::uint32 seed, const std::string& algorithm, const ccs::types::uint64 checksum);
+    bool LoadChunkedConfiguration (const std::string& name, const ccs::types::AnyValue& value);
+
+    bool LoadSingleConfiguration (const std::string& name, const ccs::types::AnyValue& value);
 
   public:
 
@@ -69,6 +93,9 @@ class ConfigurationLoaderImpl : public ccs::base::RPCClient
     bool RegisterHasher (ConfigurationHasher* hasher);
   //bool RegisterHasher (const char* name); // Get instance from GlobalObjectDatabase and ..
 
+    bool SetChunkSize (const ccs::types::uint32 size);
+    bool SetHashAlgorithm (const std::string& algorithm);
+
     bool ReadConfiguration (const std::string& name, ccs::types::AnyValue& value);
     bool LoadConfiguration (const std::string& name, const ccs::types::AnyValue& value);
 
@@ -94,7 +121,35 @@ bool ConfigurationLoader::RegisterHasher (ConfigurationHasher* hasher)
 
 }
 
-bool ConfigurationLoaderImpl::ComputeChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, ccs::types::uint32& checksum)
+bool ConfigurationLoader::SetChunkSize (const ccs::types::uint32 size)
+{
+
+  bool status = (static_cast<ConfigurationLoaderImpl*>(NULL) != __impl);
+
+  if (__builtin_expect(status, 1)) // Likely
+    {
+      status = __impl->SetChunkSize(size);
+    }
+
+  return status;
+
+}
+
+bool ConfigurationLoader::SetHashAlgorithm (const std::string& algorithm)
+{
+
+  bool status = (static_cast<ConfigurationLoaderImpl*>(NULL) != __impl);
+
+  if (__builtin_expect(status, 1)) // Likely
+    {
+      status = __impl->SetHashAlgorithm(algorithm);
+    }
+
+  return status;
+
+}
+
+bool ConfigurationLoaderImpl::GetHasher (void)
 {
 
   bool status = (static_cast<ConfigurationHasher*>(NULL) != __hasher);
@@ -105,15 +160,58 @@ bool ConfigurationLoaderImpl::ComputeChecksum (const std::string& name, const cc
       status = (static_cast<ConfigurationHasher*>(NULL) != __hasher);
     }
 
+  return status;
+
+}
+
+bool ConfigurationLoaderImpl::ComputeChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const std::string& algorithm, ccs::types::uint64& checksum)
+{
+
+  bool status = GetHasher();
+
   if (status)
     {
-      status = __hasher->ComputeChecksum(name, value, seed, checksum);
+      status = __hasher->ComputeChecksum(name, value, seed, algorithm, checksum);
     }
 
   return status;
 
 }
 
+void ConfigurationLoaderImpl::AddChecksumAttributes (ccs::types::CompoundType& type, const std::string& algorithm) const
+{
+
+  if (algorithm == CONFIGURATION_HASH_CRC32)
+    {
+      type.AddAttribute<ccs::types::uint32>("hash");
+    }
+  else
+    {
+      type.AddAttribute<ccs::types::string>("algorithm");
+      type.AddAttribute<ccs::types::uint64>("hash");
+    }
+
+  return;
+
+}
+
+void ConfigurationLoaderImpl::SetChecksumAttributes (ccs::types::AnyValue& request, const std::string& algorithm, const ccs::types::uint64 checksum) const
+{
+
+  if (algorithm == CONFIGURATION_HASH_CRC32)
+    {
+      ccs::HelperTools::SetAttributeValue(&request, "hash", static_cast<ccs::types::uint32>(checksum));
+    }
+  else
+    {
+      ccs::HelperTools::SetAttributeValue(&request, "algorithm", algorithm.c_str());
+      ccs::HelperTools::SetAttributeValue(&request, "hash", checksum);
+    }
+
+  return;
+
+}
+
 bool ConfigurationLoaderImpl::ReadConfiguration (const std::string& name, ccs::types::AnyValue& value)
 {
 
@@ -160,7 +258,7 @@ bool ConfigurationLoaderImpl::ReadConfiguration (const std::string& name, ccs::t
 
 }
 
-bool ConfigurationLoaderImpl::LoadConfiguration (const std::string& name, const ccs::types::AnyValue& value)
+bool ConfigurationLoaderImpl::GetSeed (const std::string& name, ccs::types::uint32& seed, std::string& algorithm)
 {
 
   bool status = ccs::base::RPCClient::IsConnected();
@@ -173,7 +271,10 @@ bool ConfigurationLoaderImpl::LoadConfiguration (const std::string& name, const
       request_t.AddAttribute("alias","string");
     }
 
-  ccs::types::uint32 seed;
+  if (status)
+    {
+      request_t.AddAttribute("algorithm","string");
+    }
 
   if (status)
     {
@@ -181,6 +282,7 @@ bool ConfigurationLoaderImpl::LoadConfiguration (const std::string& name, const
 
       // Seed request ..
       ccs::HelperTools::SetAttributeValue(&request, "qualifier", "init");
+      ccs::HelperTools::SetAttributeValue(&request, "algorithm", __algorithm.c_str()); // Proposed algorithm
   
       if (!name.empty())
 	{
@@ -200,6 +302,56 @@ bool ConfigurationLoaderImpl::LoadConfiguration (const std::string& name, const
 	} 
       else
 	status = reply_status;
+
+      // Accepted algorithm, legacy services only support CRC-32
+      algorithm = std::string(((ccs::HelperTools::HasAttribute(&reply, "algorithm") && (ccs::types::String == ccs::HelperTools::GetAttributeType(&reply, "algorithm"))) ?
+			       static_cast<char*>(ccs::HelperTools::GetAttributeReference(&reply, "algorithm")) : CONFIGURATION_HASH_CRC32));
+    }
+
+  return status;
+
+}
+
+bool ConfigurationLoaderImpl::LoadConfiguration (const std::string& name, const ccs::types::AnyValue& value)
+{
+
+  bool status = ccs::base::RPCClient::IsConnected();
+
+  if (status)
+    {
+      if ((0u < __chunk) && (__chunk < value.GetSize()))
+	{
+	  status = LoadChunkedConfiguration(name, value);
+	}
+      else
+	{
+	  status = LoadSingleConfiguration(name, value);
+	}
+    }
+
+  return status;
+
+}
+
+bool ConfigurationLoaderImpl::LoadSingleConfiguration (const std::string& name, const ccs::types::AnyValue& value)
+{
+
+  bool status = ccs::base::RPCClient::IsConnected();
+
+  // Copy the base request type ..
+  ccs::types::CompoundType request_t (*ccs::base::RPCTypes::Request_int); // Default RPC request type
+
+  if (status && !name.empty())
+    {
+      request_t.AddAttribute("alias","string");
+    }
+
+  ccs::types::uint32 seed;
+  std::string algorithm;
+
+  if (status)
+    {
+      status = GetSeed(name, seed, algorithm);
     }
 
   if (status)
@@ -207,14 +359,14 @@ bool ConfigurationLoaderImpl::LoadConfiguration (const std::string& name, const
       // .. add the missing bit
       request_t.AddAttribute<ccs::types::uint32>("seed");
       request_t.AddAttribute("value", value.GetType());
-      request_t.AddAttribute<ccs::types::uint32>("hash");
+      AddChecksumAttributes(request_t, algorithm);
     }
 
-  ccs::types::uint32 hash;
+  ccs::types::uint64 hash;
 
   if (status)
     {
-      status = ComputeChecksum(name, value, seed, hash);
+      status = ComputeChecksum(name, value, seed, algorithm, hash);
     }
 
   if (status)
@@ -225,7 +377,7 @@ bool ConfigurationLoaderImpl::LoadConfiguration (const std::string& name, const
       ccs::HelperTools::SetAttributeValue(&request, "qualifier", "load");
       ccs::HelperTools::SetAttributeValue(&request, "seed", seed);
       ccs::HelperTools::SetAttributeValue(&request, "value", value);
-      ccs::HelperTools::SetAttributeValue(&request, "hash", hash);
+      SetChecksumAttributes(request, algorithm, hash);
 
       if (!name.empty())
 	{
@@ -242,6 +394,242 @@ bool ConfigurationLoaderImpl::LoadConfiguration (const std::string& name, const
 
 }
 
+bool ConfigurationLoaderImpl::WaitForConnection (void) const
+{
+
+  ccs::types::uint64 till = ccs::HelperTools::GetCurrentTime() + CHUNKED_TRANSFER_RECONNECT_TIMEOUT;
+
+  bool status = ccs::base::RPCClient::IsConnected();
+
+  while (!status && (ccs::HelperTools::GetCurrentTime() < till))
+    {
+      ccs::HelperTools::SleepFor(CHUNKED_TRANSFER_RECONNECT_PERIOD);
+      status = ccs::base::RPCClient::IsConnected();
+    }
+
+  return status;
+
+}
+
+bool ConfigurationLoaderImpl::OpenStaging (const std::string& name, const ccs::types::uint32 seed, const ccs::types::uint32 size, ccs::types::uint32& offset)
+{
+
+  bool status = ccs::base::RPCClient::IsConnected();
+
+  // Copy the base request type ..
+  ccs::types::CompoundType request_t (*ccs::base::RPCTypes::Request_int); // Default RPC request type
+
+  if (status)
+    {
+      if (!name.empty())
+	{
+	  request_t.AddAttribute("alias","string");
+	}
+
+      request_t.AddAttribute<ccs::types::uint32>("seed");
+      request_t.AddAttribute<ccs::types::uint32>("size");
+    }
+
+  if (status)
+    {
+      ccs::types::AnyValue request (request_t);
+
+      // Staging request .. open or resume transfer
+      ccs::HelperTools::SetAttributeValue(&request, "qualifier", "stage");
+      ccs::HelperTools::SetAttributeValue(&request, "seed", seed);
+      ccs::HelperTools::SetAttributeValue(&request, "size", size);
+
+      if (!name.empty())
+	{
+	  // .. named data set
+	  ccs::HelperTools::SetAttributeValue(&request, "alias", name.c_str());
+	}
+  
+      // Send RPC request ..
+      ccs::types::AnyValue reply = ccs::base::RPCClient::SendRequest(request);
+      ccs::types::boolean reply_status = false;
+      status = (ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status", reply_status) && reply_status);
+
+      if (status)
+	{
+	  // Offset acknowledged by the server
+	  status = ((ccs::types::UnsignedInteger32 == ccs::HelperTools::GetAttributeType(&reply, "value")) &&
+		    ccs::HelperTools::GetAttributeValue<ccs::types::uint32>(&reply, "value", offset));
+	}
+    }
+
+  return status;
+
+}
+
+bool ConfigurationLoaderImpl::SendChunk (ccs::types::AnyValue& request, const ccs::types::uint32 sequence, const ccs::types::uint8 * const buffer, const ccs::types::uint32 offset, const ccs::types::uint32 size, ccs::types::uint32& next)
+{
+
+  bool status = (size <= __chunk);
+
+  if (status)
+    {
+      // Chunk request ..
+      ccs::HelperTools::SetAttributeValue(&request, "sequence", sequence);
+      ccs::HelperTools::SetAttributeValue(&request, "offset", offset);
+      ccs::HelperTools::SetAttributeValue(&request, "size", size);
+      ccs::HelperTools::SetAttributeValue(&request, "crc", ccs::HelperTools::CyclicRedundancyCheck<ccs::types::uint32>(buffer + offset, size));
+      (void)memcpy(ccs::HelperTools::GetAttributeReference(&request, "data"), buffer + offset, size);
+
+      // Send RPC request ..
+      ccs::types::AnyValue reply = ccs::base::RPCClient::SendRequest(request);
+      ccs::types::boolean reply_status = false;
+      status = (ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status", reply_status) && reply_status);
+
+      if (status)
+	{
+	  // Offset acknowledged by the server
+	  status = ((ccs::types::UnsignedInteger32 == ccs::HelperTools::GetAttributeType(&reply, "value")) &&
+		    ccs::HelperTools::GetAttributeValue<ccs::types::uint32>(&reply, "value", next));
+	}
+    }
+
+  return status;
+
+}
+
+bool ConfigurationLoaderImpl::CommitStaging (const std::string& name, const ccs::types::uint32 seed, const std::string& algorithm, const ccs::types::uint64 checksum)
+{
+
+  bool status = ccs::base::RPCClient::IsConnected();
+
+  // Copy the base request type ..
+  ccs::types::CompoundType request_t (*ccs::base::RPCTypes::Request_int); // Default RPC request type
+
+  if (status)
+    {
+      if (!name.empty())
+	{
+	  request_t.AddAttribute("alias","string");
+	}
+
+      request_t.AddAttribute<ccs::types::uint32>("seed");
+      AddChecksumAttributes(request_t, algorithm);
+    }
+
+  if (status)
+    {
+      ccs::types::AnyValue request (request_t);
+
+      // Commit request ..
+      ccs::HelperTools::SetAttributeValue(&request, "qualifier", "commit");
+      ccs::HelperTools::SetAttributeValue(&request, "seed", seed);
+      SetChecksumAttributes(request, algorithm, checksum);
+
+      if (!name.empty())
+	{
+	  // .. named data set
+	  ccs::HelperTools::SetAttributeValue(&request, "alias", name.c_str());
+	}
+  
+      // Send RPC request ..
+      ccs::types::AnyValue reply = ccs::base::RPCClient::SendRequest(request);
+      status = ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status");
+    }
+
+  return status;
+
+}
+
+bool ConfigurationLoaderImpl::LoadChunkedConfiguration (const std::string& name, const ccs::types::AnyValue& value)
+{
+
+  log_info("ConfigurationLoaderImpl::LoadChunkedConfiguration('%s') - Transfer '%u' bytes in chunks of '%u' ..", name.c_str(), value.GetSize(), __chunk);
+
+  ccs::types::uint32 seed;
+  std::string algorithm;
+
+  bool status = GetSeed(name, seed, algorithm);
+
+  ccs::types::uint64 hash;
+
+  if (status)
+    {
+      status = ComputeChecksum(name, value, seed, algorithm, hash);
+    }
+
+  ccs::types::uint32 size = value.GetSize();
+  ccs::types::uint32 offset = 0u;
+
+  if (status)
+    {
+      status = OpenStaging(name, seed, size, offset);
+    }
+
+  // Chunk request type, built once for the whole transfer
+  ccs::types::CompoundType request_t (*ccs::base::RPCTypes::Request_int); // Default RPC request type
+
+  if (status)
+    {
+      if (!name.empty())
+	{
+	  request_t.AddAttribute("alias","string");
+	}
+
+      request_t.AddAttribute<ccs::types::uint32>("seed");
+      request_t.AddAttribute<ccs::types::uint32>("sequence");
+      request_t.AddAttribute<ccs::types::uint32>("offset");
+      request_t.AddAttribute<ccs::types::uint32>("size");
+      request_t.AddAttribute<ccs::types::uint32>("crc");
+      request_t.AddAttribute("data", ccs::HelperTools::NewArrayType("ConfigurationChunk_t", ccs::types::UnsignedInteger8, __chunk));
+    }
+
+  ccs::types::AnyValue request (request_t);
+
+  if (status)
+    {
+      ccs::HelperTools::SetAttributeValue(&request, "qualifier", "chunk");
+      ccs::HelperTools::SetAttributeValue(&request, "seed", seed);
+
+      if (!name.empty())
+	{
+	  // .. named data set
+	  ccs::HelperTools::SetAttributeValue(&request, "alias", name.c_str());
+	}
+    }
+
+  const ccs::types::uint8* buffer = static_cast<const ccs::types::uint8*>(value.GetInstance());
+  ccs::types::uint32 retries = 0u;
+
+  while (status && (offset < size))
+    {
+      ccs::types::uint32 length = ((size - offset) < __chunk) ? (size - offset) : __chunk;
+      ccs::types::uint32 next = offset;
+
+      if (SendChunk(request, offset / __chunk, buffer, offset, length, next))
+	{
+	  offset = next;
+	  retries = 0u;
+	}
+      else if (retries < CHUNKED_TRANSFER_MAX_RETRIES)
+	{
+	  log_warning("ConfigurationLoaderImpl::LoadChunkedConfiguration('%s') - Chunk '%u' failed .. resume", name.c_str(), offset / __chunk);
+	  retries += 1u;
+
+	  // Resume from the offset acknowledged by the server
+	  status = (WaitForConnection() && OpenStaging(name, seed, size, offset));
+	}
+      else
+	{
+	  log_error("ConfigurationLoaderImpl::LoadChunkedConfiguration('%s') - Chunk '%u' failed", name.c_str(), offset / __chunk);
+	  status = false;
+	}
+    }
+
+  if (status)
+    {
+      status = CommitStaging(name, seed, algorithm, hash);
+    }
+
+  return status;
+
+}
+
 bool ConfigurationLoader::IsConnected (void) const
 {
 
@@ -310,6 +698,33 @@ bool ConfigurationLoaderImpl::RegisterHasher (ConfigurationHasher* hasher)
 
   return status;
 
+}
+bool ConfigurationLoaderImpl::SetChunkSize (const ccs::types::uint32 size)
+{
+
+  __chunk = size;
+
+  return true;
+
+}
+
+bool ConfigurationLoaderImpl::SetHashAlgorithm (const std::string& algorithm)
+{
+
+  bool status = GetHasher();
+
+  if (status)
+    {
+      status = __hasher->IsSupported(algorithm);
+    }
+
+  if (status)
+    {
+      __algorithm = algorithm;
+    }
+
+  return status;
+
 }
 #if 0
 bool ConfigurationLoaderImpl::RegisterHasher (const char* name)
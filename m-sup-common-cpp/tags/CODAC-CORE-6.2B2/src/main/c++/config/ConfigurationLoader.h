@@ -46,6 +46,8 @@
 
 // Constants
 
+#define DEFAULT_CONFIGURATION_CHUNK_SIZE 65536u // Configuration instances above this size are transferred in chunks
+
 // Type definition
 
 namespace sup {
@@ -107,6 +109,35 @@ class ConfigurationLoader
 
     bool RegisterHasher (ConfigurationHasher* hasher);
 
+    /**
+     * @brief Accessor.
+     * @detail Configuration data sets with a memory footprint larger than the chunk size
+     * are loaded using a chunked transfer, i.e. the instance is streamed to the remote
+     * ConfigurationService as a sequence of numbered chunks, each protected by its own
+     * CRC-32, and assembled incrementally into a staging buffer at the server side. The
+     * transfer resumes from the last chunk acknowledged by the server in case the RPC
+     * connection is lost in between. The checksum of the whole data set is verified
+     * upon commit, before the data set is provided to the ConfigurationHandler.
+     * @param size Chunk size in bytes, 0u disables chunked transfer.
+     * @return True.
+     *
+     * @note The chunked transfer conveys the memory image of the instance and therefore
+     * requires the type of the value to match that provided by the ConfigurationHandler.
+     */
+
+    bool SetChunkSize (const ccs::types::uint32 size);
+
+    /**
+     * @brief Accessor.
+     * @detail Selects the checksum algorithm proposed to the remote ConfigurationService
+     * when loading configuration data sets. The service may decline and fall back to
+     * CONFIGURATION_HASH_CRC32, e.g. legacy implementation.
+     * @param algorithm One of CONFIGURATION_HASH_CRC32, CONFIGURATION_HASH_CRC32C, or CONFIGURATION_HASH_HASH64.
+     * @return True if supported by the registered ConfigurationHasher, false otherwise.
+     */
+
+    bool SetHashAlgorithm (const std::string& algorithm);
+
     bool IsConnected (void) const;
     bool ReadConfiguration (const std::string& name, ccs::types::AnyValue& value) const;
     bool LoadConfiguration (const std::string& name, const ccs::types::AnyValue& value) const;
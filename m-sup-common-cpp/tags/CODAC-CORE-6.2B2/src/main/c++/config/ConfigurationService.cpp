@@ -22,13 +22,22 @@
 // Global header files
 
 #include <new> // std::nothrow
+#include <map> // std::map
+#include <memory> // std::shared_ptr
+
+#include <string.h> // memcmp, etc.
 
 #include <BasicTypes.h> // Misc. type definition
 #include <SysTools.h> // ccs::HelperTools::SafeStringCopy, etc.
 
+#include <AtomicLock.h>
+#include <SemLock.h>
+
 #include <ObjectDatabase.h>
 #include <ObjectFactory.h>
 
+#include <CyclicRedundancyCheck.h>
+
 #include <log-api.h> // Logging helper functions
 
 #include <RPCServer.h>
@@ -42,8 +51,11 @@
 
 // Constants
 
-#define OVERRIDE_HASH_MISMATCH
-//#undef OVERRIDE_HASH_MISMATCH
+#define DEFAULT_SNAPSHOT_LIFETIME 1000000000ul // Snapshots re-read from the handler thereafter, i.e. changes made on the handler side
+
+#define DEFAULT_STAGING_TIMEOUT 10000000000ul // Idle transfers may be superseded thereafter
+
+#define DEFAULT_CONFIGURATION_WORKERS 4u // Requests handled concurrently, handler accesses serialised nonetheless
 
 #undef LOG_ALTERN_SRC
 #define LOG_ALTERN_SRC "sup::core"
@@ -54,6 +66,20 @@ namespace sup {
 
 namespace core {
 
+typedef struct ConfigurationStaging {
+  ccs::types::uint32 seed; // Transfer identifier
+  ccs::types::uint32 offset; // Next expected byte
+  ccs::types::uint32 sequence; // Next expected chunk
+  ccs::types::uint64 updated; // Time of last activity
+  ccs::types::AnyValue* value; // Staging buffer
+} ConfigurationStaging_t;
+
+typedef struct ConfigurationSnapshot {
+  ccs::types::uint64 version; // Incremented upon each confirmed load or change found on the handler side
+  ccs::types::uint64 refreshed; // Time of the last load or read from the handler
+  std::shared_ptr<const ccs::types::AnyValue> value; // Immutable once published
+} ConfigurationSnapshot_t;
+
 class ConfigurationServiceImpl : public ccs::base::RPCServer
 {
 
@@ -61,14 +87,32 @@ class ConfigurationServiceImpl : public ccs::base::RPCServer
 
     ConfigurationHasher* __hasher = static_cast<ConfigurationHasher*>(NULL);
     ConfigurationHandler* __handler = static_cast<ConfigurationHandler*>(NULL);
-#ifdef OVERRIDE_HASH_MISMATCH
-    bool ComputeChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, ccs::types::uint32& checksum);
-#endif
-    bool VerifyChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const ccs::types::uint32 checksum);
+
+    bool __override = false; // Checksum recomputed upon mismatch, if enabled
+
+    std::map<std::string, ConfigurationStaging_t> __staging; // Chunked transfers in progress, per named data set
+
+    std::map<std::string, ConfigurationSnapshot_t> __snapshots; // Latest confirmed data sets, served to 'read' requests
+    ccs::base::AtomicLock __snapshot_lock; // Held only to copy or swap snapshot references
+    ccs::base::SemLock __writer; // Serialises handler accesses, i.e. 'init', 'load' and chunked transfers
+
+    bool GetSnapshot (const std::string& name, std::shared_ptr<const ccs::types::AnyValue>& value, ccs::types::uint64& version);
+    ccs::types::uint64 SetSnapshot (const std::string& name, const std::shared_ptr<const ccs::types::AnyValue>& value, const bool confirmed);
+    bool GetChecksum (const ccs::types::AnyValue * const request, std::string& algorithm, ccs::types::uint64& checksum) const;
+    bool GetHasher (void);
+    bool ComputeChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const std::string& algorithm, ccs::types::uint64& checksum);
+    bool VerifyChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const std::string& algorithm, const ccs::types::uint64 checksum);
 
     bool GetSeed (const std::string& name, ccs::types::uint32& seed);
     bool ReadConfiguration (const std::string& name, ccs::types::AnyValue& value);
-    bool LoadConfiguration (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const ccs::types::uint32 checksum);
+    bool LoadConfiguration (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const std::string& algorithm, const ccs::types::uint64 checksum);
+
+    // Chunked transfer
+    bool OpenStaging (const std::string& name, const ccs::types::uint32 seed, const ccs::types::uint32 size, ccs::types::char8 * const reason, ccs::types::uint32& offset);
+    bool StageChunk (const std::string& name, const ccs::types::uint32 seed, const ccs::types::uint32 sequence, const ccs::types::uint32 offset, 
+		     const ccs::types::uint8 * const buffer, const ccs::types::uint32 size, const ccs::types::uint32 crc, ccs::types::char8 * const reason, ccs::types::uint32& next);
+    bool CommitStaging (const std::string& name, const ccs::types::uint32 seed, const ccs::types::AnyValue*& value);
+    void DiscardStaging (const std::string& name);
 
   public:
 
@@ -77,6 +121,7 @@ class ConfigurationServiceImpl : public ccs::base::RPCServer
 
     bool RegisterHandler (ConfigurationHandler* handler);
     bool RegisterHasher (ConfigurationHasher* hasher);
+    bool SetMismatchOverride (const bool enable);
 
     virtual ccs::types::AnyValue HandleRequest (const ccs::types::AnyValue& request); // Specialises virtual method of ccs::base::RPCServer
 
@@ -179,6 +224,20 @@ bool ConfigurationService::RegisterHasher (ConfigurationHasher* hasher)
 
 }
 
+bool ConfigurationService::SetMismatchOverride (const bool enable)
+{
+
+  bool status = (static_cast<ConfigurationServiceImpl*>(NULL) != __impl);
+
+  if (status)
+    {
+      status = __impl->SetMismatchOverride(enable);
+    }
+
+  return status;
+
+}
+
 bool ConfigurationService::RegisterHasher (const char* name)
 {
 
@@ -225,6 +284,11 @@ bool ConfigurationService::SetParameter (const char* name, const char* value)
 	  status = RegisterHasher(value);
 	}
 
+      if (std::string(name) == "override")
+	{
+	  status = SetMismatchOverride(std::string(value) == "true");
+	}
+
       if ((std::string(name) == "verbose") && (std::string(value) == "true"))
 	{
 	  ccs::log::SetStdout();
@@ -258,14 +322,24 @@ bool ConfigurationServiceImpl::ReadConfiguration (const std::string& name, ccs::
 
 }
 
-bool ConfigurationServiceImpl::LoadConfiguration (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const ccs::types::uint32 checksum)
+bool ConfigurationServiceImpl::LoadConfiguration (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const std::string& algorithm, const ccs::types::uint64 checksum)
 {
 
   bool status = (static_cast<ConfigurationHandler*>(NULL) != __handler);
 
-  if (status)
+  if (status && (algorithm == CONFIGURATION_HASH_CRC32))
     {
-      status = __handler->LoadConfiguration(name, value, seed, checksum);
+      status = __handler->LoadConfiguration(name, value, seed, static_cast<ccs::types::uint32>(checksum));
+    }
+  else if (status && __handler->IsSupported(algorithm))
+    { // Negotiated checksum passed through
+      status = __handler->LoadConfiguration(name, value, seed, algorithm, checksum);
+    }
+  else if (status)
+    { // ConfigurationHandler expects the CRC-32 of the data set, only if the algorithm was not negotiated
+      ccs::types::uint64 crc = 0ul;
+      status = (ComputeChecksum(name, value, seed, CONFIGURATION_HASH_CRC32, crc) &&
+		__handler->LoadConfiguration(name, value, seed, static_cast<ccs::types::uint32>(crc)));
     }
 
   return status;
@@ -286,7 +360,31 @@ bool ConfigurationServiceImpl::GetSeed (const std::string& name, ccs::types::uin
 
 }
 
-bool ConfigurationServiceImpl::VerifyChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const ccs::types::uint32 checksum)
+bool ConfigurationServiceImpl::GetChecksum (const ccs::types::AnyValue * const request, std::string& algorithm, ccs::types::uint64& checksum) const
+{
+
+  // Negotiated algorithm, absent from legacy requests
+  algorithm = std::string(((ccs::HelperTools::HasAttribute(request, "algorithm") && (ccs::types::String == ccs::HelperTools::GetAttributeType(request, "algorithm"))) ?
+			   static_cast<char*>(ccs::HelperTools::GetAttributeReference(request, "algorithm")) : CONFIGURATION_HASH_CRC32));
+
+  bool status = ccs::HelperTools::HasAttribute(request, "hash");
+
+  if (status && (ccs::types::UnsignedInteger64 == ccs::HelperTools::GetAttributeType(request, "hash")))
+    {
+      status = ccs::HelperTools::GetAttributeValue<ccs::types::uint64>(request, "hash", checksum);
+    }
+  else if (status)
+    {
+      ccs::types::uint32 hash = 0u;
+      status = ccs::HelperTools::GetAttributeValue<ccs::types::uint32>(request, "hash", hash);
+      checksum = static_cast<ccs::types::uint64>(hash);
+    }
+
+  return status;
+
+}
+
+bool ConfigurationServiceImpl::GetHasher (void)
 {
 
   bool status = (static_cast<ConfigurationHasher*>(NULL) != __hasher);
@@ -297,35 +395,253 @@ bool ConfigurationServiceImpl::VerifyChecksum (const std::string& name, const cc
       status = (static_cast<ConfigurationHasher*>(NULL) != __hasher);
     }
 
+  return status;
+
+}
+
+bool ConfigurationServiceImpl::VerifyChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const std::string& algorithm, const ccs::types::uint64 checksum)
+{
+
+  bool status = GetHasher();
+
+  if (status && (algorithm == CONFIGURATION_HASH_CRC32))
+    {
+      ccs::types::uint32 crc = static_cast<ccs::types::uint32>(checksum);
+      status = ((static_cast<ccs::types::uint64>(crc) == checksum) && __hasher->VerifyChecksum(name, value, seed, crc));
+    }
+  else if (status)
+    {
+      status = __hasher->VerifyChecksum(name, value, seed, algorithm, checksum);
+    }
+
+  return status;
+
+}
+
+bool ConfigurationServiceImpl::ComputeChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, const std::string& algorithm, ccs::types::uint64& checksum)
+{
+
+  bool status = GetHasher();
+
   if (status)
     {
-      status = __hasher->VerifyChecksum(name, value, seed, checksum);
+      status = __hasher->ComputeChecksum(name, value, seed, algorithm, checksum);
     }
 
   return status;
 
 }
-#ifdef OVERRIDE_HASH_MISMATCH
-bool ConfigurationServiceImpl::ComputeChecksum (const std::string& name, const ccs::types::AnyValue& value, const ccs::types::uint32 seed, ccs::types::uint32& checksum)
+
+bool ConfigurationServiceImpl::GetSnapshot (const std::string& name, std::shared_ptr<const ccs::types::AnyValue>& value, ccs::types::uint64& version)
 {
 
-  bool status = (static_cast<ConfigurationHasher*>(NULL) != __hasher);
+  __snapshot_lock.AcquireLock();
+
+  std::map<std::string, ConfigurationSnapshot_t>::const_iterator iter = __snapshots.find(name);
+
+  bool status = ((__snapshots.end() != iter) && (iter->second.value ? true : false) &&
+		 ((ccs::HelperTools::GetCurrentTime() - iter->second.refreshed) < DEFAULT_SNAPSHOT_LIFETIME)); // Not expired
+
+  if (status)
+    {
+      value = iter->second.value;
+      version = iter->second.version;
+    }
+
+  __snapshot_lock.ReleaseLock();
+
+  return status;
+
+}
+
+ccs::types::uint64 ConfigurationServiceImpl::SetSnapshot (const std::string& name, const std::shared_ptr<const ccs::types::AnyValue>& value, const bool confirmed)
+{
+
+  __snapshot_lock.AcquireLock();
+
+  ConfigurationSnapshot_t& snapshot = __snapshots[name]; // Value-initialised, i.e. version 0, if not yet existing
+
+  if (confirmed)
+    {
+      snapshot.version += 1ul;
+    }
+  else if (snapshot.value && value && 
+	   ((snapshot.value->GetSize() != value->GetSize()) || 
+	    (0 != memcmp(snapshot.value->GetInstance(), value->GetInstance(), value->GetSize()))))
+    { // Changed on the handler side
+      snapshot.version += 1ul;
+    }
+
+  snapshot.value = value;
+  snapshot.refreshed = ccs::HelperTools::GetCurrentTime();
+
+  ccs::types::uint64 version = snapshot.version;
+
+  __snapshot_lock.ReleaseLock();
+
+  return version;
+
+}
+
+bool ConfigurationServiceImpl::OpenStaging (const std::string& name, const ccs::types::uint32 seed, const ccs::types::uint32 size, ccs::types::char8 * const reason, ccs::types::uint32& offset)
+{
+
+  std::map<std::string, ConfigurationStaging_t>::iterator iter = __staging.find(name);
+
+  bool status = ((__staging.end() != iter) && (iter->second.seed == seed) && (iter->second.value->GetSize() == size));
+
+  bool conflict = ((__staging.end() != iter) && (iter->second.seed != seed) && 
+		   ((ccs::HelperTools::GetCurrentTime() - iter->second.updated) < DEFAULT_STAGING_TIMEOUT)); // Another transfer in progress
+
+  if (status)
+    { // Resume transfer
+      offset = iter->second.offset;
+      iter->second.updated = ccs::HelperTools::GetCurrentTime();
+      log_info("ConfigurationServiceImpl::OpenStaging('%s') - Resume transfer at '%u'", name.c_str(), offset);
+    }
+  else if (conflict)
+    {
+      log_warning("ConfigurationServiceImpl::OpenStaging('%s') - Transfer '%u' in progress", name.c_str(), iter->second.seed);
+      ccs::HelperTools::SafeStringCopy(reason, "Transfer in progress", ccs::types::MaxStringLength);
+    }
+  else
+    { // Same transfer re-opened, or idle one superseded
+      DiscardStaging(name);
+
+      // Staging buffer conforming to the type provided by the handler
+      ccs::types::AnyValue copy;
+
+      status = ReadConfiguration(name, copy);
+
+      if (status)
+	{
+	  status = (copy.GetSize() == size);
+
+	  if (!status)
+	    {
+	      log_error("ConfigurationServiceImpl::OpenStaging('%s') - Size mismatch '%u' vs '%u'", name.c_str(), size, copy.GetSize());
+	    }
+	}
+
+      if (status)
+	{
+	  ConfigurationStaging_t staging;
+
+	  staging.seed = seed;
+	  staging.offset = 0u;
+	  staging.sequence = 0u;
+	  staging.updated = ccs::HelperTools::GetCurrentTime();
+	  staging.value = new (std::nothrow) ccs::types::AnyValue (copy);
+
+	  status = (static_cast<ccs::types::AnyValue*>(NULL) != staging.value);
+
+	  if (status)
+	    {
+	      __staging[name] = staging;
+	      offset = 0u;
+	    }
+	}
+
+      if (!status)
+	{
+	  ccs::HelperTools::SafeStringCopy(reason, "ConfigurationService::OpenStaging", ccs::types::MaxStringLength);
+	}
+    }
+
+  return status;
+
+}
+
+bool ConfigurationServiceImpl::StageChunk (const std::string& name, const ccs::types::uint32 seed, const ccs::types::uint32 sequence, const ccs::types::uint32 offset, 
+					   const ccs::types::uint8 * const buffer, const ccs::types::uint32 size, const ccs::types::uint32 crc, ccs::types::char8 * const reason, ccs::types::uint32& next)
+{
+
+  std::map<std::string, ConfigurationStaging_t>::iterator iter = __staging.find(name);
+
+  bool status = ((__staging.end() != iter) && (iter->second.seed == seed));
 
   if (!status)
-    { // Instantiate default implementation
-      __hasher = new (std::nothrow) ConfigurationHasher ();
-      status = (static_cast<ConfigurationHasher*>(NULL) != __hasher);
+    {
+      ccs::HelperTools::SafeStringCopy(reason, "No such transfer", ccs::types::MaxStringLength);
+    }
+
+  if (status)
+    {
+      status = ((iter->second.sequence == sequence) && (iter->second.offset == offset));
+
+      if (!status)
+	{
+	  snprintf(reason, STRING_MAX_LENGTH, "Out of sequence - Expect '%u' at '%u'", iter->second.sequence, iter->second.offset);
+	}
+    }
+
+  if (status)
+    {
+      status = (size <= (iter->second.value->GetSize() - offset));
+
+      if (!status)
+	{
+	  ccs::HelperTools::SafeStringCopy(reason, "Chunk out of bounds", ccs::types::MaxStringLength);
+	}
     }
 
   if (status)
     {
-      status = __hasher->ComputeChecksum(name, value, seed, checksum);
+      status = (crc == ccs::HelperTools::CyclicRedundancyCheck<ccs::types::uint32>(buffer, size));
+
+      if (!status)
+	{
+	  ccs::HelperTools::SafeStringCopy(reason, "Chunk CRC mismatch", ccs::types::MaxStringLength);
+	}
     }
 
+  if (status)
+    { // Incremental assembly
+      (void)memcpy(static_cast<ccs::types::uint8*>(iter->second.value->GetInstance()) + offset, buffer, size);
+      iter->second.offset += size;
+      iter->second.sequence += 1u;
+      iter->second.updated = ccs::HelperTools::GetCurrentTime();
+    }
+
+  // Acknowledge next expected offset
+  next = ((__staging.end() != iter) ? iter->second.offset : 0u);
+
   return status;
 
 }
-#endif
+
+bool ConfigurationServiceImpl::CommitStaging (const std::string& name, const ccs::types::uint32 seed, const ccs::types::AnyValue*& value)
+{
+
+  std::map<std::string, ConfigurationStaging_t>::iterator iter = __staging.find(name);
+
+  bool status = ((__staging.end() != iter) && (iter->second.seed == seed) && 
+		 (iter->second.value->GetSize() == iter->second.offset)); // Transfer complete
+
+  if (status)
+    {
+      value = iter->second.value;
+    }
+
+  return status;
+
+}
+
+void ConfigurationServiceImpl::DiscardStaging (const std::string& name)
+{
+
+  std::map<std::string, ConfigurationStaging_t>::iterator iter = __staging.find(name);
+
+  if (__staging.end() != iter)
+    {
+      delete iter->second.value;
+      __staging.erase(iter);
+    }
+
+  return;
+
+}
+
 bool ConfigurationServiceImpl::RegisterHandler (ConfigurationHandler* handler)
 {
 
@@ -354,6 +670,17 @@ bool ConfigurationServiceImpl::RegisterHasher (ConfigurationHasher* hasher)
 
 }
 
+bool ConfigurationServiceImpl::SetMismatchOverride (const bool enable)
+{
+
+  __writer.AcquireLock();
+  __override = enable;
+  __writer.ReleaseLock();
+
+  return true;
+
+}
+
 // cppcheck-suppress unusedFunction // Callback associated to ccs::base::RPCService
 ccs::types::AnyValue ConfigurationServiceImpl::HandleRequest (const ccs::types::AnyValue& request)
 {
@@ -388,39 +715,73 @@ ccs::types::AnyValue ConfigurationServiceImpl::HandleRequest (const ccs::types::
       alias = std::string(((ccs::HelperTools::HasAttribute(__query_value, "alias")) ? static_cast<char*>(ccs::HelperTools::GetAttributeReference(__query_value, "alias")) : ""));
     }
 
+  // Intermediate reply values are discarded upon return, their instance memory is reclaimed altogether;
+  // the reply types and the returned copy are still allocated from the heap
+  ccs::types::ArenaAllocator* arena = ccs::types::ArenaAllocator::GetThreadInstance();
+  ccs::types::ArenaAllocator::Checkpoint checkpoint (*arena);
+
   ccs::types::AnyValue __reply_value; // Placeholder for return structure
 
   ccs::types::string reason; ccs::HelperTools::SafeStringCopy(reason, "Success", ccs::types::MaxStringLength);
 
   if (qualifier == "read")
     {
-      log_info("ConfigurationService::HandleRequest('%s') - Query from handler ..", qualifier.c_str());
+      std::shared_ptr<const ccs::types::AnyValue> config; // Immutable snapshot
+      ccs::types::uint64 version = 0ul;
 
-      ccs::types::AnyValue config; // Placeholder
-
-      if (status)
+      if (status && !GetSnapshot(alias, config, version))
 	{
-	  try
-	    {
-	      status = ReadConfiguration(alias, config);
-	    }
-	  catch (const std::exception& e)
-	    {
-	      log_notice("ConfigurationService::HandleRequest('%s') - .. '%s' exception caught", qualifier.c_str(), e.what());
-	      ccs::HelperTools::SafeStringCopy(reason, e.what(), ccs::types::MaxStringLength);
-	      status = false;
-	    }
-	  catch (...)
+	  // WARNING - Not yet cached, serialised with loads so as not to publish a stale data set
+	  __writer.AcquireLock();
+
+	  if (!GetSnapshot(alias, config, version))
 	    {
-	      log_notice("ConfigurationService::HandleRequest('%s') - .. unknown exception caught", qualifier.c_str());
-	      ccs::HelperTools::SafeStringCopy(reason, "Unknown exception", ccs::types::MaxStringLength);
-	      status = false;
+	      log_info("ConfigurationService::HandleRequest('%s') - Query from handler ..", qualifier.c_str());
+
+	      std::shared_ptr<ccs::types::AnyValue> copy (new (std::nothrow) ccs::types::AnyValue ());
+
+	      status = (copy ? true : false);
+
+	      if (status)
+		{
+		  try
+		    {
+		      status = ReadConfiguration(alias, *copy);
+		    }
+		  catch (const std::exception& e)
+		    {
+		      log_notice("ConfigurationService::HandleRequest('%s') - .. '%s' exception caught", qualifier.c_str(), e.what());
+		      ccs::HelperTools::SafeStringCopy(reason, e.what(), ccs::types::MaxStringLength);
+		      status = false;
+		    }
+		  catch (...)
+		    {
+		      log_notice("ConfigurationService::HandleRequest('%s') - .. unknown exception caught", qualifier.c_str());
+		      ccs::HelperTools::SafeStringCopy(reason, "Unknown exception", ccs::types::MaxStringLength);
+		      status = false;
+		    }
+		}
+
+	      if (status)
+		{
+		  version = SetSnapshot(alias, copy, false);
+		  config = copy;
+		}
 	    }
+
+	  __writer.ReleaseLock();
 	}
+      else if (status)
+	{
+	  log_debug("ConfigurationService::HandleRequest('%s') - Serve snapshot '%lu' ..", qualifier.c_str(), version);
+	}
+
+      ccs::types::AnyValue empty; // Placeholder in case of failure
+      const ccs::types::AnyValue& value = (config ? *config : empty);
 
       if (status)
 	{
-	  char buffer [1024] = STRING_UNDEFINED; config.SerialiseInstance(buffer, 1024u);
+	  char buffer [1024] = STRING_UNDEFINED; value.SerialiseInstance(buffer, 1024u);
 	  log_info(".. '%s' ..", buffer);
 	}
 
@@ -428,14 +789,16 @@ ccs::types::AnyValue ConfigurationServiceImpl::HandleRequest (const ccs::types::
       ccs::types::CompoundType reply_type (*ccs::base::RPCTypes::Reply_int); // Default RPC reply type
       // .. and add the missing bit
 
-      reply_type.AddAttribute("value", config.GetType());
+      reply_type.AddAttribute<ccs::types::uint64>("version");
+      reply_type.AddAttribute("value", value.GetType());
 
-      ccs::types::AnyValue reply_value (reply_type);
+      ccs::types::AnyValue reply_value (std::make_shared<const ccs::types::CompoundType>(reply_type), *arena); // Intermediate
       ccs::HelperTools::SetAttributeValue(&reply_value, "timestamp", ccs::HelperTools::GetCurrentTime());
       ccs::HelperTools::SetAttributeValue(&reply_value, "qualifier", "read");
       ccs::HelperTools::SetAttributeValue(&reply_value, "status", status);
       ccs::HelperTools::SetAttributeValue(&reply_value, "reason", reason);
-      ccs::HelperTools::SetAttributeValue(&reply_value, "value", config);
+      ccs::HelperTools::SetAttributeValue(&reply_value, "version", version);
+      ccs::HelperTools::SetAttributeValue(&reply_value, "value", value);
 
       __reply_value = reply_value;
     }
@@ -445,6 +808,31 @@ ccs::types::AnyValue ConfigurationServiceImpl::HandleRequest (const ccs::types::
 
       ccs::types::uint32 seed = 0u; // Placeholder
 
+      // Negotiate checksum algorithm
+      std::string algorithm (CONFIGURATION_HASH_CRC32);
+
+      if (ccs::HelperTools::HasAttribute(__query_value, "algorithm") && (ccs::types::String == ccs::HelperTools::GetAttributeType(__query_value, "algorithm")))
+	{
+	  algorithm = std::string(static_cast<char*>(ccs::HelperTools::GetAttributeReference(__query_value, "algorithm")));
+	}
+
+      __writer.AcquireLock();
+
+      if (static_cast<ConfigurationHasher*>(NULL) == __hasher)
+	{ // Instantiate default implementation
+	  __hasher = new (std::nothrow) ConfigurationHasher ();
+	}
+
+      if ((static_cast<ConfigurationHasher*>(NULL) == __hasher) || !__hasher->IsSupported(algorithm))
+	{
+	  algorithm = std::string(CONFIGURATION_HASH_CRC32);
+	}
+
+      if ((static_cast<ConfigurationHandler*>(NULL) != __handler) && !__handler->IsSupported(algorithm))
+	{ // Handler expects the CRC-32, i.e. computed once rather than in addition to the negotiated checksum
+	  algorithm = std::string(CONFIGURATION_HASH_CRC32);
+	}
+
       if (status)
 	{
 	  try
@@ -465,6 +853,8 @@ ccs::types::AnyValue ConfigurationServiceImpl::HandleRequest (const ccs::types::
 	    }
 	}
 
+      __writer.ReleaseLock();
+
       if (status)
 	{
 	  log_info(".. '%u' ..", seed);
@@ -474,13 +864,15 @@ ccs::types::AnyValue ConfigurationServiceImpl::HandleRequest (const ccs::types::
       ccs::types::CompoundType reply_type (*ccs::base::RPCTypes::Reply_int); // Default RPC reply type
       // .. and add the missing bit
       reply_type.AddAttribute("value", "uint32");
+      reply_type.AddAttribute("algorithm", "string");
 
-      ccs::types::AnyValue reply_value (reply_type);
+      ccs::types::AnyValue reply_value (std::make_shared<const ccs::types::CompoundType>(reply_type), *arena); // Intermediate
       ccs::HelperTools::SetAttributeValue(&reply_value, "timestamp", ccs::HelperTools::GetCurrentTime());
       ccs::HelperTools::SetAttributeValue(&reply_value, "qualifier", "read");
       ccs::HelperTools::SetAttributeValue(&reply_value, "status", status);
       ccs::HelperTools::SetAttributeValue(&reply_value, "reason", reason);
       ccs::HelperTools::SetAttributeValue(&reply_value, "value", seed);
+      ccs::HelperTools::SetAttributeValue(&reply_value, "algorithm", algorithm.c_str());
 
       __reply_value = reply_value;
     }
@@ -488,6 +880,8 @@ ccs::types::AnyValue ConfigurationServiceImpl::HandleRequest (const ccs::types::
     {
       log_info("ConfigurationService::HandleRequest('%s') - Process request ..", qualifier.c_str());
 
+      __writer.AcquireLock();
+
       // Seed .. 
       ccs::types::uint32 seed;
 
@@ -512,16 +906,18 @@ ccs::types::AnyValue ConfigurationServiceImpl::HandleRequest (const ccs::types::
 	}
 
       // Checksum ..
-      ccs::types::uint32 hash;
+      std::string algorithm;
+      ccs::types::uint64 hash = 0ul;
 
       if (status)
 	{
-	  status = ccs::HelperTools::GetAttributeValue<ccs::types::uint32>(__query_value, "hash", hash);
+	  status = GetChecksum(__query_value, algorithm, hash);
 	}
 
       log_info("ConfigurationService::HandleRequest('%s') - .. fit to expected type ..", qualifier.c_str());
 
       ccs::types::AnyValue copy; // Placeholder
+      ccs::types::uint64 version = 0ul;
 
       if (status)
 	{
@@ -558,15 +954,18 @@ ccs::types::AnyValue ConfigurationServiceImpl::HandleRequest (const ccs::types::
 	{
 	  log_info("ConfigurationService::HandleRequest('%s') - .. verify hash ..", qualifier.c_str());
 
-	  status = VerifyChecksum(alias, copy, seed, hash);
-#ifdef OVERRIDE_HASH_MISMATCH
-	  if (!status)
+	  status = VerifyChecksum(alias, copy, seed, algorithm, hash);
+
+	  if (!status && __override)
 	    {
 	      log_warning("ConfigurationService::HandleRequest('%s') - .. mismatch ..", qualifier.c_str());
-	      status = ComputeChecksum(alias, copy, seed, hash);
-	      log_warning("ConfigurationService::HandleRequest('%s') - .. override with '%u' ..", qualifier.c_str(), hash);
+	      status = ComputeChecksum(alias, copy, seed, algorithm, hash);
+	      log_warning("ConfigurationService::HandleRequest('%s') - .. override with '%lu' ..", qualifier.c_str(), hash);
+	    }
+	  else if (!status)
+	    {
+	      ccs::HelperTools::SafeStringCopy(reason, "Checksum mismatch", ccs::types::MaxStringLength);
 	    }
-#endif
 	}
 
       if (status)
@@ -574,7 +973,12 @@ ccs::types::AnyValue ConfigurationServiceImpl::HandleRequest (const ccs::types::
 	  try
 	    {
 	      log_info("ConfigurationService::HandleRequest('%s') - .. and provide to handler ..", qualifier.c_str());
-	      status = LoadConfiguration(alias, copy, seed, hash);
+	      status = LoadConfiguration(alias, copy, seed, algorithm, hash);
+
+	      if (status)
+		{ // Publish confirmed data set
+		  version = SetSnapshot(alias, std::make_shared<const ccs::types::AnyValue>(copy), true);
+		}
 
 	      if (!status)
 		{
@@ -595,11 +999,205 @@ ccs::types::AnyValue ConfigurationServiceImpl::HandleRequest (const ccs::types::
 	    }
 	}
 
-      ccs::types::AnyValue reply_value (ccs::base::RPCTypes::Reply_int); // Default RPC reply type
+      __writer.ReleaseLock();
+
+      // Copy the base reply type ..
+      ccs::types::CompoundType reply_type (*ccs::base::RPCTypes::Reply_int); // Default RPC reply type
+      // .. and add the missing bit
+      reply_type.AddAttribute<ccs::types::uint64>("version");
+
+      ccs::types::AnyValue reply_value (std::make_shared<const ccs::types::CompoundType>(reply_type), *arena); // Intermediate
       ccs::HelperTools::SetAttributeValue(&reply_value, "timestamp", ccs::HelperTools::GetCurrentTime());
       ccs::HelperTools::SetAttributeValue(&reply_value, "qualifier", "load");
       ccs::HelperTools::SetAttributeValue(&reply_value, "status", status);
       ccs::HelperTools::SetAttributeValue(&reply_value, "reason", reason);
+      ccs::HelperTools::SetAttributeValue(&reply_value, "version", version);
+
+      __reply_value = reply_value;
+    }
+  else if ((qualifier == "stage") || (qualifier == "chunk"))
+    {
+      log_debug("ConfigurationService::HandleRequest('%s') - Process request ..", qualifier.c_str());
+
+      __writer.AcquireLock();
+
+      // Transfer identifier .. 
+      ccs::types::uint32 seed = 0u;
+
+      if (status)
+	{
+	  status = ccs::HelperTools::GetAttributeValue<ccs::types::uint32>(__query_value, "seed", seed);
+	}
+
+      ccs::types::uint32 size = 0u;
+
+      if (status)
+	{
+	  status = ccs::HelperTools::GetAttributeValue<ccs::types::uint32>(__query_value, "size", size);
+	}
+
+      ccs::types::uint32 offset = 0u; // Next expected byte
+
+      if (status && (qualifier == "stage"))
+	{
+	  try
+	    {
+	      status = OpenStaging(alias, seed, size, reason, offset);
+	    }
+	  catch (const std::exception& e)
+	    {
+	      log_notice("ConfigurationService::HandleRequest('%s') - .. '%s' exception caught", qualifier.c_str(), e.what());
+	      ccs::HelperTools::SafeStringCopy(reason, e.what(), ccs::types::MaxStringLength);
+	      status = false;
+	    }
+	  catch (...)
+	    {
+	      log_notice("ConfigurationService::HandleRequest('%s') - .. unknown exception caught", qualifier.c_str());
+	      ccs::HelperTools::SafeStringCopy(reason, "Unknown exception", ccs::types::MaxStringLength);
+	      status = false;
+	    }
+	}
+      else if (status)
+	{
+	  ccs::types::uint32 sequence = 0u;
+	  ccs::types::uint32 crc = 0u;
+
+	  status = (ccs::HelperTools::GetAttributeValue<ccs::types::uint32>(__query_value, "sequence", sequence) &&
+		    ccs::HelperTools::GetAttributeValue<ccs::types::uint32>(__query_value, "offset", offset) &&
+		    ccs::HelperTools::GetAttributeValue<ccs::types::uint32>(__query_value, "crc", crc) &&
+		    ccs::HelperTools::HasAttribute(__query_value, "data") &&
+		    (size <= ccs::HelperTools::GetAttributeType(__query_value, "data")->GetSize()));
+
+	  if (status)
+	    {
+	      log_debug(".. chunk '%u' at '%u' ..", sequence, offset);
+	      status = StageChunk(alias, seed, sequence, offset, static_cast<const ccs::types::uint8*>(ccs::HelperTools::GetAttributeReference(__query_value, "data")), size, crc, reason, offset);
+	    }
+	  else
+	    {
+	      ccs::HelperTools::SafeStringCopy(reason, "Invalid chunk", ccs::types::MaxStringLength);
+	    }
+	}
+
+      __writer.ReleaseLock();
+
+      // Copy the base reply type ..
+      ccs::types::CompoundType reply_type (*ccs::base::RPCTypes::Reply_int); // Default RPC reply type
+      // .. and add the missing bit
+      reply_type.AddAttribute("value", "uint32");
+
+      ccs::types::AnyValue reply_value (std::make_shared<const ccs::types::CompoundType>(reply_type), *arena); // Intermediate
+      ccs::HelperTools::SetAttributeValue(&reply_value, "timestamp", ccs::HelperTools::GetCurrentTime());
+      ccs::HelperTools::SetAttributeValue(&reply_value, "qualifier", qualifier.c_str());
+      ccs::HelperTools::SetAttributeValue(&reply_value, "status", status);
+      ccs::HelperTools::SetAttributeValue(&reply_value, "reason", reason);
+      ccs::HelperTools::SetAttributeValue(&reply_value, "value", offset);
+
+      __reply_value = reply_value;
+    }
+  else if (qualifier == "commit")
+    {
+      log_info("ConfigurationService::HandleRequest('%s') - Process request ..", qualifier.c_str());
+
+      __writer.AcquireLock();
+
+      // Transfer identifier .. 
+      ccs::types::uint32 seed = 0u;
+
+      if (status)
+	{
+	  status = ccs::HelperTools::GetAttributeValue<ccs::types::uint32>(__query_value, "seed", seed);
+	}
+
+      // Checksum ..
+      std::string algorithm;
+      ccs::types::uint64 hash = 0ul;
+
+      if (status)
+	{
+	  status = GetChecksum(__query_value, algorithm, hash);
+	}
+
+      const ccs::types::AnyValue* staged = static_cast<const ccs::types::AnyValue*>(NULL);
+      ccs::types::uint64 version = 0ul;
+
+      if (status)
+	{
+	  status = CommitStaging(alias, seed, staged);
+
+	  if (!status)
+	    {
+	      ccs::HelperTools::SafeStringCopy(reason, "Incomplete transfer", ccs::types::MaxStringLength);
+	    }
+	}
+
+      if (status)
+	{
+	  log_info("ConfigurationService::HandleRequest('%s') - .. verify hash ..", qualifier.c_str());
+
+	  status = VerifyChecksum(alias, *staged, seed, algorithm, hash);
+
+	  if (!status && __override)
+	    {
+	      log_warning("ConfigurationService::HandleRequest('%s') - .. mismatch ..", qualifier.c_str());
+	      status = ComputeChecksum(alias, *staged, seed, algorithm, hash);
+	      log_warning("ConfigurationService::HandleRequest('%s') - .. override with '%lu' ..", qualifier.c_str(), hash);
+	    }
+	  else if (!status)
+	    {
+	      ccs::HelperTools::SafeStringCopy(reason, "Checksum mismatch", ccs::types::MaxStringLength);
+	    }
+	}
+
+      if (status)
+	{
+	  try
+	    {
+	      log_info("ConfigurationService::HandleRequest('%s') - .. and provide to handler ..", qualifier.c_str());
+	      status = LoadConfiguration(alias, *staged, seed, algorithm, hash);
+
+	      if (status)
+		{ // Publish confirmed data set
+		  version = SetSnapshot(alias, std::make_shared<const ccs::types::AnyValue>(*staged), true);
+		}
+
+	      if (!status)
+		{
+		  ccs::HelperTools::SafeStringCopy(reason, "ConfigurationHandler::LoadConfiguration", ccs::types::MaxStringLength);
+		}
+	    }
+	  catch (const std::exception& e)
+	    {
+	      log_notice("ConfigurationService::HandleRequest('%s') - .. '%s' exception caught", qualifier.c_str(), e.what());
+	      ccs::HelperTools::SafeStringCopy(reason, e.what(), ccs::types::MaxStringLength);
+	      status = false;
+	    }
+	  catch (...)
+	    {
+	      log_notice("ConfigurationService::HandleRequest('%s') - .. unknown exception caught", qualifier.c_str());
+	      ccs::HelperTools::SafeStringCopy(reason, "Unknown exception", ccs::types::MaxStringLength);
+	      status = false;
+	    }
+	}
+
+      if (static_cast<const ccs::types::AnyValue*>(NULL) != staged)
+	{ // Release staging buffer
+	  DiscardStaging(alias);
+	}
+
+      __writer.ReleaseLock();
+
+      // Copy the base reply type ..
+      ccs::types::CompoundType reply_type (*ccs::base::RPCTypes::Reply_int); // Default RPC reply type
+      // .. and add the missing bit
+      reply_type.AddAttribute<ccs::types::uint64>("version");
+
+      ccs::types::AnyValue reply_value (std::make_shared<const ccs::types::CompoundType>(reply_type), *arena); // Intermediate
+      ccs::HelperTools::SetAttributeValue(&reply_value, "timestamp", ccs::HelperTools::GetCurrentTime());
+      ccs::HelperTools::SetAttributeValue(&reply_value, "qualifier", "commit");
+      ccs::HelperTools::SetAttributeValue(&reply_value, "status", status);
+      ccs::HelperTools::SetAttributeValue(&reply_value, "reason", reason);
+      ccs::HelperTools::SetAttributeValue(&reply_value, "version", version);
 
       __reply_value = reply_value;
     }
@@ -650,7 +1248,20 @@ ConfigurationService::ConfigurationService (void)
 
 }
   
-ConfigurationServiceImpl::ConfigurationServiceImpl (const char* service) : ccs::base::RPCServer(service) {}
+ConfigurationServiceImpl::ConfigurationServiceImpl (const char* service) : ccs::base::RPCServer(service)
+{
+
+  // Cached 'read' requests are not held up by loads in progress
+  bool status = (SetWorkers(DEFAULT_CONFIGURATION_WORKERS) && SetConcurrent(true));
+
+  if (!status)
+    {
+      log_warning("ConfigurationServiceImpl::ConfigurationServiceImpl('%s') - Requests handled in transport thread", service);
+    }
+
+  return;
+
+}
 
 // Destructor methods
 
@@ -667,7 +1278,19 @@ ConfigurationService::~ConfigurationService (void)
 
 }
   
-ConfigurationServiceImpl::~ConfigurationServiceImpl (void) {}
+ConfigurationServiceImpl::~ConfigurationServiceImpl (void)
+{
+
+  Terminate(); // No request handled past this point
+
+  while (!__staging.empty())
+    {
+      DiscardStaging(__staging.begin()->first);
+    }
+
+  return;
+
+}
 
 } // namespace core
 
@@ -63,6 +63,21 @@ class ConfigurationServiceImpl; // Forward class declaration
  * @brief Interface class providing support for configuration function.
  * @detail The implementation provides a named service and potentially named data sets.
  *
+ * The service supports 'read', 'init', and 'load' requests, as well as a chunked transfer
+ * protocol for large data sets, i.e. 'stage' opens or resumes a transfer identified by
+ * its seed, 'chunk' requests carry sequence-numbered and CRC-protected portions of the
+ * instance assembled incrementally into a staging buffer, and 'commit' verifies the
+ * checksum of the whole data set before providing it to the ConfigurationHandler. A 'stage'
+ * request for a data set with another transfer in progress is rejected, unless the latter
+ * was idle for longer than DEFAULT_STAGING_TIMEOUT (10s).
+ *
+ * 'read' requests are served concurrently from the latest snapshot of the named data set,
+ * i.e. the ConfigurationHandler is only queried upon first access and once the snapshot is
+ * older than DEFAULT_SNAPSHOT_LIFETIME (1s), so that changes made on the handler side are seen.
+ * Requests which involve the ConfigurationHandler are serialised. Replies to 'read', 'load'
+ * and 'commit' requests convey the snapshot version, incremented upon each successful load
+ * and each change found upon re-reading the handler.
+ *
  * @note The design is based on a bridge pattern to avoid exposing implementation
  * specific details through the interface class.
  *
@@ -179,6 +194,18 @@ class ConfigurationService : public ccs::base::AnyObject, public ccs::base::Cfga
 
     bool RegisterHasher (const char* hasher); // Instance name
 
+    /**
+     * @brief Accessor.
+     * @detail Selects whether a data set received with a mismatching checksum is nonetheless
+     * provided to the ConfigurationHandler, the checksum being recomputed upon reception, or
+     * rejected. Disabled by default, i.e. mismatching data sets are rejected. Also available
+     * as 'override' parameter.
+     * @param enable True to override mismatching checksums.
+     * @return True if the service is started.
+     */
+
+    bool SetMismatchOverride (const bool enable);
+
 };
 
 // Global variables
@@ -15,11 +15,13 @@
 #include <ObjectFactory.h>
 
 #include <AnyTypeDatabase.h>
+#include <AttributePath.h>
 
 #include <Open62541Client.h>
 
 // Local header files
 
+#include "ConfigurationHasher.h"
 #include "Open62541PlantSystemAdapter.h"
 
 // Constants
@@ -39,10 +41,13 @@ private:
 
     ccs::types::AnyValue *__config_cache;
 
+    ConfigurationHasher __hasher; // Read-back verification with the negotiated algorithm
+
     ccs::types::string __ua_srvr;
     ccs::base::Open62541Client *__ua_clnt;
 
     std::vector<std::tuple<std::string, std::string, const std::shared_ptr<const ccs::types::ScalarType>, std::string>> __assoc;
+    std::vector<ccs::types::AttributePath> __paths; // Resolved against the configuration cache, in association order
 
     ccs::types::string eoNodeId;
     ccs::types::string methodId;
@@ -60,10 +65,16 @@ public:
     bool ReadConfiguration(const std::string &name,
                            ccs::types::AnyValue &value) const;
 
+    bool IsSupported(const std::string &algorithm) const {
+        return __hasher.IsSupported(algorithm);
+    }
+    ;
+
     bool LoadConfiguration(const std::string &name,
                            const ccs::types::AnyValue &value,
                            const ccs::types::uint32 seed,
-                           const ccs::types::uint32 checksum);
+                           const std::string &algorithm,
+                           const ccs::types::uint64 checksum);
 
     bool SetServer(const char *server) {
         ccs::HelperTools::SafeStringCopy(__ua_srvr, server, STRING_MAX_LENGTH);
@@ -305,6 +316,17 @@ bool Open62541PlantSystemAdapter::ReadConfiguration(const std::string &name,
     return status;
 }
 
+bool Open62541PlantSystemAdapter::IsSupported(const std::string &algorithm) const {
+
+    bool status = (static_cast<Open62541PlantSystemAdapterImpl*>(NULL) != __impl);
+
+    if (status) {
+        status = __impl->IsSupported(algorithm);
+    }
+
+    return status;
+}
+
 bool Open62541PlantSystemAdapter::LoadConfiguration(const std::string &name,
                                                     const ccs::types::AnyValue &value,
                                                     const ccs::types::uint32 seed,
@@ -313,7 +335,22 @@ bool Open62541PlantSystemAdapter::LoadConfiguration(const std::string &name,
     bool status = (static_cast<Open62541PlantSystemAdapterImpl*>(NULL) != __impl);
 
     if (status) {
-        status = __impl->LoadConfiguration(name, value, seed, checksum);
+        status = __impl->LoadConfiguration(name, value, seed, CONFIGURATION_HASH_CRC32, static_cast<ccs::types::uint64>(checksum));
+    }
+
+    return status;
+}
+
+bool Open62541PlantSystemAdapter::LoadConfiguration(const std::string &name,
+                                                    const ccs::types::AnyValue &value,
+                                                    const ccs::types::uint32 seed,
+                                                    const std::string &algorithm,
+                                                    const ccs::types::uint64 checksum) {
+
+    bool status = (static_cast<Open62541PlantSystemAdapterImpl*>(NULL) != __impl);
+
+    if (status) {
+        status = __impl->LoadConfiguration(name, value, seed, algorithm, checksum);
     }
 
     return status;
@@ -330,7 +367,7 @@ bool Open62541PlantSystemAdapterImpl::ReadConfiguration(const std::string &name,
 
     for (ccs::types::uint32 index = 0u; (index < __assoc.size()) && status; index += 1u) {
 
-        memcpy(ccs::HelperTools::GetAttributeReference(__config_cache, std::get < 0 > (__assoc[index]).c_str()),
+        memcpy(__paths[index].GetReference(*__config_cache),
                __ua_clnt->GetVariable(std::get < 1 > (__assoc[index]).c_str())->GetInstance(),
                __ua_clnt->GetVariable(std::get < 1 > (__assoc[index]).c_str())->GetSize());
     }
@@ -347,7 +384,8 @@ bool Open62541PlantSystemAdapterImpl::ReadConfiguration(const std::string &name,
 bool Open62541PlantSystemAdapterImpl::LoadConfiguration(const std::string &name,
                                                         const ccs::types::AnyValue &value,
                                                         const ccs::types::uint32 seed,
-                                                        const ccs::types::uint32 checksum) {
+                                                        const std::string &algorithm,
+                                                        const ccs::types::uint64 checksum) {
 
     bool status = (static_cast<ccs::types::AnyValue*>(NULL) != __config_cache);
 
@@ -359,20 +397,14 @@ bool Open62541PlantSystemAdapterImpl::LoadConfiguration(const std::string &name,
     }
 
     if (status) {
-        // Update cache
+        // Update cache, the checksum being verified by the service upon reception
         *__config_cache = value; // AnyValue::operator= (const AnyValue&)
-        log_info("Open62541PlantSystemAdapterImpl::LoadConfiguration - Verify checksum ..");
-        status = (checksum
-                == ccs::HelperTools::CyclicRedundancyCheck < ccs::types::uint32
-                        > (reinterpret_cast<ccs::types::uint8*>(__config_cache->GetInstance()), __config_cache->GetSize(), seed));
     }
-    if (status)
-        log_info("... done!");
 
     log_info("Open62541PlantSystemAdapterImpl::LoadConfiguration - Update from cache ..");
     for (ccs::types::uint32 index = 0u; (status && (index < __assoc.size())); index += 1u) {
         memcpy(__ua_clnt->GetVariable(std::get < 1 > (__assoc[index]).c_str())->GetInstance(),
-               ccs::HelperTools::GetAttributeReference(__config_cache, std::get < 0 > (__assoc[index]).c_str()),
+               __paths[index].GetReference(*__config_cache),
                __ua_clnt->GetVariable(std::get < 1 > (__assoc[index]).c_str())->GetSize());
 
         status = __ua_clnt->UpdateVariable(std::get < 1 > (__assoc[index]).c_str());
@@ -386,16 +418,14 @@ bool Open62541PlantSystemAdapterImpl::LoadConfiguration(const std::string &name,
     }
 
     for (ccs::types::uint32 index = 0u; (status && (index < __assoc.size())); index += 1u) {
-        memcpy(ccs::HelperTools::GetAttributeReference(__config_cache, std::get < 0 > (__assoc[index]).c_str()),
+        memcpy(__paths[index].GetReference(*__config_cache),
                __ua_clnt->GetVariable(std::get < 1 > (__assoc[index]).c_str())->GetInstance(),
                __ua_clnt->GetVariable(std::get < 1 > (__assoc[index]).c_str())->GetSize());
     }
 
     if (status) {
-        log_info("Open62541PlantSystemAdapterImpl::LoadConfiguration - .. verify checksum again ..");
-        status = (checksum
-                == ccs::HelperTools::CyclicRedundancyCheck < ccs::types::uint32
-                        > (reinterpret_cast<ccs::types::uint8*>(__config_cache->GetInstance()), __config_cache->GetSize(), seed));
+        log_info("Open62541PlantSystemAdapterImpl::LoadConfiguration - .. verify read-back checksum ..");
+        status = __hasher.VerifyChecksum(name, *__config_cache, seed, algorithm, checksum);
     }
 
     if (status) {
@@ -410,7 +440,7 @@ bool Open62541PlantSystemAdapterImpl::LoadConfiguration(const std::string &name,
 
         for (ccs::types::uint32 index = 0u; index < __assoc.size(); index += 1u) {
             memcpy(__ua_clnt->GetVariable(std::get < 1 > (__assoc[index]).c_str())->GetInstance(),
-                   ccs::HelperTools::GetAttributeReference(&copy, std::get < 0 > (__assoc[index]).c_str()),
+                   __paths[index].GetReference(copy),
                    __ua_clnt->GetVariable(std::get < 1 > (__assoc[index]).c_str())->GetSize());
 
             __ua_clnt->UpdateVariable(std::get < 1 > (__assoc[index]).c_str());
@@ -482,12 +512,24 @@ bool Open62541PlantSystemAdapterImpl::CreateChannelAssociation(const std::string
     }
     else if (ccs::HelperTools::Is < ccs::types::ScalarType > (desc)) {
 
+        // Resolve the attribute once, accessed at each read and load thereafter
+        ccs::types::AttributePath path;
+
+        if (status) {
+            status = path.Resolve(__config_cache->GetType(), name.c_str());
+
+            if (!status) {
+                log_error("Open62541PlantSystemAdapterImpl::CreateChannelAssociation - Invalid attribute '%s'", name.c_str());
+            }
+        }
+
         // Register association
         if (status) {
             char bufferChan[chan.length() + 10];
             std::sprintf(bufferChan, "chan_%d", nodeCounter);
             std::string newChan = bufferChan;
             __assoc.push_back(std::make_tuple(name, newChan, std::dynamic_pointer_cast<const ccs::types::ScalarType>(desc), extobj));
+            __paths.push_back(path);
             nodeCounter++;
         }
     }
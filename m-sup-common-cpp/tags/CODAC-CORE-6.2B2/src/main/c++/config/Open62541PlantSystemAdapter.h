@@ -105,6 +105,19 @@ public:
                                    const ccs::types::uint32 seed,
                                    const ccs::types::uint32 checksum); // Specialises sup::core::ConfigurationHandler interface
 
+    /**
+     * @brief Behaviour. See sup::core::ConfigurationHandler::LoadConfiguration.
+     * @detail The channels read back after the update are verified once against the checksum
+     * computed with the negotiated algorithm.
+     */
+
+    virtual bool IsSupported(const std::string &algorithm) const; // Specialises sup::core::ConfigurationHandler interface
+    virtual bool LoadConfiguration(const std::string &name,
+                                   const ccs::types::AnyValue &value,
+                                   const ccs::types::uint32 seed,
+                                   const std::string &algorithm,
+                                   const ccs::types::uint64 checksum); // Specialises sup::core::ConfigurationHandler interface
+
 };
 
 // Global variables
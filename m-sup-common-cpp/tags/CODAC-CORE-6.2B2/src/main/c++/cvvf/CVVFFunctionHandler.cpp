@@ -680,6 +680,8 @@ CVVFFunctionHandler::~CVVFFunctionHandler (void)
 CVVFFunctionHandlerImpl::~CVVFFunctionHandlerImpl (void)
 {
 
+  Terminate(); // No request handled past this point
+
   return;
 
 }
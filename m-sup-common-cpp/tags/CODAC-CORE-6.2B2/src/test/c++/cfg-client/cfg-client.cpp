@@ -26,6 +26,9 @@
 #include <signal.h> // sigset, etc.
 
 #include <new> // std::nothrow
+#include <string> // std::string
+#include <thread> // std::thread
+#include <vector> // std::vector
 
 #include <types.h> // Misc. type definition, e.g. RET_STATUS
 #include <tools.h> // Misc. helper functions, e.g. hash, etc.
@@ -44,14 +47,278 @@
 #define DEFAULT_PAYLOAD     1024 // 1kB
 #define DEFAULT_PERIOD   1000000000ul
 
+#define DEFAULT_PARALLELISM       4u
+#define DEFAULT_CONNECT_TIMEOUT   5000000000ul // 5s
+
 // Type definition
 
+typedef struct BulkTarget {
+
+    std::string service;
+    std::string file;
+    std::string alias;
+
+    bool status;
+    const char* phase; // Failed phase, if any
+
+    ccs::types::uint32 size; // Configuration instance size [B]
+    ccs::types::uint64 init; // Connection and configuration read latency [ns]
+    ccs::types::uint64 load;
+    ccs::types::uint64 verify;
+
+} BulkTarget_t;
+
 // Global variables
 
 bool _terminate = false;
 
 // Function definition
 
+static bool ReadFile(const std::string& name,
+                     std::string& content) {
+
+    FILE *file = fopen(name.c_str(), "r");
+
+    bool status = (NULL != file);
+
+    if (status) {
+        char buffer[4096];
+        size_t size = 0u;
+
+        content.clear();
+
+        while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0u) {
+            content.append(buffer, size);
+        }
+
+        status = (0 == ferror(file));
+        fclose(file);
+    }
+
+    return status;
+
+}
+
+/**
+ * @brief Parses the bulk manifest.
+ * @detail One target per line, i.e. '<service> <configuration_file> [<alias>]'. Empty
+ * lines and lines starting with '#' are ignored.
+ */
+
+static bool ParseManifest(const char* name,
+                          std::vector<BulkTarget_t>& targets) {
+
+    FILE *file = fopen(name, "r");
+
+    bool status = (NULL != file);
+
+    if (status) {
+        char line[2048] = STRING_UNDEFINED;
+
+        while (status && (NULL != fgets(line, sizeof(line), file))) {
+            char service[STRING_MAX_LENGTH] = STRING_UNDEFINED;
+            char config[1024] = STRING_UNDEFINED;
+            char alias[32] = STRING_UNDEFINED;
+
+            int count = sscanf(line, "%63s %1023s %31s", service, config, alias);
+
+            if ((count < 1) || ('#' == service[0])) {
+                continue;
+            }
+
+            status = (count >= 2);
+
+            if (status) {
+                BulkTarget_t target;
+
+                target.service = service;
+                target.file = config;
+                target.alias = ((count > 2) ? alias : "");
+                target.status = false;
+                target.phase = "none";
+                target.size = 0u;
+                target.init = target.load = target.verify = 0ul;
+
+                targets.push_back(target);
+            }
+            else {
+                log_error("Invalid manifest line '%s'", line);
+            }
+        }
+
+        fclose(file);
+    }
+
+    return status;
+
+}
+
+/**
+ * @brief Performs init, load and verify operations for one target.
+ * @detail The init phase connects to the service and reads the current configuration
+ * for type discovery. The verify phase reads the configuration back and compares the
+ * instance with that loaded.
+ */
+
+static void ProcessTarget(BulkTarget_t& target) {
+
+    std::string content;
+
+    ccs::types::AnyValue config;
+    ccs::types::AnyValue readback;
+
+    ccs::types::uint64 start = ccs::HelperTools::GetCurrentTime();
+
+    sup::core::ConfigurationLoader loader(target.service);
+
+    // Init
+    target.phase = "init";
+
+    bool status = ReadFile(target.file, content);
+
+    if (status) {
+        ccs::types::uint64 till = start + DEFAULT_CONNECT_TIMEOUT;
+
+        while (!loader.IsConnected() && !_terminate && (ccs::HelperTools::GetCurrentTime() < till)) {
+            ccs::HelperTools::SleepFor(10000000ul);
+        }
+
+        status = loader.IsConnected();
+    }
+
+    if (status) {
+        status = loader.ReadConfiguration(target.alias, config);
+    }
+
+    if (status) {
+        status = (config.GetType() ? config.ParseInstance(content.c_str()) : false);
+    }
+
+    ccs::types::uint64 time = ccs::HelperTools::GetCurrentTime();
+    target.init = time - start;
+    start = time;
+
+    // Load
+    if (status) {
+        target.phase = "load";
+        target.size = config.GetSize();
+        status = loader.LoadConfiguration(target.alias, config);
+
+        time = ccs::HelperTools::GetCurrentTime();
+        target.load = time - start;
+        start = time;
+    }
+
+    // Verify
+    if (status) {
+        target.phase = "verify";
+        status = loader.ReadConfiguration(target.alias, readback);
+
+        if (status) {
+            status = ((readback.GetSize() == config.GetSize())
+                    && (0 == memcmp(readback.GetInstance(), config.GetInstance(), config.GetSize())));
+        }
+
+        time = ccs::HelperTools::GetCurrentTime();
+        target.verify = time - start;
+    }
+
+    if (status) {
+        target.phase = "none";
+    }
+
+    target.status = status;
+
+    return;
+
+}
+
+static void BulkWorker(std::vector<BulkTarget_t>* targets,
+                       volatile ccs::types::uint32* next) {
+
+    ccs::types::uint32 index = __sync_fetch_and_add(next, 1u);
+
+    while (!_terminate && (index < targets->size())) {
+        ProcessTarget((*targets)[index]);
+        index = __sync_fetch_and_add(next, 1u);
+    }
+
+    return;
+
+}
+
+static bool RunBulk(const char* manifest,
+                    ccs::types::uint32 parallelism) {
+
+    std::vector<BulkTarget_t> targets;
+
+    bool status = ParseManifest(manifest, targets);
+
+    if (!status) {
+        log_error("Unable to parse manifest '%s'", manifest);
+    }
+
+    if (status) {
+        volatile ccs::types::uint32 next = 0u;
+
+        if (0u == parallelism) {
+            parallelism = 1u;
+        }
+
+        if (parallelism > targets.size()) {
+            parallelism = static_cast<ccs::types::uint32>(targets.size());
+        }
+
+        log_info("Process '%u' targets with parallelism '%u'", static_cast<ccs::types::uint32>(targets.size()), parallelism);
+
+        ccs::types::uint64 start = ccs::HelperTools::GetCurrentTime();
+
+        std::vector<std::thread> workers;
+
+        for (ccs::types::uint32 index = 0u; index < parallelism; index += 1u) {
+            workers.push_back(std::thread(BulkWorker, &targets, &next));
+        }
+
+        for (ccs::types::uint32 index = 0u; index < workers.size(); index += 1u) {
+            workers[index].join();
+        }
+
+        ccs::types::uint64 duration = ccs::HelperTools::GetCurrentTime() - start;
+
+        // Per-target report
+        ccs::types::uint32 success = 0u;
+        ccs::types::uint64 bytes = 0ul;
+
+        fprintf(stdout, "%-32s %-8s %-8s %10s %10s %10s %10s\n", "Service", "Status", "Failed", "Size [B]", "Init [ms]", "Load [ms]", "Verify [ms]");
+
+        for (ccs::types::uint32 index = 0u; index < targets.size(); index += 1u) {
+            const BulkTarget_t& target = targets[index];
+
+            fprintf(stdout, "%-32s %-8s %-8s %10u %10.3f %10.3f %10.3f\n", target.service.c_str(), (target.status ? "success" : "failure"),
+                    target.phase, target.size, static_cast<double>(target.init) / 1e6, static_cast<double>(target.load) / 1e6,
+                    static_cast<double>(target.verify) / 1e6);
+
+            if (target.status) {
+                success += 1u;
+                bytes += target.size;
+            }
+        }
+
+        // Aggregate summary
+        double seconds = static_cast<double>(duration) / 1e9;
+
+        fprintf(stdout, "\n");
+        fprintf(stdout, "Targets: %u succeeded, %u failed, in %.3f s\n", success, static_cast<ccs::types::uint32>(targets.size()) - success, seconds);
+        fprintf(stdout, "Throughput: %.2f targets/s, %.1f kB/s\n", ((seconds > 0.0) ? static_cast<double>(success) / seconds : 0.0),
+                ((seconds > 0.0) ? static_cast<double>(bytes) / seconds / 1e3 : 0.0));
+
+        status = (success == targets.size());
+    }
+
+    return status;
+
+}
+
 void print_usage(void) {
 
     char prog_name[STRING_MAX_LENGTH] = STRING_UNDEFINED;
@@ -63,6 +330,8 @@ void print_usage(void) {
     fprintf(stdout,
             "         -c|--count <sample_nb>: Stop after <sample_nb> are published, -1 for undefined number of counts (stops with Ctrl-C), defaults to 10000.\n");
     fprintf(stdout, "         -p|--period <period_ns>: Publication period, defaults to 1000000 (1kHz).\n");
+    fprintf(stdout, "         -m|--manifest <file>: Bulk mode, init, load and verify the configuration of each '<service> <file> [<alias>]' line in <file>.\n");
+    fprintf(stdout, "         -j|--jobs <number>: Bulk mode parallelism, defaults to 4.\n");
     fprintf(stdout, "\n");
     fprintf(stdout, "The program instantiates a MCAST publisher streams <payload> bytes packets on <iface_name> with configurable rate, etc.\n");
     fprintf(stdout, "\n");
@@ -93,6 +362,9 @@ int main(int argc,
     char buffer[1000000] = STRING_UNDEFINED;
     char fileName[1024] = STRING_UNDEFINED;
     char alias[32] = STRING_UNDEFINED;
+    char manifest[1024] = STRING_UNDEFINED;
+
+    ccs::types::uint32 parallelism = DEFAULT_PARALLELISM;
 
     if (argc > 1) {
         for (uint_t index = 1; index < (uint_t) argc; index++) {
@@ -148,6 +420,28 @@ int main(int argc,
 
                 index += 1;
 
+            }
+            else if ((strcmp(argv[index], "-j") == 0) || (strcmp(argv[index], "--jobs") == 0)) {
+                if ((index + 1) < (uint_t) argc) {
+                    sscanf(argv[index + 1], "%u", &parallelism);
+                }
+                else {
+                    print_usage();
+                    return (0);
+                } // Display usage
+                index += 1;
+
+            }
+            else if ((strcmp(argv[index], "-m") == 0) || (strcmp(argv[index], "--manifest") == 0)) {
+                if ((index + 1) < (uint_t) argc) {
+                    ccs::HelperTools::SafeStringCopy(manifest, argv[index + 1], 1024u);
+                }
+                else {
+                    print_usage();
+                    return (0);
+                } // Display usage
+                index += 1;
+
             }
             else if ((strcmp(argv[index], "-s") == 0) || (strcmp(argv[index], "--service") == 0)) {
                 if ((index + 1) < (uint_t) argc)
@@ -170,6 +464,12 @@ int main(int argc,
     else {
     }
 
+    if (!ccs::HelperTools::IsUndefinedString(manifest)) {
+        // Bulk mode
+        bool status = RunBulk(manifest, parallelism);
+        return (status ? 0 : 1);
+    }
+
     // Create ConfigurationLoader instance
     log_info("Create RPC client on '%s' service", service);
     sup::core::ConfigurationLoader loader(service);
@@ -425,6 +425,123 @@ TEST(ConfigurationLoader_Test, LoadConfiguration)
   ASSERT_EQ(true, ret);
 }
 
+TEST(ConfigurationLoader_Test, LoadConfiguration_Chunked)
+{
+  sup::core::ConfigurationLoader* loader = new (std::nothrow) sup::core::ConfigurationLoader ("ForLoader@SomePlantSystem");
+
+  bool ret = (static_cast<sup::core::ConfigurationLoader*>(NULL) != loader);
+
+  if (ret)
+    {
+      ccs::HelperTools::SleepFor(500000000ul);
+      ret = loader->IsConnected();
+    }
+
+  ccs::types::AnyValue config;
+
+  if (ret)
+    {
+      ret = loader->ReadConfiguration("config", config);
+    }
+
+  if (ret)
+    {
+      ret = (NULL != config.GetInstance());
+    }
+
+  if (ret)
+    {
+      ret = loader->SetChunkSize(4u); // Transfer in 3 chunks
+    }
+
+  Handler::Config_t data;
+
+  if (ret)
+    {
+      data.enabled = false;
+      data.setpoint = 1.5;
+      config = data;
+      ret = loader->LoadConfiguration("config", config);
+    }
+
+  if (ret)
+    {
+      ret = handler->TestConfiguration(data);
+    }
+
+  if (ret)
+    {
+      ret = !loader->LoadConfiguration("limits", config); // Expect failure .. size mismatch
+    }
+
+  if (ret)
+    {
+      delete loader;
+    }
+
+  ASSERT_EQ(true, ret);
+}
+
+TEST(ConfigurationLoader_Test, SetHashAlgorithm)
+{
+  sup::core::ConfigurationLoader* loader = new (std::nothrow) sup::core::ConfigurationLoader ("ForLoader@SomePlantSystem");
+
+  bool ret = (static_cast<sup::core::ConfigurationLoader*>(NULL) != loader);
+
+  if (ret)
+    {
+      ccs::HelperTools::SleepFor(500000000ul);
+      ret = loader->IsConnected();
+    }
+
+  if (ret)
+    {
+      ret = !loader->SetHashAlgorithm("md5"); // Expect failure .. unsupported
+    }
+
+  ccs::types::AnyValue config;
+
+  if (ret)
+    {
+      ret = (loader->ReadConfiguration("config", config) && (NULL != config.GetInstance()));
+    }
+
+  Handler::Config_t data;
+
+  if (ret)
+    {
+      ret = loader->SetHashAlgorithm(CONFIGURATION_HASH_CRC32C);
+    }
+
+  if (ret)
+    {
+      data.enabled = true;
+      data.setpoint = 2.5;
+      config = data;
+      ret = (loader->LoadConfiguration("config", config) && handler->TestConfiguration(data));
+    }
+
+  if (ret)
+    {
+      ret = (loader->SetHashAlgorithm(CONFIGURATION_HASH_HASH64) && loader->SetChunkSize(4u));
+    }
+
+  if (ret)
+    {
+      data.enabled = false;
+      data.setpoint = 3.5;
+      config = data;
+      ret = (loader->LoadConfiguration("config", config) && handler->TestConfiguration(data));
+    }
+
+  if (ret)
+    {
+      delete loader;
+    }
+
+  ASSERT_EQ(true, ret);
+}
+
 TEST(ConfigurationLoader_Test, RegisterHasher)
 {
   sup::core::ConfigurationLoader* loader = new (std::nothrow) sup::core::ConfigurationLoader ("ForLoader@SomePlantSystem");
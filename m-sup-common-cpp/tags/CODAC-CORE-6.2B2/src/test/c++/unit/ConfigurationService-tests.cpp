@@ -980,4 +980,348 @@ TEST(ConfigurationService_Test, RPCClient_SendRequest_load)
   ASSERT_EQ(true, ret);
 }
 
+TEST(ConfigurationService_Test, RPCClient_SendRequest_mismatch)
+{
+  bool ret = ((static_cast<sup::core::ConfigurationService*>(NULL) != loader) &&
+	      (static_cast<ccs::base::RPCClient*>(NULL) != client));
+
+  if (!ret) // Static initialisation
+    {
+      loader = new (std::nothrow) sup::core::ConfigurationService ();
+      ret = (static_cast<sup::core::ConfigurationService*>(NULL) != loader);
+
+      if (ret)
+	{
+	  ret = (loader->SetService("Service@SomePlantSystem") && loader->RegisterHandler(handler));
+	  ccs::HelperTools::SleepFor(500000000ul);
+	} 
+    }
+
+  if (ret)
+    {
+      ret = (client->IsConnected() && loader->SetParameter("override", "false"));
+    }
+
+  Handler::Config_t config_struct; 
+  config_struct.enabled = true; config_struct.setpoint = 7.0;
+
+  ccs::types::AnyValue config_value;
+
+  if (ret)
+    { // Type of the data set
+      ccs::types::CompoundType request_type (*ccs::base::RPCTypes::Request_int); // Default RPC request type
+      request_type.AddAttribute<ccs::types::string>("alias");
+
+      ccs::types::AnyValue request (request_type);
+      ccs::HelperTools::SetAttributeValue(&request, "qualifier", "read");
+      ccs::HelperTools::SetAttributeValue(&request, "alias", "config");
+
+      ccs::types::AnyValue reply = client->SendRequest(request);
+
+      ret = ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status");
+
+      if (ret)
+	{
+	  config_value = ccs::HelperTools::GetAttributeValue<ccs::types::AnyValue>(&reply, "value");
+	  config_value = config_struct;
+	}
+    }
+
+  // Negotiated algorithm other than CRC-32
+  ccs::types::CompoundType request_type (*ccs::base::RPCTypes::Request_int); // Default RPC request type
+  request_type.AddAttribute<ccs::types::string>("alias");
+  request_type.AddAttribute<ccs::types::uint32>("seed");
+  request_type.AddAttribute("value", config_value.GetType());
+  request_type.AddAttribute<ccs::types::string>("algorithm");
+  request_type.AddAttribute<ccs::types::uint64>("hash");
+
+  ccs::types::uint64 hash = 0ul;
+
+  if (ret)
+    {
+      ret = hasher->ComputeChecksum("config", config_value, 0u, CONFIGURATION_HASH_CRC32C, hash);
+    }
+
+  if (ret) // Wrong checksum rejected
+    {
+      ccs::types::AnyValue request (request_type);
+      ccs::HelperTools::SetAttributeValue(&request, "qualifier", "load");
+      ccs::HelperTools::SetAttributeValue(&request, "alias", "config");
+      ccs::HelperTools::SetAttributeValue(&request, "seed", 0u);
+      ccs::HelperTools::SetAttributeValue(&request, "value", config_value);
+      ccs::HelperTools::SetAttributeValue(&request, "algorithm", CONFIGURATION_HASH_CRC32C);
+      ccs::HelperTools::SetAttributeValue<ccs::types::uint64>(&request, "hash", hash + 1ul);
+
+      ccs::types::AnyValue reply = client->SendRequest(request);
+
+      ret = (!ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status") && // Expect failure
+	     !handler->TestConfiguration(config_struct));
+    }
+
+  if (ret) // Handler provided with the CRC-32 of the data set
+    {
+      ccs::types::AnyValue request (request_type);
+      ccs::HelperTools::SetAttributeValue(&request, "qualifier", "load");
+      ccs::HelperTools::SetAttributeValue(&request, "alias", "config");
+      ccs::HelperTools::SetAttributeValue(&request, "seed", 0u);
+      ccs::HelperTools::SetAttributeValue(&request, "value", config_value);
+      ccs::HelperTools::SetAttributeValue(&request, "algorithm", CONFIGURATION_HASH_CRC32C);
+      ccs::HelperTools::SetAttributeValue<ccs::types::uint64>(&request, "hash", hash);
+
+      ccs::types::AnyValue reply = client->SendRequest(request);
+
+      ret = (ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status") &&
+	     handler->TestConfiguration(config_struct));
+    }
+
+  if (ret) // Wrong checksum overridden
+    {
+      config_struct.setpoint = 8.0;
+      config_value = config_struct;
+
+      ret = loader->SetParameter("override", "true");
+
+      ccs::types::AnyValue request (request_type);
+      ccs::HelperTools::SetAttributeValue(&request, "qualifier", "load");
+      ccs::HelperTools::SetAttributeValue(&request, "alias", "config");
+      ccs::HelperTools::SetAttributeValue(&request, "seed", 0u);
+      ccs::HelperTools::SetAttributeValue(&request, "value", config_value);
+      ccs::HelperTools::SetAttributeValue(&request, "algorithm", CONFIGURATION_HASH_CRC32C);
+      ccs::HelperTools::SetAttributeValue<ccs::types::uint64>(&request, "hash", hash);
+
+      if (ret)
+	{
+	  ccs::types::AnyValue reply = client->SendRequest(request);
+
+	  ret = (ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status") &&
+		 handler->TestConfiguration(config_struct));
+	}
+    }
+
+  ASSERT_EQ(true, ret);
+}
+
+TEST(ConfigurationService_Test, RPCClient_SendRequest_version)
+{
+  bool ret = ((static_cast<sup::core::ConfigurationService*>(NULL) != loader) &&
+	      (static_cast<ccs::base::RPCClient*>(NULL) != client));
+
+  if (!ret) // Static initialisation
+    {
+      loader = new (std::nothrow) sup::core::ConfigurationService ();
+      ret = (static_cast<sup::core::ConfigurationService*>(NULL) != loader);
+
+      if (ret)
+	{
+	  ret = (loader->SetService("Service@SomePlantSystem") && loader->RegisterHandler(handler));
+	  ccs::HelperTools::SleepFor(500000000ul);
+	} 
+    }
+
+  if (ret)
+    {
+      ret = client->IsConnected();
+    }
+
+  // Copy the base request type ..
+  ccs::types::CompoundType request_type (*ccs::base::RPCTypes::Request_int); // Default RPC request type
+  // .. and add the missing bit
+  request_type.AddAttribute<ccs::types::string>("alias");
+
+  ccs::types::AnyValue config_value;
+  ccs::types::uint64 version = 0ul;
+
+  if (ret)
+    {
+      ccs::types::AnyValue request (request_type);
+      ccs::HelperTools::SetAttributeValue(&request, "qualifier", "read");
+      ccs::HelperTools::SetAttributeValue(&request, "alias", "config");
+
+      ccs::types::AnyValue reply = client->SendRequest(request);
+
+      ret = (ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status") &&
+	     ccs::HelperTools::GetAttributeValue<ccs::types::uint64>(&reply, "version", version));
+
+      if (ret)
+	{
+	  config_value = ccs::HelperTools::GetAttributeValue<ccs::types::AnyValue>(&reply, "value");
+	}
+    }
+
+  Handler::Config_t config_struct; 
+  
+  if (ret)
+    {
+      config_struct.enabled = false; config_struct.setpoint = 2.5;
+      config_value = config_struct;
+    }
+
+  // .. and add the missing bit
+  request_type.AddAttribute<ccs::types::uint32>("seed");
+  request_type.AddAttribute("value", config_value.GetType());
+  request_type.AddAttribute<ccs::types::uint32>("hash");
+
+  if (ret)
+    {
+      ccs::types::AnyValue request (request_type);
+      ccs::HelperTools::SetAttributeValue(&request, "qualifier", "load");
+      ccs::HelperTools::SetAttributeValue(&request, "alias", "config");
+      ccs::HelperTools::SetAttributeValue(&request, "seed", 0u);
+      ccs::HelperTools::SetAttributeValue(&request, "value", config_value);
+      ccs::HelperTools::SetAttributeValue(&request, "hash", ccs::HelperTools::CyclicRedundancyCheck<ccs::types::uint32>(reinterpret_cast<ccs::types::uint8*>(config_value.GetInstance()), config_value.GetType()->GetSize()));
+
+      ccs::types::AnyValue reply = client->SendRequest(request);
+
+      ret = (ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status") &&
+	     ((version + 1ul) == ccs::HelperTools::GetAttributeValue<ccs::types::uint64>(&reply, "version")));
+    }
+
+  if (ret) // Confirmed snapshot
+    {
+      ccs::types::AnyValue request (request_type);
+      ccs::HelperTools::SetAttributeValue(&request, "qualifier", "read");
+      ccs::HelperTools::SetAttributeValue(&request, "alias", "config");
+
+      ccs::types::AnyValue reply = client->SendRequest(request);
+
+      ret = (ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status") &&
+	     ((version + 1ul) == ccs::HelperTools::GetAttributeValue<ccs::types::uint64>(&reply, "version")));
+
+      if (ret)
+	{
+	  Handler::Config_t value = static_cast<Handler::Config_t>(ccs::HelperTools::GetAttributeValue<ccs::types::AnyValue>(&reply, "value"));
+	  ret = handler->TestConfiguration(value);
+	}
+    }
+
+  ASSERT_EQ(true, ret);
+}
+
+TEST(ConfigurationService_Test, RPCClient_SendRequest_refresh)
+{
+  bool ret = ((static_cast<sup::core::ConfigurationService*>(NULL) != loader) &&
+	      (static_cast<ccs::base::RPCClient*>(NULL) != client));
+
+  if (!ret) // Static initialisation
+    {
+      loader = new (std::nothrow) sup::core::ConfigurationService ();
+      ret = (static_cast<sup::core::ConfigurationService*>(NULL) != loader);
+
+      if (ret)
+	{
+	  ret = (loader->SetService("Service@SomePlantSystem") && loader->RegisterHandler(handler));
+	  ccs::HelperTools::SleepFor(500000000ul);
+	} 
+    }
+
+  if (ret)
+    {
+      ret = client->IsConnected();
+    }
+
+  // Copy the base request type ..
+  ccs::types::CompoundType request_type (*ccs::base::RPCTypes::Request_int); // Default RPC request type
+  // .. and add the missing bit
+  request_type.AddAttribute<ccs::types::string>("alias");
+
+  ccs::types::AnyValue request (request_type);
+  ccs::HelperTools::SetAttributeValue(&request, "qualifier", "read");
+  ccs::HelperTools::SetAttributeValue(&request, "alias", "config");
+
+  ccs::types::uint64 version = 0ul;
+
+  if (ret)
+    {
+      ccs::types::AnyValue reply = client->SendRequest(request);
+
+      ret = (ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status") &&
+	     ccs::HelperTools::GetAttributeValue<ccs::types::uint64>(&reply, "version", version));
+    }
+
+  Handler::Config_t config_struct; 
+  
+  if (ret) // Changed on the handler side, i.e. not through the service
+    {
+      config_struct.enabled = true; config_struct.setpoint = -1.5;
+      handler->__config_data = config_struct;
+      ccs::HelperTools::SleepFor(1500000000ul); // Snapshot lifetime
+    }
+
+  if (ret)
+    {
+      ccs::types::AnyValue reply = client->SendRequest(request);
+
+      ret = (ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status") &&
+	     ((version + 1ul) == ccs::HelperTools::GetAttributeValue<ccs::types::uint64>(&reply, "version")));
+
+      if (ret)
+	{
+	  Handler::Config_t value = static_cast<Handler::Config_t>(ccs::HelperTools::GetAttributeValue<ccs::types::AnyValue>(&reply, "value"));
+	  ret = ((value.enabled == config_struct.enabled) && (value.setpoint == config_struct.setpoint));
+	}
+    }
+
+  ASSERT_EQ(true, ret);
+}
+
+TEST(ConfigurationService_Test, RPCClient_SendRequest_stage_conflict)
+{
+  bool ret = ((static_cast<sup::core::ConfigurationService*>(NULL) != loader) &&
+	      (static_cast<ccs::base::RPCClient*>(NULL) != client));
+
+  if (!ret) // Static initialisation
+    {
+      loader = new (std::nothrow) sup::core::ConfigurationService ();
+      ret = (static_cast<sup::core::ConfigurationService*>(NULL) != loader);
+
+      if (ret)
+	{
+	  ret = (loader->SetService("Service@SomePlantSystem") && loader->RegisterHandler(handler));
+	  ccs::HelperTools::SleepFor(500000000ul);
+	} 
+    }
+
+  if (ret)
+    {
+      ret = client->IsConnected();
+    }
+
+  // Copy the base request type ..
+  ccs::types::CompoundType request_type (*ccs::base::RPCTypes::Request_int); // Default RPC request type
+  // .. and add the missing bit
+  request_type.AddAttribute<ccs::types::string>("alias");
+  request_type.AddAttribute<ccs::types::uint32>("seed");
+  request_type.AddAttribute<ccs::types::uint32>("size");
+
+  ccs::types::AnyValue request (request_type);
+  ccs::HelperTools::SetAttributeValue(&request, "qualifier", "stage");
+  ccs::HelperTools::SetAttributeValue(&request, "alias", "limits");
+  ccs::HelperTools::SetAttributeValue<ccs::types::uint32>(&request, "size", sizeof(Handler::Limits_t));
+
+  if (ret)
+    {
+      ccs::HelperTools::SetAttributeValue<ccs::types::uint32>(&request, "seed", 1u);
+      ccs::types::AnyValue reply = client->SendRequest(request);
+      ret = ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status");
+    }
+
+  if (ret) // Another transfer in progress
+    {
+      ccs::HelperTools::SetAttributeValue<ccs::types::uint32>(&request, "seed", 2u);
+      ccs::types::AnyValue reply = client->SendRequest(request);
+      ret = (!ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status") &&
+	     (std::string("Transfer in progress") == static_cast<char*>(ccs::HelperTools::GetAttributeReference(&reply, "reason"))));
+    }
+
+  if (ret) // Resume
+    {
+      ccs::HelperTools::SetAttributeValue<ccs::types::uint32>(&request, "seed", 1u);
+      ccs::types::AnyValue reply = client->SendRequest(request);
+      ret = (ccs::HelperTools::GetAttributeValue<ccs::types::boolean>(&reply, "status") &&
+	     (0u == ccs::HelperTools::GetAttributeValue<ccs::types::uint32>(&reply, "value")));
+    }
+
+  ASSERT_EQ(true, ret);
+}
+
 } // namespace csrv